@@ -2,6 +2,7 @@
 #define LIME_APP_APPLICATION_H
 
 
+#include <app/FramePacer.h>
 #include <system/CFFI.h>
 
 
@@ -18,9 +19,13 @@ namespace lime {
 			static AutoGCRoot* callback;
 
 			virtual int Exec () = 0;
+			virtual void GetFrameStats (FrameStats* stats) = 0;
 			virtual void Init () = 0;
 			virtual int Quit () = 0;
+			virtual void SetFixedTimeStep (double step) = 0;
+			virtual void SetFramePacing (int policy) = 0;
 			virtual void SetFrameRate (double frameRate) = 0;
+			virtual void SetPreciseInput (bool value) = 0;
 			virtual bool Update () = 0;
 
 
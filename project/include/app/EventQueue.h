@@ -0,0 +1,104 @@
+#ifndef LIME_APP_EVENT_QUEUE_H
+#define LIME_APP_EVENT_QUEUE_H
+
+
+#include <system/CFFI.h>
+#include <system/ValuePointer.h>
+#include <ui/KeyEvent.h>
+#include <ui/MouseEvent.h>
+#include <ui/TouchEvent.h>
+#include <stdint.h>
+
+
+namespace lime {
+
+
+	// Records are written back to back after a 4 byte record count. Every
+	// record starts with its EventRecordType and has a fixed size, so the
+	// Haxe side can walk the buffer without allocating. Keep this layout in
+	// sync with NativeApplication.handleEventQueue.
+
+	enum EventRecordType {
+
+		EVENT_RECORD_KEY,
+		EVENT_RECORD_MOUSE,
+		EVENT_RECORD_TOUCH
+
+	};
+
+
+	struct KeyEventRecord {
+
+		uint8_t recordType;
+		uint8_t type;
+		uint16_t reserved;
+		int32_t windowID;
+		int32_t modifier;
+		int32_t reserved2;
+		double keyCode;
+		double timestamp;
+
+	};
+
+
+	struct MouseEventRecord {
+
+		uint8_t recordType;
+		uint8_t type;
+		uint16_t reserved;
+		int32_t windowID;
+		int32_t button;
+		int32_t clickCount;
+		double x;
+		double y;
+		double movementX;
+		double movementY;
+		double timestamp;
+
+	};
+
+
+	struct TouchEventRecord {
+
+		uint8_t recordType;
+		uint8_t type;
+		uint16_t reserved;
+		int32_t id;
+		int32_t device;
+		int32_t reserved2;
+		double x;
+		double y;
+		double dx;
+		double dy;
+		double pressure;
+		double timestamp;
+
+	};
+
+
+	class EventQueue {
+
+
+		public:
+
+			static void Flush ();
+			static bool Push (KeyEvent* event);
+			static bool Push (MouseEvent* event);
+			static bool Push (TouchEvent* event);
+			static void Register (ValuePointer* callback, ValuePointer* buffer, int length);
+
+		private:
+
+			static void* Reserve (int size);
+
+			static ValuePointer* buffer;
+			static ValuePointer* callback;
+
+
+	};
+
+
+}
+
+
+#endif
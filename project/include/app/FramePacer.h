@@ -0,0 +1,81 @@
+#ifndef LIME_APP_FRAME_PACER_H
+#define LIME_APP_FRAME_PACER_H
+
+
+#include <stdint.h>
+
+
+namespace lime {
+
+
+	enum FramePacing {
+
+		FRAME_PACING_PRECISE,
+		FRAME_PACING_ADAPTIVE,
+		FRAME_PACING_POWER_SAVING
+
+	};
+
+
+	struct FrameStats {
+
+		double frames;
+		int missed;
+		double frameTimeP50;
+		double frameTimeP99;
+		double jitterP50;
+		double jitterP99;
+		double spinMargin;
+
+	};
+
+
+	class FramePacer {
+
+
+		public:
+
+			FramePacer ();
+			~FramePacer ();
+
+			void GetStats (FrameStats* stats) const;
+			int GetPolicy () const { return policy; }
+			void Reset ();
+			void SetFrameRate (double frameRate);
+			void SetIdleCallback (void (*callback) (void*), void* userData);
+			void SetPolicy (int policy);
+			void SetVsyncLimited (bool value) { vsyncLimited = value; }
+			void Wait ();
+
+			static uint64_t Now ();
+
+		private:
+
+			void Idle (uint64_t time);
+			void Record (uint64_t time);
+			void SleepUntil (uint64_t time);
+
+			static const int HISTORY_SIZE = 240;
+
+			uint64_t deadline;
+			uint64_t frames;
+			uint64_t history[HISTORY_SIZE];
+			int historyCount;
+			int historyIndex;
+			void (*idleCallback) (void*);
+			void* idleUserData;
+			uint64_t lastFrame;
+			uint64_t period;
+			int policy;
+			uint64_t spinMargin;
+			void* timer;
+			bool vsyncLimited;
+
+
+	};
+
+
+}
+
+
+#endif
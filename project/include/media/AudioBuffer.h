@@ -43,6 +43,7 @@ namespace lime {
 		vdynamic* __srcHowl;
 		vdynamic* __srcSound;
 		vdynamic* __srcVorbisFile;
+		vdynamic* __srcWAVStream;
 
 		AudioBuffer (value audioBuffer);
 		~AudioBuffer ();
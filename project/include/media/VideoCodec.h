@@ -0,0 +1,19 @@
+#ifndef LIME_MEDIA_VIDEO_CODEC_H
+#define LIME_MEDIA_VIDEO_CODEC_H
+
+
+namespace lime {
+
+
+	enum VideoCodec {
+
+		VIDEO_CODEC_VP8,
+		VIDEO_CODEC_VP9
+
+	};
+
+
+}
+
+
+#endif
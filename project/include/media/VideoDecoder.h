@@ -0,0 +1,104 @@
+#ifndef LIME_MEDIA_VIDEO_DECODER_H
+#define LIME_MEDIA_VIDEO_DECODER_H
+
+
+#include <media/VideoCodec.h>
+#include <mkvparser/mkvparser.h>
+#include <mkvparser/mkvreader.h>
+#include <vpx/vpx_decoder.h>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+
+namespace lime {
+
+
+	enum VideoFrameStatus {
+
+		VIDEO_FRAME_ENDED = -2,
+		VIDEO_FRAME_PENDING = -1
+
+	};
+
+
+	enum VideoFrameFormat {
+
+		VIDEO_FRAME_RGBA,
+		VIDEO_FRAME_I420
+
+	};
+
+
+	// Plays the first video track of a WebM file. A worker thread demuxes
+	// and decodes ahead of the playback clock into a small ring of frames,
+	// converted to RGBA or kept as packed I420 planes for shader conversion.
+	// Read hands out the newest frame that is due at the given time, frames
+	// that are already late when they come out of the decoder are decoded
+	// but not converted.
+
+	class VideoDecoder {
+
+
+		public:
+
+			VideoDecoder (int format, int threads, int ringSize);
+			~VideoDecoder ();
+
+			void Close ();
+			int GetFrameSize ();
+			bool Open (const char* path);
+			double Read (double time, unsigned char* dest, int length);
+			void Seek (double time);
+
+			int codec;
+			double duration;
+			double frameRate;
+			int height;
+			int width;
+
+			static void ConvertI420ToRGBA (const unsigned char* y, int yStride, const unsigned char* u, int uStride, const unsigned char* v, int vStride, int width, int height, unsigned char* rgba, int stride);
+
+		private:
+
+			struct Slot {
+
+				int generation;
+				std::vector<unsigned char> pixels;
+				int state;
+				double time;
+
+			};
+
+			Slot* Acquire (int generation);
+			void Decode ();
+			bool Output (vpx_image_t* image, double time, int generation);
+
+			std::condition_variable changed;
+			double clockTime;
+			vpx_codec_ctx_t decoder;
+			bool ended;
+			int format;
+			int generation;
+			std::mutex mutex;
+			bool opened;
+			mkvparser::MkvReader* reader;
+			bool seekRequested;
+			double seekTime;
+			mkvparser::Segment* segment;
+			std::vector<Slot> slots;
+			bool stopping;
+			int threads;
+			const mkvparser::VideoTrack* track;
+			std::thread worker;
+
+
+	};
+
+
+}
+
+
+#endif
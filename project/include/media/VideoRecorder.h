@@ -0,0 +1,92 @@
+#ifndef LIME_MEDIA_VIDEO_RECORDER_H
+#define LIME_MEDIA_VIDEO_RECORDER_H
+
+
+#include <graphics/ImageBuffer.h>
+#include <media/VideoCodec.h>
+#include <mkvmuxer/mkvmuxer.h>
+#include <mkvmuxer/mkvwriter.h>
+#include <vpx/vpx_encoder.h>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+
+namespace lime {
+
+
+	// Encodes RGBA frames into a WebM file. AddFrame only copies the pixels
+	// into one of a fixed number of slots, a pool of worker threads converts
+	// them to I420 and a single encoder thread feeds libvpx and the muxer in
+	// submission order. When every slot is busy the frame is dropped rather
+	// than stalling the caller.
+
+	class VideoRecorder {
+
+
+		public:
+
+			VideoRecorder (int width, int height, double frameRate, int codec, int bitrate, int threads, int queueSize);
+			~VideoRecorder ();
+
+			bool AddFrame (ImageBuffer* buffer, double time);
+			bool Close ();
+			int GetDroppedFrames ();
+			int GetEncodedFrames ();
+			bool Open (const char* path);
+
+			static void ConvertRGBAToI420 (const unsigned char* rgba, int stride, int width, int height, unsigned char* y, int yStride, unsigned char* u, int uStride, unsigned char* v, int vStride);
+
+		private:
+
+			struct Slot {
+
+				vpx_image_t image;
+				std::vector<unsigned char> pixels;
+				int64_t sequence;
+				int state;
+				int64_t time;
+
+			};
+
+			void Convert ();
+			void Encode ();
+			bool WritePackets ();
+
+			int bitrate;
+			bool closing;
+			int codec;
+			std::condition_variable converted;
+			std::vector<std::thread> converters;
+			int droppedFrames;
+			int encodedFrames;
+			vpx_codec_ctx_t encoder;
+			std::thread encoderThread;
+			bool failed;
+			double frameRate;
+			int height;
+			int64_t lastTime;
+			std::mutex mutex;
+			int64_t nextEncode;
+			int64_t nextSequence;
+			bool opened;
+			std::condition_variable queued;
+			std::condition_variable released;
+			mkvmuxer::Segment* segment;
+			std::vector<Slot> slots;
+			bool stopping;
+			int threads;
+			uint64_t track;
+			int width;
+			mkvmuxer::MkvWriter* writer;
+
+
+	};
+
+
+}
+
+
+#endif
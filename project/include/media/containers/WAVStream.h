@@ -0,0 +1,52 @@
+#ifndef LIME_MEDIA_CONTAINERS_WAV_STREAM_H
+#define LIME_MEDIA_CONTAINERS_WAV_STREAM_H
+
+
+#include <system/System.h>
+
+
+namespace lime {
+
+
+	class WAVStream {
+
+
+		public:
+
+			static WAVStream* FromFile (const char* path);
+
+			~WAVStream ();
+
+			int Read (unsigned char* dest, int length);
+			bool Seek (int64_t frame);
+			int64_t Tell ();
+
+			int bitsPerSample;
+			int channels;
+			int64_t length;
+			int sampleRate;
+
+
+		private:
+
+			WAVStream (FILE_HANDLE* file);
+
+			bool ReadHeader ();
+
+			int blockAlign;
+			long dataOffset;
+			FILE_HANDLE* file;
+			int frameSize;
+			int64_t position;
+			int sourceBits;
+			bool sourceFloat;
+			unsigned char* window;
+
+
+	};
+
+
+}
+
+
+#endif
@@ -0,0 +1,255 @@
+#ifndef LIME_MEDIA_OPENAL_MIXER_GRAPH_H
+#define LIME_MEDIA_OPENAL_MIXER_GRAPH_H
+
+
+#include "AL/al.h"
+#include "AL/alc.h"
+#include <system/Mutex.h>
+#include <map>
+#include <vector>
+
+
+// MojoAL does not ship efx.h, these match the values used by OpenAL Soft
+
+#ifndef AL_EFFECT_TYPE
+#define AL_DIRECT_FILTER 0x20005
+#define AL_AUXILIARY_SEND_FILTER 0x20006
+#define AL_REVERB_DENSITY 0x0001
+#define AL_REVERB_DIFFUSION 0x0002
+#define AL_REVERB_GAIN 0x0003
+#define AL_REVERB_GAINHF 0x0004
+#define AL_REVERB_DECAY_TIME 0x0005
+#define AL_REVERB_DECAY_HFRATIO 0x0006
+#define AL_COMPRESSOR_ONOFF 0x0001
+#define AL_EFFECT_TYPE 0x8001
+#define AL_EFFECT_NULL 0x0000
+#define AL_EFFECT_REVERB 0x0001
+#define AL_EFFECT_COMPRESSOR 0x000B
+#define AL_EFFECTSLOT_EFFECT 0x0001
+#define AL_EFFECTSLOT_GAIN 0x0002
+#define AL_EFFECTSLOT_AUXILIARY_SEND_AUTO 0x0003
+#define AL_EFFECTSLOT_NULL 0x0000
+#define AL_LOWPASS_GAIN 0x0001
+#define AL_LOWPASS_GAINHF 0x0002
+#define AL_FILTER_TYPE 0x8001
+#define AL_FILTER_NULL 0x0000
+#define AL_FILTER_LOWPASS 0x0001
+#endif
+
+
+namespace lime {
+
+
+	struct MixerEffect {
+
+		MixerEffect ();
+
+		int type;
+		bool compressorOn;
+		float decayHFRatio;
+		float decayTime;
+		float density;
+		float diffusion;
+		float gain;
+		float gainHF;
+
+	};
+
+
+	struct MixerFilter {
+
+		MixerFilter ();
+
+		int type;
+		float gain;
+		float gainHF;
+
+	};
+
+
+	class MixerNode {
+
+
+		public:
+
+			virtual ~MixerNode () {}
+
+			virtual void Process (float* data, int frames, int channels, int sampleRate) = 0;
+
+			static MixerNode* Create (const MixerEffect& effect);
+
+
+	};
+
+
+	class CompressorNode : public MixerNode {
+
+
+		public:
+
+			CompressorNode ();
+
+			virtual void Process (float* data, int frames, int channels, int sampleRate);
+
+
+		private:
+
+			float envelope;
+
+
+	};
+
+
+	class LowPassNode : public MixerNode {
+
+
+		public:
+
+			LowPassNode (const MixerFilter& filter);
+
+			virtual void Process (float* data, int frames, int channels, int sampleRate);
+
+
+		private:
+
+			float gain;
+			float gainHF;
+			float history[8];
+
+
+	};
+
+
+	class ReverbNode : public MixerNode {
+
+
+		public:
+
+			ReverbNode (const MixerEffect& effect);
+
+			virtual void Process (float* data, int frames, int channels, int sampleRate);
+
+
+		private:
+
+			void Configure (int sampleRate);
+
+			struct Delay {
+
+				std::vector<float> buffer;
+				float feedback;
+				float history;
+				int position;
+
+			};
+
+			float damping;
+			MixerEffect effect;
+			Delay allpasses[2][2];
+			Delay combs[2][4];
+			int sampleRate;
+
+
+	};
+
+
+	struct MixerBus {
+
+		MixerBus ();
+		~MixerBus ();
+
+		float gain;
+		std::vector<float> input;
+		MixerNode* node;
+
+	};
+
+
+	struct MixerSend {
+
+		LowPassNode* filter;
+		int index;
+		ALuint slot;
+
+	};
+
+
+	struct MixerSource {
+
+		MixerSource ();
+
+		LowPassNode* filter;
+		std::vector<MixerSend> sends;
+
+	};
+
+
+	class MixerGraph {
+
+
+		public:
+
+			static MixerGraph* GetInstance ();
+
+			void Install ();
+			void RemoveSource (ALuint source);
+			void SetBusEffect (MixerBus* bus, const MixerEffect* effect);
+			void SetSourceFilter (ALuint source, const MixerFilter* filter);
+			void SetSourceSend (ALuint source, int index, ALuint slot, const MixerFilter* filter);
+
+			std::map<ALuint, MixerBus*> buses;
+			std::map<ALuint, MixerEffect> effects;
+			std::map<ALuint, MixerFilter> filters;
+			Mutex mutex;
+			ALuint nextName;
+
+
+		private:
+
+			MixerGraph ();
+
+			static void AL_APIENTRY ProcessMix (ALvoid* userdata, ALfloat* stream, ALsizei frames, ALsizei channels, ALsizei frequency);
+			static void AL_APIENTRY ProcessSource (ALvoid* userdata, ALuint source, ALfloat* data, ALsizei frames, ALsizei channels, ALsizei frequency, ALsizei offset);
+			bool PruneSource (std::map<ALuint, MixerSource>::iterator it);
+
+			ALCcontext* context;
+			std::vector<float> sendScratch;
+			std::map<ALuint, MixerSource> sources;
+
+
+	};
+
+
+	// MojoAL has no EFX support of its own, so OpenALBindings uses these
+	// instead, backed by the mixing graph. Sources are mixed into effect
+	// slots through their auxiliary sends, scaled by the send filter, and
+	// the output of each slot is added to the mix. Direct filters run on
+	// the source after it is panned. Effect and filter parameters are copied
+	// when they are attached, as they are with EFX. alDeleteSources wraps
+	// the MojoAL function so the graph forgets the sources it deletes.
+
+	void alAuxiliaryEffectSlotf (ALuint slot, ALenum param, ALfloat value);
+	void alAuxiliaryEffectSloti (ALuint slot, ALenum param, ALint value);
+	void alDeleteAuxiliaryEffectSlots (ALsizei n, const ALuint* slots);
+	void alDeleteEffects (ALsizei n, const ALuint* effects);
+	void alDeleteFilters (ALsizei n, const ALuint* filters);
+	void alDeleteSources (ALsizei n, const ALuint* sources);
+	void alEffectf (ALuint effect, ALenum param, ALfloat value);
+	void alEffecti (ALuint effect, ALenum param, ALint value);
+	void alFilterf (ALuint filter, ALenum param, ALfloat value);
+	void alFilteri (ALuint filter, ALenum param, ALint value);
+	void alGenAuxiliaryEffectSlots (ALsizei n, ALuint* slots);
+	void alGenEffects (ALsizei n, ALuint* effects);
+	void alGenFilters (ALsizei n, ALuint* filters);
+	void alGetFilteri (ALuint filter, ALenum param, ALint* value);
+	ALboolean alIsAuxiliaryEffectSlot (ALuint slot);
+	ALboolean alIsEffect (ALuint effect);
+	ALboolean alIsFilter (ALuint filter);
+	void alSourceAuxiliarySend (ALuint source, ALuint slot, ALint index, ALuint filter);
+	void alSourceDirectFilter (ALuint source, ALuint filter);
+
+
+}
+
+
+#endif
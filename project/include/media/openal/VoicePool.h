@@ -0,0 +1,92 @@
+#ifndef LIME_MEDIA_OPENAL_VOICE_POOL_H
+#define LIME_MEDIA_OPENAL_VOICE_POOL_H
+
+
+#include <vector>
+
+
+namespace lime {
+
+
+	enum VoiceParam {
+
+		VOICE_PRIORITY = 0x10000,
+		VOICE_VIRTUAL = 0x10001
+
+	};
+
+
+	struct Voice {
+
+		int generation;
+		bool active;
+		bool playing;
+		bool looping;
+		bool relative;
+
+		unsigned int buffer;
+		float duration;
+		float offset;
+
+		float priority;
+		float gain;
+		float pitch;
+		float referenceDistance;
+		float rolloffFactor;
+		float maxDistance;
+		float position[3];
+		float velocity[3];
+
+		float score;
+		int source;
+
+	};
+
+
+	class VoicePool {
+
+
+		public:
+
+			VoicePool (int maxSources);
+			~VoicePool ();
+
+			void Abandon ();
+			void DeleteSources ();
+			int GetActiveCount ();
+			void* GetContext () const { return context; }
+			int GetRealCount ();
+			int GetSourceCount ();
+			bool IsPlaying (int handle);
+			bool IsVirtual (int handle);
+			int Play (unsigned int buffer, float priority);
+			void Set3f (int handle, int param, float x, float y, float z);
+			void Setf (int handle, int param, float value);
+			void Seti (int handle, int param, int value);
+			void Stop (int handle);
+			void Update (float deltaTime);
+
+
+		private:
+
+			void ApplySource (Voice* voice);
+			Voice* GetVoice (int handle);
+			void Realize (Voice* voice);
+			void Release (Voice* voice);
+			void Virtualize (Voice* voice);
+
+			void* context;
+			std::vector<unsigned int> sources;
+			std::vector<int> freeSources;
+			std::vector<Voice> voices;
+			std::vector<int> freeVoices;
+			std::vector<int> ranked;
+
+
+	};
+
+
+}
+
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef LIME_NET_CURL_CURL_SHARE_H
+#define LIME_NET_CURL_CURL_SHARE_H
+
+
+#include <curl/curl.h>
+#include <system/Mutex.h>
+#include <atomic>
+
+
+namespace lime {
+
+
+	// A reference counted curl_share object, locked with one Mutex per data
+	// type so handles on different threads may use it at once. Every easy
+	// handle attached to a share holds a reference, so the share is only
+	// cleaned up once no transfer can still be using it.
+	//
+	// The default share holds the DNS and TLS session caches and is used by
+	// every HTTPClient, so requests to a host that has been seen before skip
+	// both the lookup and the full handshake. Connections are pooled by each
+	// client's multi handle, since libcurl does not support using a shared
+	// connection cache from concurrent threads.
+
+	class CURLShare {
+
+
+		public:
+
+			CURLShare ();
+
+			static CURLShare* GetDefault ();
+
+			CURLSH* GetHandle () const { return share; }
+			void Release ();
+			void Retain ();
+			CURLSHcode Share (int data);
+			CURLSHcode Unshare (int data);
+
+		private:
+
+			~CURLShare ();
+
+			static void LockCallback (CURL* curl, curl_lock_data data, curl_lock_access access, void* userp);
+			static void UnlockCallback (CURL* curl, curl_lock_data data, void* userp);
+
+			Mutex mutexes[CURL_LOCK_DATA_LAST];
+			std::atomic<int> references;
+			CURLSH* share;
+
+
+	};
+
+
+}
+
+
+#endif
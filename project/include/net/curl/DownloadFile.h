@@ -0,0 +1,50 @@
+#ifndef LIME_NET_CURL_DOWNLOAD_FILE_H
+#define LIME_NET_CURL_DOWNLOAD_FILE_H
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace lime {
+
+
+	// A file opened for downloads, written at explicit 64-bit offsets so
+	// several transfers may fill different ranges of the same file.
+	// Preallocation reserves space without changing the reported size, so
+	// a partially written file can still be resumed from its length.
+
+	class DownloadFile {
+
+
+		public:
+
+			static DownloadFile* Open (const char* path, bool resume);
+
+			~DownloadFile ();
+
+			int64_t GetSize () const { return size; }
+			bool Preallocate (int64_t length);
+			size_t Read (void* data, size_t length, int64_t offset);
+			bool Truncate (int64_t length);
+			bool Write (const void* data, size_t length, int64_t offset);
+
+		private:
+
+			DownloadFile ();
+
+			#ifdef HX_WINDOWS
+			void* handle;
+			#else
+			int fd;
+			#endif
+			int64_t size;
+
+
+	};
+
+
+}
+
+
+#endif
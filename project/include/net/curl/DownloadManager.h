@@ -0,0 +1,119 @@
+#ifndef LIME_NET_CURL_DOWNLOAD_MANAGER_H
+#define LIME_NET_CURL_DOWNLOAD_MANAGER_H
+
+
+#include <curl/curl.h>
+#include <net/curl/CURLShare.h>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace lime {
+
+
+	enum DownloadHash {
+
+		DOWNLOAD_HASH_NONE,
+		DOWNLOAD_HASH_CRC32,
+		DOWNLOAD_HASH_SHA256
+
+	};
+
+
+	enum DownloadMessageType {
+
+		DOWNLOAD_COMPLETE,
+		DOWNLOAD_PROGRESS
+
+	};
+
+
+	struct DownloadMessage {
+
+		double bytesLoaded;
+		double bytesTotal;
+		std::string digest;
+		int id;
+		int result;
+		int status;
+		int type;
+
+	};
+
+
+	// Downloads large files to disk over several connections at once. A
+	// HEAD request finds the length and whether the server accepts ranges,
+	// then the body is split into byte ranges that are fetched in parallel
+	// and written at their offsets into a preallocated file. Servers without
+	// range support fall back to a single stream.
+	//
+	// Failed segments are retried from the last byte written, with an
+	// exponential backoff, so a dropped connection never discards data.
+	// The optional digest is computed in file order as data lands, reading
+	// back ranges that arrived ahead of it, so the result is available as
+	// soon as the last segment completes.
+	//
+	// Like HTTPClient, transfers run on a thread of their own and only
+	// completion and throttled progress are queued for the main thread.
+
+	class DownloadManager {
+
+
+		public:
+
+			DownloadManager (int maxConnections);
+			~DownloadManager ();
+
+			void Cancel (int id);
+			DownloadMessage* GetCurrent () const { return current; }
+			DownloadMessage* Read ();
+			int Start (const char* url, const char* path, int segments, int minSegmentSize, int hash, int maxRetries, double retryDelay, double progressInterval);
+
+		private:
+
+			struct Download;
+			struct Segment;
+
+			void AdvanceHash (Download* download);
+			void Begin (Download* download);
+			void Complete (Segment* segment, CURLcode result);
+			void Destroy (Download* download);
+			void Fail (Download* download, int result, int status);
+			void Finish (Download* download);
+			void Post (DownloadMessage* message);
+			bool Process ();
+			void Progress (Download* download);
+			void ReadMessages ();
+			int Retry (double now);
+			void Run ();
+			void Split (Download* download, const char* url, curl_off_t length);
+			bool StartSegment (Segment* segment);
+			void Wake ();
+
+			static size_t HeaderCallback (char* buffer, size_t size, size_t count, void* userp);
+			static size_t WriteCallback (char* buffer, size_t size, size_t count, void* userp);
+
+			std::map<int, Download*> active;
+			std::vector<int> canceled;
+			DownloadMessage* current;
+			std::deque<DownloadMessage*> messages;
+			CURLM* multi;
+			std::mutex mutex;
+			int nextID;
+			std::vector<Download*> pending;
+			CURLShare* share;
+			bool stopping;
+			std::thread worker;
+
+
+	};
+
+
+}
+
+
+#endif
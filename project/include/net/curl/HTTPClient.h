@@ -0,0 +1,132 @@
+#ifndef LIME_NET_CURL_HTTP_CLIENT_H
+#define LIME_NET_CURL_HTTP_CLIENT_H
+
+
+#include <curl/curl.h>
+#include <net/curl/CURLShare.h>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace lime {
+
+
+	enum HTTPClientFlags {
+
+		HTTP_CLIENT_FOLLOW_REDIRECTS = 1,
+		HTTP_CLIENT_MANAGE_COOKIES = 2,
+		HTTP_CLIENT_NO_BODY = 4,
+		HTTP_CLIENT_RESPONSE_HEADERS = 8,
+		HTTP_CLIENT_TEXT = 16
+
+	};
+
+
+	enum HTTPClientMessageType {
+
+		HTTP_CLIENT_COMPLETE,
+		HTTP_CLIENT_PROGRESS
+
+	};
+
+
+	struct HTTPClientMessage {
+
+		double bytesLoaded;
+		double bytesTotal;
+		std::vector<unsigned char> data;
+		std::string headers;
+		int id;
+		int result;
+		int status;
+		int type;
+
+	};
+
+
+	// Runs libcurl transfers on a thread of its own, driven by
+	// curl_multi_socket_action and epoll where available, and by
+	// curl_multi_poll elsewhere. Response bodies and headers are collected
+	// natively, and only completed responses plus throttled progress are
+	// queued for the main thread to Read, so the number of chunks received
+	// never costs main thread time. Transfers use the default CURLShare
+	// unless another share is given, so DNS results and TLS sessions are
+	// reused across requests and other clients.
+
+	class HTTPClient {
+
+
+		public:
+
+			HTTPClient (int maxConnections, CURLShare* share = NULL);
+			~HTTPClient ();
+
+			void Cancel (int id);
+			HTTPClientMessage* GetCurrent () const { return current; }
+			HTTPClientMessage* Read ();
+			int Request (const char* url, const char* method, curl_slist* headers, const unsigned char* data, int length, int flags, int timeout, double progressInterval);
+
+		private:
+
+			struct Transfer {
+
+				HTTPClient* client;
+				CURL* curl;
+				std::vector<unsigned char> data;
+				int flags;
+				curl_slist* headers;
+				int id;
+				double lastProgress;
+				double progressInterval;
+				double progressLoaded;
+				double progressTotal;
+				std::vector<unsigned char> request;
+				size_t requestPosition;
+				std::string responseHeaders;
+
+			};
+
+			void Complete (Transfer* transfer, CURLcode result);
+			void Destroy (Transfer* transfer);
+			void Post (HTTPClientMessage* message);
+			bool Process ();
+			void ReadMessages ();
+			void Run ();
+			void Start (Transfer* transfer);
+			void Wake ();
+
+			static size_t HeaderCallback (char* buffer, size_t size, size_t count, void* userp);
+			static size_t ReadCallback (char* buffer, size_t size, size_t count, void* userp);
+			static int SocketCallback (CURL* curl, curl_socket_t socket, int action, void* userp, void* socketp);
+			static int TimerCallback (CURLM* multi, long timeout, void* userp);
+			static size_t WriteCallback (char* buffer, size_t size, size_t count, void* userp);
+			static int XferInfoCallback (void* userp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t ultotal, curl_off_t ulnow);
+
+			std::map<int, Transfer*> active;
+			std::vector<int> canceled;
+			std::vector<std::string> cookies;
+			HTTPClientMessage* current;
+			int epoll;
+			std::deque<HTTPClientMessage*> messages;
+			CURLM* multi;
+			std::mutex mutex;
+			int nextID;
+			std::vector<Transfer*> pending;
+			CURLShare* share;
+			bool stopping;
+			double timerDeadline;
+			int wakeEvent;
+			std::thread worker;
+
+
+	};
+
+
+}
+
+
+#endif
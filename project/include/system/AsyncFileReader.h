@@ -0,0 +1,88 @@
+#ifndef LIME_SYSTEM_ASYNC_FILE_READER_H
+#define LIME_SYSTEM_ASYNC_FILE_READER_H
+
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace lime {
+
+
+	struct AsyncFileRead {
+
+		unsigned char* data;
+		int fd;
+		int id;
+		int length;
+		int64_t offset;
+		std::string path;
+		int position;
+		int result;
+
+	};
+
+
+	class IORing;
+
+
+	// Reads byte ranges of files without blocking the calling thread.
+	// Requests are queued by Submit and their results are collected with
+	// Read, which hands back one completed request at a time.
+	//
+	// On Linux the reads are issued through io_uring, so any number of them
+	// can be in flight on a single completion thread. Where io_uring is not
+	// available (other platforms, older kernels, or sandboxes that block the
+	// syscalls) a small pool of threads reads the files with the C runtime.
+	//
+	// Neither path goes through lime::fopen, which enters GC blocking zones
+	// and may not be called from threads the GC does not know about, so
+	// files packed inside an Android APK cannot be read this way.
+
+	class AsyncFileReader {
+
+
+		public:
+
+			AsyncFileReader (int threads);
+			~AsyncFileReader ();
+
+			void Cancel (int id);
+			AsyncFileRead* GetCurrent () const { return current; }
+			AsyncFileRead* Read ();
+			int Submit (const char* path, double offset, int length);
+
+		private:
+
+			void Complete (AsyncFileRead* request);
+			void Run ();
+			void RunRing ();
+			bool SubmitRing (AsyncFileRead* request);
+
+			std::set<int> canceled;
+			std::deque<AsyncFileRead*> completed;
+			std::condition_variable condition;
+			AsyncFileRead* current;
+			int inFlight;
+			std::mutex mutex;
+			int nextID;
+			std::deque<AsyncFileRead*> pending;
+			IORing* ring;
+			bool stopping;
+			bool waking;
+			std::vector<std::thread> workers;
+
+
+	};
+
+
+}
+
+
+#endif
@@ -3,8 +3,13 @@
 
 #include <system/CFFI.h>
 #include <system/Mutex.h>
+#include <condition_variable>
 #include <map>
+#include <mutex>
+#include <stdint.h>
 #include <string>
+#include <thread>
+#include <time.h>
 #include <vector>
 
 #ifdef RemoveDirectory
@@ -21,10 +26,41 @@ namespace lime {
 		std::string file;
 		int action;
 		std::string oldFile;
+		double time;
 
 	};
 
 
+	struct FileWatcherSeed {
+
+		std::string directory;
+		bool recursive;
+		time_t started;
+
+	};
+
+
+	// Events are queued from the efsw thread and delivered from Update on
+	// the main thread. Repeated events for the same path are merged while
+	// they wait (an add followed by a delete cancels out, a delete followed
+	// by an add becomes a modify), and with a debounce a path is held back
+	// until it has been quiet for that long. Moves are never merged.
+	//
+	// Callbacks run after the queue has been released, so the efsw thread
+	// is never blocked on Haxe code. With a batch callback, each Update
+	// makes a single call with every event packed into one flat array of
+	// dir, file, action and oldFile values.
+	//
+	// When comparing content, settled events are handed to a worker thread
+	// that hashes each added or modified file and checks it against the
+	// hash recorded the last time it was seen. Events for files whose bytes
+	// did not change are dropped, and Update delivers whatever the worker
+	// has finished as one batch. The files already in a watched directory
+	// are hashed when it is added, or when comparing is turned on, so the
+	// first save of an untouched file is compared too. Files written since
+	// the watch started are left out, their events must not be matched
+	// against the bytes they were just given.
+
 	class FileWatcher {
 
 
@@ -36,16 +72,34 @@ namespace lime {
 			long AddDirectory (const std::string directory, bool recursive);
 			void QueueEvent (FileWatcherEvent event);
 			void RemoveDirectory (long watchID);
+			void SetOptions (double debounce, value batchCallback, bool compareContent);
 			void Update ();
 
 
 		private:
 
+			void HashEvents ();
+			void IndexQueue ();
+			void SeedHashes (const std::string& directory, bool recursive, time_t started);
+
+			AutoGCRoot* batchCallback;
 			AutoGCRoot* callback;
+			bool compareContent;
+			std::map<std::string, uint64_t> contentHashes;
+			double debounce;
+			std::map<long, std::pair<std::string, bool> > directories;
 			void* fileWatcher;
 			Mutex* mutex;
 			std::vector<FileWatcherEvent> queue;
+			std::map<std::string, size_t> queueIndex;
 			std::map<long, void*> listeners;
+			std::condition_variable hashCondition;
+			std::vector<FileWatcherEvent> hashed;
+			std::mutex hashMutex;
+			std::vector<FileWatcherEvent> hashQueue;
+			bool hashStopping;
+			std::thread hashThread;
+			std::vector<FileWatcherSeed> seedQueue;
 
 
 	};
@@ -12,6 +12,7 @@ namespace lime {
 			static void AddMapping (const char* content);
 			static const char* GetDeviceGUID (int id);
 			static const char* GetDeviceName (int id);
+			static void SetMotionSensors (bool enabled);
 
 	};
 
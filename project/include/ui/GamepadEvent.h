@@ -28,6 +28,7 @@ namespace lime {
 		int id;
 		GamepadEventType type;
 		double axisValue;
+		double timestamp;
 
 		static ValuePointer* callback;
 		static ValuePointer* eventObject;
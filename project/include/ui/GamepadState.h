@@ -0,0 +1,78 @@
+#ifndef LIME_UI_GAMEPAD_STATE_H
+#define LIME_UI_GAMEPAD_STATE_H
+
+
+#include <stdint.h>
+#include <vector>
+
+
+namespace lime {
+
+
+	enum GamepadStateKind {
+
+		GAMEPAD_STATE_GAMEPAD,
+		GAMEPAD_STATE_JOYSTICK
+
+	};
+
+
+	enum GamepadStateSensor {
+
+		GAMEPAD_STATE_GYRO,
+		GAMEPAD_STATE_ACCELEROMETER
+
+	};
+
+
+	// Written as is into the Haxe buffer by lime_gamepad_get_states, keep in
+	// sync with Gamepad.updateStates. Hats take four bits each, using the
+	// JoystickHatPosition flags.
+
+	struct GamepadStateRecord {
+
+		int32_t id;
+		uint8_t kind;
+		uint8_t reserved[3];
+		uint32_t buttons;
+		uint32_t hats;
+		float axes[8];
+		float gyro[3];
+		float accelerometer[3];
+		double timestamp;
+
+	};
+
+
+	// The latest state of every connected gamepad and joystick, updated from
+	// the event pump so it can be polled once per frame
+
+	class GamepadState {
+
+
+		public:
+
+			static void Connect (int id, int kind);
+			static void Disconnect (int id, int kind);
+			static int Read (GamepadStateRecord* records, int max);
+			static void SetAxis (int id, int kind, int axis, float value, double timestamp);
+			static void SetButton (int id, int kind, int button, bool down, double timestamp);
+			static void SetHat (int id, int kind, int hat, int value, double timestamp);
+			static void SetSensor (int id, int sensor, const float* data, double timestamp);
+
+			static bool axisEvents;
+
+		private:
+
+			static GamepadStateRecord* Find (int id, int kind);
+
+			static std::vector<GamepadStateRecord> records;
+
+
+	};
+
+
+}
+
+
+#endif
@@ -30,6 +30,7 @@ namespace lime {
 		int eventValue;
 		double x;
 		double y;
+		double timestamp;
 
 		static ValuePointer* callback;
 		static ValuePointer* eventObject;
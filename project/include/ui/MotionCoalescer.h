@@ -0,0 +1,74 @@
+#ifndef LIME_UI_MOTION_COALESCER_H
+#define LIME_UI_MOTION_COALESCER_H
+
+
+#include <ui/MouseEvent.h>
+#include <ui/TouchEvent.h>
+#include <stdint.h>
+#include <vector>
+
+
+namespace lime {
+
+
+	enum MotionSampleType {
+
+		MOTION_SAMPLE_MOUSE,
+		MOTION_SAMPLE_TOUCH
+
+	};
+
+
+	// Written as is into the Haxe buffer by lime_motion_coalescer_get_history,
+	// keep in sync with NativeApplication.getMotionHistory
+
+	struct MotionSample {
+
+		uint8_t type;
+		uint8_t reserved[3];
+		int32_t id;
+		double time;
+		double x;
+		double y;
+		double dx;
+		double dy;
+		double pressure;
+
+	};
+
+
+	class MotionCoalescer {
+
+
+		public:
+
+			static void BeginFrame ();
+			static void Flush ();
+			static int GetHistory (MotionSample* samples, int max);
+			static bool Push (MouseEvent* event, double time);
+			static bool Push (TouchEvent* event, double time);
+
+			static bool enabled;
+
+		private:
+
+			static void Record (int type, int id, double time, double x, double y, double dx, double dy, double pressure);
+
+			static const int HISTORY_SIZE = 1024;
+
+			// samples are recorded while events are polled, then published
+			// by BeginFrame so they stay readable for the whole update
+
+			static std::vector<MotionSample> history;
+			static std::vector<MouseEvent> pendingMouse;
+			static std::vector<TouchEvent> pendingTouch;
+			static std::vector<MotionSample> recording;
+
+
+	};
+
+
+}
+
+
+#endif
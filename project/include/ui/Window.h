@@ -45,13 +45,19 @@ namespace lime {
 			virtual int GetWidth () = 0;
 			virtual int GetX () = 0;
 			virtual int GetY () = 0;
+			virtual void InjectKeyEvent (int type, int keyCode, int modifier) = 0;
+			virtual void InjectMouseEvent (int type, double x, double y, int button) = 0;
+			virtual void InjectTextEvent (const char* text) = 0;
 			virtual void Move (int x, int y) = 0;
 			virtual void ReadPixels (ImageBuffer *buffer, Rectangle *rect) = 0;
+			virtual int ReadPixelsAsync (Rectangle *rect) = 0;
+			virtual int ReadPixelsAsyncResult (int id, ImageBuffer *buffer) = 0;
 			virtual void Resize (int width, int height) = 0;
 			virtual void SetMinimumSize (int width, int height) = 0;
 			virtual void SetMaximumSize (int width, int height) = 0;
 			virtual bool SetBorderless (bool borderless) = 0;
 			virtual void SetCursor (Cursor cursor) = 0;
+			virtual void SetDirtyRects (const int* rects, int count) = 0;
 			virtual void SetDisplayMode (DisplayMode* displayMode) = 0;
 			virtual bool SetFullscreen (bool fullscreen) = 0;
 			virtual void SetIcon (ImageBuffer *imageBuffer) = 0;
@@ -0,0 +1,61 @@
+#ifndef LIME_UTILS_MAPPED_FILE_H
+#define LIME_UTILS_MAPPED_FILE_H
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace lime {
+
+
+	// A read-only file mapped into memory, so ranges of it can be handed to
+	// decoders without reading the whole file first. The mapping is private
+	// and copy-on-write, so views over it may be written to without changing
+	// the file. Files that cannot be mapped, such as assets inside an
+	// Android APK, are read into memory instead.
+	//
+	// Views handed to Haxe code each hold a reference to the mapping, so
+	// Close only releases the owner's reference and the memory stays valid
+	// until the last view is released too. Destroy is called when the
+	// owning handle is collected.
+
+	class MappedFile {
+
+
+		public:
+
+			static MappedFile* Open (const char* path);
+			static void ReleaseView (const void* data);
+
+			void Close ();
+			void Destroy ();
+			unsigned char* GetData () const { return data; }
+			int64_t GetLength () const { return length; }
+			bool RetainView ();
+
+		private:
+
+			MappedFile ();
+			~MappedFile ();
+
+			void Unmap ();
+
+			bool closed;
+			unsigned char* data;
+			bool destroyed;
+			int64_t length;
+			bool mapped;
+			int views;
+			#ifdef HX_WINDOWS
+			void* mapping;
+			#endif
+
+
+	};
+
+
+}
+
+
+#endif
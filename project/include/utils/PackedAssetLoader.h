@@ -0,0 +1,95 @@
+#ifndef LIME_UTILS_PACKED_ASSET_LOADER_H
+#define LIME_UTILS_PACKED_ASSET_LOADER_H
+
+
+#include <graphics/ImageBuffer.h>
+#include <media/AudioBuffer.h>
+#include <utils/compress/Zlib.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace lime {
+
+
+	// DEFLATE and GZIP keep their ZlibType values
+	enum PackedAssetCompression {
+
+		PACKED_ASSET_DEFLATE = DEFLATE,
+		PACKED_ASSET_GZIP = GZIP,
+		PACKED_ASSET_ZSTD = 3
+
+	};
+
+
+	enum PackedAssetDecode {
+
+		PACKED_ASSET_BYTES,
+		PACKED_ASSET_IMAGE,
+		PACKED_ASSET_AUDIO
+
+	};
+
+
+	struct PackedAssetLoad {
+
+		AudioBuffer* audio;
+		int compression;
+		unsigned char* data;
+		int decode;
+		int id;
+		ImageBuffer* image;
+		int length;
+		const unsigned char* source;
+		int sourceLength;
+
+	};
+
+
+	// Inflates and decodes entries of a packed asset library on a pool of
+	// worker threads. Entries are read from memory that must outlive the
+	// loader, such as a MappedFile, and results are collected one at a time
+	// with Read.
+	//
+	// An entry is inflated when its compression is DEFLATE or GZIP, or
+	// decompressed when it is ZSTD (a compression below zero means it is
+	// stored as-is), then optionally decoded into an ImageBuffer or
+	// AudioBuffer. Decoding only allocates native memory, so the buffers are
+	// converted to Haxe objects later, on the thread that calls Read.
+
+	class PackedAssetLoader {
+
+
+		public:
+
+			PackedAssetLoader (int threads);
+			~PackedAssetLoader ();
+
+			PackedAssetLoad* GetCurrent () const { return current; }
+			PackedAssetLoad* Read ();
+			int Submit (const unsigned char* source, int length, int compression, int decode);
+
+		private:
+
+			void Run ();
+
+			std::deque<PackedAssetLoad*> completed;
+			std::condition_variable condition;
+			PackedAssetLoad* current;
+			std::mutex mutex;
+			int nextID;
+			std::deque<PackedAssetLoad*> pending;
+			bool stopping;
+			std::vector<std::thread> workers;
+
+
+	};
+
+
+}
+
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef LIME_UTILS_COMPRESS_ZSTD_H
+#define LIME_UTILS_COMPRESS_ZSTD_H
+
+
+#include <utils/Bytes.h>
+
+
+namespace lime {
+
+
+	class Zstd {
+
+
+		public:
+
+			static void Compress (Bytes* data, Bytes* result);
+			static void Decompress (Bytes* data, Bytes* result);
+			static unsigned char* Decompress (const unsigned char* data, int length, int* resultLength);
+
+
+	};
+
+
+}
+
+
+#endif
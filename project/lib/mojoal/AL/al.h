@@ -656,6 +656,17 @@ typedef void          (AL_APIENTRY *LPALTRACEMESSAGE)(const ALchar *str);
 typedef void          (AL_APIENTRY *LPALTRACEBUFFERLABEL)(ALuint name, const ALchar *str);
 typedef void          (AL_APIENTRY *LPALTRACESOURCELABEL)(ALuint name, const ALchar *str);
 
+/* Lime extension: hooks used by Lime's native mixing graph. The source filter
+   runs on the panned, device-format samples of sources flagged with
+   alSourceFilteredLIME before they are added to the mix, with the frame offset
+   they are added at, and the post-mix callback runs on the finished device mix.
+   Both are called from the mixer thread. */
+#define AL_LIME_mix_callbacks 1
+typedef void          (AL_APIENTRY *LPALSOURCEFILTERLIME)(ALvoid *userdata, ALuint source, ALfloat *data, ALsizei frames, ALsizei channels, ALsizei frequency, ALsizei offset);
+typedef void          (AL_APIENTRY *LPALPOSTMIXLIME)(ALvoid *userdata, ALfloat *stream, ALsizei frames, ALsizei channels, ALsizei frequency);
+AL_API void AL_APIENTRY alMixCallbacksLIME(LPALSOURCEFILTERLIME sourcefilter, LPALPOSTMIXLIME postmix, ALvoid *userdata);
+AL_API void AL_APIENTRY alSourceFilteredLIME(ALuint source, ALboolean filtered);
+
 #if defined(__cplusplus)
 }  /* extern "C" */
 #endif
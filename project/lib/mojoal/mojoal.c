@@ -477,6 +477,7 @@ SIMDALIGNEDSTRUCT ALsource
     ALint queue_channels;
     ALsizei queue_frequency;
     PitchState *pitchstate;
+    ALboolean lime_filtered;  /* run through the device's source filter callback as it is mixed. */
     ALsource *playlist_next;  /* linked list that contains currently-playing sources! Only touched by mixer thread! */
 };
 
@@ -514,6 +515,10 @@ struct ALCdevice_struct
             ALCsizei num_buffer_blocks;
             BufferQueueItem *buffer_queue_pool;  /* mixer thread doesn't touch this. */
             void *source_todo_pool;  /* void* because we'll atomicgetptr it. */
+            LPALSOURCEFILTERLIME lime_source_filter;  /* only changed while the device is locked. */
+            LPALPOSTMIXLIME lime_postmix;
+            void *lime_mix_userdata;
+            float *lime_mix_stream;  /* start of the mix in progress, only touched by mixer thread. */
         } playback;
         struct {
             RingBuffer ring;  /* only used if iscapture */
@@ -1357,14 +1362,8 @@ static void pitch_shift(ALsource *src, const ALbuffer *buffer, int numSampsToPro
     }
 }
 
-static void mix_buffer(ALsource *src, const ALbuffer *buffer, const ALfloat * restrict panning, const float * restrict data, float * restrict stream, const ALsizei mixframes)
+static void mix_panned_buffer(const ALbuffer *buffer, const ALfloat * restrict panning, const float * restrict data, float * restrict stream, const ALsizei mixframes)
 {
-    if ((src->pitch != 1.0f) && (src->pitchstate != NULL)) {
-        float *pitched = (float *) alloca(mixframes * buffer->channels * sizeof (float));
-        pitch_shift(src, buffer, mixframes * buffer->channels, data, pitched);
-        data = pitched;
-    }
-
     const ALfloat left = panning[0];
     const ALfloat right = panning[1];
     FIXME("currently expects output to be stereo");
@@ -1400,6 +1399,32 @@ static void mix_buffer(ALsource *src, const ALbuffer *buffer, const ALfloat * re
     }
 }
 
+static void mix_buffer(ALCcontext *ctx, ALsource *src, const ALbuffer *buffer, const ALfloat * restrict panning, const float * restrict data, float * restrict stream, const ALsizei mixframes)
+{
+    if ((src->pitch != 1.0f) && (src->pitchstate != NULL)) {
+        float *pitched = (float *) alloca(mixframes * buffer->channels * sizeof (float));
+        pitch_shift(src, buffer, mixframes * buffer->channels, data, pitched);
+        data = pitched;
+    }
+
+    if (src->lime_filtered && ctx->device->playback.lime_source_filter) {
+        /* pan into silence so the callback only sees this source, then add what it leaves to the mix. */
+        ALCdevice *device = ctx->device;
+        const ALsizei samples = mixframes * device->channels;
+        float *routed = (float *) alloca(samples * sizeof (float));
+        ALsizei i;
+        SDL_memset(routed, '\0', samples * sizeof (float));
+        mix_panned_buffer(buffer, panning, data, routed, mixframes);
+        device->playback.lime_source_filter(device->playback.lime_mix_userdata, src->name, routed, mixframes, device->channels, device->frequency, (ALsizei) ((stream - device->playback.lime_mix_stream) / device->channels));
+        for (i = 0; i < samples; i++) {
+            stream[i] += routed[i];
+        }
+        return;
+    }
+
+    mix_panned_buffer(buffer, panning, data, stream, mixframes);
+}
+
 static ALboolean mix_source_buffer(ALCcontext *ctx, ALsource *src, BufferQueueItem *queue, float **stream, int *len)
 {
     const ALbuffer *buffer = queue ? queue->buffer : NULL;
@@ -1433,7 +1458,7 @@ static ALboolean mix_source_buffer(ALCcontext *ctx, ALsource *src, BufferQueueIt
                 const int mixbufframes = mixbuflen / bufferframesize;
                 const int getframes = SDL_min(remainingmixframes, mixbufframes);
                 SDL_AudioStreamGet(src->stream, mixbuf, getframes * bufferframesize);
-                mix_buffer(src, buffer, src->panning, mixbuf, *stream, getframes);
+                mix_buffer(ctx, src, buffer, src->panning, mixbuf, *stream, getframes);
                 *len -= getframes * deviceframesize;
                 *stream += getframes * ctx->device->channels;
                 remainingmixframes -= getframes;
@@ -1441,7 +1466,7 @@ static ALboolean mix_source_buffer(ALCcontext *ctx, ALsource *src, BufferQueueIt
         } else {
             const int framesavail = (buffer->len - src->offset) / bufferframesize;
             const int mixframes = SDL_min(framesneeded, framesavail);
-            mix_buffer(src, buffer, src->panning, data, *stream, mixframes);
+            mix_buffer(ctx, src, buffer, src->panning, data, *stream, mixframes);
             src->offset += mixframes * bufferframesize;
             *len -= mixframes * deviceframesize;
             *stream += mixframes * ctx->device->channels;
@@ -2064,6 +2089,7 @@ static void SDLCALL playback_device_callback(void *userdata, Uint8 *stream, int
     ALCboolean connected = ALC_FALSE;
 
     SDL_memset(stream, '\0', len);
+    device->playback.lime_mix_stream = (float *) stream;
 
     if (SDL_AtomicGet(&device->connected)) {
         if (SDL_GetAudioDeviceStatus(device->sdldevice) == SDL_AUDIO_STOPPED) {
@@ -2082,6 +2108,10 @@ static void SDLCALL playback_device_callback(void *userdata, Uint8 *stream, int
             }
         }
     }
+
+    if (connected && device->playback.lime_postmix) {
+        device->playback.lime_postmix(device->playback.lime_mix_userdata, (float *) stream, len / device->framesize, device->channels, device->frequency);
+    }
 }
 
 static ALCcontext *_alcCreateContext(ALCdevice *device, const ALCint* attrlist)
@@ -2846,6 +2876,23 @@ static void _alSpeedOfSound(const ALfloat value)
 }
 ENTRYPOINTVOID(alSpeedOfSound,(ALfloat value),(value))
 
+static void _alMixCallbacksLIME(LPALSOURCEFILTERLIME sourcefilter, LPALPOSTMIXLIME postmix, ALvoid *userdata)
+{
+    ALCcontext *ctx = get_current_context();
+    if (!ctx) {
+        set_al_error(ctx, AL_INVALID_OPERATION);
+    } else {
+        /* the mixer thread calls these, so only swap them while it's locked out. */
+        ALCdevice *device = ctx->device;
+        SDL_LockAudioDevice(device->sdldevice);
+        device->playback.lime_source_filter = sourcefilter;
+        device->playback.lime_postmix = postmix;
+        device->playback.lime_mix_userdata = userdata;
+        SDL_UnlockAudioDevice(device->sdldevice);
+    }
+}
+ENTRYPOINTVOID(alMixCallbacksLIME,(LPALSOURCEFILTERLIME sourcefilter, LPALPOSTMIXLIME postmix, ALvoid *userdata),(sourcefilter,postmix,userdata))
+
 static void _alDistanceModel(const ALenum model)
 {
     ALCcontext *ctx = get_current_context();
@@ -3856,6 +3903,18 @@ static void _alSourceiv(const ALuint name, const ALenum param, const ALint *valu
 }
 ENTRYPOINTVOID(alSourceiv,(ALuint name, ALenum param, const ALint *values),(name,param,values))
 
+static void _alSourceFilteredLIME(const ALuint name, const ALboolean filtered)
+{
+    ALCcontext *ctx = get_current_context();
+    ALsource *src = get_source(ctx, name, NULL);
+    if (src) {
+        SDL_LockMutex(ctx->source_lock);
+        src->lime_filtered = filtered ? AL_TRUE : AL_FALSE;
+        SDL_UnlockMutex(ctx->source_lock);
+    }
+}
+ENTRYPOINTVOID(alSourceFilteredLIME,(ALuint name, ALboolean filtered),(name,filtered))
+
 static void _alSourcei(const ALuint name, const ALenum param, const ALint value)
 {
     switch (param) {
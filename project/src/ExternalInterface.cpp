@@ -10,6 +10,7 @@
 
 #include <app/Application.h>
 #include <app/ApplicationEvent.h>
+#include <app/EventQueue.h>
 #include <graphics/format/JPEG.h>
 #include <graphics/format/PNG.h>
 #include <graphics/utils/ImageDataUtil.h>
@@ -18,7 +19,9 @@
 #include <graphics/RenderEvent.h>
 #include <media/containers/OGG.h>
 #include <media/containers/WAV.h>
+#include <media/containers/WAVStream.h>
 #include <media/AudioBuffer.h>
+#include <system/AsyncFileReader.h>
 #include <system/CFFIPointer.h>
 #include <system/Clipboard.h>
 #include <system/ClipboardEvent.h>
@@ -38,11 +41,13 @@
 #include <ui/FileDialog.h>
 #include <ui/Gamepad.h>
 #include <ui/GamepadEvent.h>
+#include <ui/GamepadState.h>
 #include <ui/Haptic.h>
 #include <ui/Joystick.h>
 #include <ui/JoystickEvent.h>
 #include <ui/KeyCode.h>
 #include <ui/KeyEvent.h>
+#include <ui/MotionCoalescer.h>
 #include <ui/MouseEvent.h>
 #include <ui/TextEvent.h>
 #include <ui/TouchEvent.h>
@@ -50,6 +55,9 @@
 #include <ui/WindowEvent.h>
 #include <utils/compress/LZMA.h>
 #include <utils/compress/Zlib.h>
+#include <utils/compress/Zstd.h>
+#include <utils/MappedFile.h>
+#include <utils/PackedAssetLoader.h>
 #include <vm/NekoVM.h>
 
 #ifdef HX_WINDOWS
@@ -83,6 +91,22 @@ namespace lime {
 	}
 
 
+	void gc_async_file_reader (value handle) {
+
+		AsyncFileReader* reader = (AsyncFileReader*)val_data (handle);
+		delete reader;
+
+	}
+
+
+	void hl_gc_async_file_reader (HL_CFFIPointer* handle) {
+
+		AsyncFileReader* reader = (AsyncFileReader*)handle->ptr;
+		delete reader;
+
+	}
+
+
 	void gc_file_watcher (value handle) {
 
 		#ifdef LIME_EFSW
@@ -103,6 +127,38 @@ namespace lime {
 	}
 
 
+	void gc_mapped_file (value handle) {
+
+		MappedFile* file = (MappedFile*)val_data (handle);
+		file->Destroy ();
+
+	}
+
+
+	void hl_gc_mapped_file (HL_CFFIPointer* handle) {
+
+		MappedFile* file = (MappedFile*)handle->ptr;
+		file->Destroy ();
+
+	}
+
+
+	void gc_packed_asset_loader (value handle) {
+
+		PackedAssetLoader* loader = (PackedAssetLoader*)val_data (handle);
+		delete loader;
+
+	}
+
+
+	void hl_gc_packed_asset_loader (HL_CFFIPointer* handle) {
+
+		PackedAssetLoader* loader = (PackedAssetLoader*)handle->ptr;
+		delete loader;
+
+	}
+
+
 	void gc_font (value handle) {
 
 		#ifdef LIME_FREETYPE
@@ -123,6 +179,22 @@ namespace lime {
 	}
 
 
+	void gc_wav_stream (value handle) {
+
+		WAVStream* stream = (WAVStream*)val_data (handle);
+		delete stream;
+
+	}
+
+
+	void hl_gc_wav_stream (HL_CFFIPointer* handle) {
+
+		WAVStream* stream = (WAVStream*)handle->ptr;
+		delete stream;
+
+	}
+
+
 	void gc_window (value handle) {
 
 		Window* window = (Window*)val_data (handle);
@@ -316,6 +388,46 @@ namespace lime {
 	}
 
 
+	value lime_application_get_frame_stats (value application) {
+
+		Application* app = (Application*)val_data (application);
+
+		FrameStats stats;
+		app->GetFrameStats (&stats);
+
+		value ret = alloc_empty_object ();
+		alloc_field (ret, val_id ("frames"), alloc_float (stats.frames));
+		alloc_field (ret, val_id ("frameTimeP50"), alloc_float (stats.frameTimeP50));
+		alloc_field (ret, val_id ("frameTimeP99"), alloc_float (stats.frameTimeP99));
+		alloc_field (ret, val_id ("jitterP50"), alloc_float (stats.jitterP50));
+		alloc_field (ret, val_id ("jitterP99"), alloc_float (stats.jitterP99));
+		alloc_field (ret, val_id ("missed"), alloc_int (stats.missed));
+		alloc_field (ret, val_id ("spinMargin"), alloc_float (stats.spinMargin));
+		return ret;
+
+	}
+
+
+	HL_PRIM vdynamic* HL_NAME(hl_application_get_frame_stats) (HL_CFFIPointer* application) {
+
+		Application* app = (Application*)application->ptr;
+
+		FrameStats stats;
+		app->GetFrameStats (&stats);
+
+		vdynamic* ret = (vdynamic*)hl_alloc_dynobj ();
+		hl_dyn_setd (ret, hl_hash_utf8 ("frames"), stats.frames);
+		hl_dyn_setd (ret, hl_hash_utf8 ("frameTimeP50"), stats.frameTimeP50);
+		hl_dyn_setd (ret, hl_hash_utf8 ("frameTimeP99"), stats.frameTimeP99);
+		hl_dyn_setd (ret, hl_hash_utf8 ("jitterP50"), stats.jitterP50);
+		hl_dyn_setd (ret, hl_hash_utf8 ("jitterP99"), stats.jitterP99);
+		hl_dyn_seti (ret, hl_hash_utf8 ("missed"), &hlt_i32, stats.missed);
+		hl_dyn_setd (ret, hl_hash_utf8 ("spinMargin"), stats.spinMargin);
+		return ret;
+
+	}
+
+
 	void lime_application_init (value application) {
 
 		Application* app = (Application*)val_data (application);
@@ -348,6 +460,38 @@ namespace lime {
 	}
 
 
+	void lime_application_set_fixed_time_step (value application, double step) {
+
+		Application* app = (Application*)val_data (application);
+		app->SetFixedTimeStep (step);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_application_set_fixed_time_step) (HL_CFFIPointer* application, double step) {
+
+		Application* app = (Application*)application->ptr;
+		app->SetFixedTimeStep (step);
+
+	}
+
+
+	void lime_application_set_frame_pacing (value application, int policy) {
+
+		Application* app = (Application*)val_data (application);
+		app->SetFramePacing (policy);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_application_set_frame_pacing) (HL_CFFIPointer* application, int policy) {
+
+		Application* app = (Application*)application->ptr;
+		app->SetFramePacing (policy);
+
+	}
+
+
 	void lime_application_set_frame_rate (value application, double frameRate) {
 
 		Application* app = (Application*)val_data (application);
@@ -364,6 +508,22 @@ namespace lime {
 	}
 
 
+	void lime_application_set_precise_input (value application, bool value) {
+
+		Application* app = (Application*)val_data (application);
+		app->SetPreciseInput (value);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_application_set_precise_input) (HL_CFFIPointer* application, bool value) {
+
+		Application* app = (Application*)application->ptr;
+		app->SetPreciseInput (value);
+
+	}
+
+
 	bool lime_application_update (value application) {
 
 		Application* app = (Application*)val_data (application);
@@ -380,6 +540,118 @@ namespace lime {
 	}
 
 
+	void lime_async_file_reader_cancel (value handle, int id) {
+
+		AsyncFileReader* reader = (AsyncFileReader*)val_data (handle);
+		reader->Cancel (id);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_async_file_reader_cancel) (HL_CFFIPointer* handle, int id) {
+
+		AsyncFileReader* reader = (AsyncFileReader*)handle->ptr;
+		reader->Cancel (id);
+
+	}
+
+
+	value lime_async_file_reader_create (int threads) {
+
+		AsyncFileReader* reader = new AsyncFileReader (threads);
+		return CFFIPointer (reader, gc_async_file_reader);
+
+	}
+
+
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_async_file_reader_create) (int threads) {
+
+		AsyncFileReader* reader = new AsyncFileReader (threads);
+		return HLCFFIPointer (reader, (hl_finalizer)hl_gc_async_file_reader);
+
+	}
+
+
+	value lime_async_file_reader_read (value handle) {
+
+		AsyncFileReader* reader = (AsyncFileReader*)val_data (handle);
+		AsyncFileRead* request = reader->Read ();
+
+		if (!request) return alloc_null ();
+
+		const field id_id = val_id ("id");
+		const field id_result = val_id ("result");
+
+		value result = alloc_empty_object ();
+		alloc_field (result, id_id, alloc_int (request->id));
+		alloc_field (result, id_result, alloc_int (request->result));
+		return result;
+
+	}
+
+
+	HL_PRIM vdynamic* HL_NAME(hl_async_file_reader_read) (HL_CFFIPointer* handle, vdynamic* result) {
+
+		AsyncFileReader* reader = (AsyncFileReader*)handle->ptr;
+		AsyncFileRead* request = reader->Read ();
+
+		if (!request) return NULL;
+
+		const int id_id = hl_hash_utf8 ("id");
+		const int id_result = hl_hash_utf8 ("result");
+
+		hl_dyn_seti (result, id_id, &hlt_i32, request->id);
+		hl_dyn_seti (result, id_result, &hlt_i32, request->result);
+		return result;
+
+	}
+
+
+	void lime_async_file_reader_read_data (value handle, value bytes) {
+
+		AsyncFileReader* reader = (AsyncFileReader*)val_data (handle);
+		AsyncFileRead* request = reader->GetCurrent ();
+		Bytes _bytes (bytes);
+
+		if (request && request->result > 0 && _bytes.length >= request->result) {
+
+			memcpy (_bytes.b, request->data, request->result);
+
+		}
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_async_file_reader_read_data) (HL_CFFIPointer* handle, Bytes* bytes) {
+
+		AsyncFileReader* reader = (AsyncFileReader*)handle->ptr;
+		AsyncFileRead* request = reader->GetCurrent ();
+
+		if (request && bytes && request->result > 0 && bytes->length >= request->result) {
+
+			memcpy (bytes->b, request->data, request->result);
+
+		}
+
+	}
+
+
+	int lime_async_file_reader_submit (value handle, HxString path, double offset, int length) {
+
+		AsyncFileReader* reader = (AsyncFileReader*)val_data (handle);
+		return reader->Submit (hxs_utf8 (path, nullptr), offset, length);
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_async_file_reader_submit) (HL_CFFIPointer* handle, hl_vstring* path, double offset, int length) {
+
+		AsyncFileReader* reader = (AsyncFileReader*)handle->ptr;
+		return reader->Submit (path ? hl_to_utf8 ((const uchar*)path->bytes) : NULL, offset, length);
+
+	}
+
+
 	value lime_audio_load_bytes (value data, value buffer) {
 
 		Resource resource;
@@ -432,6 +704,65 @@ namespace lime {
 	}
 
 
+	value lime_audio_load_data_pointer (double data, int length, value buffer) {
+
+		Bytes bytes;
+		bytes.b = (unsigned char*)(uintptr_t)data;
+		bytes.length = length;
+
+		Resource resource = Resource (&bytes);
+		AudioBuffer audioBuffer = AudioBuffer (buffer);
+		value result = alloc_null ();
+
+		if (WAV::Decode (&resource, &audioBuffer)) {
+
+			result = audioBuffer.Value (buffer);
+
+		}
+
+		#ifdef LIME_OGG
+		else if (OGG::Decode (&resource, &audioBuffer)) {
+
+			result = audioBuffer.Value (buffer);
+
+		}
+		#endif
+
+		bytes.b = 0;
+		return result;
+
+	}
+
+
+	HL_PRIM AudioBuffer* HL_NAME(hl_audio_load_data_pointer) (double data, int length, AudioBuffer* buffer) {
+
+		Bytes bytes;
+		bytes.b = (unsigned char*)(uintptr_t)data;
+		bytes.length = length;
+
+		Resource resource = Resource (&bytes);
+		AudioBuffer* result = 0;
+
+		if (WAV::Decode (&resource, buffer)) {
+
+			result = buffer;
+
+		}
+
+		#ifdef LIME_OGG
+		else if (OGG::Decode (&resource, buffer)) {
+
+			result = buffer;
+
+		}
+		#endif
+
+		bytes.b = 0;
+		return result;
+
+	}
+
+
 	value lime_audio_load_file (value data, value buffer) {
 
 		Resource resource;
@@ -764,6 +1095,21 @@ namespace lime {
 	}
 
 
+	void lime_event_queue_register (value callback, value buffer) {
+
+		Bytes bytes (buffer);
+		EventQueue::Register (new ValuePointer (callback), new ValuePointer (buffer), bytes.length);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_event_queue_register) (vclosure* callback, Bytes* buffer) {
+
+		EventQueue::Register (new ValuePointer (callback), new ValuePointer ((vobj*)buffer), buffer->length);
+
+	}
+
+
 	value lime_file_dialog_open_directory (HxString title, HxString filter, HxString defaultPath) {
 
 		#ifdef LIME_TINYFILEDIALOGS
@@ -1098,6 +1444,26 @@ namespace lime {
 	}
 
 
+	void lime_file_watcher_set_options (value handle, double debounce, value batchCallback, bool compareContent) {
+
+		#ifdef LIME_EFSW
+		FileWatcher* watcher = (FileWatcher*)val_data (handle);
+		watcher->SetOptions (debounce, batchCallback, compareContent);
+		#endif
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_file_watcher_set_options) (HL_CFFIPointer* handle, double debounce, vclosure* batchCallback, bool compareContent) {
+
+		// #ifdef LIME_EFSW
+		// FileWatcher* watcher = (FileWatcher*)handle->ptr;
+		// watcher->SetOptions (debounce, batchCallback, compareContent);
+		// #endif
+
+	}
+
+
 	void lime_file_watcher_update (value handle) {
 
 		#ifdef LIME_EFSW
@@ -1448,12 +1814,16 @@ namespace lime {
 	}
 
 
-	value lime_font_load_file (value data) {
+	value lime_font_load_data_pointer (double data, int length) {
 
 		#ifdef LIME_FREETYPE
-		Resource resource = Resource (val_string (data));
+		Bytes bytes;
+		bytes.b = (unsigned char*)(uintptr_t)data;
+		bytes.length = length;
 
+		Resource resource = Resource (&bytes);
 		Font *font = new Font (&resource, 0);
+		bytes.b = 0;
 
 		if (font) {
 
@@ -1475,12 +1845,16 @@ namespace lime {
 	}
 
 
-	HL_PRIM HL_CFFIPointer* HL_NAME(hl_font_load_file) (hl_vstring* data) {
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_font_load_data_pointer) (double data, int length) {
 
 		#ifdef LIME_FREETYPE
-		Resource resource = Resource (data ? hl_to_utf8 ((const uchar*)data->bytes) : NULL);
+		Bytes bytes;
+		bytes.b = (unsigned char*)(uintptr_t)data;
+		bytes.length = length;
 
+		Resource resource = Resource (&bytes);
 		Font *font = new Font (&resource, 0);
+		bytes.b = 0;
 
 		if (font) {
 
@@ -1502,26 +1876,80 @@ namespace lime {
 	}
 
 
-	value lime_font_load (value data) {
+	value lime_font_load_file (value data) {
 
-		if (val_is_string (data)) {
+		#ifdef LIME_FREETYPE
+		Resource resource = Resource (val_string (data));
 
-			return lime_font_load_file (data);
+		Font *font = new Font (&resource, 0);
 
-		} else {
+		if (font) {
 
-			return lime_font_load_bytes (data);
+			if (font->face) {
 
-		}
+				return CFFIPointer (font, gc_font);
 
-	}
+			} else {
 
+				delete font;
 
-	value lime_font_outline_decompose (value fontHandle, int size) {
+			}
 
-		#ifdef LIME_FREETYPE
-		Font *font = (Font*)val_data (fontHandle);
-		return (value)font->Decompose (true, size);
+		}
+		#endif
+
+		return alloc_null ();
+
+	}
+
+
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_font_load_file) (hl_vstring* data) {
+
+		#ifdef LIME_FREETYPE
+		Resource resource = Resource (data ? hl_to_utf8 ((const uchar*)data->bytes) : NULL);
+
+		Font *font = new Font (&resource, 0);
+
+		if (font) {
+
+			if (font->face) {
+
+				return HLCFFIPointer (font, (hl_finalizer)hl_gc_font);
+
+			} else {
+
+				delete font;
+
+			}
+
+		}
+		#endif
+
+		return 0;
+
+	}
+
+
+	value lime_font_load (value data) {
+
+		if (val_is_string (data)) {
+
+			return lime_font_load_file (data);
+
+		} else {
+
+			return lime_font_load_bytes (data);
+
+		}
+
+	}
+
+
+	value lime_font_outline_decompose (value fontHandle, int size) {
+
+		#ifdef LIME_FREETYPE
+		Font *font = (Font*)val_data (fontHandle);
+		return (value)font->Decompose (true, size);
 		#else
 		return alloc_null ();
 		#endif
@@ -1720,6 +2148,49 @@ namespace lime {
 	}
 
 
+	int lime_gamepad_get_states (value buffer) {
+
+		Bytes bytes (buffer);
+		return GamepadState::Read ((GamepadStateRecord*)bytes.b, bytes.length / sizeof (GamepadStateRecord));
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_gamepad_get_states) (Bytes* buffer) {
+
+		return GamepadState::Read ((GamepadStateRecord*)buffer->b, buffer->length / sizeof (GamepadStateRecord));
+
+	}
+
+
+	void lime_gamepad_set_axis_events (bool enabled) {
+
+		GamepadState::axisEvents = enabled;
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_gamepad_set_axis_events) (bool enabled) {
+
+		GamepadState::axisEvents = enabled;
+
+	}
+
+
+	void lime_gamepad_set_motion_sensors (bool enabled) {
+
+		Gamepad::SetMotionSensors (enabled);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_gamepad_set_motion_sensors) (bool enabled) {
+
+		Gamepad::SetMotionSensors (enabled);
+
+	}
+
+
 	value lime_gzip_compress (value buffer, value bytes) {
 
 		#ifdef LIME_ZLIB
@@ -1923,6 +2394,69 @@ namespace lime {
 	}
 
 
+	value lime_image_load_data_pointer (double data, int length, value buffer) {
+
+		Bytes bytes;
+		bytes.b = (unsigned char*)(uintptr_t)data;
+		bytes.length = length;
+
+		Resource resource = Resource (&bytes);
+		ImageBuffer imageBuffer = ImageBuffer (buffer);
+		value result = alloc_null ();
+
+		#ifdef LIME_PNG
+		if (PNG::Decode (&resource, &imageBuffer)) {
+
+			result = imageBuffer.Value (buffer);
+
+		}
+		#endif
+
+		#ifdef LIME_JPEG
+		if (val_is_null (result) && JPEG::Decode (&resource, &imageBuffer)) {
+
+			result = imageBuffer.Value (buffer);
+
+		}
+		#endif
+
+		bytes.b = 0;
+		return result;
+
+	}
+
+
+	HL_PRIM ImageBuffer* HL_NAME(hl_image_load_data_pointer) (double data, int length, ImageBuffer* buffer) {
+
+		Bytes bytes;
+		bytes.b = (unsigned char*)(uintptr_t)data;
+		bytes.length = length;
+
+		Resource resource = Resource (&bytes);
+		ImageBuffer* result = 0;
+
+		#ifdef LIME_PNG
+		if (PNG::Decode (&resource, buffer)) {
+
+			result = buffer;
+
+		}
+		#endif
+
+		#ifdef LIME_JPEG
+		if (!result && JPEG::Decode (&resource, buffer)) {
+
+			result = buffer;
+
+		}
+		#endif
+
+		bytes.b = 0;
+		return result;
+
+	}
+
+
 	value lime_image_load_file (value data, value buffer) {
 
 		Resource resource = Resource (val_string (data));
@@ -2658,72 +3192,331 @@ namespace lime {
 	}
 
 
-	value lime_lzma_decompress (value buffer, value bytes) {
+	value lime_lzma_decompress (value buffer, value bytes) {
+
+		#ifdef LIME_LZMA
+		Bytes data (buffer);
+		Bytes result (bytes);
+
+		LZMA::Decompress (&data, &result);
+
+		return result.Value (bytes);
+		#else
+		return alloc_null ();
+		#endif
+
+	}
+
+
+	HL_PRIM Bytes* HL_NAME(hl_lzma_decompress) (Bytes* buffer, Bytes* bytes) {
+
+		#ifdef LIME_LZMA
+		LZMA::Decompress (buffer, bytes);
+		return bytes;
+		#else
+		return 0;
+		#endif
+
+	}
+
+
+	void lime_mapped_file_close (value handle) {
+
+		MappedFile* file = (MappedFile*)val_data (handle);
+		file->Close ();
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_mapped_file_close) (HL_CFFIPointer* handle) {
+
+		MappedFile* file = (MappedFile*)handle->ptr;
+		file->Close ();
+
+	}
+
+
+	double lime_mapped_file_get_data_pointer (value handle) {
+
+		MappedFile* file = (MappedFile*)val_data (handle);
+		return (uintptr_t)file->GetData ();
+
+	}
+
+
+	HL_PRIM double HL_NAME(hl_mapped_file_get_data_pointer) (HL_CFFIPointer* handle) {
+
+		MappedFile* file = (MappedFile*)handle->ptr;
+		return (uintptr_t)file->GetData ();
+
+	}
+
+
+	double lime_mapped_file_get_length (value handle) {
+
+		MappedFile* file = (MappedFile*)val_data (handle);
+		return file->GetLength ();
+
+	}
+
+
+	HL_PRIM double HL_NAME(hl_mapped_file_get_length) (HL_CFFIPointer* handle) {
+
+		MappedFile* file = (MappedFile*)handle->ptr;
+		return file->GetLength ();
+
+	}
+
+
+	value lime_mapped_file_open (HxString path) {
+
+		MappedFile* file = MappedFile::Open (hxs_utf8 (path, nullptr));
+		if (!file) return alloc_null ();
+		return CFFIPointer (file, gc_mapped_file);
+
+	}
+
+
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_mapped_file_open) (hl_vstring* path) {
+
+		MappedFile* file = MappedFile::Open (path ? hl_to_utf8 ((const uchar*)path->bytes) : NULL);
+		if (!file) return 0;
+		return HLCFFIPointer (file, (hl_finalizer)hl_gc_mapped_file);
+
+	}
+
+
+	void lime_mapped_file_release_view (double data) {
+
+		MappedFile::ReleaseView ((const void*)(uintptr_t)data);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_mapped_file_release_view) (double data) {
+
+		MappedFile::ReleaseView ((const void*)(uintptr_t)data);
+
+	}
+
+
+	bool lime_mapped_file_retain_view (value handle) {
+
+		MappedFile* file = (MappedFile*)val_data (handle);
+		return file->RetainView ();
+
+	}
+
+
+	HL_PRIM bool HL_NAME(hl_mapped_file_retain_view) (HL_CFFIPointer* handle) {
+
+		MappedFile* file = (MappedFile*)handle->ptr;
+		return file->RetainView ();
+
+	}
+
+
+	int lime_motion_coalescer_get_history (value buffer) {
+
+		Bytes bytes (buffer);
+		return MotionCoalescer::GetHistory ((MotionSample*)bytes.b, bytes.length / sizeof (MotionSample));
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_motion_coalescer_get_history) (Bytes* buffer) {
+
+		return MotionCoalescer::GetHistory ((MotionSample*)buffer->b, buffer->length / sizeof (MotionSample));
+
+	}
+
+
+	void lime_motion_coalescer_set_enabled (bool enabled) {
+
+		if (!enabled) MotionCoalescer::Flush ();
+		MotionCoalescer::enabled = enabled;
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_motion_coalescer_set_enabled) (bool enabled) {
+
+		if (!enabled) MotionCoalescer::Flush ();
+		MotionCoalescer::enabled = enabled;
+
+	}
+
+
+	void lime_mouse_event_manager_register (value callback, value eventObject) {
+
+		MouseEvent::callback = new ValuePointer (callback);
+		MouseEvent::eventObject = new ValuePointer (eventObject);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_mouse_event_manager_register) (vclosure* callback, MouseEvent* eventObject) {
+
+		MouseEvent::callback = new ValuePointer (callback);
+		MouseEvent::eventObject = new ValuePointer ((vobj*)eventObject);
+
+	}
+
+
+	void lime_neko_execute (HxString module) {
+
+		#ifdef LIME_NEKO
+		NekoVM::Execute (module.c_str ());
+		#endif
+
+	}
+
+
+	void lime_orientation_event_manager_register (value callback, value eventObject) {
+
+		OrientationEvent::callback = new ValuePointer (callback);
+		OrientationEvent::eventObject = new ValuePointer (eventObject);
+		System::EnableDeviceOrientationChange(true);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_orientation_event_manager_register) (vclosure* callback, OrientationEvent* eventObject) {
+
+		OrientationEvent::callback = new ValuePointer (callback);
+		OrientationEvent::eventObject = new ValuePointer ((vobj*)eventObject);
+
+	}
+
+
+	value lime_packed_asset_loader_create (int threads) {
+
+		PackedAssetLoader* loader = new PackedAssetLoader (threads);
+		return CFFIPointer (loader, gc_packed_asset_loader);
+
+	}
+
+
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_packed_asset_loader_create) (int threads) {
+
+		PackedAssetLoader* loader = new PackedAssetLoader (threads);
+		return HLCFFIPointer (loader, (hl_finalizer)hl_gc_packed_asset_loader);
+
+	}
+
+
+	value lime_packed_asset_loader_read (value handle) {
+
+		PackedAssetLoader* loader = (PackedAssetLoader*)val_data (handle);
+		PackedAssetLoad* load = loader->Read ();
+
+		if (!load) return alloc_null ();
+
+		const field id_id = val_id ("id");
+		const field id_length = val_id ("length");
+		const field id_pointer = val_id ("pointer");
+
+		value result = alloc_empty_object ();
+		alloc_field (result, id_id, alloc_int (load->id));
+		alloc_field (result, id_length, alloc_int (load->length));
+		alloc_field (result, id_pointer, alloc_float ((uintptr_t)(load->data ? load->data : load->source)));
+		return result;
+
+	}
+
+
+	HL_PRIM vdynamic* HL_NAME(hl_packed_asset_loader_read) (HL_CFFIPointer* handle, vdynamic* result) {
 
-		#ifdef LIME_LZMA
-		Bytes data (buffer);
-		Bytes result (bytes);
+		PackedAssetLoader* loader = (PackedAssetLoader*)handle->ptr;
+		PackedAssetLoad* load = loader->Read ();
 
-		LZMA::Decompress (&data, &result);
+		if (!load) return NULL;
 
-		return result.Value (bytes);
-		#else
-		return alloc_null ();
-		#endif
+		const int id_id = hl_hash_utf8 ("id");
+		const int id_length = hl_hash_utf8 ("length");
+		const int id_pointer = hl_hash_utf8 ("pointer");
+
+		hl_dyn_seti (result, id_id, &hlt_i32, load->id);
+		hl_dyn_seti (result, id_length, &hlt_i32, load->length);
+		hl_dyn_setd (result, id_pointer, (uintptr_t)(load->data ? load->data : load->source));
+		return result;
 
 	}
 
 
-	HL_PRIM Bytes* HL_NAME(hl_lzma_decompress) (Bytes* buffer, Bytes* bytes) {
+	value lime_packed_asset_loader_read_audio (value handle, value buffer) {
 
-		#ifdef LIME_LZMA
-		LZMA::Decompress (buffer, bytes);
-		return bytes;
-		#else
-		return 0;
-		#endif
+		PackedAssetLoader* loader = (PackedAssetLoader*)val_data (handle);
+		PackedAssetLoad* load = loader->GetCurrent ();
+
+		if (!load || !load->audio || load->length < 0) return alloc_null ();
+		return load->audio->Value (buffer);
 
 	}
 
 
-	void lime_mouse_event_manager_register (value callback, value eventObject) {
+	HL_PRIM AudioBuffer* HL_NAME(hl_packed_asset_loader_read_audio) (HL_CFFIPointer* handle, AudioBuffer* buffer) {
 
-		MouseEvent::callback = new ValuePointer (callback);
-		MouseEvent::eventObject = new ValuePointer (eventObject);
+		PackedAssetLoader* loader = (PackedAssetLoader*)handle->ptr;
+		PackedAssetLoad* load = loader->GetCurrent ();
+
+		if (!load || !load->audio || load->length < 0 || !buffer || !buffer->data) return NULL;
+
+		AudioBuffer* audio = load->audio;
+		buffer->bitsPerSample = audio->bitsPerSample;
+		buffer->channels = audio->channels;
+		buffer->sampleRate = audio->sampleRate;
+		buffer->data->Resize (audio->data->byteLength);
+		if (audio->data->byteLength > 0) memcpy (buffer->data->buffer->b, audio->data->buffer->b, audio->data->byteLength);
+		return buffer;
 
 	}
 
 
-	HL_PRIM void HL_NAME(hl_mouse_event_manager_register) (vclosure* callback, MouseEvent* eventObject) {
+	value lime_packed_asset_loader_read_image (value handle, value buffer) {
 
-		MouseEvent::callback = new ValuePointer (callback);
-		MouseEvent::eventObject = new ValuePointer ((vobj*)eventObject);
+		PackedAssetLoader* loader = (PackedAssetLoader*)val_data (handle);
+		PackedAssetLoad* load = loader->GetCurrent ();
+
+		if (!load || !load->image || load->length < 0) return alloc_null ();
+		return load->image->Value (buffer);
 
 	}
 
 
-	void lime_neko_execute (HxString module) {
+	HL_PRIM ImageBuffer* HL_NAME(hl_packed_asset_loader_read_image) (HL_CFFIPointer* handle, ImageBuffer* buffer) {
 
-		#ifdef LIME_NEKO
-		NekoVM::Execute (module.c_str ());
-		#endif
+		PackedAssetLoader* loader = (PackedAssetLoader*)handle->ptr;
+		PackedAssetLoad* load = loader->GetCurrent ();
+
+		if (!load || !load->image || load->length < 0 || !buffer || !buffer->data) return NULL;
+
+		ImageBuffer* image = load->image;
+		buffer->bitsPerPixel = image->bitsPerPixel;
+		buffer->format = image->format;
+		buffer->height = image->height;
+		buffer->premultiplied = image->premultiplied;
+		buffer->transparent = image->transparent;
+		buffer->width = image->width;
+		buffer->data->Resize (image->data->byteLength);
+		if (image->data->byteLength > 0) memcpy (buffer->data->buffer->b, image->data->buffer->b, image->data->byteLength);
+		return buffer;
 
 	}
 
 
-	void lime_orientation_event_manager_register (value callback, value eventObject) {
+	int lime_packed_asset_loader_submit (value handle, double data, int length, int compression, int decode) {
 
-		OrientationEvent::callback = new ValuePointer (callback);
-		OrientationEvent::eventObject = new ValuePointer (eventObject);
-		System::EnableDeviceOrientationChange(true);
+		PackedAssetLoader* loader = (PackedAssetLoader*)val_data (handle);
+		return loader->Submit ((const unsigned char*)(uintptr_t)data, length, compression, decode);
 
 	}
 
 
-	HL_PRIM void HL_NAME(hl_orientation_event_manager_register) (vclosure* callback, OrientationEvent* eventObject) {
+	HL_PRIM int HL_NAME(hl_packed_asset_loader_submit) (HL_CFFIPointer* handle, double data, int length, int compression, int decode) {
 
-		OrientationEvent::callback = new ValuePointer (callback);
-		OrientationEvent::eventObject = new ValuePointer ((vobj*)eventObject);
+		PackedAssetLoader* loader = (PackedAssetLoader*)handle->ptr;
+		return loader->Submit ((const unsigned char*)(uintptr_t)data, length, compression, decode);
 
 	}
 
@@ -3288,6 +4081,129 @@ namespace lime {
 	}
 
 
+	value lime_wav_stream_from_file (HxString path) {
+
+		WAVStream* stream = WAVStream::FromFile (path.c_str ());
+
+		if (stream) {
+
+			return CFFIPointer (stream, gc_wav_stream);
+
+		}
+
+		return alloc_null ();
+
+	}
+
+
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_wav_stream_from_file) (hl_vstring* path) {
+
+		WAVStream* stream = WAVStream::FromFile (path ? hl_to_utf8 ((const uchar*)path->bytes) : NULL);
+
+		if (stream) {
+
+			return HLCFFIPointer (stream, (hl_finalizer)hl_gc_wav_stream);
+
+		}
+
+		return NULL;
+
+	}
+
+
+	value lime_wav_stream_info (value handle) {
+
+		WAVStream* stream = (WAVStream*)val_data (handle);
+
+		value ret = alloc_empty_object ();
+		alloc_field (ret, val_id ("bitsPerSample"), alloc_int (stream->bitsPerSample));
+		alloc_field (ret, val_id ("channels"), alloc_int (stream->channels));
+		alloc_field (ret, val_id ("length"), alloc_float ((double)stream->length));
+		alloc_field (ret, val_id ("sampleRate"), alloc_int (stream->sampleRate));
+		return ret;
+
+	}
+
+
+	HL_PRIM vdynamic* HL_NAME(hl_wav_stream_info) (HL_CFFIPointer* handle) {
+
+		WAVStream* stream = (WAVStream*)handle->ptr;
+
+		vdynamic* ret = (vdynamic*)hl_alloc_dynobj ();
+		hl_dyn_seti (ret, hl_hash_utf8 ("bitsPerSample"), &hlt_i32, stream->bitsPerSample);
+		hl_dyn_seti (ret, hl_hash_utf8 ("channels"), &hlt_i32, stream->channels);
+		hl_dyn_setd (ret, hl_hash_utf8 ("length"), (double)stream->length);
+		hl_dyn_seti (ret, hl_hash_utf8 ("sampleRate"), &hlt_i32, stream->sampleRate);
+		return ret;
+
+	}
+
+
+	int lime_wav_stream_read (value handle, value buffer, int position, int length) {
+
+		WAVStream* stream = (WAVStream*)val_data (handle);
+
+		Bytes bytes;
+		bytes.Set (buffer);
+
+		if (position < 0 || length < 0 || position + length > bytes.length) {
+
+			return 0;
+
+		}
+
+		return stream->Read (bytes.b + position, length);
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_wav_stream_read) (HL_CFFIPointer* handle, Bytes* buffer, int position, int length) {
+
+		WAVStream* stream = (WAVStream*)handle->ptr;
+
+		if (!buffer || position < 0 || length < 0 || position + length > buffer->length) {
+
+			return 0;
+
+		}
+
+		return stream->Read (buffer->b + position, length);
+
+	}
+
+
+	bool lime_wav_stream_seek (value handle, double frame) {
+
+		WAVStream* stream = (WAVStream*)val_data (handle);
+		return stream->Seek ((int64_t)frame);
+
+	}
+
+
+	HL_PRIM bool HL_NAME(hl_wav_stream_seek) (HL_CFFIPointer* handle, double frame) {
+
+		WAVStream* stream = (WAVStream*)handle->ptr;
+		return stream->Seek ((int64_t)frame);
+
+	}
+
+
+	double lime_wav_stream_tell (value handle) {
+
+		WAVStream* stream = (WAVStream*)val_data (handle);
+		return (double)stream->Tell ();
+
+	}
+
+
+	HL_PRIM double HL_NAME(hl_wav_stream_tell) (HL_CFFIPointer* handle) {
+
+		WAVStream* stream = (WAVStream*)handle->ptr;
+		return (double)stream->Tell ();
+
+	}
+
+
 	void lime_window_alert (value window, HxString message, HxString title) {
 
 		Window* targetWindow = (Window*)val_data (window);
@@ -3639,6 +4555,54 @@ namespace lime {
 	}
 
 
+	void lime_window_inject_key_event (value window, int type, int keyCode, int modifier) {
+
+		Window* targetWindow = (Window*)val_data (window);
+		targetWindow->InjectKeyEvent (type, keyCode, modifier);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_window_inject_key_event) (HL_CFFIPointer* window, int type, int keyCode, int modifier) {
+
+		Window* targetWindow = (Window*)window->ptr;
+		targetWindow->InjectKeyEvent (type, keyCode, modifier);
+
+	}
+
+
+	void lime_window_inject_mouse_event (value window, int type, double x, double y, int button) {
+
+		Window* targetWindow = (Window*)val_data (window);
+		targetWindow->InjectMouseEvent (type, x, y, button);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_window_inject_mouse_event) (HL_CFFIPointer* window, int type, double x, double y, int button) {
+
+		Window* targetWindow = (Window*)window->ptr;
+		targetWindow->InjectMouseEvent (type, x, y, button);
+
+	}
+
+
+	void lime_window_inject_text_event (value window, HxString text) {
+
+		Window* targetWindow = (Window*)val_data (window);
+		targetWindow->InjectTextEvent (hxs_utf8 (text, nullptr));
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_window_inject_text_event) (HL_CFFIPointer* window, hl_vstring* text) {
+
+		Window* targetWindow = (Window*)window->ptr;
+		targetWindow->InjectTextEvent (text ? (char*)hl_to_utf8 ((const uchar*)text->bytes) : 0);
+
+	}
+
+
 	void lime_window_move (value window, int x, int y) {
 
 		Window* targetWindow = (Window*)val_data (window);
@@ -3695,6 +4659,58 @@ namespace lime {
 	}
 
 
+	int lime_window_read_pixels_async (value window, value rect) {
+
+		Window* targetWindow = (Window*)val_data (window);
+
+		if (!val_is_null (rect)) {
+
+			Rectangle _rect = Rectangle (rect);
+			return targetWindow->ReadPixelsAsync (&_rect);
+
+		} else {
+
+			return targetWindow->ReadPixelsAsync (NULL);
+
+		}
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_window_read_pixels_async) (HL_CFFIPointer* window, Rectangle* rect) {
+
+		Window* targetWindow = (Window*)window->ptr;
+		return targetWindow->ReadPixelsAsync (rect);
+
+	}
+
+
+	int lime_window_read_pixels_async_result (value window, int id, value imageBuffer) {
+
+		Window* targetWindow = (Window*)val_data (window);
+		ImageBuffer buffer (imageBuffer);
+
+		int status = targetWindow->ReadPixelsAsyncResult (id, &buffer);
+
+		if (status > 0) {
+
+			buffer.Value (imageBuffer);
+
+		}
+
+		return status;
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_window_read_pixels_async_result) (HL_CFFIPointer* window, int id, ImageBuffer* imageBuffer) {
+
+		Window* targetWindow = (Window*)window->ptr;
+		return targetWindow->ReadPixelsAsyncResult (id, imageBuffer);
+
+	}
+
+
 	void lime_window_resize (value window, int width, int height) {
 
 		Window* targetWindow = (Window*)val_data (window);
@@ -3775,6 +4791,22 @@ namespace lime {
 	}
 
 
+	void lime_window_set_dirty_rects (value window, double rects, int count) {
+
+		Window* targetWindow = (Window*)val_data (window);
+		targetWindow->SetDirtyRects ((const int*)(uintptr_t)rects, count);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_window_set_dirty_rects) (HL_CFFIPointer* window, double rects, int count) {
+
+		Window* targetWindow = (Window*)window->ptr;
+		targetWindow->SetDirtyRects ((const int*)(uintptr_t)rects, count);
+
+	}
+
+
 	value lime_window_set_display_mode (value window, value displayMode) {
 
 		Window* targetWindow = (Window*)val_data (window);
@@ -4090,15 +5122,81 @@ namespace lime {
 	}
 
 
+	value lime_zstd_compress (value buffer, value bytes) {
+
+		#ifdef LIME_ZSTD
+		Bytes data (buffer);
+		Bytes result (bytes);
+
+		Zstd::Compress (&data, &result);
+
+		return result.Value (bytes);
+		#else
+		return alloc_null ();
+		#endif
+
+	}
+
+
+	HL_PRIM Bytes* HL_NAME(hl_zstd_compress) (Bytes* buffer, Bytes* bytes) {
+
+		#ifdef LIME_ZSTD
+		Zstd::Compress (buffer, bytes);
+		return bytes;
+		#else
+		return 0;
+		#endif
+
+	}
+
+
+	value lime_zstd_decompress (value buffer, value bytes) {
+
+		#ifdef LIME_ZSTD
+		Bytes data (buffer);
+		Bytes result (bytes);
+
+		Zstd::Decompress (&data, &result);
+
+		return result.Value (bytes);
+		#else
+		return alloc_null ();
+		#endif
+
+	}
+
+
+	HL_PRIM Bytes* HL_NAME(hl_zstd_decompress) (Bytes* buffer, Bytes* bytes) {
+
+		#ifdef LIME_ZSTD
+		Zstd::Decompress (buffer, bytes);
+		return bytes;
+		#else
+		return 0;
+		#endif
+
+	}
+
+
 	DEFINE_PRIME0 (lime_application_create);
 	DEFINE_PRIME2v (lime_application_event_manager_register);
 	DEFINE_PRIME1 (lime_application_exec);
+	DEFINE_PRIME1 (lime_application_get_frame_stats);
 	DEFINE_PRIME1v (lime_application_init);
 	DEFINE_PRIME1 (lime_application_quit);
+	DEFINE_PRIME2v (lime_application_set_fixed_time_step);
+	DEFINE_PRIME2v (lime_application_set_frame_pacing);
 	DEFINE_PRIME2v (lime_application_set_frame_rate);
+	DEFINE_PRIME2v (lime_application_set_precise_input);
 	DEFINE_PRIME1 (lime_application_update);
+	DEFINE_PRIME2v (lime_async_file_reader_cancel);
+	DEFINE_PRIME1 (lime_async_file_reader_create);
+	DEFINE_PRIME1 (lime_async_file_reader_read);
+	DEFINE_PRIME2v (lime_async_file_reader_read_data);
+	DEFINE_PRIME4 (lime_async_file_reader_submit);
 	DEFINE_PRIME2 (lime_audio_load);
 	DEFINE_PRIME2 (lime_audio_load_bytes);
+	DEFINE_PRIME3 (lime_audio_load_data_pointer);
 	DEFINE_PRIME2 (lime_audio_load_file);
 	DEFINE_PRIME3 (lime_bytes_from_data_pointer);
 	DEFINE_PRIME1 (lime_bytes_get_data_pointer);
@@ -4113,6 +5211,7 @@ namespace lime {
 	DEFINE_PRIME2 (lime_deflate_compress);
 	DEFINE_PRIME2 (lime_deflate_decompress);
 	DEFINE_PRIME2v (lime_drop_event_manager_register);
+	DEFINE_PRIME2v (lime_event_queue_register);
 	DEFINE_PRIME3 (lime_file_dialog_open_directory);
 	DEFINE_PRIME3 (lime_file_dialog_open_file);
 	DEFINE_PRIME3 (lime_file_dialog_open_files);
@@ -4120,6 +5219,7 @@ namespace lime {
 	DEFINE_PRIME1 (lime_file_watcher_create);
 	DEFINE_PRIME3 (lime_file_watcher_add_directory);
 	DEFINE_PRIME2v (lime_file_watcher_remove_directory);
+	DEFINE_PRIME4v (lime_file_watcher_set_options);
 	DEFINE_PRIME1v (lime_file_watcher_update);
 	DEFINE_PRIME1 (lime_font_get_ascender);
 	DEFINE_PRIME1 (lime_font_get_descender);
@@ -4134,6 +5234,7 @@ namespace lime {
 	DEFINE_PRIME1 (lime_font_get_units_per_em);
 	DEFINE_PRIME1 (lime_font_load);
 	DEFINE_PRIME1 (lime_font_load_bytes);
+	DEFINE_PRIME2 (lime_font_load_data_pointer);
 	DEFINE_PRIME1 (lime_font_load_file);
 	DEFINE_PRIME2 (lime_font_outline_decompose);
 	DEFINE_PRIME3 (lime_font_render_glyph);
@@ -4143,6 +5244,9 @@ namespace lime {
 	DEFINE_PRIME2v (lime_gamepad_event_manager_register);
 	DEFINE_PRIME1 (lime_gamepad_get_device_guid);
 	DEFINE_PRIME1 (lime_gamepad_get_device_name);
+	DEFINE_PRIME1 (lime_gamepad_get_states);
+	DEFINE_PRIME1v (lime_gamepad_set_axis_events);
+	DEFINE_PRIME1v (lime_gamepad_set_motion_sensors);
 	DEFINE_PRIME2 (lime_gzip_compress);
 	DEFINE_PRIME2 (lime_gzip_decompress);
 	DEFINE_PRIME2v (lime_haptic_vibrate);
@@ -4162,6 +5266,7 @@ namespace lime {
 	DEFINE_PRIME4 (lime_image_encode);
 	DEFINE_PRIME2 (lime_image_load);
 	DEFINE_PRIME2 (lime_image_load_bytes);
+	DEFINE_PRIME3 (lime_image_load_data_pointer);
 	DEFINE_PRIME2 (lime_image_load_file);
 	DEFINE_PRIME0 (lime_jni_getenv);
 	DEFINE_PRIME1 (lime_documentsystem_create);
@@ -4187,9 +5292,22 @@ namespace lime {
 	DEFINE_PRIME0 (lime_locale_get_system_locale);
 	DEFINE_PRIME2 (lime_lzma_compress);
 	DEFINE_PRIME2 (lime_lzma_decompress);
+	DEFINE_PRIME1v (lime_mapped_file_close);
+	DEFINE_PRIME1 (lime_mapped_file_get_data_pointer);
+	DEFINE_PRIME1 (lime_mapped_file_get_length);
+	DEFINE_PRIME1 (lime_mapped_file_open);
+	DEFINE_PRIME1v (lime_mapped_file_release_view);
+	DEFINE_PRIME1 (lime_mapped_file_retain_view);
+	DEFINE_PRIME1 (lime_motion_coalescer_get_history);
+	DEFINE_PRIME1v (lime_motion_coalescer_set_enabled);
 	DEFINE_PRIME2v (lime_mouse_event_manager_register);
 	DEFINE_PRIME1v (lime_neko_execute);
 	DEFINE_PRIME2v (lime_orientation_event_manager_register);
+	DEFINE_PRIME1 (lime_packed_asset_loader_create);
+	DEFINE_PRIME1 (lime_packed_asset_loader_read);
+	DEFINE_PRIME2 (lime_packed_asset_loader_read_audio);
+	DEFINE_PRIME2 (lime_packed_asset_loader_read_image);
+	DEFINE_PRIME5 (lime_packed_asset_loader_submit);
 	DEFINE_PRIME3 (lime_png_decode_bytes);
 	DEFINE_PRIME3 (lime_png_decode_file);
 	DEFINE_PRIME2v (lime_render_event_manager_register);
@@ -4213,6 +5331,11 @@ namespace lime {
 	DEFINE_PRIME2 (lime_system_set_windows_console_mode);
 	DEFINE_PRIME2v (lime_text_event_manager_register);
 	DEFINE_PRIME2v (lime_touch_event_manager_register);
+	DEFINE_PRIME1 (lime_wav_stream_from_file);
+	DEFINE_PRIME1 (lime_wav_stream_info);
+	DEFINE_PRIME4 (lime_wav_stream_read);
+	DEFINE_PRIME2 (lime_wav_stream_seek);
+	DEFINE_PRIME1 (lime_wav_stream_tell);
 	DEFINE_PRIME3v (lime_window_alert);
 	DEFINE_PRIME1v (lime_window_close);
 	DEFINE_PRIME1v (lime_window_context_flip);
@@ -4234,13 +5357,19 @@ namespace lime {
 	DEFINE_PRIME1 (lime_window_get_width);
 	DEFINE_PRIME1 (lime_window_get_x);
 	DEFINE_PRIME1 (lime_window_get_y);
+	DEFINE_PRIME4v (lime_window_inject_key_event);
+	DEFINE_PRIME5v (lime_window_inject_mouse_event);
+	DEFINE_PRIME2v (lime_window_inject_text_event);
 	DEFINE_PRIME3v (lime_window_move);
 	DEFINE_PRIME3 (lime_window_read_pixels);
+	DEFINE_PRIME2 (lime_window_read_pixels_async);
+	DEFINE_PRIME3 (lime_window_read_pixels_async_result);
 	DEFINE_PRIME3v (lime_window_resize);
 	DEFINE_PRIME3v (lime_window_set_minimum_size);
 	DEFINE_PRIME3v (lime_window_set_maximum_size);
 	DEFINE_PRIME2 (lime_window_set_borderless);
 	DEFINE_PRIME2v (lime_window_set_cursor);
+	DEFINE_PRIME3v (lime_window_set_dirty_rects);
 	DEFINE_PRIME2 (lime_window_set_display_mode);
 	DEFINE_PRIME2 (lime_window_set_fullscreen);
 	DEFINE_PRIME2v (lime_window_set_icon);
@@ -4258,6 +5387,8 @@ namespace lime {
 	DEFINE_PRIME2v (lime_window_set_opacity);
 	DEFINE_PRIME2 (lime_zlib_compress);
 	DEFINE_PRIME2 (lime_zlib_decompress);
+	DEFINE_PRIME2 (lime_zstd_compress);
+	DEFINE_PRIME2 (lime_zstd_decompress);
 
 
 	#define _ENUM "?"
@@ -4268,23 +5399,23 @@ namespace lime {
 	#define _TCLIPBOARD_EVENT _OBJ (_I32)
 	#define _TDISPLAYMODE _OBJ (_I32 _I32 _I32 _I32)
 	#define _TDROP_EVENT _OBJ (_BYTES _I32)
-	#define _TGAMEPAD_EVENT _OBJ (_I32 _I32 _I32 _I32 _F64)
-	#define _TJOYSTICK_EVENT _OBJ (_I32 _I32 _I32 _I32 _F64 _F64)
-	#define _TKEY_EVENT _OBJ (_F64 _I32 _I32 _I32)
-	#define _TMOUSE_EVENT _OBJ (_I32 _F64 _F64 _I32 _I32 _F64 _F64 _I32)
+	#define _TGAMEPAD_EVENT _OBJ (_I32 _I32 _I32 _I32 _F64 _F64)
+	#define _TJOYSTICK_EVENT _OBJ (_I32 _I32 _I32 _I32 _F64 _F64 _F64)
+	#define _TKEY_EVENT _OBJ (_F64 _I32 _I32 _I32 _F64)
+	#define _TMOUSE_EVENT _OBJ (_I32 _F64 _F64 _I32 _I32 _F64 _F64 _I32 _F64)
 	#define _TORIENTATION_EVENT _OBJ (_I32 _I32 _I32)
 	#define _TRECTANGLE _OBJ (_F64 _F64 _F64 _F64)
 	#define _TRENDER_EVENT _OBJ (_I32)
 	#define _TSENSOR_EVENT _OBJ (_I32 _F64 _F64 _F64 _I32)
 	#define _TTEXT_EVENT _OBJ (_I32 _I32 _I32 _BYTES _I32 _I32)
-	#define _TTOUCH_EVENT _OBJ (_I32 _F64 _F64 _I32 _F64 _I32 _F64 _F64)
+	#define _TTOUCH_EVENT _OBJ (_I32 _F64 _F64 _I32 _F64 _I32 _F64 _F64 _F64)
 	#define _TVECTOR2 _OBJ (_F64 _F64)
 	#define _TVORBISFILE _OBJ (_I32 _DYN)
 	#define _TWINDOW_EVENT _OBJ (_I32 _I32 _I32 _I32 _I32 _I32)
 
 	#define _TARRAYBUFFER _TBYTES
 	#define _TARRAYBUFFERVIEW _OBJ (_I32 _TARRAYBUFFER _I32 _I32 _I32 _I32)
-	#define _TAUDIOBUFFER _OBJ (_I32 _I32 _TARRAYBUFFERVIEW _I32 _DYN _DYN _DYN _DYN _DYN _TVORBISFILE)
+	#define _TAUDIOBUFFER _OBJ (_I32 _I32 _TARRAYBUFFERVIEW _I32 _DYN _DYN _DYN _DYN _DYN _TVORBISFILE _DYN)
 	#define _TIMAGEBUFFER _OBJ (_I32 _TARRAYBUFFERVIEW _I32 _I32 _BOOL _BOOL _I32 _DYN _DYN _DYN _DYN _DYN _DYN)
 	#define _TIMAGE _OBJ (_TIMAGEBUFFER _BOOL _I32 _I32 _I32 _TRECTANGLE _ENUM _I32 _I32 _F64 _F64)
 
@@ -4295,11 +5426,21 @@ namespace lime {
 	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_application_create, _NO_ARG);
 	DEFINE_HL_PRIM (_VOID, hl_application_event_manager_register, _FUN(_VOID, _NO_ARG) _TAPPLICATION_EVENT);
 	DEFINE_HL_PRIM (_I32, hl_application_exec, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_DYN, hl_application_get_frame_stats, _TCFFIPOINTER);
 	DEFINE_HL_PRIM (_VOID, hl_application_init, _TCFFIPOINTER);
 	DEFINE_HL_PRIM (_I32, hl_application_quit, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_VOID, hl_application_set_fixed_time_step, _TCFFIPOINTER _F64);
+	DEFINE_HL_PRIM (_VOID, hl_application_set_frame_pacing, _TCFFIPOINTER _I32);
 	DEFINE_HL_PRIM (_VOID, hl_application_set_frame_rate, _TCFFIPOINTER _F64);
+	DEFINE_HL_PRIM (_VOID, hl_application_set_precise_input, _TCFFIPOINTER _BOOL);
 	DEFINE_HL_PRIM (_BOOL, hl_application_update, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_VOID, hl_async_file_reader_cancel, _TCFFIPOINTER _I32);
+	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_async_file_reader_create, _I32);
+	DEFINE_HL_PRIM (_DYN, hl_async_file_reader_read, _TCFFIPOINTER _DYN);
+	DEFINE_HL_PRIM (_VOID, hl_async_file_reader_read_data, _TCFFIPOINTER _TBYTES);
+	DEFINE_HL_PRIM (_I32, hl_async_file_reader_submit, _TCFFIPOINTER _STRING _F64 _I32);
 	DEFINE_HL_PRIM (_TAUDIOBUFFER, hl_audio_load_bytes, _TBYTES _TAUDIOBUFFER);
+	DEFINE_HL_PRIM (_TAUDIOBUFFER, hl_audio_load_data_pointer, _F64 _I32 _TAUDIOBUFFER);
 	DEFINE_HL_PRIM (_TAUDIOBUFFER, hl_audio_load_file, _STRING _TAUDIOBUFFER);
 	DEFINE_HL_PRIM (_TBYTES, hl_bytes_from_data_pointer, _F64 _I32 _TBYTES);
 	DEFINE_HL_PRIM (_F64, hl_bytes_get_data_pointer, _TBYTES);
@@ -4314,6 +5455,7 @@ namespace lime {
 	DEFINE_HL_PRIM (_TBYTES, hl_deflate_compress, _TBYTES _TBYTES);
 	DEFINE_HL_PRIM (_TBYTES, hl_deflate_decompress, _TBYTES _TBYTES);
 	DEFINE_HL_PRIM (_VOID, hl_drop_event_manager_register, _FUN(_VOID, _NO_ARG) _TDROP_EVENT);
+	DEFINE_HL_PRIM (_VOID, hl_event_queue_register, _FUN(_VOID, _NO_ARG) _TBYTES);
 	DEFINE_HL_PRIM (_BYTES, hl_file_dialog_open_directory, _STRING _STRING _STRING);
 	DEFINE_HL_PRIM (_BYTES, hl_file_dialog_open_file, _STRING _STRING _STRING);
 	DEFINE_HL_PRIM (_ARR, hl_file_dialog_open_files, _STRING _STRING _STRING);
@@ -4321,6 +5463,7 @@ namespace lime {
 	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_file_watcher_create, _DYN);
 	DEFINE_HL_PRIM (_I32, hl_file_watcher_add_directory, _TCFFIPOINTER _STRING _BOOL);
 	DEFINE_HL_PRIM (_VOID, hl_file_watcher_remove_directory, _TCFFIPOINTER _I32);
+	DEFINE_HL_PRIM (_VOID, hl_file_watcher_set_options, _TCFFIPOINTER _F64 _DYN _BOOL);
 	DEFINE_HL_PRIM (_VOID, hl_file_watcher_update, _TCFFIPOINTER);
 	DEFINE_HL_PRIM (_I32, hl_font_get_ascender, _TCFFIPOINTER);
 	DEFINE_HL_PRIM (_I32, hl_font_get_descender, _TCFFIPOINTER);
@@ -4335,6 +5478,7 @@ namespace lime {
 	DEFINE_HL_PRIM (_I32, hl_font_get_units_per_em, _TCFFIPOINTER);
 	// DEFINE_PRIME1 (lime_font_load);
 	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_font_load_bytes, _TBYTES);
+	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_font_load_data_pointer, _F64 _I32);
 	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_font_load_file, _STRING);
 	DEFINE_HL_PRIM (_DYN, hl_font_outline_decompose, _TCFFIPOINTER _I32);
 	DEFINE_HL_PRIM (_TBYTES, hl_font_render_glyph, _TCFFIPOINTER _I32 _TBYTES);
@@ -4344,6 +5488,9 @@ namespace lime {
 	DEFINE_HL_PRIM (_VOID, hl_gamepad_event_manager_register, _FUN(_VOID, _NO_ARG) _TGAMEPAD_EVENT);
 	DEFINE_HL_PRIM (_BYTES, hl_gamepad_get_device_guid, _I32);
 	DEFINE_HL_PRIM (_BYTES, hl_gamepad_get_device_name, _I32);
+	DEFINE_HL_PRIM (_I32, hl_gamepad_get_states, _TBYTES);
+	DEFINE_HL_PRIM (_VOID, hl_gamepad_set_axis_events, _BOOL);
+	DEFINE_HL_PRIM (_VOID, hl_gamepad_set_motion_sensors, _BOOL);
 	DEFINE_HL_PRIM (_TBYTES, hl_gzip_compress, _TBYTES _TBYTES);
 	DEFINE_HL_PRIM (_TBYTES, hl_gzip_decompress, _TBYTES _TBYTES);
 	DEFINE_HL_PRIM (_VOID, hl_haptic_vibrate, _I32 _I32);
@@ -4363,6 +5510,7 @@ namespace lime {
 	DEFINE_HL_PRIM (_TBYTES, hl_image_encode, _TIMAGEBUFFER _I32 _I32 _TBYTES);
 	// DEFINE_PRIME2 (lime_image_load);
 	DEFINE_HL_PRIM (_TIMAGEBUFFER, hl_image_load_bytes, _TBYTES _TIMAGEBUFFER);
+	DEFINE_HL_PRIM (_TIMAGEBUFFER, hl_image_load_data_pointer, _F64 _I32 _TIMAGEBUFFER);
 	DEFINE_HL_PRIM (_TIMAGEBUFFER, hl_image_load_file, _STRING _TIMAGEBUFFER);
 	DEFINE_HL_PRIM (_F64, hl_jni_getenv, _NO_ARG);
 	DEFINE_HL_PRIM (_VOID, hl_joystick_event_manager_register, _FUN(_VOID, _NO_ARG) _TJOYSTICK_EVENT);
@@ -4379,9 +5527,22 @@ namespace lime {
 	DEFINE_HL_PRIM (_BYTES, hl_locale_get_system_locale, _NO_ARG);
 	DEFINE_HL_PRIM (_TBYTES, hl_lzma_compress, _TBYTES _TBYTES);
 	DEFINE_HL_PRIM (_TBYTES, hl_lzma_decompress, _TBYTES _TBYTES);
+	DEFINE_HL_PRIM (_VOID, hl_mapped_file_close, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_F64, hl_mapped_file_get_data_pointer, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_F64, hl_mapped_file_get_length, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_mapped_file_open, _STRING);
+	DEFINE_HL_PRIM (_VOID, hl_mapped_file_release_view, _F64);
+	DEFINE_HL_PRIM (_BOOL, hl_mapped_file_retain_view, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_I32, hl_motion_coalescer_get_history, _TBYTES);
+	DEFINE_HL_PRIM (_VOID, hl_motion_coalescer_set_enabled, _BOOL);
 	DEFINE_HL_PRIM (_VOID, hl_mouse_event_manager_register, _FUN (_VOID, _NO_ARG) _TMOUSE_EVENT);
 	// DEFINE_PRIME1v (lime_neko_execute);
 	DEFINE_HL_PRIM (_VOID, hl_orientation_event_manager_register, _FUN (_VOID, _NO_ARG) _TORIENTATION_EVENT);
+	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_packed_asset_loader_create, _I32);
+	DEFINE_HL_PRIM (_DYN, hl_packed_asset_loader_read, _TCFFIPOINTER _DYN);
+	DEFINE_HL_PRIM (_TAUDIOBUFFER, hl_packed_asset_loader_read_audio, _TCFFIPOINTER _TAUDIOBUFFER);
+	DEFINE_HL_PRIM (_TIMAGEBUFFER, hl_packed_asset_loader_read_image, _TCFFIPOINTER _TIMAGEBUFFER);
+	DEFINE_HL_PRIM (_I32, hl_packed_asset_loader_submit, _TCFFIPOINTER _F64 _I32 _I32 _I32);
 	DEFINE_HL_PRIM (_TIMAGEBUFFER, hl_png_decode_bytes, _TBYTES _BOOL _TIMAGEBUFFER);
 	DEFINE_HL_PRIM (_TIMAGEBUFFER, hl_png_decode_file, _STRING _BOOL _TIMAGEBUFFER);
 	DEFINE_HL_PRIM (_VOID, hl_render_event_manager_register, _FUN (_VOID, _NO_ARG) _TRENDER_EVENT);
@@ -4405,6 +5566,11 @@ namespace lime {
 	DEFINE_HL_PRIM (_BOOL, hl_system_set_windows_console_mode, _I32 _I32);
 	DEFINE_HL_PRIM (_VOID, hl_text_event_manager_register, _FUN (_VOID, _NO_ARG) _TTEXT_EVENT);
 	DEFINE_HL_PRIM (_VOID, hl_touch_event_manager_register, _FUN (_VOID, _NO_ARG) _TTOUCH_EVENT);
+	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_wav_stream_from_file, _STRING);
+	DEFINE_HL_PRIM (_DYN, hl_wav_stream_info, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_I32, hl_wav_stream_read, _TCFFIPOINTER _TBYTES _I32 _I32);
+	DEFINE_HL_PRIM (_BOOL, hl_wav_stream_seek, _TCFFIPOINTER _F64);
+	DEFINE_HL_PRIM (_F64, hl_wav_stream_tell, _TCFFIPOINTER);
 	DEFINE_HL_PRIM (_VOID, hl_window_alert, _TCFFIPOINTER _STRING _STRING);
 	DEFINE_HL_PRIM (_VOID, hl_window_close, _TCFFIPOINTER);
 	DEFINE_HL_PRIM (_VOID, hl_window_context_flip, _TCFFIPOINTER);
@@ -4426,13 +5592,19 @@ namespace lime {
 	DEFINE_HL_PRIM (_I32, hl_window_get_width, _TCFFIPOINTER);
 	DEFINE_HL_PRIM (_I32, hl_window_get_x, _TCFFIPOINTER);
 	DEFINE_HL_PRIM (_I32, hl_window_get_y, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_VOID, hl_window_inject_key_event, _TCFFIPOINTER _I32 _I32 _I32);
+	DEFINE_HL_PRIM (_VOID, hl_window_inject_mouse_event, _TCFFIPOINTER _I32 _F64 _F64 _I32);
+	DEFINE_HL_PRIM (_VOID, hl_window_inject_text_event, _TCFFIPOINTER _STRING);
 	DEFINE_HL_PRIM (_VOID, hl_window_move, _TCFFIPOINTER _I32 _I32);
 	DEFINE_HL_PRIM (_DYN, hl_window_read_pixels, _TCFFIPOINTER _TRECTANGLE _TIMAGEBUFFER);
+	DEFINE_HL_PRIM (_I32, hl_window_read_pixels_async, _TCFFIPOINTER _TRECTANGLE);
+	DEFINE_HL_PRIM (_I32, hl_window_read_pixels_async_result, _TCFFIPOINTER _I32 _TIMAGEBUFFER);
 	DEFINE_HL_PRIM (_VOID, hl_window_resize, _TCFFIPOINTER _I32 _I32);
 	DEFINE_HL_PRIM (_VOID, hl_window_set_minimum_size, _TCFFIPOINTER _I32 _I32);
 	DEFINE_HL_PRIM (_VOID, hl_window_set_maximum_size, _TCFFIPOINTER _I32 _I32);
 	DEFINE_HL_PRIM (_BOOL, hl_window_set_borderless, _TCFFIPOINTER _BOOL);
 	DEFINE_HL_PRIM (_VOID, hl_window_set_cursor, _TCFFIPOINTER _I32);
+	DEFINE_HL_PRIM (_VOID, hl_window_set_dirty_rects, _TCFFIPOINTER _F64 _I32);
 	DEFINE_HL_PRIM (_VOID, hl_window_set_display_mode, _TCFFIPOINTER _TDISPLAYMODE _TDISPLAYMODE);
 	DEFINE_HL_PRIM (_BOOL, hl_window_set_fullscreen, _TCFFIPOINTER _BOOL);
 	DEFINE_HL_PRIM (_VOID, hl_window_set_icon, _TCFFIPOINTER _TIMAGEBUFFER);
@@ -4450,6 +5622,8 @@ namespace lime {
 	DEFINE_HL_PRIM (_VOID, hl_window_set_opacity, _TCFFIPOINTER _F64);
 	DEFINE_HL_PRIM (_TBYTES, hl_zlib_compress, _TBYTES _TBYTES);
 	DEFINE_HL_PRIM (_TBYTES, hl_zlib_decompress, _TBYTES _TBYTES);
+	DEFINE_HL_PRIM (_TBYTES, hl_zstd_compress, _TBYTES _TBYTES);
+	DEFINE_HL_PRIM (_TBYTES, hl_zstd_decompress, _TBYTES _TBYTES);
 
 
 }
@@ -4485,6 +5659,12 @@ extern "C" int lime_opengl_register_prims ();
 extern "C" int lime_opengl_register_prims () { return 0; }
 #endif
 
+#if defined (LIME_VPX) && defined (LIME_WEBM)
+extern "C" int lime_video_register_prims ();
+#else
+extern "C" int lime_video_register_prims () { return 0; }
+#endif
+
 #ifdef LIME_VORBIS
 extern "C" int lime_vorbis_register_prims ();
 #else
@@ -4499,6 +5679,7 @@ extern "C" int lime_register_prims () {
 	lime_harfbuzz_register_prims ();
 	lime_openal_register_prims ();
 	lime_opengl_register_prims ();
+	lime_video_register_prims ();
 	lime_vorbis_register_prims ();
 
 	return 0;
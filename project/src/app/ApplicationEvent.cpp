@@ -1,4 +1,5 @@
 #include <app/ApplicationEvent.h>
+#include <app/EventQueue.h>
 #include <system/CFFI.h>
 
 
@@ -23,6 +24,8 @@ namespace lime {
 
 	void ApplicationEvent::Dispatch (ApplicationEvent* event) {
 
+		EventQueue::Flush ();
+
 		if (ApplicationEvent::callback) {
 
 			if (ApplicationEvent::eventObject->IsCFFIValue ()) {
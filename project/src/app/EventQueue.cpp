@@ -0,0 +1,164 @@
+#include <app/EventQueue.h>
+#include <utils/Bytes.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+namespace lime {
+
+
+	ValuePointer* EventQueue::buffer = 0;
+	ValuePointer* EventQueue::callback = 0;
+
+	static int capacity = 0;
+	static int count = 0;
+	static unsigned char* data = 0;
+	static bool flushing = false;
+	static int position = 0;
+
+	static_assert (sizeof (KeyEventRecord) == 32, "KeyEventRecord layout changed");
+	static_assert (sizeof (MouseEventRecord) == 56, "MouseEventRecord layout changed");
+	static_assert (sizeof (TouchEventRecord) == 64, "TouchEventRecord layout changed");
+
+
+	void EventQueue::Flush () {
+
+		if (!callback || count == 0 || flushing) return;
+
+		flushing = true;
+
+		unsigned char* target;
+		int32_t total = count;
+
+		if (buffer->IsCFFIValue ()) {
+
+			Bytes bytes ((value)buffer->Get ());
+			target = bytes.b;
+
+		} else {
+
+			target = ((Bytes*)buffer->Get ())->b;
+
+		}
+
+		memcpy (target, &total, sizeof (int32_t));
+		memcpy (target + sizeof (int32_t), data, position);
+
+		// events pushed from inside the callback start the next batch
+
+		count = 0;
+		position = 0;
+
+		callback->Call ();
+
+		flushing = false;
+
+	}
+
+
+	bool EventQueue::Push (KeyEvent* event) {
+
+		KeyEventRecord* record = (KeyEventRecord*)Reserve (sizeof (KeyEventRecord));
+		if (!record) return false;
+
+		record->recordType = EVENT_RECORD_KEY;
+		record->type = event->type;
+		record->reserved = 0;
+		record->windowID = event->windowID;
+		record->modifier = event->modifier;
+		record->reserved2 = 0;
+		record->keyCode = event->keyCode;
+		record->timestamp = event->timestamp;
+
+		return true;
+
+	}
+
+
+	bool EventQueue::Push (MouseEvent* event) {
+
+		MouseEventRecord* record = (MouseEventRecord*)Reserve (sizeof (MouseEventRecord));
+		if (!record) return false;
+
+		record->recordType = EVENT_RECORD_MOUSE;
+		record->type = event->type;
+		record->reserved = 0;
+		record->windowID = event->windowID;
+		record->button = event->button;
+		record->clickCount = event->clickCount;
+		record->x = event->x;
+		record->y = event->y;
+		record->movementX = event->movementX;
+		record->movementY = event->movementY;
+		record->timestamp = event->timestamp;
+
+		return true;
+
+	}
+
+
+	bool EventQueue::Push (TouchEvent* event) {
+
+		TouchEventRecord* record = (TouchEventRecord*)Reserve (sizeof (TouchEventRecord));
+		if (!record) return false;
+
+		record->recordType = EVENT_RECORD_TOUCH;
+		record->type = event->type;
+		record->reserved = 0;
+		record->id = event->id;
+		record->device = event->device;
+		record->reserved2 = 0;
+		record->x = event->x;
+		record->y = event->y;
+		record->dx = event->dx;
+		record->dy = event->dy;
+		record->pressure = event->pressure;
+		record->timestamp = event->timestamp;
+
+		return true;
+
+	}
+
+
+	void EventQueue::Register (ValuePointer* callback, ValuePointer* buffer, int length) {
+
+		Flush ();
+
+		if (EventQueue::callback) delete EventQueue::callback;
+		if (EventQueue::buffer) delete EventQueue::buffer;
+
+		EventQueue::callback = callback;
+		EventQueue::buffer = buffer;
+
+		capacity = length > (int)sizeof (int32_t) ? length - sizeof (int32_t) : 0;
+		data = (unsigned char*)realloc (data, capacity > 0 ? capacity : 1);
+		count = 0;
+		position = 0;
+
+	}
+
+
+	void* EventQueue::Reserve (int size) {
+
+		if (!callback || size > capacity) return 0;
+
+		if (position + size > capacity) {
+
+			// a full queue is delivered early instead of dropping events,
+			// unless it is being delivered right now, in which case the
+			// caller dispatches the event directly
+
+			if (flushing) return 0;
+			Flush ();
+
+		}
+
+		void* record = data + position;
+		position += size;
+		count++;
+		return record;
+
+	}
+
+
+}
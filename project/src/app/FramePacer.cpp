@@ -0,0 +1,331 @@
+#include <app/FramePacer.h>
+#include <algorithm>
+#include <thread>
+
+#if defined (HX_WINDOWS)
+#include <windows.h>
+#elif defined (__APPLE__)
+#include <mach/mach_time.h>
+#include <time.h>
+#else
+#include <errno.h>
+#include <time.h>
+#endif
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+
+namespace lime {
+
+
+	static const uint64_t NANOSECONDS = 1000000000ULL;
+
+	// the spin margin starts at 1 ms and follows the measured oversleep of the
+	// platform sleep, growing quickly on a late wakeup and shrinking slowly
+	static const uint64_t SPIN_MARGIN_DEFAULT = 1000000ULL;
+	static const uint64_t SPIN_MARGIN_MAX = 4000000ULL;
+	static const uint64_t SPIN_MARGIN_MIN = 100000ULL;
+
+	// how often the idle callback runs while sleeping between frames
+	static const uint64_t IDLE_INTERVAL = 1000000ULL;
+
+
+	FramePacer::FramePacer () {
+
+		idleCallback = 0;
+		idleUserData = 0;
+		period = 0;
+		policy = FRAME_PACING_PRECISE;
+		spinMargin = SPIN_MARGIN_DEFAULT;
+		timer = 0;
+		vsyncLimited = false;
+
+		#ifdef HX_WINDOWS
+		// high resolution waitable timers need Windows 10 1803, older versions
+		// fall back to a regular timer
+		timer = CreateWaitableTimerExW (NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+		if (!timer) timer = CreateWaitableTimerExW (NULL, NULL, 0, TIMER_ALL_ACCESS);
+		#endif
+
+		Reset ();
+
+	}
+
+
+	FramePacer::~FramePacer () {
+
+		#ifdef HX_WINDOWS
+		if (timer) CloseHandle ((HANDLE)timer);
+		#endif
+
+	}
+
+
+	void FramePacer::GetStats (FrameStats* stats) const {
+
+		stats->frames = (double)frames;
+		stats->missed = 0;
+		stats->frameTimeP50 = 0;
+		stats->frameTimeP99 = 0;
+		stats->jitterP50 = 0;
+		stats->jitterP99 = 0;
+		stats->spinMargin = (double)spinMargin / 1e6;
+
+		if (historyCount == 0) return;
+
+		uint64_t times[HISTORY_SIZE];
+		uint64_t jitter[HISTORY_SIZE];
+
+		for (int i = 0; i < historyCount; i++) {
+
+			times[i] = history[i];
+			jitter[i] = history[i] > period ? history[i] - period : period - history[i];
+
+			if (period > 0 && history[i] > period + period / 2) {
+
+				stats->missed++;
+
+			}
+
+		}
+
+		int p50 = historyCount / 2;
+		int p99 = std::min (historyCount - 1, (historyCount * 99) / 100);
+
+		std::sort (times, times + historyCount);
+		std::sort (jitter, jitter + historyCount);
+
+		stats->frameTimeP50 = (double)times[p50] / 1e6;
+		stats->frameTimeP99 = (double)times[p99] / 1e6;
+
+		if (period > 0) {
+
+			stats->jitterP50 = (double)jitter[p50] / 1e6;
+			stats->jitterP99 = (double)jitter[p99] / 1e6;
+
+		}
+
+	}
+
+
+	uint64_t FramePacer::Now () {
+
+		#if defined (HX_WINDOWS)
+		static LARGE_INTEGER frequency = { 0 };
+		if (frequency.QuadPart == 0) QueryPerformanceFrequency (&frequency);
+
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter (&counter);
+
+		// split the conversion so high resolution counters cannot overflow
+		uint64_t ticks = (uint64_t)counter.QuadPart;
+		uint64_t rate = (uint64_t)frequency.QuadPart;
+		return (ticks / rate) * NANOSECONDS + ((ticks % rate) * NANOSECONDS) / rate;
+		#elif defined (__APPLE__)
+		static mach_timebase_info_data_t timebase = { 0, 0 };
+		if (timebase.denom == 0) mach_timebase_info (&timebase);
+
+		uint64_t ticks = mach_absolute_time ();
+		return (ticks / timebase.denom) * timebase.numer + ((ticks % timebase.denom) * timebase.numer) / timebase.denom;
+		#else
+		struct timespec now;
+		clock_gettime (CLOCK_MONOTONIC, &now);
+		return (uint64_t)now.tv_sec * NANOSECONDS + (uint64_t)now.tv_nsec;
+		#endif
+
+	}
+
+
+	void FramePacer::Idle (uint64_t time) {
+
+		if (idleCallback) {
+
+			uint64_t now = Now ();
+
+			while (now + IDLE_INTERVAL < time) {
+
+				SleepUntil (now + IDLE_INTERVAL);
+				idleCallback (idleUserData);
+				now = Now ();
+
+			}
+
+		}
+
+		SleepUntil (time);
+
+	}
+
+
+	void FramePacer::Record (uint64_t time) {
+
+		if (frames > 0) {
+
+			history[historyIndex] = time - lastFrame;
+			historyIndex = (historyIndex + 1) % HISTORY_SIZE;
+			if (historyCount < HISTORY_SIZE) historyCount++;
+
+		}
+
+		lastFrame = time;
+		frames++;
+
+	}
+
+
+	void FramePacer::Reset () {
+
+		deadline = Now ();
+		frames = 0;
+		historyCount = 0;
+		historyIndex = 0;
+		lastFrame = deadline;
+
+	}
+
+
+	void FramePacer::SetFrameRate (double frameRate) {
+
+		period = frameRate > 0 ? (uint64_t)(NANOSECONDS / frameRate) : 0;
+		deadline = Now ();
+		historyCount = 0;
+		historyIndex = 0;
+
+	}
+
+
+	void FramePacer::SetIdleCallback (void (*callback) (void*), void* userData) {
+
+		idleCallback = callback;
+		idleUserData = userData;
+
+	}
+
+
+	void FramePacer::SetPolicy (int policy) {
+
+		if (policy < FRAME_PACING_PRECISE || policy > FRAME_PACING_POWER_SAVING) return;
+
+		this->policy = policy;
+		deadline = Now ();
+
+	}
+
+
+	void FramePacer::SleepUntil (uint64_t time) {
+
+		#if defined (HX_WINDOWS)
+		uint64_t now = Now ();
+		if (time <= now) return;
+
+		if (timer) {
+
+			// relative due time, in 100 ns units
+			LARGE_INTEGER due;
+			due.QuadPart = -(LONGLONG)((time - now) / 100);
+
+			if (SetWaitableTimer ((HANDLE)timer, &due, 0, NULL, NULL, FALSE)) {
+
+				WaitForSingleObject ((HANDLE)timer, INFINITE);
+				return;
+
+			}
+
+		}
+
+		Sleep ((DWORD)((time - now) / 1000000));
+		#elif defined (__APPLE__)
+		uint64_t now = Now ();
+		if (time <= now) return;
+
+		struct timespec duration;
+		duration.tv_sec = (time_t)((time - now) / NANOSECONDS);
+		duration.tv_nsec = (long)((time - now) % NANOSECONDS);
+		nanosleep (&duration, NULL);
+		#else
+		// an absolute deadline on the monotonic clock, so an interrupted sleep
+		// resumes without drifting
+		struct timespec target;
+		target.tv_sec = (time_t)(time / NANOSECONDS);
+		target.tv_nsec = (long)(time % NANOSECONDS);
+
+		while (clock_nanosleep (CLOCK_MONOTONIC, TIMER_ABSTIME, &target, NULL) == EINTR) {}
+		#endif
+
+	}
+
+
+	void FramePacer::Wait () {
+
+		uint64_t now = Now ();
+
+		if (period == 0 || (policy == FRAME_PACING_ADAPTIVE && vsyncLimited)) {
+
+			// uncapped, or the buffer swap already holds us at or below the
+			// target rate, so sleeping on top of it would only add latency
+
+			deadline = now;
+			Record (now);
+			return;
+
+		}
+
+		uint64_t target = deadline + period;
+
+		if (now > target + period) {
+
+			// more than a frame behind, start a new schedule instead of
+			// rendering a burst of frames to catch up
+
+			target = now;
+
+		}
+
+		if (target > now) {
+
+			if (policy == FRAME_PACING_POWER_SAVING) {
+
+				Idle (target);
+
+			} else {
+
+				if (target - now > spinMargin) {
+
+					uint64_t wake = target - spinMargin;
+					Idle (wake);
+
+					now = Now ();
+					uint64_t oversleep = now > wake ? now - wake : 0;
+
+					if (oversleep > spinMargin) {
+
+						spinMargin = std::min (oversleep + oversleep / 4, SPIN_MARGIN_MAX);
+
+					} else {
+
+						spinMargin -= (spinMargin - oversleep) / 64;
+						if (spinMargin < SPIN_MARGIN_MIN) spinMargin = SPIN_MARGIN_MIN;
+
+					}
+
+				}
+
+				while (Now () < target) {
+
+					std::this_thread::yield ();
+
+				}
+
+			}
+
+		}
+
+		deadline = target;
+		Record (Now ());
+
+	}
+
+
+}
@@ -1,6 +1,9 @@
 #include "SDLApplication.h"
 #include "SDLGamepad.h"
 #include "SDLJoystick.h"
+#include <app/EventQueue.h>
+#include <ui/GamepadState.h>
+#include <ui/MotionCoalescer.h>
 #include <system/System.h>
 
 #ifdef HX_MACOS
@@ -23,7 +26,6 @@ namespace lime {
 	bool inBackground = false;
 
 	double lastUpdateEvent;
-	double lastScheduledTicks;
 
 	double performanceFrequency = 0.0;
 	double performanceCounter = 0.0;
@@ -31,7 +33,65 @@ namespace lime {
 	double fps = 0.0;
 	double lastRenderDuration = 0.0;
 
+	double stampScale = 0.0;
+	bool stampEvents = false;
+
+
+	static Uint32 GetEventStamp () {
+
+		// microseconds, wrapping every 71 minutes, only ever compared as a
+		// difference to the current stamp
+		return (Uint32)(uint64_t)((double)SDL_GetPerformanceCounter () * stampScale);
+
+	}
+
+
+	static int SDLCALL StampEvent (void* userdata, SDL_Event* event) {
+
+		// called from SDL_PushEvent on whichever thread produced the event,
+		// before it is queued, so the stamp is the arrival time and not the
+		// time the frame loop gets around to polling it
+		event->common.timestamp = GetEventStamp ();
+		return 0;
+
+	}
+
+
+	static void PumpEvents (void* userdata) {
+
+		SDL_PumpEvents ();
+
+	}
+
+
 	SDLApplication::SDLApplication () {
+		const char* headless = SDL_getenv ("LIME_HEADLESS");
+
+		if (headless && *headless && SDL_strcmp (headless, "0") != 0) {
+
+			// no display or audio device needed, windows fall back to the
+			// software renderer and can be read back with ReadPixels
+
+			SDL_SetHint (SDL_HINT_VIDEODRIVER, "dummy");
+
+			if (!SDL_getenv ("SDL_AUDIODRIVER")) {
+
+				SDL_SetHint (SDL_HINT_AUDIODRIVER, "dummy");
+
+			}
+
+		}
+
+		const char* preciseInput = SDL_getenv ("LIME_PRECISE_INPUT");
+
+		if (preciseInput && *preciseInput && SDL_strcmp (preciseInput, "0") != 0) {
+
+			// joystick and controller input is read on a dedicated SDL thread
+			// where the platform supports it, instead of once per frame
+			SDL_SetHint (SDL_HINT_JOYSTICK_THREAD, "1");
+
+		}
+
 		Uint32 initFlags = SDL_INIT_VIDEO | SDL_INIT_GAMECONTROLLER | SDL_INIT_TIMER | SDL_INIT_JOYSTICK;
 		#if defined(LIME_MOJOAL) || defined(LIME_OPENALSOFT)
 		initFlags |= SDL_INIT_AUDIO;
@@ -45,11 +105,15 @@ namespace lime {
 		performanceFrequency = (double)SDL_GetPerformanceFrequency();
 		performanceCounter = (double)SDL_GetPerformanceCounter();
 
+		stampScale = 1000000.0 / performanceFrequency;
+
 		SDL_LogSetPriority (SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_WARN);
 
 		currentApplication = this;
 
 		framePeriod = 1.0;
+		fixedTimeStep = 0.0;
+		virtualTime = 0.0;
 
 		currentUpdate = 0;
 		lastUpdate = 0;
@@ -75,6 +139,12 @@ namespace lime {
 		SDL_EventState (SDL_DROPCOMPLETE, SDL_ENABLE);
 		SDLJoystick::Init ();
 
+		if (preciseInput && *preciseInput && SDL_strcmp (preciseInput, "0") != 0) {
+
+			SetPreciseInput (true);
+
+		}
+
 		#ifdef HX_MACOS
 		CFURLRef resourcesURL = CFBundleCopyResourcesDirectoryURL (CFBundleGetMainBundle ());
 		char path[PATH_MAX];
@@ -131,13 +201,27 @@ namespace lime {
 		return (counter / performanceFrequency) * 1000.0;
 
 	}
-	void busyWait(double ms) {
-		const double start = getTime();
-		while(getTime() - start < ms) {
-			continue;
+
+	double SDLApplication::GetEventTime (SDL_Event* event) {
+
+		if (!stampEvents) {
+
+			// SDL's own timestamp, in milliseconds from SDL_GetTicks
+			Uint32 age = SDL_GetTicks () - event->common.timestamp;
+			if (age > 0x7FFFFFFF) age = 0;
+
+			return System::GetTimer () - age;
+
 		}
+
+		Uint32 age = GetEventStamp () - event->common.timestamp;
+		if (age > 0x7FFFFFFF) age = 0;
+
+		return System::GetTimer () - age / 1000.0;
+
 	}
 
+
 	void SDLApplication::HandleEvent (SDL_Event* event) {
 
 		#if defined(IPHONE) || defined(EMSCRIPTEN)
@@ -147,13 +231,22 @@ namespace lime {
 
 		#endif
 
+		if (event->type != SDL_MOUSEMOTION && event->type != SDL_FINGERMOTION) {
+
+			// deliver coalesced motion before anything that came after it
+			MotionCoalescer::Flush ();
+
+		}
+
 		switch (event->type) {
 
 			case SDL_USEREVENT:
 
 				if (!inBackground) {
+					MotionCoalescer::BeginFrame ();
+
 					applicationEvent.type = UPDATE;
-					applicationEvent.deltaTime = (currentUpdate - lastUpdate) / performanceFrequency * 1e+3;
+					applicationEvent.deltaTime = fixedTimeStep > 0.0 ? fixedTimeStep : (currentUpdate - lastUpdate) / performanceFrequency * 1e+3;
 
 					lastUpdate = currentUpdate;
 					ApplicationEvent::Dispatch (&applicationEvent);
@@ -200,6 +293,7 @@ namespace lime {
 			case SDL_CONTROLLERBUTTONUP:
 			case SDL_CONTROLLERDEVICEADDED:
 			case SDL_CONTROLLERDEVICEREMOVED:
+			case SDL_CONTROLLERSENSORUPDATE:
 
 				ProcessGamepadEvent (event);
 				break;
@@ -376,7 +470,15 @@ namespace lime {
 
 		lastUpdate = ticks;
 		lastUpdateEvent = lastUpdate;
-		lastScheduledTicks = ticks;
+
+		framePacer.Reset ();
+	}
+
+
+	void SDLApplication::GetFrameStats (FrameStats* stats) {
+
+		framePacer.GetStats (stats);
+
 	}
 
 
@@ -431,10 +533,25 @@ namespace lime {
 
 		if (GamepadEvent::callback) {
 
+			double timestamp = GetEventTime (event);
+			gamepadEvent.timestamp = timestamp;
+
 			switch (event->type) {
 
 				case SDL_CONTROLLERAXISMOTION:
 
+					if (event->caxis.value > -analogAxisDeadZone && event->caxis.value < analogAxisDeadZone) {
+
+						GamepadState::SetAxis (event->caxis.which, GAMEPAD_STATE_GAMEPAD, event->caxis.axis, 0, timestamp);
+
+					} else {
+
+						GamepadState::SetAxis (event->caxis.which, GAMEPAD_STATE_GAMEPAD, event->caxis.axis, event->caxis.value / (event->caxis.value > 0 ? 32767.0f : 32768.0f), timestamp);
+
+					}
+
+					if (!GamepadState::axisEvents) break;
+
 					if (gamepadsAxisMap[event->caxis.which].empty ()) {
 
 						gamepadsAxisMap[event->caxis.which][event->caxis.axis] = event->caxis.value;
@@ -471,6 +588,8 @@ namespace lime {
 
 				case SDL_CONTROLLERBUTTONDOWN:
 
+					GamepadState::SetButton (event->cbutton.which, GAMEPAD_STATE_GAMEPAD, event->cbutton.button, true, timestamp);
+
 					gamepadEvent.type = GAMEPAD_BUTTON_DOWN;
 					gamepadEvent.button = event->cbutton.button;
 					gamepadEvent.id = event->cbutton.which;
@@ -480,6 +599,8 @@ namespace lime {
 
 				case SDL_CONTROLLERBUTTONUP:
 
+					GamepadState::SetButton (event->cbutton.which, GAMEPAD_STATE_GAMEPAD, event->cbutton.button, false, timestamp);
+
 					gamepadEvent.type = GAMEPAD_BUTTON_UP;
 					gamepadEvent.button = event->cbutton.button;
 					gamepadEvent.id = event->cbutton.which;
@@ -494,6 +615,8 @@ namespace lime {
 						gamepadEvent.type = GAMEPAD_CONNECT;
 						gamepadEvent.id = SDLGamepad::GetInstanceID (event->cdevice.which);
 
+						GamepadState::Connect (gamepadEvent.id, GAMEPAD_STATE_GAMEPAD);
+
 						GamepadEvent::Dispatch (&gamepadEvent);
 
 					}
@@ -506,11 +629,29 @@ namespace lime {
 					gamepadEvent.id = event->cdevice.which;
 
 					GamepadEvent::Dispatch (&gamepadEvent);
+					GamepadState::Disconnect (event->cdevice.which, GAMEPAD_STATE_GAMEPAD);
 					SDLGamepad::Disconnect (event->cdevice.which);
 					break;
 
 				}
 
+				case SDL_CONTROLLERSENSORUPDATE:
+
+					// sensor data is only kept in the polled state, it changes
+					// every frame and would flood the event listeners
+
+					if (event->csensor.sensor == SDL_SENSOR_GYRO) {
+
+						GamepadState::SetSensor (event->csensor.which, GAMEPAD_STATE_GYRO, event->csensor.data, timestamp);
+
+					} else if (event->csensor.sensor == SDL_SENSOR_ACCEL) {
+
+						GamepadState::SetSensor (event->csensor.which, GAMEPAD_STATE_ACCELEROMETER, event->csensor.data, timestamp);
+
+					}
+
+					break;
+
 			}
 
 		}
@@ -522,6 +663,9 @@ namespace lime {
 
 		if (JoystickEvent::callback) {
 
+			double timestamp = GetEventTime (event);
+			joystickEvent.timestamp = timestamp;
+
 			switch (event->type) {
 
 				case SDL_JOYAXISMOTION:
@@ -533,7 +677,13 @@ namespace lime {
 						joystickEvent.x = event->jaxis.value / (event->jaxis.value > 0 ? 32767.0 : 32768.0);
 						joystickEvent.id = event->jaxis.which;
 
-						JoystickEvent::Dispatch (&joystickEvent);
+						GamepadState::SetAxis (joystickEvent.id, GAMEPAD_STATE_JOYSTICK, joystickEvent.index, (float)joystickEvent.x, timestamp);
+
+						if (GamepadState::axisEvents) {
+
+							JoystickEvent::Dispatch (&joystickEvent);
+
+						}
 
 					}
 					break;
@@ -547,6 +697,8 @@ namespace lime {
 						joystickEvent.index = event->jbutton.button;
 						joystickEvent.id = event->jbutton.which;
 
+						GamepadState::SetButton (joystickEvent.id, GAMEPAD_STATE_JOYSTICK, joystickEvent.index, true, timestamp);
+
 						JoystickEvent::Dispatch (&joystickEvent);
 
 					}
@@ -560,6 +712,8 @@ namespace lime {
 						joystickEvent.index = event->jbutton.button;
 						joystickEvent.id = event->jbutton.which;
 
+						GamepadState::SetButton (joystickEvent.id, GAMEPAD_STATE_JOYSTICK, joystickEvent.index, false, timestamp);
+
 						JoystickEvent::Dispatch (&joystickEvent);
 
 					}
@@ -574,6 +728,8 @@ namespace lime {
 						joystickEvent.eventValue = event->jhat.value;
 						joystickEvent.id = event->jhat.which;
 
+						GamepadState::SetHat (joystickEvent.id, GAMEPAD_STATE_JOYSTICK, joystickEvent.index, joystickEvent.eventValue, timestamp);
+
 						JoystickEvent::Dispatch (&joystickEvent);
 
 					}
@@ -586,6 +742,8 @@ namespace lime {
 						joystickEvent.type = JOYSTICK_CONNECT;
 						joystickEvent.id = SDLJoystick::GetInstanceID (event->jdevice.which);
 
+						GamepadState::Connect (joystickEvent.id, GAMEPAD_STATE_JOYSTICK);
+
 						JoystickEvent::Dispatch (&joystickEvent);
 
 					}
@@ -599,6 +757,7 @@ namespace lime {
 						joystickEvent.id = event->jdevice.which;
 
 						JoystickEvent::Dispatch (&joystickEvent);
+						GamepadState::Disconnect (event->jdevice.which, GAMEPAD_STATE_JOYSTICK);
 						SDLJoystick::Disconnect (event->jdevice.which);
 
 					}
@@ -625,6 +784,7 @@ namespace lime {
 			keyEvent.keyCode = event->key.keysym.sym;
 			keyEvent.modifier = event->key.keysym.mod;
 			keyEvent.windowID = event->key.windowID;
+			keyEvent.timestamp = GetEventTime (event);
 
 			if (keyEvent.type == KEY_DOWN) {
 
@@ -706,7 +866,13 @@ namespace lime {
 			}
 
 			mouseEvent.windowID = event->button.windowID;
-			MouseEvent::Dispatch (&mouseEvent);
+			mouseEvent.timestamp = GetEventTime (event);
+
+			if (!MotionCoalescer::Push (&mouseEvent, mouseEvent.timestamp)) {
+
+				MouseEvent::Dispatch (&mouseEvent);
+
+			}
 
 		}
 
@@ -802,8 +968,13 @@ namespace lime {
 			touchEvent.dy = event->tfinger.dy;
 			touchEvent.pressure = event->tfinger.pressure;
 			touchEvent.device = event->tfinger.touchId;
+			touchEvent.timestamp = GetEventTime (event);
 
-			TouchEvent::Dispatch (&touchEvent);
+			if (!MotionCoalescer::Push (&touchEvent, touchEvent.timestamp)) {
+
+				TouchEvent::Dispatch (&touchEvent);
+
+			}
 
 		}
 
@@ -872,6 +1043,63 @@ namespace lime {
 	}
 
 
+	bool SDLApplication::IsVsyncLimited () {
+
+		// vsync only holds the frame rate down when the display does not
+		// refresh faster than the target rate
+
+		SDL_Window* window = SDL_GL_GetCurrentWindow ();
+
+		if (!window || SDL_GL_GetSwapInterval () == 0) {
+
+			return false;
+
+		}
+
+		SDL_DisplayMode mode;
+
+		if (SDL_GetCurrentDisplayMode (SDL_GetWindowDisplayIndex (window), &mode) != 0 || mode.refresh_rate <= 0) {
+
+			return false;
+
+		}
+
+		return mode.refresh_rate <= fps + 1.0;
+
+	}
+
+
+	void SDLApplication::SetFixedTimeStep (double step) {
+
+		if (step > 0.0) {
+
+			if (fixedTimeStep <= 0.0) {
+
+				virtualTime = System::GetTimer ();
+
+			}
+
+			fixedTimeStep = step;
+			System::SetVirtualTimer (virtualTime);
+
+		} else {
+
+			fixedTimeStep = 0.0;
+			System::SetVirtualTimer (-1.0);
+			framePacer.Reset ();
+
+		}
+
+	}
+
+
+	void SDLApplication::SetFramePacing (int policy) {
+
+		framePacer.SetPolicy (policy);
+
+	}
+
+
 	void SDLApplication::SetFrameRate (double frameRate) {
 
 		if (frameRate > 0) {
@@ -886,6 +1114,36 @@ namespace lime {
 
 		}
 
+		framePacer.SetFrameRate (fps);
+
+	}
+
+
+	void SDLApplication::SetPreciseInput (bool value) {
+
+		// events are still dispatched from the frame loop, but pumping them
+		// while waiting for the next frame stamps them as they arrive. The
+		// watch runs inside every SDL_PushEvent, so it is only installed
+		// while precise stamps are wanted.
+
+		if (value != stampEvents) {
+
+			if (value) {
+
+				SDL_AddEventWatch (StampEvent, NULL);
+
+			} else {
+
+				SDL_DelEventWatch (StampEvent, NULL);
+
+			}
+
+			stampEvents = value;
+
+		}
+
+		framePacer.SetIdleCallback (value ? PumpEvents : NULL, this);
+
 	}
 
 	void PushUpdate(void) {
@@ -916,47 +1174,31 @@ namespace lime {
 				return active;
 		}
 
-		double curTicks = currentUpdate;
-		if(fps > 0.0) {
-			int ticks_to_wait = static_cast<int>(performanceFrequency / fps);
-
-			bool done = false;
+		MotionCoalescer::Flush ();
+		EventQueue::Flush ();
 
-			do
-			{
-				curTicks = (double)SDL_GetPerformanceCounter();
-				int ticks_passed = static_cast<int>(curTicks-lastScheduledTicks);
+		if (fixedTimeStep > 0.0) {
 
-				int ticks_left = ticks_to_wait - ticks_passed;
+			// simulated time, run frames back to back as fast as possible
 
-				if (curTicks < lastScheduledTicks || ticks_passed >= ticks_to_wait)
-					done = true;
+			virtualTime += fixedTimeStep;
+			System::SetVirtualTimer (virtualTime);
 
-				if (!done)
-				{
-					int scheduled_ticks = static_cast<int>((performanceFrequency * 2) * 1e-3);
+		} else {
 
-					if (ticks_left > scheduled_ticks)
-						SDL_Delay(1);
-					else
-					{
-						double curTime = (double)SDL_GetPerformanceCounter();
+			if (framePacer.GetPolicy () == FRAME_PACING_ADAPTIVE) {
 
-						do {
-							curTicks = (double)SDL_GetPerformanceCounter();
-							SDL_Delay(0);
-						}
-						while(curTicks-curTime < ticks_left);
-					}
+				framePacer.SetVsyncLimited (IsVsyncLimited ());
 
-				}
 			}
-			while(!done);
+
+			framePacer.Wait ();
+
 		}
+
 		PushUpdate();
 
 		lastUpdate = currentUpdate;
-		lastScheduledTicks = curTicks;
 
 		return active;
 	}
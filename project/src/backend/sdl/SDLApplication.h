@@ -31,16 +31,22 @@ namespace lime {
 			~SDLApplication ();
 
 			virtual int Exec ();
+			virtual void GetFrameStats (FrameStats* stats);
 			virtual void Init ();
 			virtual int Quit ();
+			virtual void SetFixedTimeStep (double step);
+			virtual void SetFramePacing (int policy);
 			virtual void SetFrameRate (double frameRate);
+			virtual void SetPreciseInput (bool value);
 			virtual bool Update ();
 
 			void RegisterWindow (SDLWindow *window);
 
 		private:
 
+			double GetEventTime (SDL_Event* event);
 			void HandleEvent (SDL_Event* event);
+			bool IsVsyncLimited ();
 			void ProcessClipboardEvent (SDL_Event* event);
 			void ProcessDropEvent (SDL_Event* event);
 			void ProcessGamepadEvent (SDL_Event* event);
@@ -61,6 +67,8 @@ namespace lime {
 			ApplicationEvent applicationEvent;
 			ClipboardEvent clipboardEvent;
 			double currentUpdate;
+			double fixedTimeStep;
+			FramePacer framePacer;
 			double framePeriod;
 			DropEvent dropEvent;
 			GamepadEvent gamepadEvent;
@@ -76,6 +84,7 @@ namespace lime {
 			SensorEvent sensorEvent;
 			TextEvent textEvent;
 			TouchEvent touchEvent;
+			double virtualTime;
 			WindowEvent windowEvent;
 
 	};
@@ -6,6 +6,28 @@ namespace lime {
 
 	std::map<int, SDL_GameController*> gameControllers = std::map<int, SDL_GameController*> ();
 	std::map<int, int> gameControllerIDs = std::map<int, int> ();
+	static bool motionSensors = false;
+
+
+	static void EnableMotionSensors (SDL_GameController* gameController, bool enabled) {
+
+		// motion sensors only feed the polled state, see GamepadState. They
+		// cost power and bandwidth on wireless controllers, so they stay off
+		// unless requested
+
+		if (SDL_GameControllerHasSensor (gameController, SDL_SENSOR_GYRO)) {
+
+			SDL_GameControllerSetSensorEnabled (gameController, SDL_SENSOR_GYRO, enabled ? SDL_TRUE : SDL_FALSE);
+
+		}
+
+		if (SDL_GameControllerHasSensor (gameController, SDL_SENSOR_ACCEL)) {
+
+			SDL_GameControllerSetSensorEnabled (gameController, SDL_SENSOR_ACCEL, enabled ? SDL_TRUE : SDL_FALSE);
+
+		}
+
+	}
 
 
 	bool SDLGamepad::Connect (int deviceID) {
@@ -22,6 +44,12 @@ namespace lime {
 				gameControllers[id] = gameController;
 				gameControllerIDs[deviceID] = id;
 
+				if (motionSensors) {
+
+					EnableMotionSensors (gameController, true);
+
+				}
+
 				return true;
 
 			}
@@ -88,4 +116,19 @@ namespace lime {
 	}
 
 
+	void Gamepad::SetMotionSensors (bool enabled) {
+
+		if (enabled == motionSensors) return;
+
+		motionSensors = enabled;
+
+		for (std::map<int, SDL_GameController*>::iterator it = gameControllers.begin (); it != gameControllers.end (); ++it) {
+
+			EnableMotionSensors (it->second, enabled);
+
+		}
+
+	}
+
+
 }
\ No newline at end of file
@@ -64,6 +64,7 @@ namespace lime {
 
 	static double performanceFrequency = -1.0;
 	static double performanceCounter = -1.0;
+	static double virtualTimer = -1.0;
 
 
 	const char* Clipboard::GetText () {
@@ -583,6 +584,9 @@ namespace lime {
 
 
 	double System::GetTimer () {
+		if(virtualTimer >= 0.0) {
+			return virtualTimer;
+		}
 		if(performanceCounter == -1.0) {
 			performanceCounter = (double)SDL_GetPerformanceCounter();
 		}
@@ -594,6 +598,16 @@ namespace lime {
 	}
 
 
+	void System::SetVirtualTimer (double time) {
+
+		// while set, GetTimer reports this time instead of the real clock,
+		// so a fixed time step also drives Lime timers
+
+		virtualTimer = time;
+
+	}
+
+
 	bool System::SetAllowScreenTimeout (bool allow) {
 
 		if (allow) {
@@ -3,6 +3,7 @@
 #include "SDLApplication.h"
 #include "../../graphics/opengl/OpenGL.h"
 #include "../../graphics/opengl/OpenGLBindings.h"
+#include "../../graphics/opengl/OpenGLReadback.h"
 
 #ifdef HX_WINDOWS
 #include <SDL_syswm.h>
@@ -16,6 +17,10 @@ namespace lime {
 
 	static Cursor currentCursor = DEFAULT;
 
+	// more rectangles than this are merged, and once they cover most of the
+	// window the whole frame is presented instead
+	static const int MAX_DIRTY_RECTS = 16;
+
 	SDL_Cursor* SDLCursor::arrowCursor = 0;
 	SDL_Cursor* SDLCursor::crosshairCursor = 0;
 	SDL_Cursor* SDLCursor::moveCursor = 0;
@@ -42,6 +47,11 @@ namespace lime {
 
 		contextWidth = 0;
 		contextHeight = 0;
+		contextResized = false;
+		readback = 0;
+
+		injectedMouseX = 0;
+		injectedMouseY = 0;
 
 		currentApplication = application;
 		this->flags = flags;
@@ -73,6 +83,16 @@ namespace lime {
 		}
 		#endif
 
+		const char* videoDriver = SDL_GetCurrentVideoDriver ();
+
+		if (videoDriver && SDL_strcmp (videoDriver, "dummy") == 0) {
+
+			// headless, the dummy driver has no OpenGL support
+			flags &= ~WINDOW_FLAG_HARDWARE;
+			this->flags = flags;
+
+		}
+
 		#if !defined(EMSCRIPTEN) && !defined(LIME_SWITCH)
 		SDL_SetHint (SDL_HINT_ANDROID_TRAP_BACK_BUTTON, "0");
 		SDL_SetHint (SDL_HINT_MOUSE_FOCUS_CLICKTHROUGH, "1");
@@ -306,6 +326,13 @@ namespace lime {
 
 	SDLWindow::~SDLWindow () {
 
+		if (readback) {
+
+			delete readback;
+			readback = 0;
+
+		}
+
 		if (sdlWindow) {
 
 			SDL_DestroyWindow (sdlWindow);
@@ -392,12 +419,33 @@ namespace lime {
 
 			SDL_GL_SwapWindow (sdlWindow);
 
+			if (readback) {
+
+				readback->Poll ();
+
+			}
+
 		} else if (sdlRenderer) {
 
-			SDL_RenderPresent (sdlRenderer);
+			if (!dirtyRects.empty ()) {
+
+				// the software renderer draws into the window surface, so
+				// only the dirty regions need to reach the screen
+
+				SDL_RenderFlush (sdlRenderer);
+				SDL_UpdateWindowSurfaceRects (sdlWindow, &dirtyRects[0], dirtyRects.size ());
+
+			} else {
+
+				SDL_RenderPresent (sdlRenderer);
+
+			}
 
 		}
 
+		dirtyRects.clear ();
+		contextResized = false;
+
 	}
 
 
@@ -422,6 +470,7 @@ namespace lime {
 
 				contextWidth = width;
 				contextHeight = height;
+				contextResized = true;
 
 			}
 
@@ -502,8 +551,30 @@ namespace lime {
 		if (sdlTexture) {
 
 			SDL_UnlockTexture (sdlTexture);
-			SDL_RenderClear (sdlRenderer);
-			SDL_RenderCopy (sdlRenderer, sdlTexture, NULL, NULL);
+
+			if (contextResized) {
+
+				dirtyRects.clear ();
+
+			}
+
+			if (dirtyRects.empty ()) {
+
+				SDL_RenderClear (sdlRenderer);
+				SDL_RenderCopy (sdlRenderer, sdlTexture, NULL, NULL);
+
+			} else {
+
+				// the texture matches the output size, so each region is
+				// copied in place and the rest of the window is left as is
+
+				for (size_t i = 0; i < dirtyRects.size (); i++) {
+
+					SDL_RenderCopy (sdlRenderer, sdlTexture, &dirtyRects[i], &dirtyRects[i]);
+
+				}
+
+			}
 
 		}
 
@@ -710,6 +781,130 @@ namespace lime {
 	}
 
 
+	void SDLWindow::InjectKeyEvent (int type, int keyCode, int modifier) {
+
+		SDL_Event event;
+		SDL_zero (event);
+
+		event.type = (type == KEY_UP) ? SDL_KEYUP : SDL_KEYDOWN;
+		event.key.timestamp = SDL_GetTicks ();
+		event.key.windowID = SDL_GetWindowID (sdlWindow);
+		event.key.state = (type == KEY_UP) ? SDL_RELEASED : SDL_PRESSED;
+		event.key.keysym.sym = keyCode;
+		event.key.keysym.scancode = SDL_GetScancodeFromKey (keyCode);
+		event.key.keysym.mod = modifier;
+
+		SDL_PushEvent (&event);
+
+	}
+
+
+	void SDLWindow::InjectMouseEvent (int type, double x, double y, int button) {
+
+		SDL_Event event;
+		SDL_zero (event);
+
+		Uint32 windowID = SDL_GetWindowID (sdlWindow);
+
+		switch (type) {
+
+			case MOUSE_DOWN:
+			case MOUSE_UP:
+
+				event.type = (type == MOUSE_UP) ? SDL_MOUSEBUTTONUP : SDL_MOUSEBUTTONDOWN;
+				event.button.timestamp = SDL_GetTicks ();
+				event.button.windowID = windowID;
+				event.button.button = button + 1;
+				event.button.state = (type == MOUSE_UP) ? SDL_RELEASED : SDL_PRESSED;
+				event.button.clicks = 1;
+				event.button.x = x;
+				event.button.y = y;
+				injectedMouseX = x;
+				injectedMouseY = y;
+				break;
+
+			case MOUSE_MOVE:
+
+				event.type = SDL_MOUSEMOTION;
+				event.motion.timestamp = SDL_GetTicks ();
+				event.motion.windowID = windowID;
+				event.motion.x = x;
+				event.motion.y = y;
+				event.motion.xrel = (int)x - injectedMouseX;
+				event.motion.yrel = (int)y - injectedMouseY;
+				injectedMouseX = x;
+				injectedMouseY = y;
+				break;
+
+			case MOUSE_WHEEL:
+
+				event.type = SDL_MOUSEWHEEL;
+				event.wheel.timestamp = SDL_GetTicks ();
+				event.wheel.windowID = windowID;
+				event.wheel.x = x;
+				event.wheel.y = y;
+				event.wheel.preciseX = x;
+				event.wheel.preciseY = y;
+				event.wheel.direction = SDL_MOUSEWHEEL_NORMAL;
+				break;
+
+			default:
+
+				return;
+
+		}
+
+		SDL_PushEvent (&event);
+
+	}
+
+
+	void SDLWindow::InjectTextEvent (const char* text) {
+
+		if (!text) return;
+
+		Uint32 windowID = SDL_GetWindowID (sdlWindow);
+		size_t length = SDL_strlen (text);
+		size_t position = 0;
+
+		while (position < length) {
+
+			SDL_Event event;
+			SDL_zero (event);
+
+			// SDL_TEXTINPUT holds a limited number of bytes, split longer
+			// text without breaking up UTF-8 sequences
+
+			size_t size = length - position;
+
+			if (size >= SDL_TEXTINPUTEVENT_TEXT_SIZE) {
+
+				size = SDL_TEXTINPUTEVENT_TEXT_SIZE - 1;
+
+				while (size > 0 && (text[position + size] & 0xC0) == 0x80) {
+
+					size--;
+
+				}
+
+				if (size == 0) break;
+
+			}
+
+			event.type = SDL_TEXTINPUT;
+			event.text.timestamp = SDL_GetTicks ();
+			event.text.windowID = windowID;
+			SDL_memcpy (event.text.text, text + position, size);
+			event.text.text[size] = '\0';
+
+			SDL_PushEvent (&event);
+			position += size;
+
+		}
+
+	}
+
+
 	void SDLWindow::Move (int x, int y) {
 
 		SDL_SetWindowPosition (sdlWindow, x, y);
@@ -742,10 +937,73 @@ namespace lime {
 
 		} else if (context) {
 
-			// TODO
+			int drawableWidth;
+			int drawableHeight;
+			SDL_GL_GetDrawableSize (sdlWindow, &drawableWidth, &drawableHeight);
+
+			int x = 0;
+			int y = 0;
+			int width = drawableWidth;
+			int height = drawableHeight;
+
+			if (rect) {
+
+				// GL rows are counted from the bottom
+				x = rect->x;
+				y = drawableHeight - rect->y - rect->height;
+				width = rect->width;
+				height = rect->height;
+
+			}
+
+			OpenGLReadback::Read (x, y, width, height, buffer);
+
+		}
+
+	}
+
+
+	int SDLWindow::ReadPixelsAsync (Rectangle *rect) {
+
+		if (!context || sdlRenderer || !OpenGLReadback::IsSupported ()) {
+
+			return -1;
+
+		}
+
+		if (!readback) {
+
+			readback = new OpenGLReadback ();
+
+		}
+
+		int drawableWidth;
+		int drawableHeight;
+		SDL_GL_GetDrawableSize (sdlWindow, &drawableWidth, &drawableHeight);
+
+		if (rect) {
+
+			return readback->Request (rect->x, drawableHeight - rect->y - rect->height, rect->width, rect->height);
+
+		} else {
+
+			return readback->Request (0, 0, drawableWidth, drawableHeight);
+
+		}
+
+	}
+
+
+	int SDLWindow::ReadPixelsAsyncResult (int id, ImageBuffer *buffer) {
+
+		if (!readback) {
+
+			return READBACK_UNKNOWN;
 
 		}
 
+		return readback->Collect (id, buffer);
+
 	}
 
 
@@ -933,6 +1191,103 @@ namespace lime {
 	}
 
 
+	void SDLWindow::SetDirtyRects (const int* rects, int count) {
+
+		dirtyRects.clear ();
+
+		if (!sdlRenderer || !rects || count <= 0) return;
+
+		SDL_Rect bounds = { 0, 0, contextWidth, contextHeight };
+		SDL_Rect rect;
+
+		for (int i = 0; i < count; i++) {
+
+			SDL_Rect source = { rects[i * 4], rects[i * 4 + 1], rects[i * 4 + 2], rects[i * 4 + 3] };
+
+			if (SDL_IntersectRect (&source, &bounds, &rect)) {
+
+				dirtyRects.push_back (rect);
+
+			}
+
+		}
+
+		// merge overlapping regions first, then the pairs that waste the
+		// least area until the count is down to MAX_DIRTY_RECTS
+
+		bool merged = true;
+
+		while (merged) {
+
+			merged = false;
+
+			for (size_t i = 0; i < dirtyRects.size () && !merged; i++) {
+
+				for (size_t j = i + 1; j < dirtyRects.size (); j++) {
+
+					if (SDL_HasIntersection (&dirtyRects[i], &dirtyRects[j])) {
+
+						SDL_UnionRect (&dirtyRects[i], &dirtyRects[j], &dirtyRects[i]);
+						dirtyRects.erase (dirtyRects.begin () + j);
+						merged = true;
+						break;
+
+					}
+
+				}
+
+			}
+
+		}
+
+		while ((int)dirtyRects.size () > MAX_DIRTY_RECTS) {
+
+			size_t bestA = 0;
+			size_t bestB = 1;
+			long long bestCost = -1;
+
+			for (size_t i = 0; i < dirtyRects.size (); i++) {
+
+				for (size_t j = i + 1; j < dirtyRects.size (); j++) {
+
+					SDL_UnionRect (&dirtyRects[i], &dirtyRects[j], &rect);
+
+					long long cost = (long long)rect.w * rect.h - (long long)dirtyRects[i].w * dirtyRects[i].h - (long long)dirtyRects[j].w * dirtyRects[j].h;
+
+					if (bestCost < 0 || cost < bestCost) {
+
+						bestA = i;
+						bestB = j;
+						bestCost = cost;
+
+					}
+
+				}
+
+			}
+
+			SDL_UnionRect (&dirtyRects[bestA], &dirtyRects[bestB], &dirtyRects[bestA]);
+			dirtyRects.erase (dirtyRects.begin () + bestB);
+
+		}
+
+		long long area = 0;
+
+		for (size_t i = 0; i < dirtyRects.size (); i++) {
+
+			area += (long long)dirtyRects[i].w * dirtyRects[i].h;
+
+		}
+
+		if (area * 4 >= (long long)contextWidth * contextHeight * 3) {
+
+			dirtyRects.clear ();
+
+		}
+
+	}
+
+
 	void SDLWindow::SetDisplayMode (DisplayMode* displayMode) {
 
 		Uint32 pixelFormat = 0;
@@ -6,11 +6,15 @@
 #include <graphics/ImageBuffer.h>
 #include <ui/Cursor.h>
 #include <ui/Window.h>
+#include <vector>
 
 
 namespace lime {
 
 
+	class OpenGLReadback;
+
+
 	class SDLWindow : public Window {
 
 		public:
@@ -39,13 +43,19 @@ namespace lime {
 			virtual int GetWidth ();
 			virtual int GetX ();
 			virtual int GetY ();
+			virtual void InjectKeyEvent (int type, int keyCode, int modifier);
+			virtual void InjectMouseEvent (int type, double x, double y, int button);
+			virtual void InjectTextEvent (const char* text);
 			virtual void Move (int x, int y);
 			virtual void ReadPixels (ImageBuffer *buffer, Rectangle *rect);
+			virtual int ReadPixelsAsync (Rectangle *rect);
+			virtual int ReadPixelsAsyncResult (int id, ImageBuffer *buffer);
 			virtual void Resize (int width, int height);
 			virtual void SetMinimumSize (int width, int height);
 			virtual void SetMaximumSize (int width, int height);
 			virtual bool SetBorderless (bool borderless);
 			virtual void SetCursor (Cursor cursor);
+			virtual void SetDirtyRects (const int* rects, int count);
 			virtual void SetDisplayMode (DisplayMode* displayMode);
 			virtual bool SetFullscreen (bool fullscreen);
 			virtual void SetIcon (ImageBuffer *imageBuffer);
@@ -69,6 +79,11 @@ namespace lime {
 			SDL_GLContext context;
 			int contextHeight;
 			int contextWidth;
+			bool contextResized;
+			std::vector<SDL_Rect> dirtyRects;
+			OpenGLReadback* readback;
+			int injectedMouseX;
+			int injectedMouseY;
 
 	};
 
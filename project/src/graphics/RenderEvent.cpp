@@ -1,3 +1,4 @@
+#include <app/EventQueue.h>
 #include <graphics/RenderEvent.h>
 #include <system/CFFI.h>
 
@@ -21,6 +22,8 @@ namespace lime {
 
 	void RenderEvent::Dispatch (RenderEvent* event) {
 
+		EventQueue::Flush ();
+
 		if (RenderEvent::callback) {
 
 			if (RenderEvent::eventObject->IsCFFIValue ()) {
@@ -0,0 +1,264 @@
+#include "OpenGL.h"
+#include "OpenGLBindings.h"
+#include "OpenGLReadback.h"
+#include <string.h>
+
+
+namespace lime {
+
+
+	enum ReadbackSlotState {
+
+		SLOT_FREE,
+		SLOT_PENDING,
+		SLOT_READY
+
+	};
+
+
+	static void CopyFlipped (const unsigned char* source, unsigned char* dest, int width, int height) {
+
+		// GL rows start at the bottom, image buffers at the top
+
+		int stride = width * 4;
+
+		for (int row = 0; row < height; row++) {
+
+			memcpy (dest + row * stride, source + (height - row - 1) * stride, stride);
+
+		}
+
+	}
+
+
+	OpenGLReadback::OpenGLReadback () {
+
+		nextID = 0;
+
+		for (int i = 0; i < RING_SIZE; i++) {
+
+			slots[i].buffer = 0;
+			slots[i].capacity = 0;
+			slots[i].fence = 0;
+			slots[i].frames = 0;
+			slots[i].height = 0;
+			slots[i].id = -1;
+			slots[i].state = SLOT_FREE;
+			slots[i].width = 0;
+
+		}
+
+	}
+
+
+	OpenGLReadback::~OpenGLReadback () {
+
+		#ifdef LIME_GLES3_API
+		for (int i = 0; i < RING_SIZE; i++) {
+
+			if (slots[i].fence) glDeleteSync ((GLsync)slots[i].fence);
+			if (slots[i].buffer) glDeleteBuffers (1, &slots[i].buffer);
+
+		}
+		#endif
+
+	}
+
+
+	int OpenGLReadback::Collect (int id, ImageBuffer* buffer) {
+
+		for (int i = 0; i < RING_SIZE; i++) {
+
+			Slot* slot = &slots[i];
+
+			if (slot->state == SLOT_FREE || slot->id != id) continue;
+			if (slot->state == SLOT_PENDING) return READBACK_PENDING;
+
+			buffer->Resize (slot->width, slot->height, 32);
+
+			if (buffer->data && slot->pixels.size () > 0) {
+
+				memcpy (buffer->data->buffer->b, &slot->pixels[0], slot->pixels.size ());
+
+			}
+
+			slot->id = -1;
+			slot->state = SLOT_FREE;
+			return READBACK_READY;
+
+		}
+
+		return READBACK_UNKNOWN;
+
+	}
+
+
+	void OpenGLReadback::Complete (Slot* slot) {
+
+		#ifdef LIME_GLES3_API
+		GLint previousBuffer = 0;
+		glGetIntegerv (GL_PIXEL_PACK_BUFFER_BINDING, &previousBuffer);
+
+		int size = slot->width * slot->height * 4;
+		slot->pixels.resize (size);
+
+		glBindBuffer (GL_PIXEL_PACK_BUFFER, slot->buffer);
+		const unsigned char* data = (const unsigned char*)glMapBufferRange (GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+
+		if (data) {
+
+			CopyFlipped (data, &slot->pixels[0], slot->width, slot->height);
+			glUnmapBuffer (GL_PIXEL_PACK_BUFFER);
+
+		} else {
+
+			memset (&slot->pixels[0], 0, size);
+
+		}
+
+		glBindBuffer (GL_PIXEL_PACK_BUFFER, previousBuffer);
+
+		glDeleteSync ((GLsync)slot->fence);
+		slot->fence = 0;
+		#endif
+
+		slot->state = SLOT_READY;
+
+	}
+
+
+	bool OpenGLReadback::IsSupported () {
+
+		#ifdef LIME_GLES3_API
+		return CHECK_EXT (glFenceSync) && CHECK_EXT (glClientWaitSync) && CHECK_EXT (glMapBufferRange);
+		#else
+		return false;
+		#endif
+
+	}
+
+
+	void OpenGLReadback::Poll () {
+
+		#ifdef LIME_GLES3_API
+		for (int i = 0; i < RING_SIZE; i++) {
+
+			Slot* slot = &slots[i];
+
+			if (slot->state != SLOT_PENDING) continue;
+
+			slot->frames++;
+
+			GLenum result = glClientWaitSync ((GLsync)slot->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+			// a request that has waited for the whole ring is completed
+			// anyway, mapping the buffer then waits for the copy to finish
+
+			if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || slot->frames >= RING_SIZE) {
+
+				Complete (slot);
+
+			}
+
+		}
+		#endif
+
+	}
+
+
+	void OpenGLReadback::Read (int x, int y, int width, int height, ImageBuffer* buffer) {
+
+		buffer->Resize (width, height, 32);
+
+		if (!buffer->data || width <= 0 || height <= 0) return;
+
+		GLint previousFramebuffer = 0;
+		glGetIntegerv (GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+		glBindFramebuffer (GL_FRAMEBUFFER, OpenGLBindings::defaultFramebuffer);
+
+		#ifdef LIME_GLES3_API
+		GLint previousBuffer = 0;
+		glGetIntegerv (GL_PIXEL_PACK_BUFFER_BINDING, &previousBuffer);
+		glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);
+		#endif
+
+		std::vector<unsigned char> pixels (width * height * 4);
+		glReadPixels (x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, &pixels[0]);
+		CopyFlipped (&pixels[0], buffer->data->buffer->b, width, height);
+
+		#ifdef LIME_GLES3_API
+		glBindBuffer (GL_PIXEL_PACK_BUFFER, previousBuffer);
+		#endif
+
+		glBindFramebuffer (GL_FRAMEBUFFER, previousFramebuffer);
+
+	}
+
+
+	int OpenGLReadback::Request (int x, int y, int width, int height) {
+
+		#ifdef LIME_GLES3_API
+		if (width <= 0 || height <= 0) return -1;
+
+		Slot* slot = 0;
+
+		for (int i = 0; i < RING_SIZE; i++) {
+
+			if (slots[i].state == SLOT_FREE) {
+
+				slot = &slots[i];
+				break;
+
+			}
+
+		}
+
+		// every slot is in flight or waiting to be collected, the caller
+		// falls back to a synchronous read
+
+		if (!slot) return -1;
+
+		GLint previousBuffer = 0;
+		GLint previousFramebuffer = 0;
+		glGetIntegerv (GL_PIXEL_PACK_BUFFER_BINDING, &previousBuffer);
+		glGetIntegerv (GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+
+		if (!slot->buffer) glGenBuffers (1, &slot->buffer);
+
+		int size = width * height * 4;
+
+		glBindBuffer (GL_PIXEL_PACK_BUFFER, slot->buffer);
+
+		if (size > slot->capacity) {
+
+			glBufferData (GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+			slot->capacity = size;
+
+		}
+
+		glBindFramebuffer (GL_FRAMEBUFFER, OpenGLBindings::defaultFramebuffer);
+		glReadPixels (x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+		slot->fence = glFenceSync (GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		glBindFramebuffer (GL_FRAMEBUFFER, previousFramebuffer);
+		glBindBuffer (GL_PIXEL_PACK_BUFFER, previousBuffer);
+
+		if (!slot->fence) return -1;
+
+		slot->frames = 0;
+		slot->height = height;
+		slot->id = nextID++;
+		slot->state = SLOT_PENDING;
+		slot->width = width;
+
+		if (nextID < 0) nextID = 0;
+
+		return slot->id;
+		#else
+		return -1;
+		#endif
+
+	}
+
+
+}
@@ -0,0 +1,71 @@
+#ifndef LIME_GRAPHICS_OPENGL_OPENGL_READBACK_H
+#define LIME_GRAPHICS_OPENGL_OPENGL_READBACK_H
+
+
+#include <graphics/ImageBuffer.h>
+#include <vector>
+
+
+namespace lime {
+
+
+	enum ReadbackStatus {
+
+		READBACK_UNKNOWN = -1,
+		READBACK_PENDING = 0,
+		READBACK_READY = 1
+
+	};
+
+
+	// Reads the default framebuffer through a ring of pixel pack buffers, so
+	// the copy runs on the GPU while the next frames are rendered. Requests
+	// are completed in Poll, which is expected to run once per frame after
+	// the buffer swap, and picked up with Collect.
+
+	class OpenGLReadback {
+
+
+		public:
+
+			OpenGLReadback ();
+			~OpenGLReadback ();
+
+			int Collect (int id, ImageBuffer* buffer);
+			void Poll ();
+			int Request (int x, int y, int width, int height);
+
+			static bool IsSupported ();
+			static void Read (int x, int y, int width, int height, ImageBuffer* buffer);
+
+		private:
+
+			struct Slot {
+
+				unsigned int buffer;
+				int capacity;
+				void* fence;
+				int frames;
+				int height;
+				int id;
+				std::vector<unsigned char> pixels;
+				int state;
+				int width;
+
+			};
+
+			void Complete (Slot* slot);
+
+			static const int RING_SIZE = 4;
+
+			int nextID;
+			Slot slots[RING_SIZE];
+
+
+	};
+
+
+}
+
+
+#endif
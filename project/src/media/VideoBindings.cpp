@@ -0,0 +1,318 @@
+#include <graphics/ImageBuffer.h>
+#include <media/VideoDecoder.h>
+#include <media/VideoRecorder.h>
+#include <system/CFFI.h>
+#include <system/CFFIPointer.h>
+
+
+namespace lime {
+
+
+	static int id_codec;
+	static int id_duration;
+	static int id_frameRate;
+	static int id_height;
+	static int id_width;
+	static bool init = false;
+
+
+	void gc_video_decoder (value handle) {
+
+		VideoDecoder* decoder = (VideoDecoder*)val_data (handle);
+		delete decoder;
+
+	}
+
+
+	void hl_gc_video_decoder (HL_CFFIPointer* handle) {
+
+		VideoDecoder* decoder = (VideoDecoder*)handle->ptr;
+		delete decoder;
+
+	}
+
+
+	void gc_video_recorder (value handle) {
+
+		VideoRecorder* recorder = (VideoRecorder*)val_data (handle);
+		delete recorder;
+
+	}
+
+
+	void hl_gc_video_recorder (HL_CFFIPointer* handle) {
+
+		VideoRecorder* recorder = (VideoRecorder*)handle->ptr;
+		delete recorder;
+
+	}
+
+
+	void lime_video_decoder_close (value handle) {
+
+		VideoDecoder* decoder = (VideoDecoder*)val_data (handle);
+		decoder->Close ();
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_video_decoder_close) (HL_CFFIPointer* handle) {
+
+		VideoDecoder* decoder = (VideoDecoder*)handle->ptr;
+		decoder->Close ();
+
+	}
+
+
+	value lime_video_decoder_get_info (value handle) {
+
+		VideoDecoder* decoder = (VideoDecoder*)val_data (handle);
+
+		if (!init) {
+
+			id_codec = val_id ("codec");
+			id_duration = val_id ("duration");
+			id_frameRate = val_id ("frameRate");
+			id_height = val_id ("height");
+			id_width = val_id ("width");
+			init = true;
+
+		}
+
+		value info = alloc_empty_object ();
+		alloc_field (info, id_codec, alloc_int (decoder->codec));
+		alloc_field (info, id_duration, alloc_float (decoder->duration));
+		alloc_field (info, id_frameRate, alloc_float (decoder->frameRate));
+		alloc_field (info, id_height, alloc_int (decoder->height));
+		alloc_field (info, id_width, alloc_int (decoder->width));
+		return info;
+
+	}
+
+
+	HL_PRIM vdynamic* HL_NAME(hl_video_decoder_get_info) (HL_CFFIPointer* handle) {
+
+		VideoDecoder* decoder = (VideoDecoder*)handle->ptr;
+
+		if (!init) {
+
+			id_codec = hl_hash_utf8 ("codec");
+			id_duration = hl_hash_utf8 ("duration");
+			id_frameRate = hl_hash_utf8 ("frameRate");
+			id_height = hl_hash_utf8 ("height");
+			id_width = hl_hash_utf8 ("width");
+			init = true;
+
+		}
+
+		vdynamic* info = (vdynamic*)hl_alloc_dynobj ();
+		hl_dyn_seti (info, id_codec, &hlt_i32, decoder->codec);
+		hl_dyn_setd (info, id_duration, decoder->duration);
+		hl_dyn_setd (info, id_frameRate, decoder->frameRate);
+		hl_dyn_seti (info, id_height, &hlt_i32, decoder->height);
+		hl_dyn_seti (info, id_width, &hlt_i32, decoder->width);
+		return info;
+
+	}
+
+
+	value lime_video_decoder_open (HxString path, int format, int threads, int ringSize) {
+
+		VideoDecoder* decoder = new VideoDecoder (format, threads, ringSize);
+
+		if (decoder->Open (hxs_utf8 (path, nullptr))) {
+
+			return CFFIPointer (decoder, gc_video_decoder);
+
+		}
+
+		delete decoder;
+		return alloc_null ();
+
+	}
+
+
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_video_decoder_open) (hl_vstring* path, int format, int threads, int ringSize) {
+
+		VideoDecoder* decoder = new VideoDecoder (format, threads, ringSize);
+
+		if (path && decoder->Open ((const char*)hl_to_utf8 ((const uchar*)path->bytes))) {
+
+			return HLCFFIPointer (decoder, (hl_finalizer)hl_gc_video_decoder);
+
+		}
+
+		delete decoder;
+		return NULL;
+
+	}
+
+
+	double lime_video_decoder_read (value handle, double time, double data, int length) {
+
+		VideoDecoder* decoder = (VideoDecoder*)val_data (handle);
+		return decoder->Read (time, (unsigned char*)(uintptr_t)data, length);
+
+	}
+
+
+	HL_PRIM double HL_NAME(hl_video_decoder_read) (HL_CFFIPointer* handle, double time, double data, int length) {
+
+		VideoDecoder* decoder = (VideoDecoder*)handle->ptr;
+		return decoder->Read (time, (unsigned char*)(uintptr_t)data, length);
+
+	}
+
+
+	void lime_video_decoder_seek (value handle, double time) {
+
+		VideoDecoder* decoder = (VideoDecoder*)val_data (handle);
+		decoder->Seek (time);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_video_decoder_seek) (HL_CFFIPointer* handle, double time) {
+
+		VideoDecoder* decoder = (VideoDecoder*)handle->ptr;
+		decoder->Seek (time);
+
+	}
+
+
+	bool lime_video_recorder_add_frame (value handle, value imageBuffer, double time) {
+
+		VideoRecorder* recorder = (VideoRecorder*)val_data (handle);
+		ImageBuffer buffer (imageBuffer);
+		return recorder->AddFrame (&buffer, time);
+
+	}
+
+
+	HL_PRIM bool HL_NAME(hl_video_recorder_add_frame) (HL_CFFIPointer* handle, ImageBuffer* imageBuffer, double time) {
+
+		VideoRecorder* recorder = (VideoRecorder*)handle->ptr;
+		return recorder->AddFrame (imageBuffer, time);
+
+	}
+
+
+	bool lime_video_recorder_close (value handle) {
+
+		VideoRecorder* recorder = (VideoRecorder*)val_data (handle);
+		return recorder->Close ();
+
+	}
+
+
+	HL_PRIM bool HL_NAME(hl_video_recorder_close) (HL_CFFIPointer* handle) {
+
+		VideoRecorder* recorder = (VideoRecorder*)handle->ptr;
+		return recorder->Close ();
+
+	}
+
+
+	value lime_video_recorder_create (HxString path, int width, int height, double frameRate, int codec, int bitrate, int threads, int queueSize) {
+
+		VideoRecorder* recorder = new VideoRecorder (width, height, frameRate, codec, bitrate, threads, queueSize);
+
+		if (recorder->Open (hxs_utf8 (path, nullptr))) {
+
+			return CFFIPointer (recorder, gc_video_recorder);
+
+		}
+
+		delete recorder;
+		return alloc_null ();
+
+	}
+
+
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_video_recorder_create) (hl_vstring* path, int width, int height, double frameRate, int codec, int bitrate, int threads, int queueSize) {
+
+		VideoRecorder* recorder = new VideoRecorder (width, height, frameRate, codec, bitrate, threads, queueSize);
+
+		if (path && recorder->Open ((const char*)hl_to_utf8 ((const uchar*)path->bytes))) {
+
+			return HLCFFIPointer (recorder, (hl_finalizer)hl_gc_video_recorder);
+
+		}
+
+		delete recorder;
+		return NULL;
+
+	}
+
+
+	int lime_video_recorder_get_dropped_frames (value handle) {
+
+		VideoRecorder* recorder = (VideoRecorder*)val_data (handle);
+		return recorder->GetDroppedFrames ();
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_video_recorder_get_dropped_frames) (HL_CFFIPointer* handle) {
+
+		VideoRecorder* recorder = (VideoRecorder*)handle->ptr;
+		return recorder->GetDroppedFrames ();
+
+	}
+
+
+	int lime_video_recorder_get_encoded_frames (value handle) {
+
+		VideoRecorder* recorder = (VideoRecorder*)val_data (handle);
+		return recorder->GetEncodedFrames ();
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_video_recorder_get_encoded_frames) (HL_CFFIPointer* handle) {
+
+		VideoRecorder* recorder = (VideoRecorder*)handle->ptr;
+		return recorder->GetEncodedFrames ();
+
+	}
+
+
+	DEFINE_PRIME1v (lime_video_decoder_close);
+	DEFINE_PRIME1 (lime_video_decoder_get_info);
+	DEFINE_PRIME4 (lime_video_decoder_open);
+	DEFINE_PRIME4 (lime_video_decoder_read);
+	DEFINE_PRIME2v (lime_video_decoder_seek);
+	DEFINE_PRIME3 (lime_video_recorder_add_frame);
+	DEFINE_PRIME1 (lime_video_recorder_close);
+	DEFINE_PRIME8 (lime_video_recorder_create);
+	DEFINE_PRIME1 (lime_video_recorder_get_dropped_frames);
+	DEFINE_PRIME1 (lime_video_recorder_get_encoded_frames);
+
+
+	#define _TBYTES _OBJ (_I32 _BYTES)
+	#define _TCFFIPOINTER _DYN
+
+	#define _TARRAYBUFFER _TBYTES
+	#define _TARRAYBUFFERVIEW _OBJ (_I32 _TARRAYBUFFER _I32 _I32 _I32 _I32)
+	#define _TIMAGEBUFFER _OBJ (_I32 _TARRAYBUFFERVIEW _I32 _I32 _BOOL _BOOL _I32 _DYN _DYN _DYN _DYN _DYN _DYN)
+
+	DEFINE_HL_PRIM (_VOID, hl_video_decoder_close, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_DYN, hl_video_decoder_get_info, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_video_decoder_open, _STRING _I32 _I32 _I32);
+	DEFINE_HL_PRIM (_F64, hl_video_decoder_read, _TCFFIPOINTER _F64 _F64 _I32);
+	DEFINE_HL_PRIM (_VOID, hl_video_decoder_seek, _TCFFIPOINTER _F64);
+	DEFINE_HL_PRIM (_BOOL, hl_video_recorder_add_frame, _TCFFIPOINTER _TIMAGEBUFFER _F64);
+	DEFINE_HL_PRIM (_BOOL, hl_video_recorder_close, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_video_recorder_create, _STRING _I32 _I32 _F64 _I32 _I32 _I32 _I32);
+	DEFINE_HL_PRIM (_I32, hl_video_recorder_get_dropped_frames, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_I32, hl_video_recorder_get_encoded_frames, _TCFFIPOINTER);
+
+
+}
+
+
+extern "C" int lime_video_register_prims () {
+
+	return 0;
+
+}
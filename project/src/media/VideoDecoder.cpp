@@ -0,0 +1,543 @@
+#include <media/VideoDecoder.h>
+#include <vpx/vp8dx.h>
+#include <string.h>
+
+
+namespace lime {
+
+
+	enum VideoDecoderSlotState {
+
+		SLOT_FREE,
+		SLOT_WRITING,
+		SLOT_READY,
+		SLOT_READING
+
+	};
+
+
+	static inline unsigned char Clamp (int value) {
+
+		return (unsigned char)(value < 0 ? 0 : (value > 255 ? 255 : value));
+
+	}
+
+
+	VideoDecoder::VideoDecoder (int format, int threads, int ringSize) {
+
+		this->format = format;
+		this->threads = threads > 0 ? threads : 1;
+
+		clockTime = 0;
+		codec = VIDEO_CODEC_VP8;
+		duration = 0;
+		ended = false;
+		frameRate = 0;
+		generation = 0;
+		height = 0;
+		opened = false;
+		reader = 0;
+		seekRequested = false;
+		seekTime = 0;
+		segment = 0;
+		stopping = false;
+		track = 0;
+		width = 0;
+
+		if (ringSize <= 0) ringSize = 4;
+		slots.resize (ringSize > 1 ? ringSize : 2);
+
+	}
+
+
+	VideoDecoder::~VideoDecoder () {
+
+		Close ();
+
+	}
+
+
+	VideoDecoder::Slot* VideoDecoder::Acquire (int generation) {
+
+		std::unique_lock<std::mutex> lock (mutex);
+
+		while (!stopping && !seekRequested && this->generation == generation) {
+
+			for (size_t i = 0; i < slots.size (); i++) {
+
+				if (slots[i].state == SLOT_FREE) {
+
+					slots[i].generation = generation;
+					slots[i].state = SLOT_WRITING;
+					return &slots[i];
+
+				}
+
+			}
+
+			changed.wait (lock);
+
+		}
+
+		return 0;
+
+	}
+
+
+	void VideoDecoder::Close () {
+
+		if (!opened) return;
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			stopping = true;
+
+		}
+
+		changed.notify_all ();
+		worker.join ();
+
+		vpx_codec_destroy (&decoder);
+
+		delete segment;
+		segment = 0;
+		track = 0;
+
+		reader->Close ();
+		delete reader;
+		reader = 0;
+
+		opened = false;
+
+	}
+
+
+	void VideoDecoder::ConvertI420ToRGBA (const unsigned char* y, int yStride, const unsigned char* u, int uStride, const unsigned char* v, int vStride, int width, int height, unsigned char* rgba, int stride) {
+
+		// BT.601 limited range
+
+		for (int row = 0; row < height; row++) {
+
+			const unsigned char* yRow = y + row * yStride;
+			const unsigned char* uRow = u + (row / 2) * uStride;
+			const unsigned char* vRow = v + (row / 2) * vStride;
+			unsigned char* dest = rgba + row * stride;
+
+			for (int x = 0; x < width; x++) {
+
+				int c = 298 * (yRow[x] - 16) + 128;
+				int d = uRow[x / 2] - 128;
+				int e = vRow[x / 2] - 128;
+
+				dest[0] = Clamp ((c + 409 * e) >> 8);
+				dest[1] = Clamp ((c - 100 * d - 208 * e) >> 8);
+				dest[2] = Clamp ((c + 516 * d) >> 8);
+				dest[3] = 0xFF;
+				dest += 4;
+
+			}
+
+		}
+
+	}
+
+
+	void VideoDecoder::Decode () {
+
+		const mkvparser::BlockEntry* entry = 0;
+		track->GetFirst (entry);
+
+		std::vector<unsigned char> data;
+		int currentGeneration;
+		double previousTime = -1;
+		double skipBefore = 0;
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			currentGeneration = generation;
+
+		}
+
+		while (true) {
+
+			{
+
+				std::unique_lock<std::mutex> lock (mutex);
+
+				while (!stopping && !seekRequested && ended) {
+
+					changed.wait (lock);
+
+				}
+
+				if (stopping) break;
+
+				if (seekRequested) {
+
+					seekRequested = false;
+					currentGeneration = generation;
+					previousTime = -1;
+					skipBefore = seekTime;
+					lock.unlock ();
+
+					entry = 0;
+
+					if (track->Seek ((long long)(skipBefore * 1000000.0), entry) < 0 || !entry) {
+
+						track->GetFirst (entry);
+
+					}
+
+					continue;
+
+				}
+
+			}
+
+			if (!entry || entry->EOS ()) {
+
+				std::unique_lock<std::mutex> lock (mutex);
+				if (!seekRequested) ended = true;
+				changed.notify_all ();
+				continue;
+
+			}
+
+			const mkvparser::Block* block = entry->GetBlock ();
+			double time = block->GetTime (entry->GetCluster ()) / 1000000.0;
+
+			// a frame is only worth converting if it is still on screen at
+			// the seek target or the current clock, otherwise it only
+			// rebuilds the reference frames
+			double interval = (previousTime >= 0 && time > previousTime) ? time - previousTime : (frameRate > 0 ? 1000.0 / frameRate : 0);
+			previousTime = time;
+
+			for (int i = 0; i < block->GetFrameCount (); i++) {
+
+				const mkvparser::Block::Frame& frame = block->GetFrame (i);
+
+				if (frame.len <= 0) continue;
+
+				data.resize (frame.len);
+
+				if (frame.Read (reader, &data[0]) < 0 || vpx_codec_decode (&decoder, &data[0], (unsigned int)frame.len, NULL, 0) != VPX_CODEC_OK) {
+
+					continue;
+
+				}
+
+				vpx_codec_iter_t iterator = NULL;
+				vpx_image_t* image;
+
+				while ((image = vpx_codec_get_frame (&decoder, &iterator)) != NULL) {
+
+					double deadline = skipBefore;
+
+					{
+
+						std::unique_lock<std::mutex> lock (mutex);
+						if (clockTime > deadline) deadline = clockTime;
+
+					}
+
+					if (interval > 0 && time + interval <= deadline) continue;
+
+					Output (image, time, currentGeneration);
+
+				}
+
+			}
+
+			const mkvparser::BlockEntry* next = 0;
+
+			if (track->GetNext (entry, next) < 0) {
+
+				next = 0;
+
+			}
+
+			entry = next;
+
+		}
+
+	}
+
+
+	int VideoDecoder::GetFrameSize () {
+
+		if (format == VIDEO_FRAME_I420) {
+
+			return width * height + ((width + 1) / 2) * ((height + 1) / 2) * 2;
+
+		}
+
+		return width * height * 4;
+
+	}
+
+
+	bool VideoDecoder::Open (const char* path) {
+
+		if (opened || !path) return false;
+
+		reader = new mkvparser::MkvReader ();
+
+		if (reader->Open (path) != 0) {
+
+			delete reader;
+			reader = 0;
+			return false;
+
+		}
+
+		long long position = 0;
+		mkvparser::EBMLHeader header;
+
+		if (header.Parse (reader, position) < 0 || mkvparser::Segment::CreateInstance (reader, position, segment) != 0 || !segment || segment->Load () < 0) {
+
+			delete segment;
+			segment = 0;
+			reader->Close ();
+			delete reader;
+			reader = 0;
+			return false;
+
+		}
+
+		const mkvparser::Tracks* tracks = segment->GetTracks ();
+
+		for (unsigned long i = 0; tracks && i < tracks->GetTracksCount (); i++) {
+
+			const mkvparser::Track* candidate = tracks->GetTrackByIndex (i);
+
+			if (candidate && candidate->GetType () == mkvparser::Track::kVideo) {
+
+				track = (const mkvparser::VideoTrack*)candidate;
+				break;
+
+			}
+
+		}
+
+		vpx_codec_iface_t* codecInterface = 0;
+
+		if (track && track->GetCodecId ()) {
+
+			if (strcmp (track->GetCodecId (), "V_VP8") == 0) {
+
+				codec = VIDEO_CODEC_VP8;
+				codecInterface = vpx_codec_vp8_dx ();
+
+			} else if (strcmp (track->GetCodecId (), "V_VP9") == 0) {
+
+				codec = VIDEO_CODEC_VP9;
+				#ifdef LIME_VPX_VP9
+				codecInterface = vpx_codec_vp9_dx ();
+				#endif
+
+			}
+
+		}
+
+		width = track ? (int)track->GetWidth () : 0;
+		height = track ? (int)track->GetHeight () : 0;
+
+		vpx_codec_dec_cfg_t config;
+		config.threads = threads;
+		config.w = width;
+		config.h = height;
+
+		if (!codecInterface || width <= 0 || height <= 0 || vpx_codec_dec_init (&decoder, codecInterface, &config, 0) != VPX_CODEC_OK) {
+
+			track = 0;
+			delete segment;
+			segment = 0;
+			reader->Close ();
+			delete reader;
+			reader = 0;
+			return false;
+
+		}
+
+		duration = segment->GetInfo () ? segment->GetInfo ()->GetDuration () / 1000000.0 : 0;
+		frameRate = track->GetFrameRate ();
+
+		int size = GetFrameSize ();
+
+		for (size_t i = 0; i < slots.size (); i++) {
+
+			slots[i].generation = 0;
+			slots[i].pixels.resize (size);
+			slots[i].state = SLOT_FREE;
+			slots[i].time = 0;
+
+		}
+
+		opened = true;
+		worker = std::thread (&VideoDecoder::Decode, this);
+
+		return true;
+
+	}
+
+
+	bool VideoDecoder::Output (vpx_image_t* image, double time, int generation) {
+
+		if (image->fmt != VPX_IMG_FMT_I420 || (int)image->d_w != width || (int)image->d_h != height) {
+
+			return false;
+
+		}
+
+		Slot* slot = Acquire (generation);
+
+		if (!slot) return false;
+
+		unsigned char* dest = &slot->pixels[0];
+
+		if (format == VIDEO_FRAME_I420) {
+
+			int chromaWidth = (width + 1) / 2;
+			int chromaHeight = (height + 1) / 2;
+
+			for (int row = 0; row < height; row++) {
+
+				memcpy (dest, image->planes[VPX_PLANE_Y] + row * image->stride[VPX_PLANE_Y], width);
+				dest += width;
+
+			}
+
+			for (int plane = VPX_PLANE_U; plane <= VPX_PLANE_V; plane++) {
+
+				for (int row = 0; row < chromaHeight; row++) {
+
+					memcpy (dest, image->planes[plane] + row * image->stride[plane], chromaWidth);
+					dest += chromaWidth;
+
+				}
+
+			}
+
+		} else {
+
+			ConvertI420ToRGBA (image->planes[VPX_PLANE_Y], image->stride[VPX_PLANE_Y], image->planes[VPX_PLANE_U], image->stride[VPX_PLANE_U], image->planes[VPX_PLANE_V], image->stride[VPX_PLANE_V], width, height, dest, width * 4);
+
+		}
+
+		std::unique_lock<std::mutex> lock (mutex);
+
+		if (slot->generation != this->generation) {
+
+			slot->state = SLOT_FREE;
+			return false;
+
+		}
+
+		slot->state = SLOT_READY;
+		slot->time = time;
+		return true;
+
+	}
+
+
+	double VideoDecoder::Read (double time, unsigned char* dest, int length) {
+
+		if (!opened) return VIDEO_FRAME_ENDED;
+
+		Slot* slot = 0;
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			clockTime = time;
+
+			for (size_t i = 0; i < slots.size (); i++) {
+
+				if (slots[i].state == SLOT_READY && slots[i].time <= time && (!slot || slots[i].time > slot->time)) {
+
+					slot = &slots[i];
+
+				}
+
+			}
+
+			if (!slot) {
+
+				bool pending = false;
+
+				for (size_t i = 0; i < slots.size (); i++) {
+
+					if (slots[i].state != SLOT_FREE) pending = true;
+
+				}
+
+				return (ended && !pending) ? VIDEO_FRAME_ENDED : VIDEO_FRAME_PENDING;
+
+			}
+
+			// anything older than the frame on screen is stale
+			for (size_t i = 0; i < slots.size (); i++) {
+
+				if (slots[i].state == SLOT_READY && slots[i].time < slot->time) {
+
+					slots[i].state = SLOT_FREE;
+
+				}
+
+			}
+
+			slot->state = SLOT_READING;
+
+		}
+
+		if (dest && length >= (int)slot->pixels.size ()) {
+
+			memcpy (dest, &slot->pixels[0], slot->pixels.size ());
+
+		}
+
+		double frameTime = slot->time;
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			slot->state = SLOT_FREE;
+
+		}
+
+		changed.notify_all ();
+		return frameTime;
+
+	}
+
+
+	void VideoDecoder::Seek (double time) {
+
+		if (!opened) return;
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+
+			clockTime = time;
+			ended = false;
+			generation++;
+			seekRequested = true;
+			seekTime = time < 0 ? 0 : time;
+
+			for (size_t i = 0; i < slots.size (); i++) {
+
+				if (slots[i].state == SLOT_READY) slots[i].state = SLOT_FREE;
+
+			}
+
+		}
+
+		changed.notify_all ();
+
+	}
+
+
+}
@@ -0,0 +1,561 @@
+#include <media/VideoRecorder.h>
+#include <vpx/vp8cx.h>
+#include <algorithm>
+#include <string.h>
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LIME_VIDEO_SSE2
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+#include <arm_neon.h>
+#define LIME_VIDEO_NEON
+#endif
+
+
+namespace lime {
+
+
+	enum VideoRecorderSlotState {
+
+		SLOT_FREE,
+		SLOT_COPYING,
+		SLOT_QUEUED,
+		SLOT_CONVERTING,
+		SLOT_CONVERTED
+
+	};
+
+
+	// BT.601 limited range, the default colorspace for VP8 and VP9
+
+	static inline unsigned char RGBToY (int r, int g, int b) {
+
+		return (unsigned char)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+
+	}
+
+
+	static inline unsigned char RGBToU (int r, int g, int b) {
+
+		return (unsigned char)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+
+	}
+
+
+	static inline unsigned char RGBToV (int r, int g, int b) {
+
+		return (unsigned char)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+
+	}
+
+
+	static void ConvertRowY (const unsigned char* rgba, unsigned char* y, int width) {
+
+		int x = 0;
+
+		#if defined (LIME_VIDEO_SSE2)
+		const __m128i zero = _mm_setzero_si128 ();
+		const __m128i coefficients = _mm_setr_epi16 (66, 129, 25, 0, 66, 129, 25, 0);
+		const __m128i round = _mm_set1_epi32 (128);
+		const __m128i offset = _mm_set1_epi32 (16);
+
+		for (; x + 4 <= width; x += 4) {
+
+			// four pixels, multiply-add gives R+G and B+A sums per pixel,
+			// which are then regrouped and added
+			__m128i pixels = _mm_loadu_si128 ((const __m128i*)(rgba + x * 4));
+			__m128i low = _mm_madd_epi16 (_mm_unpacklo_epi8 (pixels, zero), coefficients);
+			__m128i high = _mm_madd_epi16 (_mm_unpackhi_epi8 (pixels, zero), coefficients);
+
+			__m128 lowf = _mm_castsi128_ps (low);
+			__m128 highf = _mm_castsi128_ps (high);
+			__m128i even = _mm_castps_si128 (_mm_shuffle_ps (lowf, highf, _MM_SHUFFLE (2, 0, 2, 0)));
+			__m128i odd = _mm_castps_si128 (_mm_shuffle_ps (lowf, highf, _MM_SHUFFLE (3, 1, 3, 1)));
+
+			__m128i sum = _mm_add_epi32 (_mm_srai_epi32 (_mm_add_epi32 (_mm_add_epi32 (even, odd), round), 8), offset);
+			__m128i packed = _mm_packs_epi32 (sum, sum);
+			packed = _mm_packus_epi16 (packed, packed);
+
+			int result = _mm_cvtsi128_si32 (packed);
+			memcpy (y + x, &result, 4);
+
+		}
+		#elif defined (LIME_VIDEO_NEON)
+		const uint8x8_t coefficientR = vdup_n_u8 (66);
+		const uint8x8_t coefficientG = vdup_n_u8 (129);
+		const uint8x8_t coefficientB = vdup_n_u8 (25);
+		const uint16x8_t round = vdupq_n_u16 (128);
+		const uint8x8_t offset = vdup_n_u8 (16);
+
+		for (; x + 8 <= width; x += 8) {
+
+			uint8x8x4_t pixels = vld4_u8 (rgba + x * 4);
+			uint16x8_t sum = vmull_u8 (pixels.val[0], coefficientR);
+			sum = vmlal_u8 (sum, pixels.val[1], coefficientG);
+			sum = vmlal_u8 (sum, pixels.val[2], coefficientB);
+			vst1_u8 (y + x, vadd_u8 (vshrn_n_u16 (vaddq_u16 (sum, round), 8), offset));
+
+		}
+		#endif
+
+		for (; x < width; x++) {
+
+			const unsigned char* pixel = rgba + x * 4;
+			y[x] = RGBToY (pixel[0], pixel[1], pixel[2]);
+
+		}
+
+	}
+
+
+	VideoRecorder::VideoRecorder (int width, int height, double frameRate, int codec, int bitrate, int threads, int queueSize) {
+
+		this->bitrate = bitrate > 0 ? bitrate : 4000;
+		this->codec = codec;
+		this->frameRate = frameRate > 0 ? frameRate : 30;
+		this->height = height;
+		this->threads = threads > 0 ? threads : 1;
+		this->width = width;
+
+		closing = false;
+		droppedFrames = 0;
+		encodedFrames = 0;
+		failed = false;
+		lastTime = -1;
+		nextEncode = 0;
+		nextSequence = 0;
+		opened = false;
+		segment = 0;
+		stopping = false;
+		track = 0;
+		writer = 0;
+
+		if (queueSize <= 0) queueSize = 8;
+		slots.resize (queueSize > 1 ? queueSize : 2);
+
+	}
+
+
+	VideoRecorder::~VideoRecorder () {
+
+		Close ();
+
+		if (segment) delete segment;
+		if (writer) delete writer;
+
+	}
+
+
+	bool VideoRecorder::AddFrame (ImageBuffer* buffer, double time) {
+
+		if (!opened || !buffer || !buffer->data || buffer->width != width || buffer->height != height || buffer->bitsPerPixel != 32) {
+
+			return false;
+
+		}
+
+		Slot* slot = 0;
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+
+			if (closing || failed) return false;
+
+			for (size_t i = 0; i < slots.size (); i++) {
+
+				if (slots[i].state == SLOT_FREE) {
+
+					slot = &slots[i];
+					break;
+
+				}
+
+			}
+
+			if (!slot) {
+
+				// the encoder is behind, dropping keeps the caller at frame rate
+				droppedFrames++;
+				return false;
+
+			}
+
+			int64_t timestamp = time >= 0 ? (int64_t)time : (int64_t)(nextSequence * 1000 / frameRate);
+			if (timestamp <= lastTime) timestamp = lastTime + 1;
+			lastTime = timestamp;
+
+			slot->sequence = nextSequence++;
+			slot->state = SLOT_COPYING;
+			slot->time = timestamp;
+
+		}
+
+		// copied outside of the lock so the workers keep going meanwhile
+		int stride = buffer->Stride ();
+		slot->pixels.resize (stride * height);
+		memcpy (&slot->pixels[0], buffer->data->buffer->b, stride * height);
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			slot->state = SLOT_QUEUED;
+
+		}
+
+		queued.notify_one ();
+		return true;
+
+	}
+
+
+	bool VideoRecorder::Close () {
+
+		if (!opened) return false;
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			closing = true;
+
+			while (true) {
+
+				bool busy = false;
+
+				for (size_t i = 0; i < slots.size (); i++) {
+
+					if (slots[i].state != SLOT_FREE) busy = true;
+
+				}
+
+				if (!busy) break;
+				released.wait (lock);
+
+			}
+
+			stopping = true;
+
+		}
+
+		queued.notify_all ();
+		converted.notify_all ();
+
+		for (size_t i = 0; i < converters.size (); i++) {
+
+			converters[i].join ();
+
+		}
+
+		converters.clear ();
+		encoderThread.join ();
+
+		// drain the frames libvpx still holds
+		if (vpx_codec_encode (&encoder, NULL, -1, 1, 0, VPX_DL_REALTIME) != VPX_CODEC_OK || !WritePackets ()) {
+
+			failed = true;
+
+		}
+
+		if (!segment->Finalize ()) {
+
+			failed = true;
+
+		}
+
+		writer->Close ();
+		vpx_codec_destroy (&encoder);
+
+		for (size_t i = 0; i < slots.size (); i++) {
+
+			vpx_img_free (&slots[i].image);
+
+		}
+
+		opened = false;
+		return !failed;
+
+	}
+
+
+	void VideoRecorder::Convert () {
+
+		std::unique_lock<std::mutex> lock (mutex);
+
+		while (!stopping) {
+
+			Slot* slot = 0;
+
+			for (size_t i = 0; i < slots.size (); i++) {
+
+				if (slots[i].state == SLOT_QUEUED && (!slot || slots[i].sequence < slot->sequence)) {
+
+					slot = &slots[i];
+
+				}
+
+			}
+
+			if (!slot) {
+
+				queued.wait (lock);
+				continue;
+
+			}
+
+			slot->state = SLOT_CONVERTING;
+			lock.unlock ();
+
+			vpx_image_t* image = &slot->image;
+			ConvertRGBAToI420 (&slot->pixels[0], width * 4, width, height, image->planes[VPX_PLANE_Y], image->stride[VPX_PLANE_Y], image->planes[VPX_PLANE_U], image->stride[VPX_PLANE_U], image->planes[VPX_PLANE_V], image->stride[VPX_PLANE_V]);
+
+			lock.lock ();
+			slot->state = SLOT_CONVERTED;
+			converted.notify_all ();
+
+		}
+
+	}
+
+
+	void VideoRecorder::ConvertRGBAToI420 (const unsigned char* rgba, int stride, int width, int height, unsigned char* y, int yStride, unsigned char* u, int uStride, unsigned char* v, int vStride) {
+
+		for (int row = 0; row < height; row++) {
+
+			ConvertRowY (rgba + row * stride, y + row * yStride, width);
+
+		}
+
+		// chroma is taken from the average of each 2x2 block, odd sizes
+		// repeat the last row or column
+
+		for (int row = 0; row < height; row += 2) {
+
+			const unsigned char* top = rgba + row * stride;
+			const unsigned char* bottom = row + 1 < height ? top + stride : top;
+			unsigned char* uRow = u + (row / 2) * uStride;
+			unsigned char* vRow = v + (row / 2) * vStride;
+
+			for (int x = 0; x < width; x += 2) {
+
+				int next = (x + 1 < width ? x + 1 : x) * 4;
+				int current = x * 4;
+
+				int r = (top[current] + top[next] + bottom[current] + bottom[next] + 2) >> 2;
+				int g = (top[current + 1] + top[next + 1] + bottom[current + 1] + bottom[next + 1] + 2) >> 2;
+				int b = (top[current + 2] + top[next + 2] + bottom[current + 2] + bottom[next + 2] + 2) >> 2;
+
+				uRow[x / 2] = RGBToU (r, g, b);
+				vRow[x / 2] = RGBToV (r, g, b);
+
+			}
+
+		}
+
+	}
+
+
+	void VideoRecorder::Encode () {
+
+		unsigned long duration = (unsigned long)(1000 / frameRate);
+		if (duration < 1) duration = 1;
+
+		std::unique_lock<std::mutex> lock (mutex);
+
+		while (true) {
+
+			Slot* slot = 0;
+
+			for (size_t i = 0; i < slots.size (); i++) {
+
+				if (slots[i].state == SLOT_CONVERTED && slots[i].sequence == nextEncode) {
+
+					slot = &slots[i];
+					break;
+
+				}
+
+			}
+
+			if (!slot) {
+
+				if (stopping) break;
+				converted.wait (lock);
+				continue;
+
+			}
+
+			lock.unlock ();
+
+			bool success = !failed && vpx_codec_encode (&encoder, &slot->image, slot->time, duration, 0, VPX_DL_REALTIME) == VPX_CODEC_OK && WritePackets ();
+
+			lock.lock ();
+
+			if (success) {
+
+				encodedFrames++;
+
+			} else {
+
+				failed = true;
+
+			}
+
+			slot->state = SLOT_FREE;
+			nextEncode++;
+			released.notify_all ();
+
+		}
+
+	}
+
+
+	int VideoRecorder::GetDroppedFrames () {
+
+		std::unique_lock<std::mutex> lock (mutex);
+		return droppedFrames;
+
+	}
+
+
+	int VideoRecorder::GetEncodedFrames () {
+
+		std::unique_lock<std::mutex> lock (mutex);
+		return encodedFrames;
+
+	}
+
+
+	bool VideoRecorder::Open (const char* path) {
+
+		if (opened || !path || width <= 0 || height <= 0) return false;
+
+		vpx_codec_iface_t* codecInterface = 0;
+		const char* codecID = 0;
+
+		if (codec == VIDEO_CODEC_VP9) {
+
+			#ifdef LIME_VPX_VP9
+			codecInterface = vpx_codec_vp9_cx ();
+			codecID = mkvmuxer::Tracks::kVp9CodecId;
+			#endif
+
+		} else {
+
+			codecInterface = vpx_codec_vp8_cx ();
+			codecID = mkvmuxer::Tracks::kVp8CodecId;
+
+		}
+
+		if (!codecInterface) return false;
+
+		vpx_codec_enc_cfg_t config;
+
+		if (vpx_codec_enc_config_default (codecInterface, &config, 0) != VPX_CODEC_OK) {
+
+			return false;
+
+		}
+
+		config.g_w = width;
+		config.g_h = height;
+		config.g_timebase.num = 1;
+		config.g_timebase.den = 1000;
+		config.g_threads = threads;
+		config.g_lag_in_frames = 0;
+		config.rc_end_usage = VPX_VBR;
+		config.rc_target_bitrate = bitrate;
+		config.kf_max_dist = (unsigned int)(frameRate * 5);
+
+		if (vpx_codec_enc_init (&encoder, codecInterface, &config, 0) != VPX_CODEC_OK) {
+
+			return false;
+
+		}
+
+		// favour speed, recordings run next to the game
+		vpx_codec_control (&encoder, VP8E_SET_CPUUSED, codec == VIDEO_CODEC_VP9 ? 8 : 12);
+
+		writer = new mkvmuxer::MkvWriter ();
+		segment = new mkvmuxer::Segment ();
+
+		if (!writer->Open (path) || !segment->Init (writer)) {
+
+			vpx_codec_destroy (&encoder);
+			return false;
+
+		}
+
+		segment->set_mode (mkvmuxer::Segment::kFile);
+		segment->OutputCues (true);
+		segment->GetSegmentInfo ()->set_writing_app ("Lime");
+
+		track = segment->AddVideoTrack (width, height, 0);
+		mkvmuxer::VideoTrack* videoTrack = (mkvmuxer::VideoTrack*)segment->GetTrackByNumber (track);
+
+		if (!videoTrack) {
+
+			vpx_codec_destroy (&encoder);
+			writer->Close ();
+			return false;
+
+		}
+
+		videoTrack->set_codec_id (codecID);
+		videoTrack->set_frame_rate (frameRate);
+		segment->CuesTrack (track);
+
+		for (size_t i = 0; i < slots.size (); i++) {
+
+			vpx_img_alloc (&slots[i].image, VPX_IMG_FMT_I420, width, height, 16);
+			slots[i].sequence = 0;
+			slots[i].state = SLOT_FREE;
+			slots[i].time = 0;
+
+		}
+
+		opened = true;
+
+		// the encoder thread already uses libvpx threads, the pool only has
+		// to keep up with the color conversion
+		unsigned int workers = std::thread::hardware_concurrency () / 2;
+		workers = std::max (1u, std::min (workers, 4u));
+
+		for (unsigned int i = 0; i < workers; i++) {
+
+			converters.push_back (std::thread (&VideoRecorder::Convert, this));
+
+		}
+
+		encoderThread = std::thread (&VideoRecorder::Encode, this);
+
+		return true;
+
+	}
+
+
+	bool VideoRecorder::WritePackets () {
+
+		vpx_codec_iter_t iterator = NULL;
+		const vpx_codec_cx_pkt_t* packet;
+
+		while ((packet = vpx_codec_get_cx_data (&encoder, &iterator)) != NULL) {
+
+			if (packet->kind != VPX_CODEC_CX_FRAME_PKT) continue;
+
+			bool keyFrame = (packet->data.frame.flags & VPX_FRAME_IS_KEY) != 0;
+			uint64_t timestamp = (uint64_t)packet->data.frame.pts * 1000000;
+
+			if (!segment->AddFrame ((const uint8_t*)packet->data.frame.buf, packet->data.frame.sz, track, timestamp, keyFrame)) {
+
+				return false;
+
+			}
+
+		}
+
+		return true;
+
+	}
+
+
+}
@@ -0,0 +1,326 @@
+#include <media/containers/WAV.h>
+#include <media/containers/WAVStream.h>
+#include <string.h>
+
+
+namespace lime {
+
+
+	static const int WAVE_FORMAT_PCM = 0x0001;
+	static const int WAVE_FORMAT_IEEE_FLOAT = 0x0003;
+	static const int WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+	static const int WINDOW_FRAMES = 4096;
+
+
+	static inline short ConvertSample (const unsigned char* src, int bits, bool isFloat) {
+
+		if (isFloat) {
+
+			double sample;
+
+			if (bits == 64) {
+
+				memcpy (&sample, src, sizeof (double));
+
+			} else {
+
+				float value;
+				memcpy (&value, src, sizeof (float));
+				sample = value;
+
+			}
+
+			if (sample > 1.0) sample = 1.0;
+			if (sample < -1.0) sample = -1.0;
+
+			return (short)(sample * 32767.0);
+
+		}
+
+		switch (bits) {
+
+			case 24: return (short)(src[1] | (src[2] << 8));
+			case 32: return (short)(src[2] | (src[3] << 8));
+			default: return (short)(src[0] | (src[1] << 8));
+
+		}
+
+	}
+
+
+	WAVStream::WAVStream (FILE_HANDLE* file) : file (file) {
+
+		bitsPerSample = 0;
+		blockAlign = 0;
+		channels = 0;
+		dataOffset = 0;
+		frameSize = 0;
+		length = 0;
+		position = 0;
+		sampleRate = 0;
+		sourceBits = 0;
+		sourceFloat = false;
+		window = 0;
+
+	}
+
+
+	WAVStream::~WAVStream () {
+
+		if (file) {
+
+			lime::fclose (file);
+
+		}
+
+		delete[] window;
+
+	}
+
+
+	WAVStream* WAVStream::FromFile (const char* path) {
+
+		if (!path) return 0;
+
+		FILE_HANDLE* file = lime::fopen (path, "rb");
+
+		if (!file) {
+
+			return 0;
+
+		}
+
+		WAVStream* stream = new WAVStream (file);
+
+		if (!stream->ReadHeader ()) {
+
+			delete stream;
+			return 0;
+
+		}
+
+		return stream;
+
+	}
+
+
+	int WAVStream::Read (unsigned char* dest, int bytes) {
+
+		int64_t frames = bytes / frameSize;
+
+		if (frames > length - position) {
+
+			frames = length - position;
+
+		}
+
+		if (frames <= 0) {
+
+			return 0;
+
+		}
+
+		if (!window) {
+
+			// 8 and 16-bit PCM is handed to OpenAL as-is, everything else is
+			// converted to 16-bit through a small window
+
+			size_t read = lime::fread (dest, 1, frames * blockAlign, file);
+
+			// a file that ends early still hands back its last whole frames
+			if (read < (size_t)(frames * blockAlign)) {
+
+				frames = read / blockAlign;
+				position = length;
+
+			} else {
+
+				position += frames;
+
+			}
+
+			return (int)(frames * frameSize);
+
+		}
+
+		int sampleSize = sourceBits / 8;
+		short* output = (short*)dest;
+		int64_t remaining = frames;
+
+		while (remaining > 0) {
+
+			int count = remaining > WINDOW_FRAMES ? WINDOW_FRAMES : (int)remaining;
+
+			size_t read = lime::fread (window, 1, count * blockAlign, file);
+			bool truncated = read < (size_t)(count * blockAlign);
+
+			if (truncated) {
+
+				count = (int)(read / blockAlign);
+
+			}
+
+			const unsigned char* frame = window;
+
+			for (int i = 0; i < count; i++) {
+
+				for (int c = 0; c < channels; c++) {
+
+					*output++ = ConvertSample (frame + c * sampleSize, sourceBits, sourceFloat);
+
+				}
+
+				frame += blockAlign;
+
+			}
+
+			remaining -= count;
+
+			if (truncated) {
+
+				frames -= remaining;
+				position = length;
+				return (int)(frames * frameSize);
+
+			}
+
+		}
+
+		position += frames;
+
+		return (int)(frames * frameSize);
+
+	}
+
+
+	bool WAVStream::ReadHeader () {
+
+		RIFF_Header riff_header;
+
+		if (lime::fread (&riff_header, sizeof (RIFF_Header), 1, file) != 1) {
+
+			return false;
+
+		}
+
+		if ((riff_header.chunkID[0] != 'R' || riff_header.chunkID[1] != 'I' || riff_header.chunkID[2] != 'F' || riff_header.chunkID[3] != 'F') || (riff_header.format[0] != 'W' || riff_header.format[1] != 'A' || riff_header.format[2] != 'V' || riff_header.format[3] != 'E')) {
+
+			return false;
+
+		}
+
+		WAVE_Data chunk;
+		unsigned char format[40];
+		bool foundFormat = false;
+		long chunkStart;
+
+		while (lime::fread (&chunk, sizeof (WAVE_Data), 1, file) == 1) {
+
+			chunkStart = lime::ftell (file);
+
+			if (memcmp (chunk.subChunkID, "fmt ", 4) == 0) {
+
+				unsigned int size = chunk.subChunkSize < sizeof (format) ? chunk.subChunkSize : sizeof (format);
+
+				if (size < 16 || lime::fread (format, size, 1, file) != 1) {
+
+					return false;
+
+				}
+
+				int audioFormat = format[0] | (format[1] << 8);
+
+				if (audioFormat == WAVE_FORMAT_EXTENSIBLE && size >= 26) {
+
+					// the first two bytes of the sub-format GUID hold the actual format tag
+					audioFormat = format[24] | (format[25] << 8);
+
+				}
+
+				channels = format[2] | (format[3] << 8);
+				sampleRate = format[4] | (format[5] << 8) | (format[6] << 16) | (format[7] << 24);
+				blockAlign = format[12] | (format[13] << 8);
+				sourceBits = format[14] | (format[15] << 8);
+				sourceFloat = (audioFormat == WAVE_FORMAT_IEEE_FLOAT);
+
+				if ((audioFormat != WAVE_FORMAT_PCM && !sourceFloat) || channels <= 0 || blockAlign < channels * (sourceBits / 8)) {
+
+					LOG_SOUND ("Unsupported Wave Format!\n");
+					return false;
+
+				}
+
+				if (sourceFloat ? (sourceBits != 32 && sourceBits != 64) : (sourceBits != 8 && sourceBits != 16 && sourceBits != 24 && sourceBits != 32)) {
+
+					LOG_SOUND ("Unsupported Wave Format!\n");
+					return false;
+
+				}
+
+				foundFormat = true;
+
+			} else if (memcmp (chunk.subChunkID, "data", 4) == 0) {
+
+				if (!foundFormat) {
+
+					LOG_SOUND ("Invalid Wave Format!\n");
+					return false;
+
+				}
+
+				dataOffset = chunkStart;
+				length = chunk.subChunkSize / blockAlign;
+
+				if (!sourceFloat && (sourceBits == 8 || sourceBits == 16) && blockAlign == channels * (sourceBits / 8)) {
+
+					bitsPerSample = sourceBits;
+
+				} else {
+
+					bitsPerSample = 16;
+					window = new unsigned char[WINDOW_FRAMES * blockAlign];
+
+				}
+
+				frameSize = channels * (bitsPerSample / 8);
+				return true;
+
+			}
+
+			// chunks are padded to an even size
+			lime::fseek (file, chunkStart + chunk.subChunkSize + (chunk.subChunkSize & 1), SEEK_SET);
+
+		}
+
+		LOG_SOUND ("Invalid Wav Data Header!\n");
+		return false;
+
+	}
+
+
+	bool WAVStream::Seek (int64_t frame) {
+
+		if (frame < 0) frame = 0;
+		if (frame > length) frame = length;
+
+		if (lime::fseek (file, dataOffset + (long)(frame * blockAlign), SEEK_SET) != 0) {
+
+			return false;
+
+		}
+
+		position = frame;
+		return true;
+
+	}
+
+
+	int64_t WAVStream::Tell () {
+
+		return position;
+
+	}
+
+
+}
@@ -0,0 +1,884 @@
+#include <media/openal/MixerGraph.h>
+#include <math.h>
+#include <string.h>
+
+#if defined (__SSE__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define LIME_MIXER_SSE
+#elif defined (__ARM_NEON__) || defined (__ARM_NEON)
+#include <arm_neon.h>
+#define LIME_MIXER_NEON
+#endif
+
+
+namespace lime {
+
+
+	static const int ALLPASS_TUNING[2] = { 556, 441 };
+	static const int COMB_TUNING[4] = { 1116, 1188, 1277, 1356 };
+	static const int STEREO_SPREAD = 23;
+	static const float REVERB_INPUT_GAIN = 0.03f;
+
+	static const float COMPRESSOR_ATTACK = 0.005f;
+	static const float COMPRESSOR_RATIO = 4.0f;
+	static const float COMPRESSOR_RELEASE = 0.1f;
+	static const float COMPRESSOR_THRESHOLD = 0.25f;
+
+	static const float LOWPASS_REFERENCE = 5000.0f;
+	static const float TWO_PI = 6.28318530718f;
+
+	static MixerGraph* mixerGraph = 0;
+
+
+	static inline float Clamp (float value, float min, float max) {
+
+		return value < min ? min : (value > max ? max : value);
+
+	}
+
+
+	static void MixScaled (float* dest, const float* src, float amount, int count) {
+
+		// dest += src * amount
+
+		int i = 0;
+
+		#if defined (LIME_MIXER_SSE)
+		__m128 factor = _mm_set1_ps (amount);
+
+		for (; i + 4 <= count; i += 4) {
+
+			__m128 a = _mm_loadu_ps (dest + i);
+			__m128 b = _mm_loadu_ps (src + i);
+			_mm_storeu_ps (dest + i, _mm_add_ps (a, _mm_mul_ps (b, factor)));
+
+		}
+		#elif defined (LIME_MIXER_NEON)
+		float32x4_t factor = vdupq_n_f32 (amount);
+
+		for (; i + 4 <= count; i += 4) {
+
+			float32x4_t a = vld1q_f32 (dest + i);
+			float32x4_t b = vld1q_f32 (src + i);
+			vst1q_f32 (dest + i, vmlaq_f32 (a, b, factor));
+
+		}
+		#endif
+
+		for (; i < count; i++) {
+
+			dest[i] += src[i] * amount;
+
+		}
+
+	}
+
+
+	MixerEffect::MixerEffect () {
+
+		type = AL_EFFECT_NULL;
+		compressorOn = true;
+		decayHFRatio = 0.83f;
+		decayTime = 1.49f;
+		density = 1.0f;
+		diffusion = 1.0f;
+		gain = 0.32f;
+		gainHF = 0.89f;
+
+	}
+
+
+	MixerFilter::MixerFilter () {
+
+		type = AL_FILTER_NULL;
+		gain = 1.0f;
+		gainHF = 1.0f;
+
+	}
+
+
+	MixerNode* MixerNode::Create (const MixerEffect& effect) {
+
+		switch (effect.type) {
+
+			case AL_EFFECT_COMPRESSOR: return effect.compressorOn ? new CompressorNode () : 0;
+			case AL_EFFECT_REVERB: return new ReverbNode (effect);
+			default: return 0;
+
+		}
+
+	}
+
+
+	CompressorNode::CompressorNode () {
+
+		envelope = 0;
+
+	}
+
+
+	void CompressorNode::Process (float* data, int frames, int channels, int sampleRate) {
+
+		// stereo-linked peak compressor, so the image does not shift when
+		// one side is louder than the other
+
+		float attack = expf (-1.0f / (COMPRESSOR_ATTACK * sampleRate));
+		float release = expf (-1.0f / (COMPRESSOR_RELEASE * sampleRate));
+		float exponent = 1.0f / COMPRESSOR_RATIO - 1.0f;
+
+		for (int i = 0; i < frames; i++) {
+
+			float* frame = data + i * channels;
+			float peak = 0;
+
+			for (int c = 0; c < channels; c++) {
+
+				float sample = fabsf (frame[c]);
+				if (sample > peak) peak = sample;
+
+			}
+
+			float coefficient = peak > envelope ? attack : release;
+			envelope = peak + coefficient * (envelope - peak);
+
+			if (envelope > COMPRESSOR_THRESHOLD) {
+
+				float gain = powf (envelope / COMPRESSOR_THRESHOLD, exponent);
+
+				for (int c = 0; c < channels; c++) {
+
+					frame[c] *= gain;
+
+				}
+
+			}
+
+		}
+
+	}
+
+
+	LowPassNode::LowPassNode (const MixerFilter& filter) {
+
+		gain = filter.gain;
+		gainHF = filter.gainHF;
+		memset (history, 0, sizeof (history));
+
+	}
+
+
+	void LowPassNode::Process (float* data, int frames, int channels, int sampleRate) {
+
+		// one-pole split at the EFX reference frequency, the part above it is
+		// scaled by gainHF and the whole signal by gain
+
+		if (channels > 8) channels = 8;
+
+		float cutoff = LOWPASS_REFERENCE < sampleRate * 0.5f ? LOWPASS_REFERENCE : sampleRate * 0.5f;
+		float coefficient = 1.0f - expf (-TWO_PI * cutoff / sampleRate);
+
+		for (int i = 0; i < frames; i++) {
+
+			float* frame = data + i * channels;
+
+			for (int c = 0; c < channels; c++) {
+
+				float low = history[c] + coefficient * (frame[c] - history[c]);
+				history[c] = low;
+				frame[c] = gain * (low + gainHF * (frame[c] - low));
+
+			}
+
+		}
+
+	}
+
+
+	ReverbNode::ReverbNode (const MixerEffect& effect) : effect (effect) {
+
+		damping = 0;
+		sampleRate = 0;
+
+	}
+
+
+	void ReverbNode::Configure (int sampleRate) {
+
+		this->sampleRate = sampleRate;
+
+		// Schroeder/Freeverb style: parallel damped combs into series allpasses,
+		// with density scaling the delay lengths and decay time setting the
+		// comb feedback for a 60 dB decay
+
+		float scale = (sampleRate / 44100.0f) * (0.5f + 0.5f * Clamp (effect.density, 0.0f, 1.0f));
+		float decayTime = Clamp (effect.decayTime, 0.1f, 20.0f);
+
+		damping = Clamp (1.0f - effect.decayHFRatio * effect.gainHF, 0.0f, 0.95f);
+
+		for (int c = 0; c < 2; c++) {
+
+			int spread = c * STEREO_SPREAD;
+
+			for (int i = 0; i < 4; i++) {
+
+				Delay* comb = &combs[c][i];
+				int length = (int)((COMB_TUNING[i] + spread) * scale);
+				if (length < 1) length = 1;
+
+				comb->buffer.assign (length, 0.0f);
+				comb->feedback = powf (10.0f, -3.0f * length / (decayTime * sampleRate));
+				comb->history = 0;
+				comb->position = 0;
+
+			}
+
+			for (int i = 0; i < 2; i++) {
+
+				Delay* allpass = &allpasses[c][i];
+				int length = (int)((ALLPASS_TUNING[i] + spread) * scale);
+				if (length < 1) length = 1;
+
+				allpass->buffer.assign (length, 0.0f);
+				allpass->feedback = 0.5f * Clamp (effect.diffusion, 0.0f, 1.0f);
+				allpass->history = 0;
+				allpass->position = 0;
+
+			}
+
+		}
+
+	}
+
+
+	void ReverbNode::Process (float* data, int frames, int channels, int sampleRate) {
+
+		if (sampleRate != this->sampleRate) {
+
+			Configure (sampleRate);
+
+		}
+
+		int outputs = channels < 2 ? channels : 2;
+		float wet = Clamp (effect.gain, 0.0f, 1.0f);
+
+		for (int i = 0; i < frames; i++) {
+
+			float* frame = data + i * channels;
+			float input = 0;
+
+			for (int c = 0; c < channels; c++) {
+
+				input += frame[c];
+
+			}
+
+			input *= REVERB_INPUT_GAIN / channels;
+
+			for (int c = 0; c < outputs; c++) {
+
+				float output = 0;
+
+				for (int j = 0; j < 4; j++) {
+
+					Delay* comb = &combs[c][j];
+					float delayed = comb->buffer[comb->position];
+
+					comb->history = delayed * (1.0f - damping) + comb->history * damping;
+					comb->buffer[comb->position] = input + comb->history * comb->feedback;
+					if (++comb->position >= (int)comb->buffer.size ()) comb->position = 0;
+
+					output += delayed;
+
+				}
+
+				for (int j = 0; j < 2; j++) {
+
+					Delay* allpass = &allpasses[c][j];
+					float delayed = allpass->buffer[allpass->position];
+
+					allpass->buffer[allpass->position] = output + delayed * allpass->feedback;
+					if (++allpass->position >= (int)allpass->buffer.size ()) allpass->position = 0;
+
+					output = delayed - output;
+
+				}
+
+				frame[c] = output * wet;
+
+			}
+
+			// effect slots only output the wet signal, the dry signal
+			// already reached the mix through the source
+
+			for (int c = outputs; c < channels; c++) {
+
+				frame[c] = 0;
+
+			}
+
+		}
+
+	}
+
+
+	MixerBus::MixerBus () {
+
+		gain = 1.0f;
+		node = 0;
+
+	}
+
+
+	MixerBus::~MixerBus () {
+
+		delete node;
+
+	}
+
+
+	MixerSource::MixerSource () {
+
+		filter = 0;
+
+	}
+
+
+	MixerGraph::MixerGraph () {
+
+		context = 0;
+		nextName = 1;
+
+	}
+
+
+	MixerGraph* MixerGraph::GetInstance () {
+
+		if (!mixerGraph) {
+
+			mixerGraph = new MixerGraph ();
+
+		}
+
+		return mixerGraph;
+
+	}
+
+
+	void MixerGraph::Install () {
+
+		// must not be called with the graph locked, MojoAL locks the audio
+		// device while it swaps the callbacks
+
+		ALCcontext* current = alcGetCurrentContext ();
+
+		if (current && current != context) {
+
+			alMixCallbacksLIME (ProcessSource, ProcessMix, this);
+			context = current;
+
+		}
+
+	}
+
+
+	void AL_APIENTRY MixerGraph::ProcessMix (ALvoid* userdata, ALfloat* stream, ALsizei frames, ALsizei channels, ALsizei frequency) {
+
+		MixerGraph* graph = (MixerGraph*)userdata;
+		int count = frames * channels;
+
+		graph->mutex.Lock ();
+
+		for (std::map<ALuint, MixerBus*>::iterator it = graph->buses.begin (); it != graph->buses.end (); ++it) {
+
+			MixerBus* bus = it->second;
+
+			// slots keep running without sends, so reverb tails can ring out
+
+			if ((int)bus->input.size () < count) bus->input.resize (count);
+
+			float* input = &bus->input[0];
+
+			if (bus->node && bus->gain > 0.0f) {
+
+				bus->node->Process (input, frames, channels, frequency);
+				MixScaled (stream, input, bus->gain, count);
+
+			}
+
+			memset (input, 0, bus->input.size () * sizeof (float));
+
+		}
+
+		graph->mutex.Unlock ();
+
+	}
+
+
+	void AL_APIENTRY MixerGraph::ProcessSource (ALvoid* userdata, ALuint source, ALfloat* data, ALsizei frames, ALsizei channels, ALsizei frequency, ALsizei offset) {
+
+		MixerGraph* graph = (MixerGraph*)userdata;
+		int count = frames * channels;
+		int start = offset * channels;
+
+		graph->mutex.Lock ();
+
+		std::map<ALuint, MixerSource>::iterator it = graph->sources.find (source);
+
+		if (it != graph->sources.end ()) {
+
+			MixerSource* mixerSource = &it->second;
+
+			// sends take the source before its direct filter, as with EFX
+
+			for (size_t i = 0; i < mixerSource->sends.size (); i++) {
+
+				MixerSend* send = &mixerSource->sends[i];
+				std::map<ALuint, MixerBus*>::iterator bus = graph->buses.find (send->slot);
+
+				if (bus == graph->buses.end ()) continue;
+
+				std::vector<float>* input = &bus->second->input;
+				if ((int)input->size () < start + count) input->resize (start + count);
+
+				const float* sendData = data;
+
+				if (send->filter) {
+
+					if ((int)graph->sendScratch.size () < count) graph->sendScratch.resize (count);
+
+					float* scratch = &graph->sendScratch[0];
+					memcpy (scratch, data, count * sizeof (float));
+					send->filter->Process (scratch, frames, channels, frequency);
+					sendData = scratch;
+
+				}
+
+				MixScaled (&(*input)[start], sendData, 1.0f, count);
+
+			}
+
+			if (mixerSource->filter) {
+
+				mixerSource->filter->Process (data, frames, channels, frequency);
+
+			}
+
+		}
+
+		graph->mutex.Unlock ();
+
+	}
+
+
+	bool MixerGraph::PruneSource (std::map<ALuint, MixerSource>::iterator it) {
+
+		if (!it->second.filter && it->second.sends.empty ()) {
+
+			sources.erase (it);
+			return false;
+
+		}
+
+		return true;
+
+	}
+
+
+	void MixerGraph::RemoveSource (ALuint source) {
+
+		std::vector<LowPassNode*> nodes;
+
+		mutex.Lock ();
+
+		std::map<ALuint, MixerSource>::iterator it = sources.find (source);
+
+		if (it != sources.end ()) {
+
+			nodes.push_back (it->second.filter);
+
+			for (size_t i = 0; i < it->second.sends.size (); i++) {
+
+				nodes.push_back (it->second.sends[i].filter);
+
+			}
+
+			sources.erase (it);
+
+		}
+
+		mutex.Unlock ();
+
+		for (size_t i = 0; i < nodes.size (); i++) {
+
+			delete nodes[i];
+
+		}
+
+	}
+
+
+	void MixerGraph::SetBusEffect (MixerBus* bus, const MixerEffect* effect) {
+
+		MixerNode* node = effect ? MixerNode::Create (*effect) : 0;
+
+		mutex.Lock ();
+		MixerNode* previous = bus->node;
+		bus->node = node;
+		mutex.Unlock ();
+
+		delete previous;
+
+	}
+
+
+	void MixerGraph::SetSourceFilter (ALuint source, const MixerFilter* filter) {
+
+		Install ();
+
+		LowPassNode* node = (filter && filter->type == AL_FILTER_LOWPASS) ? new LowPassNode (*filter) : 0;
+
+		mutex.Lock ();
+
+		std::map<ALuint, MixerSource>::iterator it = sources.insert (std::make_pair (source, MixerSource ())).first;
+		LowPassNode* previous = it->second.filter;
+		it->second.filter = node;
+		bool routed = PruneSource (it);
+
+		mutex.Unlock ();
+
+		delete previous;
+		alSourceFilteredLIME (source, routed ? AL_TRUE : AL_FALSE);
+
+	}
+
+
+	void MixerGraph::SetSourceSend (ALuint source, int index, ALuint slot, const MixerFilter* filter) {
+
+		Install ();
+
+		// the send filter sets the send level, a null filter sends at full gain
+
+		LowPassNode* node = (slot != AL_EFFECTSLOT_NULL && filter && filter->type == AL_FILTER_LOWPASS) ? new LowPassNode (*filter) : 0;
+		LowPassNode* previous = 0;
+
+		mutex.Lock ();
+
+		std::map<ALuint, MixerSource>::iterator it = sources.insert (std::make_pair (source, MixerSource ())).first;
+		std::vector<MixerSend>* sends = &it->second.sends;
+
+		for (size_t i = 0; i < sends->size (); i++) {
+
+			if ((*sends)[i].index == index) {
+
+				previous = (*sends)[i].filter;
+				sends->erase (sends->begin () + i);
+				break;
+
+			}
+
+		}
+
+		if (slot != AL_EFFECTSLOT_NULL) {
+
+			MixerSend send;
+			send.filter = node;
+			send.index = index;
+			send.slot = slot;
+			sends->push_back (send);
+
+		}
+
+		bool routed = PruneSource (it);
+
+		mutex.Unlock ();
+
+		delete previous;
+		alSourceFilteredLIME (source, routed ? AL_TRUE : AL_FALSE);
+
+	}
+
+
+	void alAuxiliaryEffectSlotf (ALuint slot, ALenum param, ALfloat value) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		std::map<ALuint, MixerBus*>::iterator it = graph->buses.find (slot);
+
+		if (it != graph->buses.end () && param == AL_EFFECTSLOT_GAIN) {
+
+			graph->mutex.Lock ();
+			it->second->gain = Clamp (value, 0.0f, 1.0f);
+			graph->mutex.Unlock ();
+
+		}
+
+	}
+
+
+	void alAuxiliaryEffectSloti (ALuint slot, ALenum param, ALint value) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		std::map<ALuint, MixerBus*>::iterator it = graph->buses.find (slot);
+
+		if (it != graph->buses.end () && param == AL_EFFECTSLOT_EFFECT) {
+
+			std::map<ALuint, MixerEffect>::iterator effect = graph->effects.find ((ALuint)value);
+			graph->SetBusEffect (it->second, effect != graph->effects.end () ? &effect->second : 0);
+
+		}
+
+	}
+
+
+	void alDeleteAuxiliaryEffectSlots (ALsizei n, const ALuint* slots) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+
+		for (ALsizei i = 0; i < n; i++) {
+
+			std::map<ALuint, MixerBus*>::iterator it = graph->buses.find (slots[i]);
+
+			if (it != graph->buses.end ()) {
+
+				MixerBus* bus = it->second;
+
+				graph->mutex.Lock ();
+				graph->buses.erase (it);
+				graph->mutex.Unlock ();
+
+				delete bus;
+
+			}
+
+		}
+
+	}
+
+
+	void alDeleteEffects (ALsizei n, const ALuint* effects) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+
+		for (ALsizei i = 0; i < n; i++) {
+
+			graph->effects.erase (effects[i]);
+
+		}
+
+	}
+
+
+	void alDeleteFilters (ALsizei n, const ALuint* filters) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+
+		for (ALsizei i = 0; i < n; i++) {
+
+			graph->filters.erase (filters[i]);
+
+		}
+
+	}
+
+
+	void alDeleteSources (ALsizei n, const ALuint* sources) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+
+		for (ALsizei i = 0; i < n; i++) {
+
+			graph->RemoveSource (sources[i]);
+
+		}
+
+		::alDeleteSources (n, sources);
+
+	}
+
+
+	void alEffectf (ALuint effect, ALenum param, ALfloat value) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		std::map<ALuint, MixerEffect>::iterator it = graph->effects.find (effect);
+
+		if (it == graph->effects.end () || it->second.type != AL_EFFECT_REVERB) return;
+
+		MixerEffect* data = &it->second;
+
+		switch (param) {
+
+			case AL_REVERB_DENSITY: data->density = value; break;
+			case AL_REVERB_DIFFUSION: data->diffusion = value; break;
+			case AL_REVERB_GAIN: data->gain = value; break;
+			case AL_REVERB_GAINHF: data->gainHF = value; break;
+			case AL_REVERB_DECAY_TIME: data->decayTime = value; break;
+			case AL_REVERB_DECAY_HFRATIO: data->decayHFRatio = value; break;
+			default: break;
+
+		}
+
+	}
+
+
+	void alEffecti (ALuint effect, ALenum param, ALint value) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		std::map<ALuint, MixerEffect>::iterator it = graph->effects.find (effect);
+
+		if (it == graph->effects.end ()) return;
+
+		if (param == AL_EFFECT_TYPE) {
+
+			if (value == AL_EFFECT_NULL || value == AL_EFFECT_REVERB || value == AL_EFFECT_COMPRESSOR) {
+
+				it->second = MixerEffect ();
+				it->second.type = value;
+
+			}
+
+		} else if (param == AL_COMPRESSOR_ONOFF && it->second.type == AL_EFFECT_COMPRESSOR) {
+
+			it->second.compressorOn = (value != 0);
+
+		}
+
+	}
+
+
+	void alFilterf (ALuint filter, ALenum param, ALfloat value) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		std::map<ALuint, MixerFilter>::iterator it = graph->filters.find (filter);
+
+		if (it == graph->filters.end () || it->second.type != AL_FILTER_LOWPASS) return;
+
+		switch (param) {
+
+			case AL_LOWPASS_GAIN: it->second.gain = Clamp (value, 0.0f, 1.0f); break;
+			case AL_LOWPASS_GAINHF: it->second.gainHF = Clamp (value, 0.0f, 1.0f); break;
+			default: break;
+
+		}
+
+	}
+
+
+	void alFilteri (ALuint filter, ALenum param, ALint value) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		std::map<ALuint, MixerFilter>::iterator it = graph->filters.find (filter);
+
+		if (it != graph->filters.end () && param == AL_FILTER_TYPE && (value == AL_FILTER_NULL || value == AL_FILTER_LOWPASS)) {
+
+			it->second = MixerFilter ();
+			it->second.type = value;
+
+		}
+
+	}
+
+
+	void alGenAuxiliaryEffectSlots (ALsizei n, ALuint* slots) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		graph->Install ();
+
+		for (ALsizei i = 0; i < n; i++) {
+
+			slots[i] = graph->nextName++;
+			MixerBus* bus = new MixerBus ();
+
+			graph->mutex.Lock ();
+			graph->buses[slots[i]] = bus;
+			graph->mutex.Unlock ();
+
+		}
+
+	}
+
+
+	void alGenEffects (ALsizei n, ALuint* effects) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+
+		for (ALsizei i = 0; i < n; i++) {
+
+			effects[i] = graph->nextName++;
+			graph->effects[effects[i]] = MixerEffect ();
+
+		}
+
+	}
+
+
+	void alGenFilters (ALsizei n, ALuint* filters) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+
+		for (ALsizei i = 0; i < n; i++) {
+
+			filters[i] = graph->nextName++;
+			graph->filters[filters[i]] = MixerFilter ();
+
+		}
+
+	}
+
+
+	void alGetFilteri (ALuint filter, ALenum param, ALint* value) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		std::map<ALuint, MixerFilter>::iterator it = graph->filters.find (filter);
+
+		*value = (it != graph->filters.end () && param == AL_FILTER_TYPE) ? it->second.type : 0;
+
+	}
+
+
+	ALboolean alIsAuxiliaryEffectSlot (ALuint slot) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		return graph->buses.find (slot) != graph->buses.end () ? AL_TRUE : AL_FALSE;
+
+	}
+
+
+	ALboolean alIsEffect (ALuint effect) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		return graph->effects.find (effect) != graph->effects.end () ? AL_TRUE : AL_FALSE;
+
+	}
+
+
+	ALboolean alIsFilter (ALuint filter) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		return graph->filters.find (filter) != graph->filters.end () ? AL_TRUE : AL_FALSE;
+
+	}
+
+
+	void alSourceAuxiliarySend (ALuint source, ALuint slot, ALint index, ALuint filter) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+
+		if (index < 0 || (slot != AL_EFFECTSLOT_NULL && graph->buses.find (slot) == graph->buses.end ())) return;
+
+		std::map<ALuint, MixerFilter>::iterator it = graph->filters.find (filter);
+
+		graph->SetSourceSend (source, index, slot, it != graph->filters.end () ? &it->second : 0);
+
+	}
+
+
+	void alSourceDirectFilter (ALuint source, ALuint filter) {
+
+		MixerGraph* graph = MixerGraph::GetInstance ();
+		std::map<ALuint, MixerFilter>::iterator it = graph->filters.find (filter);
+
+		graph->SetSourceFilter (source, it != graph->filters.end () ? &it->second : 0);
+
+	}
+
+
+}
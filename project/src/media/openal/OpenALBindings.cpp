@@ -2,7 +2,9 @@
 #include <OpenAL/al.h>
 #include <OpenAL/alc.h>
 #define LIME_OPENAL_DELETION_DELAY 600
-#include <time.h>
+#include <chrono>
+#include <stdint.h>
+#include <vector>
 #else
 #include "AL/al.h"
 #include "AL/alc.h"
@@ -12,11 +14,18 @@
 #endif
 #endif
 
+#if defined (LIME_OPENALSOFT) || defined (LIME_MOJOAL)
+#define LIME_OPENAL_EFX
+#endif
+
 #include <system/CFFI.h>
 #include <system/CFFIPointer.h>
 #include <system/Mutex.h>
+#include <media/openal/VoicePool.h>
+#ifdef LIME_MOJOAL
+#include <media/openal/MixerGraph.h>
+#endif
 #include <utils/ArrayBufferView.h>
-#include <list>
 #include <map>
 
 
@@ -24,10 +33,89 @@ namespace lime {
 
 
 	#ifdef LIME_OPENAL_DELETION_DELAY
-	std::list<ALuint> alDeletedBuffer;
-	std::list<time_t> alDeletedBufferTime;
-	std::list<ALuint> alDeletedSource;
-	std::list<time_t> alDeletedSourceTime;
+	struct ALDeletedObject {
+
+		ALuint id;
+		uint64_t time;
+
+	};
+
+
+	// Objects are pushed with a monotonic timestamp, so the ring is always
+	// ordered by deletion time and only the expired head needs to be visited
+
+	class ALDeletionQueue {
+
+		public:
+
+			ALDeletionQueue () : head (0), count (0) {}
+
+
+			void Push (ALuint id, uint64_t time) {
+
+				if (count == entries.size ()) {
+
+					std::vector<ALDeletedObject> resized (entries.empty () ? 64 : entries.size () * 2);
+
+					for (size_t i = 0; i < count; ++i) {
+
+						resized[i] = entries[(head + i) % entries.size ()];
+
+					}
+
+					entries.swap (resized);
+					head = 0;
+
+				}
+
+				ALDeletedObject& entry = entries[(head + count) % entries.size ()];
+				entry.id = id;
+				entry.time = time;
+				count++;
+
+			}
+
+
+			void PopExpired (uint64_t currentTime, std::vector<ALuint>& expired) {
+
+				while (count > 0) {
+
+					ALDeletedObject& entry = entries[head];
+
+					if (currentTime - entry.time <= LIME_OPENAL_DELETION_DELAY) {
+
+						break;
+
+					}
+
+					expired.push_back (entry.id);
+					head = (head + 1) % entries.size ();
+					count--;
+
+				}
+
+			}
+
+
+		private:
+
+			std::vector<ALDeletedObject> entries;
+			size_t head;
+			size_t count;
+
+	};
+
+
+	ALDeletionQueue alDeletedBuffers;
+	ALDeletionQueue alDeletedSources;
+	std::vector<ALuint> alExpiredObjects;
+
+
+	static uint64_t lime_al_deletion_time () {
+
+		return std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+
+	}
 	#endif
 
 	std::map<ALuint, void*> alObjects;
@@ -35,7 +123,7 @@ namespace lime {
 	Mutex al_gc_mutex;
 
 
-	#ifdef LIME_OPENALSOFT
+	#ifdef LIME_OPENAL_EFX
 	void lime_al_delete_auxiliary_effect_slot (value aux);
 	HL_PRIM void HL_NAME(hl_al_delete_auxiliary_effect_slot) (HL_CFFIPointer* aux);
 	#endif
@@ -43,7 +131,7 @@ namespace lime {
 	void lime_al_delete_source (value source);
 	HL_PRIM void HL_NAME(hl_al_delete_buffer) (HL_CFFIPointer* buffer);
 	HL_PRIM void HL_NAME(hl_al_delete_source) (HL_CFFIPointer* source);
-	#ifdef LIME_OPENALSOFT
+	#ifdef LIME_OPENAL_EFX
 	void lime_al_delete_effect (value effect);
 	void lime_al_delete_filter (value filter);
 	HL_PRIM void HL_NAME(hl_al_delete_effect) (HL_CFFIPointer* effect);
@@ -65,7 +153,7 @@ namespace lime {
 	}
 
 
-	#ifdef LIME_OPENALSOFT
+	#ifdef LIME_OPENAL_EFX
 	void gc_al_auxiliary_effect_slot (value aux) {
 
 		lime_al_delete_auxiliary_effect_slot (aux);
@@ -95,7 +183,52 @@ namespace lime {
 	}
 
 
-	#ifdef LIME_OPENALSOFT
+	static void lime_al_voice_pool_delete (VoicePool* voicePool) {
+
+		// finalizers run on whichever thread collects the pool, so the
+		// sources are deleted under the GC lock with their own context current
+
+		al_gc_mutex.Lock ();
+
+		ALCcontext* context = (ALCcontext*)voicePool->GetContext ();
+		ALCcontext* currentContext = alcGetCurrentContext ();
+
+		if (context && (context == currentContext || alcObjects.find (context) != alcObjects.end ())) {
+
+			if (context != currentContext) alcMakeContextCurrent (context);
+			voicePool->DeleteSources ();
+			if (context != currentContext) alcMakeContextCurrent (currentContext);
+
+		} else {
+
+			// the context, and the sources with it, is already gone
+			voicePool->Abandon ();
+
+		}
+
+		delete voicePool;
+		al_gc_mutex.Unlock ();
+
+	}
+
+
+	void gc_al_voice_pool (value pool) {
+
+		VoicePool* voicePool = (VoicePool*)val_data (pool);
+		lime_al_voice_pool_delete (voicePool);
+
+	}
+
+
+	void hl_gc_al_voice_pool (HL_CFFIPointer* pool) {
+
+		VoicePool* voicePool = (VoicePool*)pool->ptr;
+		lime_al_voice_pool_delete (voicePool);
+
+	}
+
+
+	#ifdef LIME_OPENAL_EFX
 	void gc_al_effect (value effect) {
 
 		lime_al_delete_effect (effect);
@@ -172,7 +305,7 @@ namespace lime {
 
 	void lime_al_auxf (value aux, int param, float value) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (aux);
 		alAuxiliaryEffectSlotf (id, param, value);
 		#endif
@@ -182,7 +315,7 @@ namespace lime {
 
 	HL_PRIM void HL_NAME(hl_al_auxf) (HL_CFFIPointer* aux, int param, float value) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)aux->ptr;
 		alAuxiliaryEffectSlotf (id, param, value);
 		#endif
@@ -233,7 +366,7 @@ namespace lime {
 
 	void lime_al_auxi (value aux, int param, value val) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (aux);
 		ALuint data;
 
@@ -255,7 +388,7 @@ namespace lime {
 
 	HL_PRIM void HL_NAME(hl_al_auxi) (HL_CFFIPointer* aux, int param, vdynamic* val) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)aux->ptr;
 		ALuint data;
 
@@ -472,55 +605,29 @@ namespace lime {
 	void lime_al_cleanup () {
 
 		#ifdef LIME_OPENAL_DELETION_DELAY
-		time_t currentTime = time (0);
-		ALuint deletedData;
-		time_t deletedTime;
-
-		std::list<ALuint>::const_iterator itSource = alDeletedSource.begin ();
-		std::list<time_t>::const_iterator itSourceTime = alDeletedSourceTime.begin ();
-
-		while (itSource != alDeletedSource.end ()) {
-
-			deletedTime = *itSourceTime;
+		uint64_t currentTime = lime_al_deletion_time ();
 
-			if (difftime (currentTime, deletedTime) * 1000 > LIME_OPENAL_DELETION_DELAY) {
-
-				ALuint deletedData = *itSource;
-				alDeleteSources (1, &deletedData);
-				itSource = alDeletedSource.erase (itSource);
-				itSourceTime = alDeletedSourceTime.erase (itSourceTime);
+		al_gc_mutex.Lock ();
 
-			} else {
+		alExpiredObjects.clear ();
+		alDeletedSources.PopExpired (currentTime, alExpiredObjects);
 
-				++itSource;
-				++itSourceTime;
+		if (!alExpiredObjects.empty ()) {
 
-			}
+			alDeleteSources ((ALsizei)alExpiredObjects.size (), &alExpiredObjects[0]);
 
 		}
 
-		std::list<ALuint>::iterator itBuffer = alDeletedBuffer.begin ();
-		std::list<time_t>::iterator itBufferTime = alDeletedBufferTime.begin ();
+		alExpiredObjects.clear ();
+		alDeletedBuffers.PopExpired (currentTime, alExpiredObjects);
 
-		while (itBuffer != alDeletedBuffer.end ()) {
+		if (!alExpiredObjects.empty ()) {
 
-			deletedTime = *itBufferTime;
-
-			if (difftime (currentTime, deletedTime) * 1000 > LIME_OPENAL_DELETION_DELAY) {
-
-				ALuint deletedData = *itBuffer;
-				alDeleteBuffers (1, &deletedData);
-				itBuffer = alDeletedBuffer.erase (itBuffer);
-				itBufferTime = alDeletedBufferTime.erase (itBufferTime);
-
-			} else {
-
-				++itBuffer;
-				++itBufferTime;
-
-			}
+			alDeleteBuffers ((ALsizei)alExpiredObjects.size (), &alExpiredObjects[0]);
 
 		}
+
+		al_gc_mutex.Unlock ();
 		#endif
 
 	}
@@ -535,7 +642,7 @@ namespace lime {
 
 	void lime_al_delete_auxiliary_effect_slot (value aux) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		if (!val_is_null (aux)) {
 
 			al_gc_mutex.Lock ();
@@ -553,7 +660,7 @@ namespace lime {
 
 	HL_PRIM void HL_NAME(hl_al_delete_auxiliary_effect_slot) (HL_CFFIPointer* aux) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		if (aux) {
 
 			al_gc_mutex.Lock ();
@@ -577,8 +684,7 @@ namespace lime {
 			ALuint data = (ALuint)(uintptr_t)val_data (buffer);
 			val_gc (buffer, 0);
 			#ifdef LIME_OPENAL_DELETION_DELAY
-			alDeletedBuffer.push_back (data);
-			alDeletedBufferTime.push_back (time (0));
+			alDeletedBuffers.Push (data, lime_al_deletion_time ());
 			#else
 			alDeleteBuffers ((ALuint)1, &data);
 			#endif
@@ -598,8 +704,7 @@ namespace lime {
 			ALuint data = (ALuint)(uintptr_t)buffer->ptr;
 			buffer->finalizer = 0;
 			#ifdef LIME_OPENAL_DELETION_DELAY
-			alDeletedBuffer.push_back (data);
-			alDeletedBufferTime.push_back (time (0));
+			alDeletedBuffers.Push (data, lime_al_deletion_time ());
 			#else
 			alDeleteBuffers ((ALuint)1, &data);
 			#endif
@@ -622,13 +727,13 @@ namespace lime {
 
 			#ifdef LIME_OPENAL_DELETION_DELAY
 			ALuint data;
+			uint64_t deletedTime = lime_al_deletion_time ();
 
 			for (int i = 0; i < size; ++i) {
 
 				buffer = val_array_i (buffers, i);
 				data = (ALuint)(uintptr_t)val_data (buffer);
-				alDeletedBuffer.push_back (data);
-				alDeletedBufferTime.push_back (time (0));
+				alDeletedBuffers.Push (data, deletedTime);
 				val_gc (buffer, 0);
 				alObjects.erase (data);
 
@@ -670,13 +775,13 @@ namespace lime {
 
 			#ifdef LIME_OPENAL_DELETION_DELAY
 			ALuint data;
+			uint64_t deletedTime = lime_al_deletion_time ();
 
 			for (int i = 0; i < size; ++i) {
 
 				buffer = *bufferData++;
 				data = (ALuint)(uintptr_t)buffer->ptr;
-				alDeletedBuffer.push_back (data);
-				alDeletedBufferTime.push_back (time (0));
+				alDeletedBuffers.Push (data, deletedTime);
 				buffer->finalizer = 0;
 				alObjects.erase (data);
 
@@ -708,7 +813,7 @@ namespace lime {
 
 	void lime_al_delete_effect (value effect) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		if (!val_is_null (effect)) {
 
 			ALuint data = (ALuint)(uintptr_t)val_data (effect);
@@ -723,7 +828,7 @@ namespace lime {
 
 	HL_PRIM void HL_NAME(hl_al_delete_effect) (HL_CFFIPointer* effect) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		if (effect) {
 
 			ALuint data = (ALuint)(uintptr_t)effect->ptr;
@@ -738,7 +843,7 @@ namespace lime {
 
 	void lime_al_delete_filter (value filter) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		if (!val_is_null (filter)) {
 
 			ALuint data = (ALuint)(uintptr_t)val_data (filter);
@@ -753,7 +858,7 @@ namespace lime {
 
 	HL_PRIM void HL_NAME(hl_al_delete_filter) (HL_CFFIPointer* filter) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		if (filter) {
 
 			ALuint data = (ALuint)(uintptr_t)filter->ptr;
@@ -775,8 +880,7 @@ namespace lime {
 			#ifdef LIME_OPENAL_DELETION_DELAY
 			al_gc_mutex.Lock ();
 			alSourcei (data, AL_BUFFER, 0);
-			alDeletedSource.push_back (data);
-			alDeletedSourceTime.push_back (time (0));
+			alDeletedSources.Push (data, lime_al_deletion_time ());
 			al_gc_mutex.Unlock ();
 			#else
 			alDeleteSources (1, &data);
@@ -796,8 +900,7 @@ namespace lime {
 			#ifdef LIME_OPENAL_DELETION_DELAY
 			al_gc_mutex.Lock ();
 			alSourcei (data, AL_BUFFER, 0);
-			alDeletedSource.push_back (data);
-			alDeletedSourceTime.push_back (time (0));
+			alDeletedSources.Push (data, lime_al_deletion_time ());
 			al_gc_mutex.Unlock ();
 			#else
 			alDeleteSources (1, &data);
@@ -818,14 +921,14 @@ namespace lime {
 			#ifdef LIME_OPENAL_DELETION_DELAY
 			al_gc_mutex.Lock ();
 			ALuint data;
+			uint64_t deletedTime = lime_al_deletion_time ();
 
 			for (int i = 0; i < size; ++i) {
 
 				source = val_array_i (sources, i);
 				data = (ALuint)(uintptr_t)val_data (source);
 				alSourcei (data, AL_BUFFER, 0);
-				alDeletedSource.push_back (data);
-				alDeletedSourceTime.push_back (time (0));
+				alDeletedSources.Push (data, deletedTime);
 				val_gc (source, 0);
 
 			}
@@ -864,14 +967,14 @@ namespace lime {
 			#ifdef LIME_OPENAL_DELETION_DELAY
 			al_gc_mutex.Lock ();
 			ALuint data;
+			uint64_t deletedTime = lime_al_deletion_time ();
 
 			for (int i = 0; i < size; ++i) {
 
 				source = *sourceData++;
 				data = (ALuint)(uintptr_t)source->ptr;
 				alSourcei (data, AL_BUFFER, 0);
-				alDeletedSource.push_back (data);
-				alDeletedSourceTime.push_back (time (0));
+				alDeletedSources.Push (data, deletedTime);
 				source->finalizer = 0;
 
 			}
@@ -957,7 +1060,7 @@ namespace lime {
 
 	void lime_al_effectf (value effect, int param, float value) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (effect);
 		alEffectf (id, param, value);
 		#endif
@@ -967,7 +1070,7 @@ namespace lime {
 
 	HL_PRIM void HL_NAME(hl_al_effectf) (HL_CFFIPointer* effect, int param, float value) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)effect->ptr;
 		alEffectf (id, param, value);
 		#endif
@@ -1018,7 +1121,7 @@ namespace lime {
 
 	void lime_al_effecti (value effect, int param, int value) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (effect);
 		alEffecti (id, param, value);
 		#endif
@@ -1028,7 +1131,7 @@ namespace lime {
 
 	HL_PRIM void HL_NAME(hl_al_effecti) (HL_CFFIPointer* effect, int param, int value) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)effect->ptr;
 		alEffecti (id, param, value);
 		#endif
@@ -1092,7 +1195,7 @@ namespace lime {
 
 	void lime_al_filteri (value filter, int param, value val) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (filter);
 		ALuint data;
 
@@ -1106,7 +1209,7 @@ namespace lime {
 
 	HL_PRIM void HL_NAME(hl_al_filteri) (HL_CFFIPointer* filter, int param, int val) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)filter->ptr;
 		ALuint data;
 
@@ -1120,7 +1223,7 @@ namespace lime {
 
 	void lime_al_filterf (value filter, int param, float value) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (filter);
 		alFilterf (id, param, value);
 		#endif
@@ -1130,7 +1233,7 @@ namespace lime {
 
 	HL_PRIM void HL_NAME(hl_al_filterf) (HL_CFFIPointer* filter, int param, float value) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)filter->ptr;
 		alFilterf (id, param, value);
 		#endif
@@ -1140,7 +1243,7 @@ namespace lime {
 
 	value lime_al_gen_aux () {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint aux;
 		alGenAuxiliaryEffectSlots ((ALuint)1, &aux);
 		return CFFIPointer ((void*)(uintptr_t)aux, gc_al_auxiliary_effect_slot);
@@ -1153,7 +1256,7 @@ namespace lime {
 
 	HL_PRIM HL_CFFIPointer* HL_NAME(hl_al_gen_aux) () {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint aux;
 		alGenAuxiliaryEffectSlots ((ALuint)1, &aux);
 		return HLCFFIPointer ((void*)(uintptr_t)aux, (hl_finalizer)hl_gc_al_auxiliary_effect_slot);
@@ -1294,7 +1397,7 @@ namespace lime {
 
 		alGetError ();
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint effect;
 		alGenEffects ((ALuint)1, &effect);
 
@@ -1314,7 +1417,7 @@ namespace lime {
 
 		alGetError ();
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint effect;
 		alGenEffects ((ALuint)1, &effect);
 
@@ -1334,7 +1437,7 @@ namespace lime {
 
 		alGetError ();
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint filter;
 		alGenFilters ((ALuint)1, &filter);
 
@@ -1354,7 +1457,7 @@ namespace lime {
 
 		alGetError ();
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint filter;
 		alGenFilters ((ALuint)1, &filter);
 
@@ -1738,7 +1841,7 @@ namespace lime {
 
 	int lime_al_get_filteri (value filter, int param) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (filter);
 		ALint data;
 		alGetFilteri (id, param, &data);
@@ -1752,7 +1855,7 @@ namespace lime {
 
 	HL_PRIM int HL_NAME(hl_al_get_filteri) (HL_CFFIPointer* filter, int param) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)filter->ptr;
 		ALint data;
 		alGetFilteri (id, param, &data);
@@ -2256,7 +2359,7 @@ namespace lime {
 
 	bool lime_al_is_aux (value aux) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (aux);
 		return alIsAuxiliaryEffectSlot (id);
 		#else
@@ -2268,7 +2371,7 @@ namespace lime {
 
 	HL_PRIM bool HL_NAME(hl_al_is_aux) (HL_CFFIPointer* aux) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)aux->ptr;
 		return alIsAuxiliaryEffectSlot (id);
 		#else
@@ -2296,7 +2399,7 @@ namespace lime {
 
 	bool lime_al_is_effect (value effect) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (effect);
 		return alIsEffect (id);
 		#else
@@ -2308,7 +2411,7 @@ namespace lime {
 
 	HL_PRIM bool HL_NAME(hl_al_is_effect) (HL_CFFIPointer* effect) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)effect->ptr;
 		return alIsEffect (id);
 		#else
@@ -2356,7 +2459,7 @@ namespace lime {
 
 	bool lime_al_is_filter (value filter) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (filter);
 		return alIsSource (id);
 		#else
@@ -2368,7 +2471,7 @@ namespace lime {
 
 	HL_PRIM bool HL_NAME(hl_al_is_filter) (HL_CFFIPointer* filter) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)filter->ptr;
 		return alIsSource (id);
 		#else
@@ -2518,40 +2621,56 @@ namespace lime {
 
 	void lime_al_remove_direct_filter (value source) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (source);
+		#ifdef LIME_MOJOAL
+		alSourceDirectFilter (id, AL_FILTER_NULL);
+		#else
 		alSourcei (id, AL_DIRECT_FILTER, AL_FILTER_NULL);
 		#endif
+		#endif
 
 	}
 
 
 	HL_PRIM void HL_NAME(hl_al_remove_direct_filter) (HL_CFFIPointer* source) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)source->ptr;
+		#ifdef LIME_MOJOAL
+		alSourceDirectFilter (id, AL_FILTER_NULL);
+		#else
 		alSourcei (id, AL_DIRECT_FILTER, AL_FILTER_NULL);
 		#endif
+		#endif
 
 	}
 
 
 	void lime_al_remove_send (value source, int index) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)val_data (source);
+		#ifdef LIME_MOJOAL
+		alSourceAuxiliarySend (id, AL_EFFECTSLOT_NULL, index, AL_FILTER_NULL);
+		#else
 		alSource3i (id, AL_AUXILIARY_SEND_FILTER, AL_EFFECTSLOT_NULL, index, 0);
 		#endif
+		#endif
 
 	}
 
 
 	HL_PRIM void HL_NAME(hl_al_remove_send) (HL_CFFIPointer* source, int index) {
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		ALuint id = (ALuint)(uintptr_t)source->ptr;
+		#ifdef LIME_MOJOAL
+		alSourceAuxiliarySend (id, AL_EFFECTSLOT_NULL, index, AL_FILTER_NULL);
+		#else
 		alSource3i (id, AL_AUXILIARY_SEND_FILTER, AL_EFFECTSLOT_NULL, index, 0);
 		#endif
+		#endif
 
 	}
 
@@ -2935,7 +3054,7 @@ namespace lime {
 		ALuint id = (ALuint)(uintptr_t)val_data (source);
 		ALuint data1;
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		if (param == AL_AUXILIARY_SEND_FILTER) {
 
 			data1 = (ALuint)(uintptr_t)val_data (value1);
@@ -2949,6 +3068,15 @@ namespace lime {
 		data1 = val_int (value1);
 		#endif
 
+		#ifdef LIME_MOJOAL
+		if (param == AL_AUXILIARY_SEND_FILTER) {
+
+			alSourceAuxiliarySend (id, data1, value2, value3);
+			return;
+
+		}
+		#endif
+
 		alSource3i (id, param, data1, value2, value3);
 
 	}
@@ -2959,7 +3087,7 @@ namespace lime {
 		ALuint id = (ALuint)(uintptr_t)source->ptr;
 		ALuint data1;
 
-		#ifdef LIME_OPENALSOFT
+		#ifdef LIME_OPENAL_EFX
 		if (param == AL_AUXILIARY_SEND_FILTER) {
 
 			data1 = (ALuint)(uintptr_t)((HL_CFFIPointer*)value1)->ptr;
@@ -2973,6 +3101,15 @@ namespace lime {
 		data1 = value1->v.i;
 		#endif
 
+		#ifdef LIME_MOJOAL
+		if (param == AL_AUXILIARY_SEND_FILTER) {
+
+			alSourceAuxiliarySend (id, data1, value2, value3);
+			return;
+
+		}
+		#endif
+
 		alSource3i (id, param, data1, value2, value3);
 
 	}
@@ -3038,7 +3175,7 @@ namespace lime {
 
 		if (!val_is_null (val)) {
 
-			#ifdef LIME_OPENALSOFT
+			#ifdef LIME_OPENAL_EFX
 			if (param == AL_BUFFER || param == AL_DIRECT_FILTER) {
 
 				data = (ALuint)(uintptr_t)val_data (val);
@@ -3062,6 +3199,15 @@ namespace lime {
 
 		}
 
+		#ifdef LIME_MOJOAL
+		if (param == AL_DIRECT_FILTER) {
+
+			alSourceDirectFilter (id, data);
+			return;
+
+		}
+		#endif
+
 		alSourcei (id, param, data);
 
 	}
@@ -3074,7 +3220,7 @@ namespace lime {
 
 		if (val) {
 
-			#ifdef LIME_OPENALSOFT
+			#ifdef LIME_OPENAL_EFX
 			if (param == AL_BUFFER || param == AL_DIRECT_FILTER) {
 
 				data = (ALuint)(uintptr_t)((HL_CFFIPointer*)val)->ptr;
@@ -3098,6 +3244,15 @@ namespace lime {
 
 		}
 
+		#ifdef LIME_MOJOAL
+		if (param == AL_DIRECT_FILTER) {
+
+			alSourceDirectFilter (id, data);
+			return;
+
+		}
+		#endif
+
 		alSourcei (id, param, data);
 
 	}
@@ -3154,6 +3309,150 @@ namespace lime {
 	}
 
 
+	int lime_al_get_voicei (value pool, int voice, int param) {
+
+		VoicePool* voicePool = (VoicePool*)val_data (pool);
+
+		switch (param) {
+
+			case AL_SOURCE_STATE: return voicePool->IsPlaying (voice) ? AL_PLAYING : AL_STOPPED;
+			case VOICE_VIRTUAL: return voicePool->IsVirtual (voice) ? 1 : 0;
+			default: return 0;
+
+		}
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_al_get_voicei) (HL_CFFIPointer* pool, int voice, int param) {
+
+		VoicePool* voicePool = (VoicePool*)pool->ptr;
+
+		switch (param) {
+
+			case AL_SOURCE_STATE: return voicePool->IsPlaying (voice) ? AL_PLAYING : AL_STOPPED;
+			case VOICE_VIRTUAL: return voicePool->IsVirtual (voice) ? 1 : 0;
+			default: return 0;
+
+		}
+
+	}
+
+
+	int lime_al_voice_play (value pool, value buffer, float priority) {
+
+		VoicePool* voicePool = (VoicePool*)val_data (pool);
+		ALuint id = (ALuint)(uintptr_t)val_data (buffer);
+		return voicePool->Play (id, priority);
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_al_voice_play) (HL_CFFIPointer* pool, HL_CFFIPointer* buffer, float priority) {
+
+		VoicePool* voicePool = (VoicePool*)pool->ptr;
+		ALuint id = (ALuint)(uintptr_t)buffer->ptr;
+		return voicePool->Play (id, priority);
+
+	}
+
+
+	value lime_al_voice_pool_create (int maxSources) {
+
+		VoicePool* voicePool = new VoicePool (maxSources);
+		return CFFIPointer (voicePool, gc_al_voice_pool);
+
+	}
+
+
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_al_voice_pool_create) (int maxSources) {
+
+		VoicePool* voicePool = new VoicePool (maxSources);
+		return HLCFFIPointer (voicePool, (hl_finalizer)hl_gc_al_voice_pool);
+
+	}
+
+
+	void lime_al_voice_pool_update (value pool, float deltaTime) {
+
+		VoicePool* voicePool = (VoicePool*)val_data (pool);
+		voicePool->Update (deltaTime);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_al_voice_pool_update) (HL_CFFIPointer* pool, float deltaTime) {
+
+		VoicePool* voicePool = (VoicePool*)pool->ptr;
+		voicePool->Update (deltaTime);
+
+	}
+
+
+	void lime_al_voice_stop (value pool, int voice) {
+
+		VoicePool* voicePool = (VoicePool*)val_data (pool);
+		voicePool->Stop (voice);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_al_voice_stop) (HL_CFFIPointer* pool, int voice) {
+
+		VoicePool* voicePool = (VoicePool*)pool->ptr;
+		voicePool->Stop (voice);
+
+	}
+
+
+	void lime_al_voice3f (value pool, int voice, int param, float value1, float value2, float value3) {
+
+		VoicePool* voicePool = (VoicePool*)val_data (pool);
+		voicePool->Set3f (voice, param, value1, value2, value3);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_al_voice3f) (HL_CFFIPointer* pool, int voice, int param, float value1, float value2, float value3) {
+
+		VoicePool* voicePool = (VoicePool*)pool->ptr;
+		voicePool->Set3f (voice, param, value1, value2, value3);
+
+	}
+
+
+	void lime_al_voicef (value pool, int voice, int param, float value) {
+
+		VoicePool* voicePool = (VoicePool*)val_data (pool);
+		voicePool->Setf (voice, param, value);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_al_voicef) (HL_CFFIPointer* pool, int voice, int param, float value) {
+
+		VoicePool* voicePool = (VoicePool*)pool->ptr;
+		voicePool->Setf (voice, param, value);
+
+	}
+
+
+	void lime_al_voicei (value pool, int voice, int param, int value) {
+
+		VoicePool* voicePool = (VoicePool*)val_data (pool);
+		voicePool->Seti (voice, param, value);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_al_voicei) (HL_CFFIPointer* pool, int voice, int param, int value) {
+
+		VoicePool* voicePool = (VoicePool*)pool->ptr;
+		voicePool->Seti (voice, param, value);
+
+	}
+
+
 	bool lime_alc_close_device (value device) {
 
 		al_gc_mutex.Lock ();
@@ -3652,6 +3951,14 @@ namespace lime {
 	DEFINE_PRIME3v (lime_al_sourcei);
 	DEFINE_PRIME3v (lime_al_sourceiv);
 	DEFINE_PRIME1v (lime_al_speed_of_sound);
+	DEFINE_PRIME3 (lime_al_get_voicei);
+	DEFINE_PRIME3 (lime_al_voice_play);
+	DEFINE_PRIME1 (lime_al_voice_pool_create);
+	DEFINE_PRIME2v (lime_al_voice_pool_update);
+	DEFINE_PRIME2v (lime_al_voice_stop);
+	DEFINE_PRIME6v (lime_al_voice3f);
+	DEFINE_PRIME4v (lime_al_voicef);
+	DEFINE_PRIME4v (lime_al_voicei);
 	DEFINE_PRIME2 (lime_alc_create_context);
 	DEFINE_PRIME1 (lime_alc_close_device);
 	DEFINE_PRIME1v (lime_alc_destroy_context);
@@ -3777,6 +4084,14 @@ namespace lime {
 	DEFINE_HL_PRIM (_VOID, hl_al_sourcei, _TCFFIPOINTER _I32 _DYN);
 	DEFINE_HL_PRIM (_VOID, hl_al_sourceiv, _TCFFIPOINTER _I32 _ARR);
 	DEFINE_HL_PRIM (_VOID, hl_al_speed_of_sound, _F32);
+	DEFINE_HL_PRIM (_I32, hl_al_get_voicei, _TCFFIPOINTER _I32 _I32);
+	DEFINE_HL_PRIM (_I32, hl_al_voice_play, _TCFFIPOINTER _TCFFIPOINTER _F32);
+	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_al_voice_pool_create, _I32);
+	DEFINE_HL_PRIM (_VOID, hl_al_voice_pool_update, _TCFFIPOINTER _F32);
+	DEFINE_HL_PRIM (_VOID, hl_al_voice_stop, _TCFFIPOINTER _I32);
+	DEFINE_HL_PRIM (_VOID, hl_al_voice3f, _TCFFIPOINTER _I32 _I32 _F32 _F32 _F32);
+	DEFINE_HL_PRIM (_VOID, hl_al_voicef, _TCFFIPOINTER _I32 _I32 _F32);
+	DEFINE_HL_PRIM (_VOID, hl_al_voicei, _TCFFIPOINTER _I32 _I32 _I32);
 	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_alc_create_context, _TCFFIPOINTER _ARR);
 	DEFINE_HL_PRIM (_BOOL, hl_alc_close_device, _TCFFIPOINTER);
 	DEFINE_HL_PRIM (_VOID, hl_alc_destroy_context, _TCFFIPOINTER);
@@ -0,0 +1,504 @@
+#if defined (TVOS) || ((defined (IPHONE) || defined (HX_MACOS)) && !defined (LIME_OPENALSOFT))
+#include <OpenAL/al.h>
+#include <OpenAL/alc.h>
+#else
+#include "AL/al.h"
+#include "AL/alc.h"
+#endif
+
+#include <media/openal/VoicePool.h>
+#include <algorithm>
+#include <math.h>
+
+
+namespace lime {
+
+
+	static const float AUDIBLE_THRESHOLD = 0.0001f;
+	static const int GENERATION_MAX = 0x7FFF;
+
+
+	struct VoiceRanking {
+
+		VoiceRanking (std::vector<Voice>& _voices) : voices (_voices) {}
+
+		bool operator() (int a, int b) const {
+
+			return voices[a].score > voices[b].score;
+
+		}
+
+		std::vector<Voice>& voices;
+
+	};
+
+
+	VoicePool::VoicePool (int maxSources) {
+
+		context = alcGetCurrentContext ();
+
+		alGetError ();
+
+		ALuint source;
+
+		// OpenAL implementations cap the number of sources, so stop at the
+		// first failure and treat that as the size of the pool
+
+		for (int i = 0; i < maxSources; i++) {
+
+			alGenSources (1, &source);
+
+			if (alGetError () != AL_NO_ERROR) {
+
+				break;
+
+			}
+
+			sources.push_back (source);
+			freeSources.push_back (i);
+
+		}
+
+	}
+
+
+	VoicePool::~VoicePool () {
+
+		DeleteSources ();
+
+	}
+
+
+	void VoicePool::Abandon () {
+
+		sources.clear ();
+		freeSources.clear ();
+
+		for (size_t i = 0; i < voices.size (); i++) {
+
+			voices[i].source = -1;
+
+		}
+
+	}
+
+
+	void VoicePool::DeleteSources () {
+
+		for (size_t i = 0; i < voices.size (); i++) {
+
+			if (voices[i].active) {
+
+				Release (&voices[i]);
+
+			}
+
+		}
+
+		if (!sources.empty ()) {
+
+			alDeleteSources ((ALsizei)sources.size (), &sources[0]);
+
+		}
+
+		Abandon ();
+
+	}
+
+
+	void VoicePool::ApplySource (Voice* voice) {
+
+		ALuint source = sources[voice->source];
+
+		alSourcef (source, AL_GAIN, voice->gain);
+		alSourcef (source, AL_PITCH, voice->pitch);
+		alSourcef (source, AL_REFERENCE_DISTANCE, voice->referenceDistance);
+		alSourcef (source, AL_ROLLOFF_FACTOR, voice->rolloffFactor);
+		alSourcef (source, AL_MAX_DISTANCE, voice->maxDistance);
+		alSourcefv (source, AL_POSITION, voice->position);
+		alSourcefv (source, AL_VELOCITY, voice->velocity);
+		alSourcei (source, AL_LOOPING, voice->looping ? AL_TRUE : AL_FALSE);
+		alSourcei (source, AL_SOURCE_RELATIVE, voice->relative ? AL_TRUE : AL_FALSE);
+
+	}
+
+
+	int VoicePool::GetActiveCount () {
+
+		return (int)(voices.size () - freeVoices.size ());
+
+	}
+
+
+	int VoicePool::GetRealCount () {
+
+		return (int)(sources.size () - freeSources.size ());
+
+	}
+
+
+	int VoicePool::GetSourceCount () {
+
+		return (int)sources.size ();
+
+	}
+
+
+	Voice* VoicePool::GetVoice (int handle) {
+
+		int index = handle & 0xFFFF;
+		int generation = (handle >> 16) & GENERATION_MAX;
+
+		if (index < (int)voices.size ()) {
+
+			Voice* voice = &voices[index];
+
+			if (voice->active && voice->generation == generation) {
+
+				return voice;
+
+			}
+
+		}
+
+		return 0;
+
+	}
+
+
+	bool VoicePool::IsPlaying (int handle) {
+
+		Voice* voice = GetVoice (handle);
+		return voice && voice->playing;
+
+	}
+
+
+	bool VoicePool::IsVirtual (int handle) {
+
+		Voice* voice = GetVoice (handle);
+		return voice && voice->source < 0;
+
+	}
+
+
+	int VoicePool::Play (unsigned int buffer, float priority) {
+
+		int index;
+
+		if (!freeVoices.empty ()) {
+
+			index = freeVoices.back ();
+			freeVoices.pop_back ();
+
+		} else {
+
+			if (voices.size () > 0xFFFF) {
+
+				return 0;
+
+			}
+
+			index = (int)voices.size ();
+			Voice empty = Voice ();
+			empty.generation = 1;
+			voices.push_back (empty);
+
+		}
+
+		Voice* voice = &voices[index];
+
+		ALint size = 0, frequency = 0, channels = 0, bits = 0;
+		alGetBufferi (buffer, AL_SIZE, &size);
+		alGetBufferi (buffer, AL_FREQUENCY, &frequency);
+		alGetBufferi (buffer, AL_CHANNELS, &channels);
+		alGetBufferi (buffer, AL_BITS, &bits);
+
+		voice->active = true;
+		voice->playing = true;
+		voice->looping = false;
+		voice->relative = false;
+		voice->buffer = buffer;
+		voice->duration = (frequency > 0 && channels > 0 && bits > 0) ? (float)size / (frequency * channels * (bits / 8)) : 0;
+		voice->offset = 0;
+		voice->priority = priority;
+		voice->gain = 1;
+		voice->pitch = 1;
+		voice->referenceDistance = 1;
+		voice->rolloffFactor = 1;
+		voice->maxDistance = 3.402823466e38f;
+		voice->position[0] = voice->position[1] = voice->position[2] = 0;
+		voice->velocity[0] = voice->velocity[1] = voice->velocity[2] = 0;
+		voice->score = 0;
+		voice->source = -1;
+
+		if (!freeSources.empty ()) {
+
+			Realize (voice);
+
+		}
+
+		return (voice->generation << 16) | index;
+
+	}
+
+
+	void VoicePool::Realize (Voice* voice) {
+
+		voice->source = freeSources.back ();
+		freeSources.pop_back ();
+
+		ALuint source = sources[voice->source];
+
+		alSourcei (source, AL_BUFFER, voice->buffer);
+		ApplySource (voice);
+
+		if (voice->offset > 0) {
+
+			alSourcef (source, AL_SEC_OFFSET, voice->offset);
+
+		}
+
+		alSourcePlay (source);
+
+	}
+
+
+	void VoicePool::Release (Voice* voice) {
+
+		if (voice->source >= 0) {
+
+			ALuint source = sources[voice->source];
+			alSourceStop (source);
+			alSourcei (source, AL_BUFFER, 0);
+			freeSources.push_back (voice->source);
+			voice->source = -1;
+
+		}
+
+		voice->active = false;
+		voice->playing = false;
+		voice->generation = (voice->generation % GENERATION_MAX) + 1;
+		freeVoices.push_back ((int)(voice - &voices[0]));
+
+	}
+
+
+	void VoicePool::Set3f (int handle, int param, float x, float y, float z) {
+
+		Voice* voice = GetVoice (handle);
+		if (!voice) return;
+
+		float* target;
+
+		switch (param) {
+
+			case AL_POSITION: target = voice->position; break;
+			case AL_VELOCITY: target = voice->velocity; break;
+			default: return;
+
+		}
+
+		target[0] = x;
+		target[1] = y;
+		target[2] = z;
+
+		if (voice->source >= 0) {
+
+			alSource3f (sources[voice->source], param, x, y, z);
+
+		}
+
+	}
+
+
+	void VoicePool::Setf (int handle, int param, float value) {
+
+		Voice* voice = GetVoice (handle);
+		if (!voice) return;
+
+		switch (param) {
+
+			case VOICE_PRIORITY: voice->priority = value; return;
+			case AL_GAIN: voice->gain = value; break;
+			case AL_PITCH: voice->pitch = value; break;
+			case AL_REFERENCE_DISTANCE: voice->referenceDistance = value; break;
+			case AL_ROLLOFF_FACTOR: voice->rolloffFactor = value; break;
+			case AL_MAX_DISTANCE: voice->maxDistance = value; break;
+			default: return;
+
+		}
+
+		if (voice->source >= 0) {
+
+			alSourcef (sources[voice->source], param, value);
+
+		}
+
+	}
+
+
+	void VoicePool::Seti (int handle, int param, int value) {
+
+		Voice* voice = GetVoice (handle);
+		if (!voice) return;
+
+		switch (param) {
+
+			case AL_LOOPING: voice->looping = (value != 0); break;
+			case AL_SOURCE_RELATIVE: voice->relative = (value != 0); break;
+			default: return;
+
+		}
+
+		if (voice->source >= 0) {
+
+			alSourcei (sources[voice->source], param, value ? AL_TRUE : AL_FALSE);
+
+		}
+
+	}
+
+
+	void VoicePool::Stop (int handle) {
+
+		Voice* voice = GetVoice (handle);
+
+		if (voice) {
+
+			Release (voice);
+
+		}
+
+	}
+
+
+	void VoicePool::Update (float deltaTime) {
+
+		float listener[3];
+		alGetListenerfv (AL_POSITION, listener);
+
+		ranked.clear ();
+
+		for (size_t i = 0; i < voices.size (); i++) {
+
+			Voice* voice = &voices[i];
+			if (!voice->active) continue;
+
+			if (voice->source >= 0) {
+
+				ALuint source = sources[voice->source];
+				ALint state;
+				alGetSourcei (source, AL_SOURCE_STATE, &state);
+
+				if (state == AL_STOPPED) {
+
+					Release (voice);
+					continue;
+
+				}
+
+				alGetSourcef (source, AL_SEC_OFFSET, &voice->offset);
+
+			} else {
+
+				// virtual voices keep their playback position so they resume
+				// in the right place if they win a source back
+
+				voice->offset += deltaTime * voice->pitch;
+
+				if (voice->offset >= voice->duration) {
+
+					if (voice->looping && voice->duration > 0) {
+
+						voice->offset = fmodf (voice->offset, voice->duration);
+
+					} else {
+
+						Release (voice);
+						continue;
+
+					}
+
+				}
+
+			}
+
+			float dx = voice->position[0];
+			float dy = voice->position[1];
+			float dz = voice->position[2];
+
+			if (!voice->relative) {
+
+				dx -= listener[0];
+				dy -= listener[1];
+				dz -= listener[2];
+
+			}
+
+			float distance = sqrtf (dx * dx + dy * dy + dz * dz);
+			distance = std::max (voice->referenceDistance, std::min (distance, voice->maxDistance));
+
+			float attenuation = 1;
+
+			if (voice->referenceDistance > 0) {
+
+				attenuation = voice->referenceDistance / (voice->referenceDistance + voice->rolloffFactor * (distance - voice->referenceDistance));
+
+			}
+
+			voice->score = voice->priority * voice->gain * attenuation;
+			ranked.push_back ((int)i);
+
+		}
+
+		size_t realCount = std::min (ranked.size (), sources.size ());
+
+		if (realCount < ranked.size ()) {
+
+			std::partial_sort (ranked.begin (), ranked.begin () + realCount, ranked.end (), VoiceRanking (voices));
+
+		}
+
+		for (size_t i = realCount; i < ranked.size (); i++) {
+
+			Voice* voice = &voices[ranked[i]];
+
+			if (voice->source >= 0) {
+
+				Virtualize (voice);
+
+			}
+
+		}
+
+		for (size_t i = 0; i < realCount; i++) {
+
+			Voice* voice = &voices[ranked[i]];
+
+			if (voice->source < 0 && voice->score > AUDIBLE_THRESHOLD && !freeSources.empty ()) {
+
+				Realize (voice);
+
+			}
+
+		}
+
+	}
+
+
+	void VoicePool::Virtualize (Voice* voice) {
+
+		ALuint source = sources[voice->source];
+
+		alGetSourcef (source, AL_SEC_OFFSET, &voice->offset);
+		alSourceStop (source);
+		alSourcei (source, AL_BUFFER, 0);
+
+		freeSources.push_back (voice->source);
+		voice->source = -1;
+
+	}
+
+
+}
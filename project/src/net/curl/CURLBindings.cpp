@@ -1,4 +1,8 @@
 #include <curl/curl.h>
+#include <net/curl/CURLShare.h>
+#include <net/curl/DownloadFile.h>
+#include <net/curl/DownloadManager.h>
+#include <net/curl/HTTPClient.h>
 #include <system/CFFI.h>
 #include <system/CFFIPointer.h>
 #include <system/Mutex.h>
@@ -6,7 +10,6 @@
 #include <system/ValuePointer.h>
 #include <utils/Bytes.h>
 #include <string.h>
-#include <map>
 #include <vector>
 
 
@@ -31,330 +34,344 @@ namespace lime {
 
 	};
 
-	std::map<void*, std::vector<void*>* > curlMultiHandles;
-	std::map<void*, ValuePointer*> curlMultiObjects;
-	std::map<void*, void*> curlMultiReferences;
-	std::map<void*, int> curlMultiRunningHandles;
-	std::map<void*, bool> curlMultiValid;
-	std::map<CURL*, void*> curlObjects;
-	std::map<void*, bool> curlValid;
-	std::map<void*, ValuePointer*> headerCallbacks;
-	std::map<void*, curl_slist*> headerSLists;
-	std::map<void*, std::vector<char*>* > headerValues;
-	std::map<void*, ValuePointer*> progressCallbacks;
-	std::map<void*, CURL_Progress*> progressValues;
-	std::map<void*, Bytes*> readBytes;
-	std::map<void*, int> readBytesPosition;
-	std::map<void*, ValuePointer*> readBytesRoot;
-	// TODO: Switch to structs
-	std::map<void*, char*> writeBuffers;
-	std::map<void*, int> writeBufferPosition;
-	std::map<void*, int> writeBufferSize;
-	std::map<void*, Bytes*> writeBytes;
-	std::map<void*, ValuePointer*> writeBytesRoot;
-	std::map<void*, ValuePointer*> writeCallbacks;
-	std::map<void*, ValuePointer*> xferInfoCallbacks;
-	std::map<void*, CURL_XferInfo*> xferInfoValues;
-	Mutex curl_gc_mutex;
+	struct CURL_MultiContext;
+
+	// Everything a Haxe CURL handle needs on the native side. The CFFI
+	// pointer wraps the context, and the context is also the CURLOPT_PRIVATE
+	// and callback userdata of the easy handle, so callbacks reach it without
+	// a lookup and without locking. A context is only touched by the thread
+	// running its transfer.
+	//
+	// Response bodies are either buffered until the next flush, written
+	// straight to writeFile, or, when writeChunkSize is set, collected in a
+	// fixed-size buffer that is handed to the write callback whenever it
+	// fills. The last two run in constant memory regardless of body size.
+
+	struct CURL_Context {
+
+		bool blocking;
+		CURL* curl;
+		void (*flushWrite) (CURL_Context*);
+		ValuePointer* headerCallback;
+		curl_slist* headerSList;
+		std::vector<char*> headerValues;
+		CURL_MultiContext* multi;
+		ValuePointer* multiObject;
+		CURL_Progress progress;
+		ValuePointer* progressCallback;
+		Bytes* readBytes;
+		int readBytesPosition;
+		ValuePointer* readBytesRoot;
+		CURLShare* share;
+		char* writeBuffer;
+		int writeBufferPosition;
+		int writeBufferSize;
+		Bytes* writeBytes;
+		ValuePointer* writeBytesRoot;
+		ValuePointer* writeCallback;
+		int writeChunkSize;
+		DownloadFile* writeFile;
+		int64_t writeFileOffset;
+		bool writeFilePreallocate;
+		bool writeFileSkip;
+		bool writeFileStarted;
+		bool writePaused;
+		CURL_XferInfo xferInfo;
+		ValuePointer* xferInfoCallback;
 
+	};
 
-	void gc_curl (value handle) {
+	// The mutex only guards the handle list and the multi handle itself, so
+	// transfers on different multi handles never contend with each other.
 
-		if (!val_is_null (handle)) {
+	struct CURL_MultiContext {
 
-			curl_gc_mutex.Lock ();
+		std::vector<CURL_Context*> handles;
+		CURLM* multi;
+		Mutex mutex;
+		int runningHandles;
 
-			if (curlMultiReferences.find (handle) != curlMultiReferences.end ()) {
+	};
 
-				value multi_handle = (value)curlMultiReferences[handle];
-				curl_multi_remove_handle ((CURLM*)val_data (multi_handle), (CURL*)val_data (handle));
-				curlMultiReferences.erase (handle);
 
-				std::vector<void*>* handles = curlMultiHandles[multi_handle];
+	static CURL_Context* curl_context_create (CURL* curl) {
 
-				if (handles->size () > 0) {
+		CURL_Context* context = new CURL_Context ();
+		context->curl = curl;
 
-					for (std::vector<void*>::iterator it = handles->begin (); it != handles->end (); ++it) {
+		if (curl) {
 
-						if (*it == handle) {
+			curl_easy_setopt (curl, CURLOPT_PRIVATE, context);
 
-							handles->erase (it);
-							delete curlMultiObjects[handle];
-							curlMultiObjects.erase (handle);
-							break;
+		}
 
-						}
+		return context;
 
-					}
+	}
 
-				}
+
+	static void curl_multi_context_detach (CURL_MultiContext* multi, CURL_Context* context) {
+
+		for (std::vector<CURL_Context*>::iterator it = multi->handles.begin (); it != multi->handles.end (); ++it) {
+
+			if (*it == context) {
+
+				multi->handles.erase (it);
+				break;
 
 			}
 
-			if (curlValid.find (handle) != curlValid.end ()) {
+		}
 
-				CURL* curl = (CURL*)val_data (handle);
+		delete context->multiObject;
+		context->multiObject = NULL;
+		context->multi = NULL;
 
-				curlValid.erase (handle);
-				curlObjects.erase (curl);
-				curl_easy_cleanup (curl);
+	}
 
-				if (writeBuffers[handle]) {
 
-					free (writeBuffers[handle]);
+	static void curl_context_reset_write (CURL_Context* context) {
 
-				}
+		if (context->writeFile) {
 
-				writeBuffers.erase (handle);
-				writeBufferPosition.erase (handle);
-				writeBufferSize.erase (handle);
+			delete context->writeFile;
+			context->writeFile = NULL;
 
-			}
+		}
 
-			ValuePointer* callback;
-			Bytes* bytes;
-			ValuePointer* bytesRoot;
+		if (context->writeBuffer) {
 
-			if (headerCallbacks.find (handle) != headerCallbacks.end ()) {
+			free (context->writeBuffer);
+			context->writeBuffer = NULL;
 
-				callback = headerCallbacks[handle];
-				std::vector<char*>* values = headerValues[handle];
-				headerCallbacks.erase (handle);
-				headerValues.erase (handle);
-				delete callback;
-				delete values;
+		}
 
-			}
+		context->writeBufferPosition = 0;
+		context->writeBufferSize = 0;
+		context->writeChunkSize = 0;
+		context->writeFileOffset = 0;
+		context->writeFilePreallocate = false;
+		context->writeFileSkip = false;
+		context->writeFileStarted = false;
 
-			if (headerSLists.find (handle) != headerSLists.end ()) {
+		if (context->writePaused) {
 
-				curl_slist* chunk = headerSLists[handle];
-				headerSLists.erase (handle);
-				curl_slist_free_all (chunk);
+			context->writePaused = false;
+			if (context->curl) curl_easy_pause (context->curl, CURLPAUSE_CONT);
 
-			}
+		}
 
-			if (progressCallbacks.find (handle) != progressCallbacks.end ()) {
+	}
 
-				callback = progressCallbacks[handle];
-				CURL_Progress* progress = progressValues[handle];
-				progressCallbacks.erase (handle);
-				progressValues.erase (progress);
-				delete callback;
-				delete progress;
 
-			}
+	static void curl_context_set_share (CURL_Context* context, CURLShare* share) {
 
-			if (readBytes.find (handle) != readBytes.end ()) {
+		// The easy handle must be detached before its reference is dropped,
+		// so curl_share_cleanup never runs while the share is still in use
 
-				bytes = readBytes[handle];
-				bytesRoot = readBytesRoot[handle];
-				readBytes.erase (handle);
-				readBytesPosition.erase (handle);
-				readBytesRoot.erase (handle);
-				delete bytes;
-				delete bytesRoot;
+		if (share) share->Retain ();
+		if (context->share) context->share->Release ();
+		context->share = share;
 
-			}
+	}
 
-			if (writeCallbacks.find (handle) != writeCallbacks.end ()) {
 
-				callback = writeCallbacks[handle];
-				bytes = writeBytes[handle];
-				bytesRoot = writeBytesRoot[handle];
-				writeCallbacks.erase (handle);
-				writeBytes.erase (handle);
-				writeBytesRoot.erase (handle);
-				delete callback;
-				delete bytes;
-				delete bytesRoot;
+	static void curl_context_release (CURL_Context* context, bool ownsBytes) {
 
-			}
+		CURL_MultiContext* multi = context->multi;
+
+		if (multi) {
 
-			if (xferInfoCallbacks.find (handle) != xferInfoCallbacks.end ()) {
+			multi->mutex.Lock ();
 
-				callback = xferInfoCallbacks[handle];
-				CURL_XferInfo* info = xferInfoValues[handle];
-				xferInfoCallbacks.erase (handle);
-				xferInfoValues.erase (handle);
-				delete callback;
-				delete info;
+			if (multi->multi && context->curl) {
+
+				curl_multi_remove_handle (multi->multi, context->curl);
 
 			}
 
-			val_gc (handle, 0);
+			curl_multi_context_detach (multi, context);
+			multi->mutex.Unlock ();
+
+		}
 
-			curl_gc_mutex.Unlock ();
+		if (context->curl) {
+
+			curl_easy_cleanup (context->curl);
+			context->curl = NULL;
 
 		}
 
-	}
+		curl_context_set_share (context, NULL);
+		curl_context_reset_write (context);
 
+		for (std::vector<char*>::iterator it = context->headerValues.begin (); it != context->headerValues.end (); ++it) {
 
-	void hl_gc_curl (HL_CFFIPointer* handle) {
+			free (*it);
 
-		if (handle) {
+		}
 
-			curl_gc_mutex.Lock ();
+		context->headerValues.clear ();
 
-			if (curlMultiReferences.find (handle) != curlMultiReferences.end ()) {
+		if (context->headerSList) {
 
-				HL_CFFIPointer* multi_handle = (HL_CFFIPointer*)curlMultiReferences[handle];
-				curl_multi_remove_handle ((CURLM*)multi_handle->ptr, (CURL*)handle->ptr);
-				curlMultiReferences.erase (handle);
+			curl_slist_free_all (context->headerSList);
+			context->headerSList = NULL;
 
-				std::vector<void*>* handles = curlMultiHandles[multi_handle];
+		}
 
-				if (handles->size () > 0) {
+		if (ownsBytes) {
 
-					for (std::vector<void*>::iterator it = handles->begin (); it != handles->end (); ++it) {
+			delete context->readBytes;
+			delete context->writeBytes;
 
-						if (*it == handle) {
+		}
 
-							handles->erase (it);
-							delete curlMultiObjects[handle];
-							curlMultiObjects.erase (handle);
-							break;
+		delete context->headerCallback;
+		delete context->progressCallback;
+		delete context->readBytesRoot;
+		delete context->writeBytesRoot;
+		delete context->writeCallback;
+		delete context->xferInfoCallback;
 
-						}
+		context->headerCallback = NULL;
+		context->progressCallback = NULL;
+		context->readBytes = NULL;
+		context->readBytesRoot = NULL;
+		context->writeBytes = NULL;
+		context->writeBytesRoot = NULL;
+		context->writeCallback = NULL;
+		context->xferInfoCallback = NULL;
 
-					}
+	}
 
-				}
+
+	static void curl_multi_context_release (CURL_MultiContext* context) {
+
+		context->mutex.Lock ();
+
+		while (context->handles.size () > 0) {
+
+			CURL_Context* handle = context->handles.back ();
+
+			if (context->multi && handle->curl) {
+
+				curl_multi_remove_handle (context->multi, handle->curl);
 
 			}
 
-			if (curlValid.find (handle) != curlValid.end ()) {
+			curl_multi_context_detach (context, handle);
 
-				CURL* curl = (CURL*)handle->ptr;
+		}
 
-				curlValid.erase (handle);
-				curlObjects.erase (curl);
-				curl_easy_cleanup (curl);
+		if (context->multi) {
 
-				if (writeBuffers[handle]) {
+			curl_multi_cleanup (context->multi);
+			context->multi = NULL;
 
-					free (writeBuffers[handle]);
+		}
 
-				}
+		context->runningHandles = 0;
 
-				writeBuffers.erase (handle);
-				writeBufferPosition.erase (handle);
-				writeBufferSize.erase (handle);
+		context->mutex.Unlock ();
 
-			}
+	}
 
-			ValuePointer* callback;
-			Bytes* bytes;
-			ValuePointer* bytesRoot;
 
-			if (headerCallbacks.find (handle) != headerCallbacks.end ()) {
+	static CURL_Context* curl_context_duplicate (CURL_Context* context) {
 
-				callback = headerCallbacks[handle];
-				std::vector<char*>* values = headerValues[handle];
-				headerCallbacks.erase (handle);
-				headerValues.erase (handle);
-				delete callback;
-				delete values;
+		CURL_Context* dup = curl_context_create (context->curl ? curl_easy_duphandle (context->curl) : NULL);
+		CURL* curl = dup->curl;
 
-			}
+		if (!curl) return dup;
 
-			if (headerSLists.find (handle) != headerSLists.end ()) {
+		// A duplicate inherits the callback userdata of the original, so point
+		// it at the new context before any transfer can run
 
-				curl_slist* chunk = headerSLists[handle];
-				headerSLists.erase (handle);
-				curl_slist_free_all (chunk);
+		if (context->headerCallback) curl_easy_setopt (curl, CURLOPT_HEADERDATA, dup);
+		if (context->progressCallback) curl_easy_setopt (curl, CURLOPT_PROGRESSDATA, dup);
+		if (context->writeCallback || context->writeFile) curl_easy_setopt (curl, CURLOPT_WRITEDATA, dup);
+		if (context->xferInfoCallback) curl_easy_setopt (curl, CURLOPT_XFERINFODATA, dup);
 
-			}
+		if (context->readBytesRoot) {
 
-			if (progressCallbacks.find (handle) != progressCallbacks.end ()) {
+			curl_easy_setopt (curl, CURLOPT_READDATA, dup);
+			curl_easy_setopt (curl, CURLOPT_SEEKDATA, dup);
 
-				callback = progressCallbacks[handle];
-				CURL_Progress* progress = progressValues[handle];
-				progressCallbacks.erase (handle);
-				progressValues.erase (progress);
-				delete callback;
-				delete progress;
+		}
 
-			}
+		if (context->share) {
 
-			if (readBytes.find (handle) != readBytes.end ()) {
+			curl_context_set_share (dup, context->share);
 
-				bytes = readBytes[handle];
-				bytesRoot = readBytesRoot[handle];
-				readBytes.erase (handle);
-				readBytesPosition.erase (handle);
-				readBytesRoot.erase (handle);
-				delete bytesRoot;
+		}
 
-			}
+		if (context->writeChunkSize > 0) {
 
-			if (writeCallbacks.find (handle) != writeCallbacks.end ()) {
+			dup->flushWrite = context->flushWrite;
+			dup->writeChunkSize = context->writeChunkSize;
+			dup->writeBuffer = (char*)malloc (context->writeChunkSize);
+			dup->writeBufferSize = context->writeChunkSize;
 
-				callback = writeCallbacks[handle];
-				bytes = writeBytes[handle];
-				bytesRoot = writeBytesRoot[handle];
-				writeCallbacks.erase (handle);
-				writeBytes.erase (handle);
-				writeBytesRoot.erase (handle);
-				delete callback;
-				delete bytesRoot;
+		}
 
-			}
+		if (context->headerSList) {
 
-			if (xferInfoCallbacks.find (handle) != xferInfoCallbacks.end ()) {
+			for (curl_slist* item = context->headerSList; item; item = item->next) {
 
-				callback = xferInfoCallbacks[handle];
-				CURL_XferInfo* info = xferInfoValues[handle];
-				xferInfoCallbacks.erase (handle);
-				xferInfoValues.erase (handle);
-				delete callback;
-				delete info;
+				dup->headerSList = curl_slist_append (dup->headerSList, item->data);
 
 			}
 
-			handle->finalizer = NULL;
-
-			curl_gc_mutex.Unlock ();
+			curl_easy_setopt (curl, CURLOPT_HTTPHEADER, dup->headerSList);
 
 		}
 
+		return dup;
+
 	}
 
 
-	void gc_curl_multi (value handle) {
+	void gc_curl (value handle) {
 
 		if (!val_is_null (handle)) {
 
-			curl_gc_mutex.Lock ();
+			CURL_Context* context = (CURL_Context*)val_data (handle);
+			curl_context_release (context, true);
+			delete context;
 
-			if (curlMultiValid.find (handle) != curlMultiValid.end ()) {
+			val_gc (handle, 0);
 
-				curlMultiValid.erase (handle);
-				curl_multi_cleanup ((CURLM*)val_data(handle));
+		}
 
-			}
+	}
 
-			std::vector<void*>* handles = curlMultiHandles[handle];
 
-			for (std::vector<void*>::iterator it = handles->begin (); it != handles->end (); ++it) {
+	void hl_gc_curl (HL_CFFIPointer* handle) {
 
-				delete curlMultiObjects[*it];
-				curlMultiObjects.erase (*it);
+		if (handle && handle->ptr) {
 
-				curl_gc_mutex.Unlock ();
-				gc_curl ((value)*it);
-				curl_gc_mutex.Lock ();
+			CURL_Context* context = (CURL_Context*)handle->ptr;
+			curl_context_release (context, false);
+			delete context;
 
-			}
+			handle->ptr = NULL;
+			handle->finalizer = NULL;
 
-			delete curlMultiHandles[handle];
-			curlMultiHandles.erase (handle);
+		}
 
-			val_gc (handle, 0);
-			//handle = alloc_null ();
+	}
+
+
+	void gc_curl_multi (value handle) {
+
+		if (!val_is_null (handle)) {
 
-			curl_gc_mutex.Unlock ();
+			CURL_MultiContext* context = (CURL_MultiContext*)val_data (handle);
+			curl_multi_context_release (context);
+			delete context;
+
+			val_gc (handle, 0);
 
 		}
 
@@ -363,37 +380,39 @@ namespace lime {
 
 	void hl_gc_curl_multi (HL_CFFIPointer* handle) {
 
-		if (handle) {
+		if (handle && handle->ptr) {
+
+			CURL_MultiContext* context = (CURL_MultiContext*)handle->ptr;
+			curl_multi_context_release (context);
+			delete context;
+
+			handle->ptr = NULL;
+			handle->finalizer = NULL;
 
-			curl_gc_mutex.Lock ();
+		}
 
-			if (curlMultiValid.find (handle) != curlMultiValid.end ()) {
+	}
 
-				curlMultiValid.erase (handle);
-				curl_multi_cleanup ((CURLM*)handle->ptr);
 
-			}
+	void gc_curl_share (value handle) {
 
-			std::vector<void*>* handles = curlMultiHandles[handle];
+		if (!val_is_null (handle)) {
+
+			((CURLShare*)val_data (handle))->Release ();
+			val_gc (handle, 0);
 
-			for (std::vector<void*>::iterator it = handles->begin (); it != handles->end (); ++it) {
+		}
 
-				delete curlMultiObjects[*it];
-				curlMultiObjects.erase (*it);
+	}
 
-				curl_gc_mutex.Unlock ();
-				hl_gc_curl ((HL_CFFIPointer*)*it);
-				curl_gc_mutex.Lock ();
 
-			}
+	void hl_gc_curl_share (HL_CFFIPointer* handle) {
 
-			delete curlMultiHandles[handle];
-			curlMultiHandles.erase (handle);
+		if (handle && handle->ptr) {
 
+			((CURLShare*)handle->ptr)->Release ();
+			handle->ptr = NULL;
 			handle->finalizer = NULL;
-			//handle = alloc_null ();
-
-			curl_gc_mutex.Unlock ();
 
 		}
 
@@ -402,152 +421,122 @@ namespace lime {
 
 	void lime_curl_easy_cleanup (value handle) {
 
-		gc_curl (handle);
+		curl_context_release ((CURL_Context*)val_data (handle), true);
 
 	}
 
 
 	HL_PRIM void HL_NAME(hl_curl_easy_cleanup) (HL_CFFIPointer* handle) {
 
-		hl_gc_curl (handle);
+		if (handle->ptr) curl_context_release ((CURL_Context*)handle->ptr, false);
 
 	}
 
 
 	value lime_curl_easy_duphandle (value handle) {
 
-		curl_gc_mutex.Lock ();
-
-		CURL* dup = curl_easy_duphandle ((CURL*)val_data(handle));
-		value duphandle = CFFIPointer (dup, gc_curl);
-		curlValid[duphandle] = true;
-		curlObjects[dup] = duphandle;
+		CURL_Context* context = (CURL_Context*)val_data (handle);
+		CURL_Context* dup = curl_context_duplicate (context);
 
 		value callbackValue;
-		Bytes* bytes;
 		value bytesValue;
 
-		if (headerCallbacks.find (handle) != headerCallbacks.end ()) {
+		if (context->headerCallback) {
 
-			callbackValue = (value)headerCallbacks[handle]->Get ();
-			headerCallbacks[duphandle] = new ValuePointer (callbackValue);
-			headerValues[duphandle] = new std::vector<char*> ();
+			callbackValue = (value)context->headerCallback->Get ();
+			dup->headerCallback = new ValuePointer (callbackValue);
 
 		}
 
-		if (progressCallbacks.find (handle) != progressCallbacks.end ()) {
+		if (context->progressCallback) {
 
-			callbackValue = (value)progressCallbacks[handle]->Get ();
-			progressCallbacks[duphandle] = new ValuePointer (callbackValue);
-			progressValues[duphandle] = new CURL_Progress ();
+			callbackValue = (value)context->progressCallback->Get ();
+			dup->progressCallback = new ValuePointer (callbackValue);
 
 		}
 
-		if (readBytes.find (handle) != readBytes.end ()) {
+		if (context->readBytesRoot) {
 
-			bytesValue = (value)readBytesRoot[handle]->Get ();
-			bytes = new Bytes (bytesValue);
-			readBytes[duphandle] = bytes;
-			readBytesPosition[duphandle] = 0;
-			readBytesRoot[duphandle] = new ValuePointer (bytesValue);
+			bytesValue = (value)context->readBytesRoot->Get ();
+			dup->readBytes = new Bytes (bytesValue);
+			dup->readBytesRoot = new ValuePointer (bytesValue);
 
 		}
 
-		if (writeCallbacks.find (handle) != writeCallbacks.end ()) {
+		if (context->writeCallback) {
 
-			callbackValue = (value)writeCallbacks[handle]->Get ();
-			bytesValue = (value)writeBytesRoot[handle]->Get ();
-			bytes = new Bytes (bytesValue);
-			writeCallbacks[duphandle] = new ValuePointer (callbackValue);
-			writeBuffers[duphandle] = NULL;
-			writeBufferPosition[duphandle] = 0;
-			writeBufferSize[duphandle] = 0;
-			writeBytes[duphandle] = bytes;
-			writeBytesRoot[duphandle] = new ValuePointer (bytesValue);
+			callbackValue = (value)context->writeCallback->Get ();
+			bytesValue = (value)context->writeBytesRoot->Get ();
+			dup->writeCallback = new ValuePointer (callbackValue);
+			dup->writeBytes = new Bytes (bytesValue);
+			dup->writeBytesRoot = new ValuePointer (bytesValue);
 
 		}
 
-		if (xferInfoCallbacks.find (handle) != xferInfoCallbacks.end ()) {
+		if (context->xferInfoCallback) {
 
-			callbackValue = (value)xferInfoCallbacks[handle]->Get ();
-			xferInfoCallbacks[duphandle] = new ValuePointer (callbackValue);
-			xferInfoValues[duphandle] = new CURL_XferInfo ();
+			callbackValue = (value)context->xferInfoCallback->Get ();
+			dup->xferInfoCallback = new ValuePointer (callbackValue);
 
 		}
 
-		curl_gc_mutex.Unlock ();
-
-		return duphandle;
+		return CFFIPointer (dup, gc_curl);
 
 	}
 
 
 	HL_PRIM HL_CFFIPointer* HL_NAME(hl_curl_easy_duphandle) (HL_CFFIPointer* handle) {
 
-		curl_gc_mutex.Lock ();
-
-		CURL* dup = curl_easy_duphandle ((CURL*)handle->ptr);
-		HL_CFFIPointer* duphandle = HLCFFIPointer (dup, (hl_finalizer)hl_gc_curl);
-		curlValid[duphandle] = true;
-		curlObjects[dup] = duphandle;
+		CURL_Context* context = (CURL_Context*)handle->ptr;
+		CURL_Context* dup = curl_context_duplicate (context);
 
 		vclosure* callbackValue;
-		Bytes* bytes;
 
-		if (headerCallbacks.find (handle) != headerCallbacks.end ()) {
+		if (context->headerCallback) {
 
-			callbackValue = (vclosure*)headerCallbacks[handle]->Get ();
-			headerCallbacks[duphandle] = new ValuePointer (callbackValue);
-			headerValues[duphandle] = new std::vector<char*> ();
+			callbackValue = (vclosure*)context->headerCallback->Get ();
+			dup->headerCallback = new ValuePointer (callbackValue);
 
 		}
 
-		if (progressCallbacks.find (handle) != progressCallbacks.end ()) {
+		if (context->progressCallback) {
 
-			callbackValue = (vclosure*)progressCallbacks[handle]->Get ();
-			progressCallbacks[duphandle] = new ValuePointer (callbackValue);
-			progressValues[duphandle] = new CURL_Progress ();
+			callbackValue = (vclosure*)context->progressCallback->Get ();
+			dup->progressCallback = new ValuePointer (callbackValue);
 
 		}
 
-		if (readBytes.find (handle) != readBytes.end ()) {
+		if (context->readBytesRoot) {
 
-			readBytes[duphandle] = readBytes[handle];
-			readBytesPosition[duphandle] = 0;
-			readBytesRoot[duphandle] = new ValuePointer ((vobj*)readBytes[handle]);
+			dup->readBytes = context->readBytes;
+			dup->readBytesRoot = new ValuePointer ((vobj*)context->readBytes);
 
 		}
 
-		if (writeCallbacks.find (handle) != writeCallbacks.end ()) {
+		if (context->writeCallback) {
 
-			callbackValue = (vclosure*)writeCallbacks[handle]->Get ();
-			writeCallbacks[duphandle] = new ValuePointer (callbackValue);
-			writeBuffers[duphandle] = NULL;
-			writeBufferPosition[duphandle] = 0;
-			writeBufferSize[duphandle] = 0;
-			writeBytes[duphandle] = writeBytes[handle];
-			writeBytesRoot[duphandle] = new ValuePointer ((vobj*)writeBytes[handle]);
+			callbackValue = (vclosure*)context->writeCallback->Get ();
+			dup->writeCallback = new ValuePointer (callbackValue);
+			dup->writeBytes = context->writeBytes;
+			dup->writeBytesRoot = new ValuePointer ((vobj*)context->writeBytes);
 
 		}
 
-		if (xferInfoCallbacks.find (handle) != xferInfoCallbacks.end ()) {
+		if (context->xferInfoCallback) {
 
-			callbackValue = (vclosure*)xferInfoCallbacks[handle]->Get ();
-			xferInfoCallbacks[duphandle] = new ValuePointer (callbackValue);
-			xferInfoValues[duphandle] = new CURL_XferInfo ();
+			callbackValue = (vclosure*)context->xferInfoCallback->Get ();
+			dup->xferInfoCallback = new ValuePointer (callbackValue);
 
 		}
 
-		curl_gc_mutex.Unlock ();
-
-		return duphandle;
+		return HLCFFIPointer (dup, (hl_finalizer)hl_gc_curl);
 
 	}
 
 
 	value lime_curl_easy_escape (value curl, HxString url, int length) {
 
-		char* result = curl_easy_escape ((CURL*)val_data(curl), url.__s, length);
+		char* result = curl_easy_escape (((CURL_Context*)val_data (curl))->curl, url.__s, length);
 		return result ? alloc_string (result) : alloc_null ();
 
 	}
@@ -555,189 +544,164 @@ namespace lime {
 
 	HL_PRIM vbyte* HL_NAME(hl_curl_easy_escape) (HL_CFFIPointer* curl, hl_vstring* url, int length) {
 
-		char* result = curl_easy_escape ((CURL*)curl->ptr, url ? hl_to_utf8 (url->bytes) : NULL, length);
+		char* result = curl_easy_escape (((CURL_Context*)curl->ptr)->curl, url ? hl_to_utf8 (url->bytes) : NULL, length);
 		return (vbyte*)result;
 
 	}
 
 
-	void lime_curl_easy_flush (value easy_handle) {
-
-		curl_gc_mutex.Lock ();
-		int code;
+	static void curl_context_flush_write (CURL_Context* context) {
 
-		if (headerCallbacks.find (easy_handle) != headerCallbacks.end ()) {
+		if (context->writeCallback && context->writeBuffer && context->writeBufferPosition > 0) {
 
-			ValuePointer* headerCallback = headerCallbacks[easy_handle];
-			std::vector<char*>* values = headerValues[easy_handle];
+			int position = context->writeBufferPosition;
 
-			if (values->size () > 0) {
+			Bytes* bytes = context->writeBytes;
+			if (bytes->length < position) bytes->Resize (position);
+			memcpy ((char*)bytes->b, context->writeBuffer, position);
+			context->writeBufferPosition = 0;
 
-				for (std::vector<char*>::iterator it = values->begin (); it != values->end (); ++it) {
+			value _bytes = bytes->Value ((value)context->writeBytesRoot->Get ());
 
-					curl_gc_mutex.Unlock ();
-					headerCallback->Call (alloc_string (*it));
-					curl_gc_mutex.Lock ();
+			int length = val_int ((value)context->writeCallback->Call (_bytes, alloc_int (position)));
 
-				}
+			if (length == CURL_WRITEFUNC_PAUSE) {
 
-				values->clear ();
+				// TODO: Handle pause
 
 			}
 
 		}
 
-		if (writeBuffers.find (easy_handle) != writeBuffers.end ()) {
-
-			char* buffer = writeBuffers[easy_handle];
-			int position = writeBufferPosition[easy_handle];
-			int length = writeBufferSize[easy_handle];
-
-			if (buffer && position > 0) {
+	}
 
-				if (writeCallbacks.find (easy_handle) != writeCallbacks.end ()) {
 
-					ValuePointer* writeCallback = writeCallbacks[easy_handle];
-					ValuePointer* bytesRoot = writeBytesRoot[easy_handle];
+	static void hl_curl_context_flush_write (CURL_Context* context) {
 
-					Bytes* bytes = writeBytes[easy_handle];
-					if (bytes->length < position) bytes->Resize (position);
-					memcpy ((char*)bytes->b, buffer, position);
-					// free (buffer);
-					// writeBuffers[easy_handle] = NULL;
-					// writeBufferSize[easy_handle] = 0;
-					writeBufferPosition[easy_handle] = 0;
+		if (context->writeCallback && context->writeBuffer && context->writeBufferPosition > 0) {
 
-					value _bytes = bytes->Value ((value)bytesRoot->Get ());
+			int position = context->writeBufferPosition;
 
-					curl_gc_mutex.Unlock ();
-					length = val_int ((value)writeCallback->Call (_bytes, alloc_int (position)));
-					curl_gc_mutex.Lock ();
+			Bytes* bytes = context->writeBytes;
+			if (bytes->length < position) bytes->Resize (position);
+			memcpy ((char*)bytes->b, context->writeBuffer, position);
+			context->writeBufferPosition = 0;
 
-					if (length == CURL_WRITEFUNC_PAUSE) {
+			vdynamic* pos = hl_alloc_dynamic (&hlt_i32);
+			pos->v.i = position;
 
-						// TODO: Handle pause
+			vdynamic* _length = (vdynamic*)context->writeCallback->Call (bytes, pos);
+			int length = (_length != NULL ? _length->v.i : 0);
 
-					}
+			if (length == CURL_WRITEFUNC_PAUSE) {
 
-				}
+				// TODO: Handle pause
 
 			}
 
 		}
 
-		if (progressCallbacks.find (easy_handle) != progressCallbacks.end ()) {
+	}
 
-			CURL_Progress* progress = progressValues[easy_handle];
-			ValuePointer* progressCallback = progressCallbacks[easy_handle];
 
-			curl_gc_mutex.Unlock ();
-			code = val_int ((value)progressCallback->Call (alloc_float (progress->dltotal), alloc_float (progress->dlnow), alloc_float (progress->ultotal), alloc_float (progress->ulnow)));
-			curl_gc_mutex.Lock ();
+	static void curl_context_flush (CURL_Context* context) {
 
-			if (code != 0) { // CURLE_OK
+		int code;
 
-				// TODO: Abort
+		if (context->headerCallback && context->headerValues.size () > 0) {
 
-			}
+			std::vector<char*> values;
+			values.swap (context->headerValues);
 
-		}
+			for (std::vector<char*>::iterator it = values.begin (); it != values.end (); ++it) {
 
-		if (xferInfoCallbacks.find (easy_handle) != xferInfoCallbacks.end ()) {
+				if (context->headerCallback) context->headerCallback->Call (alloc_string (*it));
+				free (*it);
 
-			CURL_XferInfo* xferInfo = xferInfoValues[easy_handle];
-			ValuePointer* xferInfoCallback = xferInfoCallbacks[easy_handle];
+			}
 
-			curl_gc_mutex.Unlock ();
-			code = val_int ((value)xferInfoCallback->Call (alloc_int (xferInfo->dltotal), alloc_int (xferInfo->dlnow), alloc_int (xferInfo->ultotal), alloc_int (xferInfo->ulnow)));
-			curl_gc_mutex.Lock ();
+		}
 
-			if (code != 0) {
+		curl_context_flush_write (context);
 
-				// TODO: Abort
+		if (context->writePaused) {
 
-			}
+			// The write callback paused because the chunk buffer was full, now
+			// that it has been handed over the transfer can continue
 
-		}
+			context->writePaused = false;
+			curl_easy_pause (context->curl, CURLPAUSE_CONT);
 
-		curl_gc_mutex.Unlock ();
+		}
 
-	}
+		if (context->progressCallback) {
 
+			CURL_Progress* progress = &context->progress;
 
-	HL_PRIM void HL_NAME(hl_curl_easy_flush) (HL_CFFIPointer* easy_handle) {
+			code = val_int ((value)context->progressCallback->Call (alloc_float (progress->dltotal), alloc_float (progress->dlnow), alloc_float (progress->ultotal), alloc_float (progress->ulnow)));
 
-		curl_gc_mutex.Lock ();
-		int code;
+			if (code != 0) { // CURLE_OK
 
-		if (headerCallbacks.find (easy_handle) != headerCallbacks.end ()) {
+				// TODO: Abort
 
-			ValuePointer* headerCallback = headerCallbacks[easy_handle];
-			std::vector<char*>* values = headerValues[easy_handle];
+			}
 
-			if (values->size () > 0) {
+		}
 
-				for (std::vector<char*>::iterator it = values->begin (); it != values->end (); ++it) {
+		if (context->xferInfoCallback) {
 
-					vdynamic* bytes = hl_alloc_dynamic (&hlt_bytes);
-					bytes->v.bytes = (vbyte*)*it;
+			CURL_XferInfo* xferInfo = &context->xferInfo;
 
-					curl_gc_mutex.Unlock ();
-					headerCallback->Call (bytes);
-					curl_gc_mutex.Lock ();
+			code = val_int ((value)context->xferInfoCallback->Call (alloc_int (xferInfo->dltotal), alloc_int (xferInfo->dlnow), alloc_int (xferInfo->ultotal), alloc_int (xferInfo->ulnow)));
 
-				}
+			if (code != 0) {
 
-				values->clear ();
+				// TODO: Abort
 
 			}
 
 		}
 
-		if (writeBuffers.find (easy_handle) != writeBuffers.end ()) {
+	}
 
-			char* buffer = writeBuffers[easy_handle];
-			int position = writeBufferPosition[easy_handle];
-			int length = writeBufferSize[easy_handle];
 
-			if (buffer && position > 0) {
+	static void hl_curl_context_flush (CURL_Context* context) {
 
-				if (writeCallbacks.find (easy_handle) != writeCallbacks.end ()) {
+		int code;
 
-					ValuePointer* writeCallback = writeCallbacks[easy_handle];
+		if (context->headerCallback && context->headerValues.size () > 0) {
 
-					Bytes* bytes = writeBytes[easy_handle];
-					if (bytes->length < position) bytes->Resize (position);
-					memcpy ((char*)bytes->b, buffer, position);
-					// free (buffer);
-					// writeBuffers[easy_handle] = NULL;
-					// writeBufferSize[easy_handle] = 0;
-					writeBufferPosition[easy_handle] = 0;
+			std::vector<char*> values;
+			values.swap (context->headerValues);
 
-					vdynamic* pos = hl_alloc_dynamic (&hlt_i32);
-					pos->v.i = position;
+			for (std::vector<char*>::iterator it = values.begin (); it != values.end (); ++it) {
 
-					curl_gc_mutex.Unlock ();
-					vdynamic* _length = (vdynamic*)writeCallback->Call (bytes, pos);
-					length = (_length != NULL ? _length->v.i : 0);
-					curl_gc_mutex.Lock ();
+				int size = strlen (*it) + 1;
+				vbyte* header = hl_alloc_bytes (size);
+				memcpy (header, *it, size);
+				free (*it);
 
-					if (length == CURL_WRITEFUNC_PAUSE) {
+				vdynamic* bytes = hl_alloc_dynamic (&hlt_bytes);
+				bytes->v.bytes = header;
 
-						// TODO: Handle pause
+				if (context->headerCallback) context->headerCallback->Call (bytes);
 
-					}
+			}
 
-				}
+		}
 
-			}
+		hl_curl_context_flush_write (context);
+
+		if (context->writePaused) {
+
+			context->writePaused = false;
+			curl_easy_pause (context->curl, CURLPAUSE_CONT);
 
 		}
 
-		if (progressCallbacks.find (easy_handle) != progressCallbacks.end ()) {
+		if (context->progressCallback) {
 
-			CURL_Progress* progress = progressValues[easy_handle];
-			ValuePointer* progressCallback = progressCallbacks[easy_handle];
+			CURL_Progress* progress = &context->progress;
 
 			vdynamic* dltotal = hl_alloc_dynamic (&hlt_f64);
 			vdynamic* dlnow = hl_alloc_dynamic (&hlt_f64);
@@ -749,10 +713,8 @@ namespace lime {
 			ultotal->v.d = progress->ultotal;
 			ulnow->v.d = progress->ulnow;
 
-			curl_gc_mutex.Unlock ();
-			vdynamic* _code = (vdynamic*)progressCallback->Call (dltotal, dlnow, ultotal, ulnow);
+			vdynamic* _code = (vdynamic*)context->progressCallback->Call (dltotal, dlnow, ultotal, ulnow);
 			code = (_code != NULL ? _code->v.i : 0);
-			curl_gc_mutex.Lock ();
 
 			if (code != 0) { // CURLE_OK
 
@@ -762,10 +724,9 @@ namespace lime {
 
 		}
 
-		if (xferInfoCallbacks.find (easy_handle) != xferInfoCallbacks.end ()) {
+		if (context->xferInfoCallback) {
 
-			CURL_XferInfo* xferInfo = xferInfoValues[easy_handle];
-			ValuePointer* xferInfoCallback = xferInfoCallbacks[easy_handle];
+			CURL_XferInfo* xferInfo = &context->xferInfo;
 
 			vdynamic* dltotal = hl_alloc_dynamic (&hlt_i32);
 			vdynamic* dlnow = hl_alloc_dynamic (&hlt_i32);
@@ -777,10 +738,8 @@ namespace lime {
 			ultotal->v.i = xferInfo->ultotal;
 			ulnow->v.i = xferInfo->ulnow;
 
-			curl_gc_mutex.Unlock ();
-			vdynamic* _code = (vdynamic*)xferInfoCallback->Call (dltotal, dlnow, ultotal, ulnow);
+			vdynamic* _code = (vdynamic*)context->xferInfoCallback->Call (dltotal, dlnow, ultotal, ulnow);
 			code = (_code != NULL ? _code->v.i : 0);
-			curl_gc_mutex.Lock ();
 
 			if (code != 0) {
 
@@ -790,7 +749,19 @@ namespace lime {
 
 		}
 
-		curl_gc_mutex.Unlock ();
+	}
+
+
+	void lime_curl_easy_flush (value easy_handle) {
+
+		curl_context_flush ((CURL_Context*)val_data (easy_handle));
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_curl_easy_flush) (HL_CFFIPointer* easy_handle) {
+
+		if (easy_handle->ptr) hl_curl_context_flush ((CURL_Context*)easy_handle->ptr);
 
 	}
 
@@ -798,7 +769,7 @@ namespace lime {
 	value lime_curl_easy_getinfo (value curl, int info) {
 
 		CURLcode code = CURLE_OK;
-		CURL* handle = (CURL*)val_data(curl);
+		CURL* handle = ((CURL_Context*)val_data (curl))->curl;
 		CURLINFO type = (CURLINFO)info;
 
 		switch (type) {
@@ -806,7 +777,6 @@ namespace lime {
 			case CURLINFO_EFFECTIVE_URL:
 			case CURLINFO_REDIRECT_URL:
 			case CURLINFO_CONTENT_TYPE:
-			case CURLINFO_PRIVATE:
 			case CURLINFO_PRIMARY_IP:
 			case CURLINFO_LOCAL_IP:
 			case CURLINFO_FTP_ENTRY_PATH:
@@ -885,6 +855,7 @@ namespace lime {
 				break;
 			}
 
+			case CURLINFO_PRIVATE:
 			case CURLINFO_SSL_ENGINES:
 			case CURLINFO_CERTINFO:
 			case CURLINFO_TLS_SESSION:
@@ -913,7 +884,7 @@ namespace lime {
 	HL_PRIM vdynamic* HL_NAME(hl_curl_easy_getinfo) (HL_CFFIPointer* curl, int info) {
 
 		CURLcode code = CURLE_OK;
-		CURL* handle = (CURL*)curl->ptr;
+		CURL* handle = ((CURL_Context*)curl->ptr)->curl;
 		CURLINFO type = (CURLINFO)info;
 
 		int size;
@@ -924,7 +895,6 @@ namespace lime {
 			case CURLINFO_EFFECTIVE_URL:
 			case CURLINFO_REDIRECT_URL:
 			case CURLINFO_CONTENT_TYPE:
-			case CURLINFO_PRIVATE:
 			case CURLINFO_PRIMARY_IP:
 			case CURLINFO_LOCAL_IP:
 			case CURLINFO_FTP_ENTRY_PATH:
@@ -1004,6 +974,7 @@ namespace lime {
 				break;
 			}
 
+			case CURLINFO_PRIVATE:
 			case CURLINFO_SSL_ENGINES:
 			case CURLINFO_COOKIELIST:
 			case CURLINFO_CERTINFO:
@@ -1032,140 +1003,62 @@ namespace lime {
 
 	value lime_curl_easy_init () {
 
-		curl_gc_mutex.Lock ();
-
 		CURL* curl = curl_easy_init ();
-		value handle = CFFIPointer (curl, gc_curl);
-
-		if (curlValid.find (handle) != curlValid.end ()) {
-
-			printf ("Error: Duplicate cURL handle\n");
-
-		}
-
-		if (headerCallbacks.find (handle) != headerCallbacks.end ()) {
-
-			printf ("Error: cURL handle already has a header callback\n");
-
-		}
-
-		if (progressCallbacks.find (handle) != progressCallbacks.end ()) {
-
-			printf ("Error: cURL handle already has a progress callback\n");
-
-		}
-
-		if (readBytes.find (handle) != readBytes.end ()) {
-
-			printf ("Error: cURL handle already has a read data value\n");
-
-		}
-
-		if (writeCallbacks.find (handle) != writeCallbacks.end ()) {
-
-			printf ("Error: cURL handle already has a write callback\n");
-
-		}
-
-		curlValid[handle] = true;
-		curlObjects[curl] = handle;
-
-		writeBuffers[handle] = NULL;
-		writeBufferPosition[handle] = 0;
-		writeBufferSize[handle] = 0;
+		CURL_Context* context = curl_context_create (curl);
 
 		CURLcode setopt_result = curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
 		if(setopt_result != CURLE_OK) {
 			printf("Failed to set CURLOPT_ACCEPT_ENCODING: %s\n", curl_easy_strerror(setopt_result));
 		}
 
-		curl_gc_mutex.Unlock ();
-
-		return handle;
+		return CFFIPointer (context, gc_curl);
 
 	}
 
 
 	HL_PRIM HL_CFFIPointer* HL_NAME(hl_curl_easy_init) () {
 
-		curl_gc_mutex.Lock ();
-
 		CURL* curl = curl_easy_init ();
-		HL_CFFIPointer* handle = HLCFFIPointer (curl, (hl_finalizer)hl_gc_curl);
-
-		if (curlValid.find (handle) != curlValid.end ()) {
-
-			printf ("Error: Duplicate cURL handle\n");
-
-		}
-
-		if (headerCallbacks.find (handle) != headerCallbacks.end ()) {
-
-			printf ("Error: cURL handle already has a header callback\n");
-
-		}
-
-		if (progressCallbacks.find (handle) != progressCallbacks.end ()) {
-
-			printf ("Error: cURL handle already has a progress callback\n");
-
-		}
-
-		if (readBytes.find (handle) != readBytes.end ()) {
-
-			printf ("Error: cURL handle already has a read data value\n");
-
-		}
-
-		if (writeCallbacks.find (handle) != writeCallbacks.end ()) {
-
-			printf ("Error: cURL handle already has a write callback\n");
-
-		}
-
-		curlValid[handle] = true;
-		curlObjects[curl] = handle;
-
-		writeBuffers[handle] = NULL;
-		writeBufferPosition[handle] = 0;
-		writeBufferSize[handle] = 0;
+		CURL_Context* context = curl_context_create (curl);
 
 		CURLcode setopt_result = curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
 		if(setopt_result != CURLE_OK) {
 			printf("Failed to set CURLOPT_ACCEPT_ENCODING: %s\n", curl_easy_strerror(setopt_result));
 		}
 
-		curl_gc_mutex.Unlock ();
-
-		return handle;
+		return HLCFFIPointer (context, (hl_finalizer)hl_gc_curl);
 
 	}
 
 
 	int lime_curl_easy_pause (value handle, int bitmask) {
 
-		return curl_easy_pause ((CURL*)val_data(handle), bitmask);
+		return curl_easy_pause (((CURL_Context*)val_data (handle))->curl, bitmask);
 
 	}
 
 
 	HL_PRIM int HL_NAME(hl_curl_easy_pause) (HL_CFFIPointer* handle, int bitmask) {
 
-		return curl_easy_pause ((CURL*)handle->ptr, bitmask);
+		return curl_easy_pause (((CURL_Context*)handle->ptr)->curl, bitmask);
 
 	}
 
 
 	int lime_curl_easy_perform (value easy_handle) {
 
+		CURL_Context* context = (CURL_Context*)val_data (easy_handle);
+
 		int code;
 		System::GCEnterBlocking ();
 
-		code = curl_easy_perform ((CURL*)val_data(easy_handle));
+		context->blocking = true;
+		code = curl_easy_perform (context->curl);
+		context->blocking = false;
 
 		System::GCExitBlocking ();
 
-		lime_curl_easy_flush (easy_handle);
+		curl_context_flush (context);
 
 		return code;
 
@@ -1174,14 +1067,18 @@ namespace lime {
 
 	HL_PRIM int HL_NAME(hl_curl_easy_perform) (HL_CFFIPointer* easy_handle) {
 
+		CURL_Context* context = (CURL_Context*)easy_handle->ptr;
+
 		int code;
 		System::GCEnterBlocking ();
 
-		code = curl_easy_perform ((CURL*)easy_handle->ptr);
+		context->blocking = true;
+		code = curl_easy_perform (context->curl);
+		context->blocking = false;
 
 		System::GCExitBlocking ();
 
-		lime_hl_curl_easy_flush (easy_handle);
+		hl_curl_context_flush (context);
 
 		return code;
 
@@ -1208,14 +1105,20 @@ namespace lime {
 
 	void lime_curl_easy_reset (value curl) {
 
-		curl_easy_reset ((CURL*)val_data(curl));
+		CURL_Context* context = (CURL_Context*)val_data (curl);
+		curl_easy_reset (context->curl);
+		curl_easy_setopt (context->curl, CURLOPT_PRIVATE, context);
+		curl_context_set_share (context, NULL);
 
 	}
 
 
 	HL_PRIM void HL_NAME(hl_curl_easy_reset) (HL_CFFIPointer* curl) {
 
-		curl_easy_reset ((CURL*)curl->ptr);
+		CURL_Context* context = (CURL_Context*)curl->ptr;
+		curl_easy_reset (context->curl);
+		curl_easy_setopt (context->curl, CURLOPT_PRIVATE, context);
+		curl_context_set_share (context, NULL);
 
 	}
 
@@ -1240,14 +1143,14 @@ namespace lime {
 
 	static size_t header_callback (void *ptr, size_t size, size_t nmemb, void *userp) {
 
-		std::vector<char*>* values = headerValues[userp];
+		CURL_Context* context = (CURL_Context*)userp;
 
 		if (size * nmemb > 0) {
 
 			char* data = (char*)malloc (size * nmemb + 1);
 			memcpy (data, ptr, size * nmemb);
 			data[size * nmemb] = '\0';
-			values->push_back (data);
+			context->headerValues.push_back (data);
 
 		}
 
@@ -1256,101 +1159,211 @@ namespace lime {
 	}
 
 
-	static size_t write_callback (void *ptr, size_t size, size_t nmemb, void *userp) {
-
-		if (size * nmemb < 1) {
+	static size_t write_file (CURL_Context* context, const char* data, size_t length) {
 
-			return 0;
+		if (!context->writeFileStarted) {
 
-		}
+			context->writeFileStarted = true;
 
-		char* buffer = writeBuffers[userp];
-		int writeSize = (size * nmemb);
+			long status = 0;
+			curl_easy_getinfo (context->curl, CURLINFO_RESPONSE_CODE, &status);
 
-		if (!buffer) {
+			if (status >= 400) {
 
-			buffer = (char*)malloc (CURL_MAX_WRITE_SIZE);
-			memcpy (buffer, ptr, writeSize);
-			writeBuffers[userp] = buffer;
-			writeBufferPosition[userp] = writeSize;
-			writeBufferSize[userp] = CURL_MAX_WRITE_SIZE;
+				// Keep error pages out of the file, the caller sees the status
 
-		} else {
+				context->writeFileSkip = true;
 
-			int position = writeBufferPosition[userp];
-			int currentSize = writeBufferSize[userp];
+			} else {
 
-			if (position + writeSize > currentSize) {
+				if (context->writeFileOffset > 0 && status == 200) {
 
-				int newSize = currentSize;
-				while (newSize < position + writeSize) newSize += CURL_MAX_WRITE_SIZE;
+					// The server ignored the range request, start over
 
-				buffer = (char*)realloc (buffer, newSize);
-				writeBufferSize[userp] = newSize;
-				writeBuffers[userp] = buffer;
+					context->writeFile->Truncate (0);
+					context->writeFileOffset = 0;
 
-			}
+				}
 
-			memcpy (buffer + position, ptr, writeSize);
-			writeBufferPosition[userp] = position + writeSize;
+				if (context->writeFilePreallocate) {
 
-		}
+					curl_off_t contentLength = -1;
+					curl_easy_getinfo (context->curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &contentLength);
 
-		return writeSize;
+					if (contentLength > 0) {
 
-	}
+						context->writeFile->Preallocate (context->writeFileOffset + contentLength);
 
-	static int seek_callback (void *userp, curl_off_t offset, int origin) {
-		if (origin == SEEK_SET)  {
-			readBytesPosition[userp] = offset;
-			return CURL_SEEKFUNC_OK;
-		}
-		return CURL_SEEKFUNC_CANTSEEK;
-	}
+					}
 
-	static size_t read_callback (void *buffer, size_t size, size_t nmemb, void *userp) {
+				}
 
-		Bytes* bytes = readBytes[userp];
-		int position = readBytesPosition[userp];
-		int length = size * nmemb;
+			}
 
-		if (bytes->length < position + length) {
+		}
 
-			length = bytes->length - position;
+		if (context->writeFileSkip) return length;
 
-		}
+		if (!context->writeFile->Write (data, length, context->writeFileOffset)) {
 
-		if (length <= 0) return 0;
+			return 0;
 
-		memcpy (buffer, bytes->b + position, length);
-		readBytesPosition[userp] = position + length;
+		}
 
+		context->writeFileOffset += length;
 		return length;
 
 	}
 
 
-	static int progress_callback (void *userp, double dltotal, double dlnow, double ultotal, double ulnow) {
+	static size_t write_chunk (CURL_Context* context, const char* data, size_t length) {
 
-		CURL_Progress* progress = progressValues[userp];
+		if (context->writeBufferPosition + length > (size_t)context->writeBufferSize) {
 
-		progress->dltotal = dltotal;
-		progress->dlnow = dlnow;
-		progress->ultotal = ultotal;
-		progress->ulnow = ulnow;
+			if (context->blocking) {
 
-		return 0;
+				// curl_easy_perform will not return until the transfer is done,
+				// so hand the chunk over from inside the transfer
 
-	}
+				System::GCExitBlocking ();
+				context->flushWrite (context);
+				System::GCEnterBlocking ();
 
+			} else {
 
-	static int xferinfo_callback (void *userp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t ultotal, curl_off_t ulnow) {
+				// Leave the data with libcurl until the next flush empties the
+				// buffer and resumes the transfer
 
-		CURL_XferInfo* xferInfo = xferInfoValues[userp];
+				context->writePaused = true;
+				return CURL_WRITEFUNC_PAUSE;
 
-		xferInfo->dltotal = dltotal;
-		xferInfo->dlnow = dlnow;
-		xferInfo->ultotal = ultotal;
+			}
+
+		}
+
+		memcpy (context->writeBuffer + context->writeBufferPosition, data, length);
+		context->writeBufferPosition += length;
+
+		return length;
+
+	}
+
+
+	static size_t write_callback (void *ptr, size_t size, size_t nmemb, void *userp) {
+
+		if (size * nmemb < 1) {
+
+			return 0;
+
+		}
+
+		CURL_Context* context = (CURL_Context*)userp;
+
+		if (context->writeFile) {
+
+			return write_file (context, (const char*)ptr, size * nmemb);
+
+		} else if (!context->writeCallback) {
+
+			return size * nmemb;
+
+		} else if (context->writeChunkSize > 0) {
+
+			return write_chunk (context, (const char*)ptr, size * nmemb);
+
+		}
+
+		char* buffer = context->writeBuffer;
+		int writeSize = (size * nmemb);
+
+		if (!buffer) {
+
+			int newSize = CURL_MAX_WRITE_SIZE;
+			while (newSize < writeSize) newSize += CURL_MAX_WRITE_SIZE;
+
+			buffer = (char*)malloc (newSize);
+			memcpy (buffer, ptr, writeSize);
+			context->writeBuffer = buffer;
+			context->writeBufferPosition = writeSize;
+			context->writeBufferSize = newSize;
+
+		} else {
+
+			int position = context->writeBufferPosition;
+			int currentSize = context->writeBufferSize;
+
+			if (position + writeSize > currentSize) {
+
+				int newSize = currentSize;
+				while (newSize < position + writeSize) newSize += CURL_MAX_WRITE_SIZE;
+
+				buffer = (char*)realloc (buffer, newSize);
+				context->writeBufferSize = newSize;
+				context->writeBuffer = buffer;
+
+			}
+
+			memcpy (buffer + position, ptr, writeSize);
+			context->writeBufferPosition = position + writeSize;
+
+		}
+
+		return writeSize;
+
+	}
+
+	static int seek_callback (void *userp, curl_off_t offset, int origin) {
+		if (origin == SEEK_SET)  {
+			((CURL_Context*)userp)->readBytesPosition = offset;
+			return CURL_SEEKFUNC_OK;
+		}
+		return CURL_SEEKFUNC_CANTSEEK;
+	}
+
+	static size_t read_callback (void *buffer, size_t size, size_t nmemb, void *userp) {
+
+		CURL_Context* context = (CURL_Context*)userp;
+		Bytes* bytes = context->readBytes;
+		int position = context->readBytesPosition;
+		int length = size * nmemb;
+
+		if (bytes->length < position + length) {
+
+			length = bytes->length - position;
+
+		}
+
+		if (length <= 0) return 0;
+
+		memcpy (buffer, bytes->b + position, length);
+		context->readBytesPosition = position + length;
+
+		return length;
+
+	}
+
+
+	static int progress_callback (void *userp, double dltotal, double dlnow, double ultotal, double ulnow) {
+
+		CURL_Progress* progress = &((CURL_Context*)userp)->progress;
+
+		progress->dltotal = dltotal;
+		progress->dlnow = dlnow;
+		progress->ultotal = ultotal;
+		progress->ulnow = ulnow;
+
+		return 0;
+
+	}
+
+
+	static int xferinfo_callback (void *userp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t ultotal, curl_off_t ulnow) {
+
+		CURL_XferInfo* xferInfo = &((CURL_Context*)userp)->xferInfo;
+
+		xferInfo->dltotal = dltotal;
+		xferInfo->dlnow = dlnow;
+		xferInfo->ultotal = ultotal;
 		xferInfo->ulnow = ulnow;
 
 		return 0;
@@ -1358,10 +1371,114 @@ namespace lime {
 	}
 
 
+	static int curl_context_set_write_file (CURL_Context* context, const char* path, bool resume, bool preallocate) {
+
+		curl_context_reset_write (context);
+
+		if (!path) {
+
+			curl_easy_setopt (context->curl, CURLOPT_WRITEFUNCTION, NULL);
+			curl_easy_setopt (context->curl, CURLOPT_WRITEDATA, NULL);
+			return CURLE_OK;
+
+		}
+
+		DownloadFile* file = DownloadFile::Open (path, resume);
+
+		if (!file) {
+
+			return CURLE_WRITE_ERROR;
+
+		}
+
+		context->writeFile = file;
+		context->writeFileOffset = resume ? file->GetSize () : 0;
+		context->writeFilePreallocate = preallocate;
+
+		curl_easy_setopt (context->curl, CURLOPT_RESUME_FROM_LARGE, (curl_off_t)context->writeFileOffset);
+		curl_easy_setopt (context->curl, CURLOPT_WRITEDATA, context);
+		return curl_easy_setopt (context->curl, CURLOPT_WRITEFUNCTION, write_callback);
+
+	}
+
+
+	static int curl_context_set_write_chunk (CURL_Context* context, int chunkSize) {
+
+		curl_context_reset_write (context);
+
+		// libcurl may deliver up to CURL_MAX_WRITE_SIZE at once, and paused
+		// data is redelivered whole, so a chunk must be able to hold that much
+
+		if (chunkSize < CURL_MAX_WRITE_SIZE) chunkSize = CURL_MAX_WRITE_SIZE;
+
+		context->writeBuffer = (char*)malloc (chunkSize);
+		context->writeBufferSize = chunkSize;
+		context->writeChunkSize = chunkSize;
+
+		curl_easy_setopt (context->curl, CURLOPT_WRITEDATA, context);
+		return curl_easy_setopt (context->curl, CURLOPT_WRITEFUNCTION, write_callback);
+
+	}
+
+
+	int lime_curl_easy_set_write_chunk (value handle, value callback, value bytes, int chunkSize) {
+
+		CURL_Context* context = (CURL_Context*)val_data (handle);
+		int code = curl_context_set_write_chunk (context, chunkSize);
+
+		delete context->writeCallback;
+		delete context->writeBytes;
+		delete context->writeBytesRoot;
+
+		context->flushWrite = curl_context_flush_write;
+		context->writeCallback = new ValuePointer (callback);
+		context->writeBytes = new Bytes (bytes);
+		context->writeBytesRoot = new ValuePointer (bytes);
+
+		return code;
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_curl_easy_set_write_chunk) (HL_CFFIPointer* handle, vdynamic* callback, Bytes* bytes, int chunkSize) {
+
+		CURL_Context* context = (CURL_Context*)handle->ptr;
+		int code = curl_context_set_write_chunk (context, chunkSize);
+
+		delete context->writeCallback;
+		delete context->writeBytesRoot;
+
+		context->flushWrite = hl_curl_context_flush_write;
+		context->writeCallback = new ValuePointer (callback);
+		context->writeBytes = bytes;
+		context->writeBytesRoot = new ValuePointer ((vobj*)bytes);
+
+		return code;
+
+	}
+
+
+	int lime_curl_easy_set_write_file (value handle, value path, bool resume, bool preallocate) {
+
+		CURL_Context* context = (CURL_Context*)val_data (handle);
+		return curl_context_set_write_file (context, val_is_null (path) ? NULL : val_string (path), resume, preallocate);
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_curl_easy_set_write_file) (HL_CFFIPointer* handle, hl_vstring* path, bool resume, bool preallocate) {
+
+		CURL_Context* context = (CURL_Context*)handle->ptr;
+		return curl_context_set_write_file (context, path ? hl_to_utf8 (path->bytes) : NULL, resume, preallocate);
+
+	}
+
+
 	int lime_curl_easy_setopt (value handle, int option, value parameter, value bytes) {
 
 		CURLcode code = CURLE_OK;
-		CURL* easy_handle = (CURL*)val_data(handle);
+		CURL_Context* context = (CURL_Context*)val_data (handle);
+		CURL* easy_handle = context->curl;
 		CURLoption type = (CURLoption)option;
 
 		switch (type) {
@@ -1613,7 +1730,6 @@ namespace lime {
 			case CURLOPT_SSH_KEYFUNCTION:
 			case CURLOPT_SSH_KEYDATA:
 			case CURLOPT_PRIVATE:
-			case CURLOPT_SHARE:
 			case CURLOPT_TELNETOPTIONS:
 			case CURLOPT_STREAM_DEPENDS:
 			case CURLOPT_STREAM_DEPENDS_E:
@@ -1630,137 +1746,91 @@ namespace lime {
 
 			case CURLOPT_READFUNCTION:
 			{
-				// curl_gc_mutex.Lock ();
 				// ValuePointer* callback = new ValuePointer (parameter);
-				// readCallbacks[handle] = callback;
+				// context->readCallback = callback;
 				// code = curl_easy_setopt (easy_handle, type, read_callback);
-				// curl_easy_setopt (easy_handle, CURLOPT_READDATA, handle);
-				// curl_gc_mutex.Unlock ();
+				// curl_easy_setopt (easy_handle, CURLOPT_READDATA, context);
 				break;
 			}
 			case CURLOPT_READDATA:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (readBytes.find (handle) == readBytes.end ()) {
-
-					delete readBytes[handle];
-					delete readBytesRoot[handle];
-
-				}
+				delete context->readBytes;
+				delete context->readBytesRoot;
 
-				Bytes* _readBytes = new Bytes (bytes);
-				readBytes[handle] = _readBytes;
-				readBytesPosition[handle] = 0;
-				readBytesRoot[handle] = new ValuePointer (bytes);
+				context->readBytes = new Bytes (bytes);
+				context->readBytesPosition = 0;
+				context->readBytesRoot = new ValuePointer (bytes);
 
 				// seek function is needed to support redirects
 				curl_easy_setopt (easy_handle, CURLOPT_SEEKFUNCTION, seek_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_SEEKDATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_SEEKDATA, context);
 				code = curl_easy_setopt (easy_handle, CURLOPT_READFUNCTION, read_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_READDATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_READDATA, context);
 
-				curl_gc_mutex.Unlock ();
 				break;
 			}
 			case CURLOPT_WRITEFUNCTION:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (writeCallbacks.find (handle) == writeCallbacks.end ()) {
+				curl_context_reset_write (context);
 
-					delete writeCallbacks[handle];
-					delete writeBytes[handle];
-					delete writeBytesRoot[handle];
-
-				}
+				delete context->writeCallback;
+				delete context->writeBytes;
+				delete context->writeBytesRoot;
 
-				ValuePointer* callback = new ValuePointer (parameter);
-				writeCallbacks[handle] = callback;
-				Bytes* _writeBytes = new Bytes (bytes);
-				writeBytes[handle] = _writeBytes;
-				writeBytesRoot[handle] = new ValuePointer (bytes);
+				context->writeCallback = new ValuePointer (parameter);
+				context->writeBytes = new Bytes (bytes);
+				context->writeBytesRoot = new ValuePointer (bytes);
 
 				code = curl_easy_setopt (easy_handle, type, write_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_WRITEDATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_WRITEDATA, context);
 
-				curl_gc_mutex.Unlock ();
 				break;
 			}
 			case CURLOPT_HEADERFUNCTION:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (headerCallbacks.find (handle) == headerCallbacks.end ()) {
-
-					delete headerCallbacks[handle];
-					delete headerValues[handle];
-
-				}
-
-				ValuePointer* callback = new ValuePointer (parameter);
-				headerCallbacks[handle] = callback;
-				headerValues[handle] = new std::vector<char*> ();
+				delete context->headerCallback;
+				context->headerCallback = new ValuePointer (parameter);
 
 				code = curl_easy_setopt (easy_handle, type, header_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_HEADERDATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_HEADERDATA, context);
 
-				curl_gc_mutex.Unlock ();
 				break;
 			}
 			case CURLOPT_PROGRESSFUNCTION:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (progressCallbacks.find (handle) != progressCallbacks.end ()) {
-
-					delete progressCallbacks[handle];
-					delete progressValues[handle];
-
-				}
-
-				progressCallbacks[handle] = new ValuePointer (parameter);
-				progressValues[handle] = new CURL_Progress ();
+				delete context->progressCallback;
+				context->progressCallback = new ValuePointer (parameter);
+				memset (&context->progress, 0, sizeof (CURL_Progress));
 
 				code = curl_easy_setopt (easy_handle, type, progress_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_PROGRESSDATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_PROGRESSDATA, context);
 				curl_easy_setopt (easy_handle, CURLOPT_NOPROGRESS, false);
 
-				curl_gc_mutex.Unlock ();
 				break;
 			}
 			case CURLOPT_XFERINFOFUNCTION:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (xferInfoCallbacks.find (handle) != xferInfoCallbacks.end ()) {
-
-					delete xferInfoCallbacks[handle];
-					delete xferInfoValues[handle];
-
-				}
-
-				xferInfoCallbacks[handle] = new ValuePointer (parameter);
-				xferInfoValues[handle] = new CURL_XferInfo ();
+				delete context->xferInfoCallback;
+				context->xferInfoCallback = new ValuePointer (parameter);
+				memset (&context->xferInfo, 0, sizeof (CURL_XferInfo));
 
 				code = curl_easy_setopt (easy_handle, type, xferinfo_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_XFERINFODATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_XFERINFODATA, context);
 				curl_easy_setopt (easy_handle, CURLOPT_NOPROGRESS, false);
 
-				curl_gc_mutex.Unlock ();
 				break;
 			}
 
-			case CURLOPT_HTTPHEADER:
+			case CURLOPT_SHARE:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (headerSLists.find (handle) != headerSLists.end ()) {
-
-					curl_slist_free_all (headerSLists[handle]);
-
-				}
+				CURLShare* share = val_is_null (parameter) ? NULL : (CURLShare*)val_data (parameter);
+				code = curl_easy_setopt (easy_handle, type, share ? share->GetHandle () : NULL);
+				if (code == CURLE_OK) curl_context_set_share (context, share);
+				break;
+			}
 
+			case CURLOPT_HTTPHEADER:
+			{
 				struct curl_slist *chunk = NULL;
 				int size = val_array_size (parameter);
 
@@ -1770,10 +1840,11 @@ namespace lime {
 
 				}
 
-				headerSLists[handle] = chunk;
-
 				code = curl_easy_setopt (easy_handle, type, chunk);
-				curl_gc_mutex.Unlock ();
+
+				if (context->headerSList) curl_slist_free_all (context->headerSList);
+				context->headerSList = chunk;
+
 				break;
 			}
 
@@ -1791,7 +1862,8 @@ namespace lime {
 	HL_PRIM int HL_NAME(hl_curl_easy_setopt) (HL_CFFIPointer* handle, int option, vdynamic* parameter, Bytes* bytes) {
 
 		CURLcode code = CURLE_OK;
-		CURL* easy_handle = (CURL*)handle->ptr;
+		CURL_Context* context = (CURL_Context*)handle->ptr;
+		CURL* easy_handle = context->curl;
 		CURLoption type = (CURLoption)option;
 
 		switch (type) {
@@ -2045,7 +2117,6 @@ namespace lime {
 			case CURLOPT_SSH_KEYFUNCTION:
 			case CURLOPT_SSH_KEYDATA:
 			case CURLOPT_PRIVATE:
-			case CURLOPT_SHARE:
 			case CURLOPT_TELNETOPTIONS:
 			case CURLOPT_STREAM_DEPENDS:
 			case CURLOPT_STREAM_DEPENDS_E:
@@ -2062,132 +2133,88 @@ namespace lime {
 
 			case CURLOPT_READFUNCTION:
 			{
-				// curl_gc_mutex.Lock ();
 				// ValuePointer* callback = new ValuePointer (parameter);
-				// readCallbacks[handle] = callback;
+				// context->readCallback = callback;
 				// code = curl_easy_setopt (easy_handle, type, read_callback);
-				// curl_easy_setopt (easy_handle, CURLOPT_READDATA, handle);
-				// curl_gc_mutex.Unlock ();
+				// curl_easy_setopt (easy_handle, CURLOPT_READDATA, context);
 				break;
 			}
 			case CURLOPT_READDATA:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (readBytes.find (handle) == readBytes.end ()) {
-
-					delete readBytesRoot[handle];
-
-				}
+				delete context->readBytesRoot;
 
-				readBytes[handle] = bytes;
-				readBytesPosition[handle] = 0;
-				readBytesRoot[handle] = new ValuePointer ((vobj*)bytes);
+				context->readBytes = bytes;
+				context->readBytesPosition = 0;
+				context->readBytesRoot = new ValuePointer ((vobj*)bytes);
 
 				curl_easy_setopt (easy_handle, CURLOPT_SEEKFUNCTION, seek_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_SEEKDATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_SEEKDATA, context);
 				code = curl_easy_setopt (easy_handle, CURLOPT_READFUNCTION, read_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_READDATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_READDATA, context);
 
-				curl_gc_mutex.Unlock ();
 				break;
 			}
 			case CURLOPT_WRITEFUNCTION:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (writeCallbacks.find (handle) == writeCallbacks.end ()) {
+				curl_context_reset_write (context);
 
-					delete writeCallbacks[handle];
-					delete writeBytesRoot[handle];
-
-				}
+				delete context->writeCallback;
+				delete context->writeBytesRoot;
 
-				ValuePointer* callback = new ValuePointer (parameter);
-				writeCallbacks[handle] = callback;
-				writeBytes[handle] = bytes;
-				writeBytesRoot[handle] = new ValuePointer ((vobj*)bytes);
+				context->writeCallback = new ValuePointer (parameter);
+				context->writeBytes = bytes;
+				context->writeBytesRoot = new ValuePointer ((vobj*)bytes);
 
 				code = curl_easy_setopt (easy_handle, type, write_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_WRITEDATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_WRITEDATA, context);
 
-				curl_gc_mutex.Unlock ();
 				break;
 			}
 			case CURLOPT_HEADERFUNCTION:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (headerCallbacks.find (handle) == headerCallbacks.end ()) {
-
-					delete headerCallbacks[handle];
-					delete headerValues[handle];
-
-				}
-
-				ValuePointer* callback = new ValuePointer (parameter);
-				headerCallbacks[handle] = callback;
-				headerValues[handle] = new std::vector<char*> ();
+				delete context->headerCallback;
+				context->headerCallback = new ValuePointer (parameter);
 
 				code = curl_easy_setopt (easy_handle, type, header_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_HEADERDATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_HEADERDATA, context);
 
-				curl_gc_mutex.Unlock ();
 				break;
 			}
 			case CURLOPT_PROGRESSFUNCTION:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (progressCallbacks.find (handle) != progressCallbacks.end ()) {
-
-					delete progressCallbacks[handle];
-					delete progressValues[handle];
-
-				}
-
-				progressCallbacks[handle] = new ValuePointer (parameter);
-				progressValues[handle] = new CURL_Progress ();
+				delete context->progressCallback;
+				context->progressCallback = new ValuePointer (parameter);
+				memset (&context->progress, 0, sizeof (CURL_Progress));
 
 				code = curl_easy_setopt (easy_handle, type, progress_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_PROGRESSDATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_PROGRESSDATA, context);
 				curl_easy_setopt (easy_handle, CURLOPT_NOPROGRESS, false);
 
-				curl_gc_mutex.Unlock ();
 				break;
 			}
 			case CURLOPT_XFERINFOFUNCTION:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (xferInfoCallbacks.find (handle) != xferInfoCallbacks.end ()) {
-
-					delete xferInfoCallbacks[handle];
-					delete xferInfoValues[handle];
-
-				}
-
-				xferInfoCallbacks[handle] = new ValuePointer (parameter);
-				xferInfoValues[handle] = new CURL_XferInfo ();
+				delete context->xferInfoCallback;
+				context->xferInfoCallback = new ValuePointer (parameter);
+				memset (&context->xferInfo, 0, sizeof (CURL_XferInfo));
 
 				code = curl_easy_setopt (easy_handle, type, xferinfo_callback);
-				curl_easy_setopt (easy_handle, CURLOPT_XFERINFODATA, handle);
+				curl_easy_setopt (easy_handle, CURLOPT_XFERINFODATA, context);
 				curl_easy_setopt (easy_handle, CURLOPT_NOPROGRESS, false);
 
-				curl_gc_mutex.Unlock ();
 				break;
 			}
 
-			case CURLOPT_HTTPHEADER:
+			case CURLOPT_SHARE:
 			{
-				curl_gc_mutex.Lock ();
-
-				if (headerSLists.find (handle) != headerSLists.end ()) {
-
-					curl_slist_free_all (headerSLists[handle]);
-
-				}
+				CURLShare* share = parameter ? (CURLShare*)((HL_CFFIPointer*)parameter)->ptr : NULL;
+				code = curl_easy_setopt (easy_handle, type, share ? share->GetHandle () : NULL);
+				if (code == CURLE_OK) curl_context_set_share (context, share);
+				break;
+			}
 
+			case CURLOPT_HTTPHEADER:
+			{
 				struct curl_slist *chunk = NULL;
 				varray* stringList = (varray*)parameter;
 				hl_vstring** stringListData = hl_aptr (stringList, hl_vstring*);
@@ -2201,10 +2228,11 @@ namespace lime {
 
 				}
 
-				headerSLists[handle] = chunk;
-
 				code = curl_easy_setopt (easy_handle, type, chunk);
-				curl_gc_mutex.Unlock ();
+
+				if (context->headerSList) curl_slist_free_all (context->headerSList);
+				context->headerSList = chunk;
+
 				break;
 			}
 
@@ -2240,7 +2268,7 @@ namespace lime {
 
 	value lime_curl_easy_unescape (value curl, HxString url, int inlength, int outlength) {
 
-		char* result = curl_easy_unescape ((CURL*)val_data(curl), url.__s, inlength, &outlength);
+		char* result = curl_easy_unescape (((CURL_Context*)val_data (curl))->curl, url.__s, inlength, &outlength);
 		return result ? alloc_string (result) : alloc_null ();
 
 	}
@@ -2248,7 +2276,7 @@ namespace lime {
 
 	HL_PRIM vbyte* HL_NAME(hl_curl_easy_unescape) (HL_CFFIPointer* curl, hl_vstring* url, int inlength, int outlength) {
 
-		char* result = curl_easy_unescape ((CURL*)curl->ptr, url ? hl_to_utf8 (url->bytes) : NULL, inlength, &outlength);
+		char* result = curl_easy_unescape (((CURL_Context*)curl->ptr)->curl, url ? hl_to_utf8 (url->bytes) : NULL, inlength, &outlength);
 		int length = strlen (result);
 		char* _result = (char*)malloc (length + 1);
 		strcpy (_result, result);
@@ -2308,12 +2336,7 @@ namespace lime {
 
 	int lime_curl_multi_cleanup (value multi_handle) {
 
-		// curl_gc_mutex.Lock ();
-
-		// CURLMcode result = curl_multi_cleanup ((CURLM*)val_data (multi_handle));
-		gc_curl_multi (multi_handle);
-
-		// curl_gc_mutex.Unlock ();
+		curl_multi_context_release ((CURL_MultiContext*)val_data (multi_handle));
 
 		return CURLM_OK;
 
@@ -2322,12 +2345,7 @@ namespace lime {
 
 	HL_PRIM int HL_NAME(hl_curl_multi_cleanup) (HL_CFFIPointer* multi_handle) {
 
-		// curl_gc_mutex.Lock ();
-
-		// CURLMcode result = curl_multi_cleanup ((CURLM*)val_data (multi_handle));
-		hl_gc_curl_multi (multi_handle);
-
-		// curl_gc_mutex.Unlock ();
+		if (multi_handle->ptr) curl_multi_context_release ((CURL_MultiContext*)multi_handle->ptr);
 
 		return CURLM_OK;
 
@@ -2336,65 +2354,42 @@ namespace lime {
 
 	value lime_curl_multi_init () {
 
-		curl_gc_mutex.Lock ();
-
-		value handle = CFFIPointer (curl_multi_init (), gc_curl_multi);
-
-		if (curlMultiValid.find (handle) != curlMultiValid.end ()) {
-
-			printf ("Error: Duplicate cURL Multi handle\n");
-
-		}
-
-		curlMultiValid[handle] = true;
-		curlMultiRunningHandles[handle] = 0;
-		curlMultiHandles[handle] = new std::vector<void*> ();
+		CURL_MultiContext* context = new CURL_MultiContext ();
+		context->multi = curl_multi_init ();
 
-		curl_gc_mutex.Unlock ();
-
-		return handle;
+		return CFFIPointer (context, gc_curl_multi);
 
 	}
 
 
 	HL_PRIM HL_CFFIPointer* HL_NAME(hl_curl_multi_init) () {
 
-		curl_gc_mutex.Lock ();
-
-		HL_CFFIPointer* handle = HLCFFIPointer (curl_multi_init (), (hl_finalizer)hl_gc_curl_multi);
-
-		if (curlMultiValid.find (handle) != curlMultiValid.end ()) {
-
-			printf ("Error: Duplicate cURL Multi handle\n");
-
-		}
-
-		curlMultiValid[handle] = true;
-		curlMultiRunningHandles[handle] = 0;
-		curlMultiHandles[handle] = new std::vector<void*> ();
-
-		curl_gc_mutex.Unlock ();
+		CURL_MultiContext* context = new CURL_MultiContext ();
+		context->multi = curl_multi_init ();
 
-		return handle;
+		return HLCFFIPointer (context, (hl_finalizer)hl_gc_curl_multi);
 
 	}
 
 
 	int lime_curl_multi_add_handle (value multi_handle, value curl_object, value curl_handle) {
 
-		curl_gc_mutex.Lock ();
+		CURL_MultiContext* multi = (CURL_MultiContext*)val_data (multi_handle);
+		CURL_Context* context = (CURL_Context*)val_data (curl_handle);
 
-		CURLMcode result = curl_multi_add_handle ((CURLM*)val_data (multi_handle), (CURL*)val_data (curl_handle));
+		multi->mutex.Lock ();
+
+		CURLMcode result = curl_multi_add_handle (multi->multi, context->curl);
 
 		if (result == CURLM_OK) {
 
-			curlMultiReferences[curl_handle] = multi_handle;
-			curlMultiHandles[multi_handle]->push_back (curl_handle);
-			curlMultiObjects[curl_handle] = new ValuePointer (curl_object);
+			context->multi = multi;
+			context->multiObject = new ValuePointer (curl_object);
+			multi->handles.push_back (context);
 
 		}
 
-		curl_gc_mutex.Unlock ();
+		multi->mutex.Unlock ();
 
 		return result;
 
@@ -2403,19 +2398,22 @@ namespace lime {
 
 	HL_PRIM int HL_NAME(hl_curl_multi_add_handle) (HL_CFFIPointer* multi_handle, vdynamic* curl_object, HL_CFFIPointer* curl_handle) {
 
-		curl_gc_mutex.Lock ();
+		CURL_MultiContext* multi = (CURL_MultiContext*)multi_handle->ptr;
+		CURL_Context* context = (CURL_Context*)curl_handle->ptr;
+
+		multi->mutex.Lock ();
 
-		CURLMcode result = curl_multi_add_handle ((CURLM*)multi_handle->ptr, (CURL*)curl_handle->ptr);
+		CURLMcode result = curl_multi_add_handle (multi->multi, context->curl);
 
 		if (result == CURLM_OK) {
 
-			curlMultiReferences[curl_handle] = multi_handle;
-			curlMultiHandles[multi_handle]->push_back (curl_handle);
-			curlMultiObjects[curl_handle] = new ValuePointer (curl_object);
+			context->multi = multi;
+			context->multiObject = new ValuePointer (curl_object);
+			multi->handles.push_back (context);
 
 		}
 
-		curl_gc_mutex.Unlock ();
+		multi->mutex.Unlock ();
 
 		return result;
 
@@ -2424,22 +2422,24 @@ namespace lime {
 
 	int lime_curl_multi_get_running_handles (value multi_handle) {
 
-		return curlMultiRunningHandles[multi_handle];
+		return ((CURL_MultiContext*)val_data (multi_handle))->runningHandles;
 
 	}
 
 
 	HL_PRIM int HL_NAME(hl_curl_multi_get_running_handles) (HL_CFFIPointer* multi_handle) {
 
-		return curlMultiRunningHandles[multi_handle];
+		return ((CURL_MultiContext*)multi_handle->ptr)->runningHandles;
 
 	}
 
 
 	value lime_curl_multi_info_read (value multi_handle) {
 
+		CURL_MultiContext* multi = (CURL_MultiContext*)val_data (multi_handle);
+
 		int msgs_in_queue;
-		CURLMsg* msg = curl_multi_info_read ((CURLM*)val_data (multi_handle), &msgs_in_queue);
+		CURLMsg* msg = curl_multi_info_read (multi->multi, &msgs_in_queue);
 
 		if (msg) {
 
@@ -2447,13 +2447,14 @@ namespace lime {
 			const field id_curl = val_id ("curl");
 			const field id_result = val_id ("result");
 
-			CURL* curl = msg->easy_handle;
+			CURL_Context* context = NULL;
+			curl_easy_getinfo (msg->easy_handle, CURLINFO_PRIVATE, (char**)&context);
+
 			value result = alloc_empty_object ();
 
-			if (curlObjects.find (curl) != curlObjects.end ()) {
+			if (context && context->multiObject) {
 
-				value handle = (value)curlObjects[curl];
-				alloc_field (result, id_curl, (value)curlMultiObjects[handle]->Get ());
+				alloc_field (result, id_curl, (value)context->multiObject->Get ());
 
 			} else {
 
@@ -2476,8 +2477,10 @@ namespace lime {
 
 	HL_PRIM vdynamic* HL_NAME(hl_curl_multi_info_read) (HL_CFFIPointer* multi_handle, vdynamic* result) {
 
+		CURL_MultiContext* multi = (CURL_MultiContext*)multi_handle->ptr;
+
 		int msgs_in_queue;
-		CURLMsg* msg = curl_multi_info_read ((CURLM*)multi_handle->ptr, &msgs_in_queue);
+		CURLMsg* msg = curl_multi_info_read (multi->multi, &msgs_in_queue);
 
 		if (msg) {
 
@@ -2485,12 +2488,12 @@ namespace lime {
 			const int id_curl = hl_hash_utf8 ("curl");
 			const int id_result = hl_hash_utf8 ("result");
 
-			CURL* curl = msg->easy_handle;
+			CURL_Context* context = NULL;
+			curl_easy_getinfo (msg->easy_handle, CURLINFO_PRIVATE, (char**)&context);
 
-			if (curlObjects.find (curl) != curlObjects.end ()) {
+			if (context && context->multiObject) {
 
-				HL_CFFIPointer* handle = (HL_CFFIPointer*)curlObjects[curl];
-				hl_dyn_setp (result, id_curl, &hlt_dyn, (vdynamic*)curlMultiObjects[handle]->Get ());
+				hl_dyn_setp (result, id_curl, &hlt_dyn, (vdynamic*)context->multiObject->Get ());
 
 			} else {
 
@@ -2511,26 +2514,39 @@ namespace lime {
 	}
 
 
+	static CURL_Context* curl_multi_context_get (CURL_MultiContext* multi, size_t index) {
+
+		multi->mutex.Lock ();
+		CURL_Context* context = index < multi->handles.size () ? multi->handles[index] : NULL;
+		multi->mutex.Unlock ();
+
+		return context;
+
+	}
+
+
 	int lime_curl_multi_perform (value multi_handle) {
 
-		curl_gc_mutex.Lock ();
+		CURL_MultiContext* multi = (CURL_MultiContext*)val_data (multi_handle);
+
+		multi->mutex.Lock ();
 
 		int runningHandles = 0;
-		CURLMcode result = curl_multi_perform ((CURLM*)val_data (multi_handle), &runningHandles);
+		CURLMcode result = curl_multi_perform (multi->multi, &runningHandles);
+		multi->runningHandles = runningHandles;
 
-		std::vector<void*>* handles = curlMultiHandles[multi_handle];
+		multi->mutex.Unlock ();
 
-		for (std::vector<void*>::iterator it = handles->begin (); it != handles->end (); ++it) {
+		// Callbacks may add or remove handles, so the list is re-read under the
+		// lock for each flush rather than iterated while unlocked
 
-			curl_gc_mutex.Unlock ();
-			lime_curl_easy_flush ((value)*it);
-			curl_gc_mutex.Lock ();
+		CURL_Context* context;
 
-		}
+		for (size_t i = 0; (context = curl_multi_context_get (multi, i)) != NULL; i++) {
 
-		curlMultiRunningHandles[multi_handle] = runningHandles;
+			curl_context_flush (context);
 
-		curl_gc_mutex.Unlock ();
+		}
 
 		return result;
 
@@ -2539,24 +2555,23 @@ namespace lime {
 
 	HL_PRIM int HL_NAME(hl_curl_multi_perform) (HL_CFFIPointer* multi_handle) {
 
-		curl_gc_mutex.Lock ();
+		CURL_MultiContext* multi = (CURL_MultiContext*)multi_handle->ptr;
 
-		int runningHandles = 0;
-		CURLMcode result = curl_multi_perform ((CURLM*)multi_handle->ptr, &runningHandles);
+		multi->mutex.Lock ();
 
-		std::vector<void*>* handles = curlMultiHandles[multi_handle];
+		int runningHandles = 0;
+		CURLMcode result = curl_multi_perform (multi->multi, &runningHandles);
+		multi->runningHandles = runningHandles;
 
-		for (std::vector<void*>::iterator it = handles->begin (); it != handles->end (); ++it) {
+		multi->mutex.Unlock ();
 
-			curl_gc_mutex.Unlock ();
-			lime_hl_curl_easy_flush ((HL_CFFIPointer*)*it);
-			curl_gc_mutex.Lock ();
+		CURL_Context* context;
 
-		}
+		for (size_t i = 0; (context = curl_multi_context_get (multi, i)) != NULL; i++) {
 
-		curlMultiRunningHandles[multi_handle] = runningHandles;
+			hl_curl_context_flush (context);
 
-		curl_gc_mutex.Unlock ();
+		}
 
 		return result;
 
@@ -2565,36 +2580,20 @@ namespace lime {
 
 	int lime_curl_multi_remove_handle (value multi_handle, value curl_handle) {
 
-		curl_gc_mutex.Lock ();
-
-		CURLMcode result = curl_multi_remove_handle ((CURLM*)val_data (multi_handle), (CURL*)val_data (curl_handle));
-
-		if (/*result == CURLM_OK &&*/ curlMultiReferences.find (curl_handle) != curlMultiReferences.end ()) {
-
-			curlMultiReferences.erase (curl_handle);
-
-		}
+		CURL_MultiContext* multi = (CURL_MultiContext*)val_data (multi_handle);
+		CURL_Context* context = (CURL_Context*)val_data (curl_handle);
 
-		std::vector<void*>* handles = curlMultiHandles[multi_handle];
+		multi->mutex.Lock ();
 
-		if (handles->size () > 0) {
+		CURLMcode result = curl_multi_remove_handle (multi->multi, context->curl);
 
-			for (std::vector<void*>::iterator it = handles->begin (); it != handles->end (); ++it) {
+		if (context->multi == multi) {
 
-				if (*it == curl_handle) {
-
-					handles->erase (it);
-					delete curlMultiObjects[curl_handle];
-					curlMultiObjects.erase (curl_handle);
-					break;
-
-				}
-
-			}
+			curl_multi_context_detach (multi, context);
 
 		}
 
-		curl_gc_mutex.Unlock ();
+		multi->mutex.Unlock ();
 
 		return result;
 
@@ -2603,36 +2602,20 @@ namespace lime {
 
 	HL_PRIM int HL_NAME(hl_curl_multi_remove_handle) (HL_CFFIPointer* multi_handle, HL_CFFIPointer* curl_handle) {
 
-		curl_gc_mutex.Lock ();
-
-		CURLMcode result = curl_multi_remove_handle ((CURLM*)multi_handle->ptr, (CURL*)curl_handle->ptr);
-
-		if (/*result == CURLM_OK &&*/ curlMultiReferences.find (curl_handle) != curlMultiReferences.end ()) {
-
-			curlMultiReferences.erase (curl_handle);
+		CURL_MultiContext* multi = (CURL_MultiContext*)multi_handle->ptr;
+		CURL_Context* context = (CURL_Context*)curl_handle->ptr;
 
-		}
-
-		std::vector<void*>* handles = curlMultiHandles[multi_handle];
-
-		if (handles->size () > 0) {
+		multi->mutex.Lock ();
 
-			for (std::vector<void*>::iterator it = handles->begin (); it != handles->end (); ++it) {
+		CURLMcode result = curl_multi_remove_handle (multi->multi, context->curl);
 
-				if (*it == curl_handle) {
+		if (context->multi == multi) {
 
-					handles->erase (it);
-					delete curlMultiObjects[curl_handle];
-					curlMultiObjects.erase (curl_handle);
-					break;
-
-				}
-
-			}
+			curl_multi_context_detach (multi, context);
 
 		}
 
-		curl_gc_mutex.Unlock ();
+		multi->mutex.Unlock ();
 
 		return result;
 
@@ -2642,7 +2625,7 @@ namespace lime {
 	int lime_curl_multi_setopt (value multi_handle, int option, value parameter) {
 
 		CURLMcode code = CURLM_OK;
-		CURLM* multi = (CURLM*)val_data (multi_handle);
+		CURLM* multi = ((CURL_MultiContext*)val_data (multi_handle))->multi;
 		CURLMoption type = (CURLMoption)option;
 
 		switch (type) {
@@ -2692,7 +2675,7 @@ namespace lime {
 	HL_PRIM int HL_NAME(hl_curl_multi_setopt) (HL_CFFIPointer* multi_handle, int option, vdynamic* parameter) {
 
 		CURLMcode code = CURLM_OK;
-		CURLM* multi = (CURLM*)multi_handle->ptr;
+		CURLM* multi = ((CURL_MultiContext*)multi_handle->ptr)->multi;
 		CURLMoption type = (CURLMoption)option;
 
 		switch (type) {
@@ -2744,7 +2727,7 @@ namespace lime {
 		System::GCEnterBlocking ();
 
 		int retcode;
-		CURLMcode result = curl_multi_wait ((CURLM*)val_data (multi_handle), 0, 0, timeout_ms, &retcode);
+		CURLMcode result = curl_multi_wait (((CURL_MultiContext*)val_data (multi_handle))->multi, 0, 0, timeout_ms, &retcode);
 
 		System::GCExitBlocking ();
 		return result;
@@ -2757,7 +2740,7 @@ namespace lime {
 		System::GCEnterBlocking ();
 
 		int retcode;
-		CURLMcode result = curl_multi_wait ((CURLM*)multi_handle->ptr, 0, 0, timeout_ms, &retcode);
+		CURLMcode result = curl_multi_wait (((CURL_MultiContext*)multi_handle->ptr)->multi, 0, 0, timeout_ms, &retcode);
 
 		System::GCExitBlocking ();
 		return result;
@@ -2779,10 +2762,95 @@ namespace lime {
 	//lime_curl_multi_strerror
 	//lime_curl_multi_timeout
 
-	//lime_curl_share_cleanup
-	//lime_curl_share_init
-	//lime_curl_share_setopt
-	//lime_curl_share_strerror
+	void lime_curl_share_cleanup (value handle) {
+
+		if (!val_is_null (handle)) {
+
+			// handles still using the share keep it alive until they are done
+
+			((CURLShare*)val_data (handle))->Release ();
+			val_gc (handle, 0);
+
+		}
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_curl_share_cleanup) (HL_CFFIPointer* handle) {
+
+		if (handle && handle->ptr) {
+
+			((CURLShare*)handle->ptr)->Release ();
+			handle->ptr = NULL;
+			handle->finalizer = NULL;
+
+		}
+
+	}
+
+
+	value lime_curl_share_init () {
+
+		return CFFIPointer (new CURLShare (), gc_curl_share);
+
+	}
+
+
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_curl_share_init) () {
+
+		return HLCFFIPointer (new CURLShare (), (hl_finalizer)hl_gc_curl_share);
+
+	}
+
+
+	static int curl_share_set_option (CURLShare* share, int option, int parameter) {
+
+		// locking is installed by CURLShare itself and is not configurable
+
+		switch (option) {
+
+			case CURLSHOPT_SHARE: return share->Share (parameter);
+			case CURLSHOPT_UNSHARE: return share->Unshare (parameter);
+			default: return CURLSHE_BAD_OPTION;
+
+		}
+
+	}
+
+
+	int lime_curl_share_setopt (value handle, int option, int parameter) {
+
+		return curl_share_set_option ((CURLShare*)val_data (handle), option, parameter);
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_curl_share_setopt) (HL_CFFIPointer* handle, int option, int parameter) {
+
+		if (!handle->ptr) return CURLSHE_INVALID;
+		return curl_share_set_option ((CURLShare*)handle->ptr, option, parameter);
+
+	}
+
+
+	value lime_curl_share_strerror (int errornum) {
+
+		const char* result = curl_share_strerror ((CURLSHcode)errornum);
+		return result ? alloc_string (result) : alloc_null ();
+
+	}
+
+
+	HL_PRIM vbyte* HL_NAME(hl_curl_share_strerror) (int errornum) {
+
+		const char* result = curl_share_strerror ((CURLSHcode)errornum);
+		int length = strlen (result);
+		char* _result = (char*)malloc (length + 1);
+		strcpy (_result, result);
+		return (vbyte*)_result;
+
+	}
+
 
 	//lime_curl_slist_append
 	//lime_curl_slist_free_all
@@ -2829,6 +2897,347 @@ namespace lime {
 	}
 
 
+	void gc_download_manager (value handle) {
+
+		DownloadManager* manager = (DownloadManager*)val_data (handle);
+		delete manager;
+
+	}
+
+
+	void hl_gc_download_manager (HL_CFFIPointer* handle) {
+
+		DownloadManager* manager = (DownloadManager*)handle->ptr;
+		delete manager;
+
+	}
+
+
+	void lime_download_manager_cancel (value handle, int id) {
+
+		DownloadManager* manager = (DownloadManager*)val_data (handle);
+		manager->Cancel (id);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_download_manager_cancel) (HL_CFFIPointer* handle, int id) {
+
+		DownloadManager* manager = (DownloadManager*)handle->ptr;
+		manager->Cancel (id);
+
+	}
+
+
+	value lime_download_manager_create (int maxConnections) {
+
+		DownloadManager* manager = new DownloadManager (maxConnections);
+		return CFFIPointer (manager, gc_download_manager);
+
+	}
+
+
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_download_manager_create) (int maxConnections) {
+
+		DownloadManager* manager = new DownloadManager (maxConnections);
+		return HLCFFIPointer (manager, (hl_finalizer)hl_gc_download_manager);
+
+	}
+
+
+	value lime_download_manager_get_digest (value handle) {
+
+		DownloadManager* manager = (DownloadManager*)val_data (handle);
+		DownloadMessage* message = manager->GetCurrent ();
+
+		if (!message || message->digest.empty ()) return alloc_null ();
+
+		return alloc_string_len (message->digest.c_str (), message->digest.size ());
+
+	}
+
+
+	HL_PRIM vbyte* HL_NAME(hl_download_manager_get_digest) (HL_CFFIPointer* handle) {
+
+		DownloadManager* manager = (DownloadManager*)handle->ptr;
+		DownloadMessage* message = manager->GetCurrent ();
+
+		if (!message || message->digest.empty ()) return NULL;
+
+		vbyte* result = hl_alloc_bytes (message->digest.size () + 1);
+		memcpy (result, message->digest.c_str (), message->digest.size () + 1);
+		return result;
+
+	}
+
+
+	value lime_download_manager_read (value handle) {
+
+		DownloadManager* manager = (DownloadManager*)val_data (handle);
+		DownloadMessage* message = manager->Read ();
+
+		if (!message) return alloc_null ();
+
+		const field id_bytesLoaded = val_id ("bytesLoaded");
+		const field id_bytesTotal = val_id ("bytesTotal");
+		const field id_id = val_id ("id");
+		const field id_result = val_id ("result");
+		const field id_status = val_id ("status");
+		const field id_type = val_id ("type");
+
+		value result = alloc_empty_object ();
+		alloc_field (result, id_bytesLoaded, alloc_float (message->bytesLoaded));
+		alloc_field (result, id_bytesTotal, alloc_float (message->bytesTotal));
+		alloc_field (result, id_id, alloc_int (message->id));
+		alloc_field (result, id_result, alloc_int (message->result));
+		alloc_field (result, id_status, alloc_int (message->status));
+		alloc_field (result, id_type, alloc_int (message->type));
+		return result;
+
+	}
+
+
+	HL_PRIM vdynamic* HL_NAME(hl_download_manager_read) (HL_CFFIPointer* handle, vdynamic* result) {
+
+		DownloadManager* manager = (DownloadManager*)handle->ptr;
+		DownloadMessage* message = manager->Read ();
+
+		if (!message) return NULL;
+
+		const int id_bytesLoaded = hl_hash_utf8 ("bytesLoaded");
+		const int id_bytesTotal = hl_hash_utf8 ("bytesTotal");
+		const int id_id = hl_hash_utf8 ("id");
+		const int id_result = hl_hash_utf8 ("result");
+		const int id_status = hl_hash_utf8 ("status");
+		const int id_type = hl_hash_utf8 ("type");
+
+		hl_dyn_setd (result, id_bytesLoaded, message->bytesLoaded);
+		hl_dyn_setd (result, id_bytesTotal, message->bytesTotal);
+		hl_dyn_seti (result, id_id, &hlt_i32, message->id);
+		hl_dyn_seti (result, id_result, &hlt_i32, message->result);
+		hl_dyn_seti (result, id_status, &hlt_i32, message->status);
+		hl_dyn_seti (result, id_type, &hlt_i32, message->type);
+		return result;
+
+	}
+
+
+	int lime_download_manager_start (value handle, HxString url, HxString path, int segments, int minSegmentSize, int hash, int maxRetries, double retryDelay, double progressInterval) {
+
+		DownloadManager* manager = (DownloadManager*)val_data (handle);
+		return manager->Start (url.c_str (), path.c_str (), segments, minSegmentSize, hash, maxRetries, retryDelay, progressInterval);
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_download_manager_start) (HL_CFFIPointer* handle, hl_vstring* url, hl_vstring* path, int segments, int minSegmentSize, int hash, int maxRetries, double retryDelay, double progressInterval) {
+
+		DownloadManager* manager = (DownloadManager*)handle->ptr;
+		return manager->Start (url ? hl_to_utf8 (url->bytes) : NULL, path ? hl_to_utf8 (path->bytes) : NULL, segments, minSegmentSize, hash, maxRetries, retryDelay, progressInterval);
+
+	}
+
+
+	void gc_http_client (value handle) {
+
+		HTTPClient* client = (HTTPClient*)val_data (handle);
+		delete client;
+
+	}
+
+
+	void hl_gc_http_client (HL_CFFIPointer* handle) {
+
+		HTTPClient* client = (HTTPClient*)handle->ptr;
+		delete client;
+
+	}
+
+
+	void lime_http_client_cancel (value handle, int id) {
+
+		HTTPClient* client = (HTTPClient*)val_data (handle);
+		client->Cancel (id);
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_http_client_cancel) (HL_CFFIPointer* handle, int id) {
+
+		HTTPClient* client = (HTTPClient*)handle->ptr;
+		client->Cancel (id);
+
+	}
+
+
+	value lime_http_client_create (int maxConnections, value share) {
+
+		HTTPClient* client = new HTTPClient (maxConnections, val_is_null (share) ? NULL : (CURLShare*)val_data (share));
+		return CFFIPointer (client, gc_http_client);
+
+	}
+
+
+	HL_PRIM HL_CFFIPointer* HL_NAME(hl_http_client_create) (int maxConnections, HL_CFFIPointer* share) {
+
+		HTTPClient* client = new HTTPClient (maxConnections, share ? (CURLShare*)share->ptr : NULL);
+		return HLCFFIPointer (client, (hl_finalizer)hl_gc_http_client);
+
+	}
+
+
+	value lime_http_client_get_headers (value handle) {
+
+		HTTPClient* client = (HTTPClient*)val_data (handle);
+		HTTPClientMessage* message = client->GetCurrent ();
+
+		if (!message || message->headers.empty ()) return alloc_null ();
+
+		return alloc_string_len (message->headers.c_str (), message->headers.size ());
+
+	}
+
+
+	HL_PRIM vbyte* HL_NAME(hl_http_client_get_headers) (HL_CFFIPointer* handle) {
+
+		HTTPClient* client = (HTTPClient*)handle->ptr;
+		HTTPClientMessage* message = client->GetCurrent ();
+
+		if (!message || message->headers.empty ()) return NULL;
+
+		vbyte* result = hl_alloc_bytes (message->headers.size () + 1);
+		memcpy (result, message->headers.c_str (), message->headers.size () + 1);
+		return result;
+
+	}
+
+
+	value lime_http_client_read (value handle) {
+
+		HTTPClient* client = (HTTPClient*)val_data (handle);
+		HTTPClientMessage* message = client->Read ();
+
+		if (!message) return alloc_null ();
+
+		const field id_bytesLoaded = val_id ("bytesLoaded");
+		const field id_bytesTotal = val_id ("bytesTotal");
+		const field id_id = val_id ("id");
+		const field id_length = val_id ("length");
+		const field id_result = val_id ("result");
+		const field id_status = val_id ("status");
+		const field id_type = val_id ("type");
+
+		value result = alloc_empty_object ();
+		alloc_field (result, id_bytesLoaded, alloc_float (message->bytesLoaded));
+		alloc_field (result, id_bytesTotal, alloc_float (message->bytesTotal));
+		alloc_field (result, id_id, alloc_int (message->id));
+		alloc_field (result, id_length, alloc_int (message->data.size ()));
+		alloc_field (result, id_result, alloc_int (message->result));
+		alloc_field (result, id_status, alloc_int (message->status));
+		alloc_field (result, id_type, alloc_int (message->type));
+		return result;
+
+	}
+
+
+	HL_PRIM vdynamic* HL_NAME(hl_http_client_read) (HL_CFFIPointer* handle, vdynamic* result) {
+
+		HTTPClient* client = (HTTPClient*)handle->ptr;
+		HTTPClientMessage* message = client->Read ();
+
+		if (!message) return NULL;
+
+		const int id_bytesLoaded = hl_hash_utf8 ("bytesLoaded");
+		const int id_bytesTotal = hl_hash_utf8 ("bytesTotal");
+		const int id_id = hl_hash_utf8 ("id");
+		const int id_length = hl_hash_utf8 ("length");
+		const int id_result = hl_hash_utf8 ("result");
+		const int id_status = hl_hash_utf8 ("status");
+		const int id_type = hl_hash_utf8 ("type");
+
+		hl_dyn_setd (result, id_bytesLoaded, message->bytesLoaded);
+		hl_dyn_setd (result, id_bytesTotal, message->bytesTotal);
+		hl_dyn_seti (result, id_id, &hlt_i32, message->id);
+		hl_dyn_seti (result, id_length, &hlt_i32, message->data.size ());
+		hl_dyn_seti (result, id_result, &hlt_i32, message->result);
+		hl_dyn_seti (result, id_status, &hlt_i32, message->status);
+		hl_dyn_seti (result, id_type, &hlt_i32, message->type);
+		return result;
+
+	}
+
+
+	void lime_http_client_read_data (value handle, value bytes) {
+
+		HTTPClient* client = (HTTPClient*)val_data (handle);
+		HTTPClientMessage* message = client->GetCurrent ();
+		Bytes _bytes (bytes);
+
+		if (message && !message->data.empty () && _bytes.length >= (int)message->data.size ()) {
+
+			memcpy (_bytes.b, &message->data[0], message->data.size ());
+
+		}
+
+	}
+
+
+	HL_PRIM void HL_NAME(hl_http_client_read_data) (HL_CFFIPointer* handle, Bytes* bytes) {
+
+		HTTPClient* client = (HTTPClient*)handle->ptr;
+		HTTPClientMessage* message = client->GetCurrent ();
+
+		if (message && bytes && !message->data.empty () && bytes->length >= (int)message->data.size ()) {
+
+			memcpy (bytes->b, &message->data[0], message->data.size ());
+
+		}
+
+	}
+
+
+	int lime_http_client_request (value handle, HxString url, HxString method, value headers, value data, int flags, int timeout, double progressInterval) {
+
+		HTTPClient* client = (HTTPClient*)val_data (handle);
+
+		curl_slist* list = NULL;
+		int size = val_is_null (headers) ? 0 : val_array_size (headers);
+
+		for (int i = 0; i < size; i++) {
+
+			list = curl_slist_append (list, val_string (val_array_i (headers, i)));
+
+		}
+
+		Bytes bytes (data);
+		return client->Request (url.__s, method.__s, list, bytes.b, bytes.length, flags, timeout, progressInterval);
+
+	}
+
+
+	HL_PRIM int HL_NAME(hl_http_client_request) (HL_CFFIPointer* handle, hl_vstring* url, hl_vstring* method, varray* headers, Bytes* data, int flags, int timeout, double progressInterval) {
+
+		HTTPClient* client = (HTTPClient*)handle->ptr;
+
+		curl_slist* list = NULL;
+
+		if (headers) {
+
+			hl_vstring** headerData = hl_aptr (headers, hl_vstring*);
+
+			for (int i = 0; i < headers->size; i++) {
+
+				if (headerData[i]) list = curl_slist_append (list, hl_to_utf8 (headerData[i]->bytes));
+
+			}
+
+		}
+
+		return client->Request (url ? hl_to_utf8 (url->bytes) : NULL, method ? hl_to_utf8 (method->bytes) : NULL, list, data ? data->b : NULL, data ? data->length : 0, flags, timeout, progressInterval);
+
+	}
+
+
 	DEFINE_PRIME1v (lime_curl_easy_cleanup);
 	DEFINE_PRIME1 (lime_curl_easy_duphandle);
 	DEFINE_PRIME3 (lime_curl_easy_escape);
@@ -2840,6 +3249,8 @@ namespace lime {
 	DEFINE_PRIME4 (lime_curl_easy_recv);
 	DEFINE_PRIME1v (lime_curl_easy_reset);
 	DEFINE_PRIME4 (lime_curl_easy_send);
+	DEFINE_PRIME4 (lime_curl_easy_set_write_chunk);
+	DEFINE_PRIME4 (lime_curl_easy_set_write_file);
 	DEFINE_PRIME4 (lime_curl_easy_setopt);
 	DEFINE_PRIME1 (lime_curl_easy_strerror);
 	DEFINE_PRIME4 (lime_curl_easy_unescape);
@@ -2855,8 +3266,23 @@ namespace lime {
 	DEFINE_PRIME2 (lime_curl_multi_remove_handle);
 	DEFINE_PRIME3 (lime_curl_multi_setopt);
 	DEFINE_PRIME2 (lime_curl_multi_wait);
+	DEFINE_PRIME1v (lime_curl_share_cleanup);
+	DEFINE_PRIME0 (lime_curl_share_init);
+	DEFINE_PRIME3 (lime_curl_share_setopt);
+	DEFINE_PRIME1 (lime_curl_share_strerror);
 	DEFINE_PRIME0 (lime_curl_version);
 	DEFINE_PRIME1 (lime_curl_version_info);
+	DEFINE_PRIME2v (lime_download_manager_cancel);
+	DEFINE_PRIME1 (lime_download_manager_create);
+	DEFINE_PRIME1 (lime_download_manager_get_digest);
+	DEFINE_PRIME1 (lime_download_manager_read);
+	DEFINE_PRIME9 (lime_download_manager_start);
+	DEFINE_PRIME2v (lime_http_client_cancel);
+	DEFINE_PRIME2 (lime_http_client_create);
+	DEFINE_PRIME1 (lime_http_client_get_headers);
+	DEFINE_PRIME1 (lime_http_client_read);
+	DEFINE_PRIME2v (lime_http_client_read_data);
+	DEFINE_PRIME8 (lime_http_client_request);
 
 
 	#define _TBYTES _OBJ (_I32 _BYTES)
@@ -2873,6 +3299,8 @@ namespace lime {
 	DEFINE_HL_PRIM (_I32, hl_curl_easy_recv, _TCFFIPOINTER _F64 _I32 _I32);
 	DEFINE_HL_PRIM (_VOID, hl_curl_easy_reset, _TCFFIPOINTER);
 	DEFINE_HL_PRIM (_I32, hl_curl_easy_send, _TCFFIPOINTER _F64 _I32 _I32);
+	DEFINE_HL_PRIM (_I32, hl_curl_easy_set_write_chunk, _TCFFIPOINTER _DYN _TBYTES _I32);
+	DEFINE_HL_PRIM (_I32, hl_curl_easy_set_write_file, _TCFFIPOINTER _STRING _BOOL _BOOL);
 	DEFINE_HL_PRIM (_I32, hl_curl_easy_setopt, _TCFFIPOINTER _I32 _DYN _TBYTES);
 	DEFINE_HL_PRIM (_BYTES, hl_curl_easy_strerror, _I32);
 	DEFINE_HL_PRIM (_BYTES, hl_curl_easy_unescape, _TCFFIPOINTER _STRING _I32 _I32);
@@ -2888,8 +3316,23 @@ namespace lime {
 	DEFINE_HL_PRIM (_I32, hl_curl_multi_remove_handle, _TCFFIPOINTER _TCFFIPOINTER);
 	DEFINE_HL_PRIM (_I32, hl_curl_multi_setopt, _TCFFIPOINTER _I32 _DYN);
 	DEFINE_HL_PRIM (_I32, hl_curl_multi_wait, _TCFFIPOINTER _I32);
+	DEFINE_HL_PRIM (_VOID, hl_curl_share_cleanup, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_curl_share_init, _NO_ARG);
+	DEFINE_HL_PRIM (_I32, hl_curl_share_setopt, _TCFFIPOINTER _I32 _I32);
+	DEFINE_HL_PRIM (_BYTES, hl_curl_share_strerror, _I32);
 	DEFINE_HL_PRIM (_BYTES, hl_curl_version, _NO_ARG);
 	DEFINE_HL_PRIM (_DYN, hl_curl_version_info, _I32);
+	DEFINE_HL_PRIM (_VOID, hl_download_manager_cancel, _TCFFIPOINTER _I32);
+	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_download_manager_create, _I32);
+	DEFINE_HL_PRIM (_BYTES, hl_download_manager_get_digest, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_DYN, hl_download_manager_read, _TCFFIPOINTER _DYN);
+	DEFINE_HL_PRIM (_I32, hl_download_manager_start, _TCFFIPOINTER _STRING _STRING _I32 _I32 _I32 _I32 _F64 _F64);
+	DEFINE_HL_PRIM (_VOID, hl_http_client_cancel, _TCFFIPOINTER _I32);
+	DEFINE_HL_PRIM (_TCFFIPOINTER, hl_http_client_create, _I32 _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_BYTES, hl_http_client_get_headers, _TCFFIPOINTER);
+	DEFINE_HL_PRIM (_DYN, hl_http_client_read, _TCFFIPOINTER _DYN);
+	DEFINE_HL_PRIM (_VOID, hl_http_client_read_data, _TCFFIPOINTER _TBYTES);
+	DEFINE_HL_PRIM (_I32, hl_http_client_request, _TCFFIPOINTER _STRING _STRING _ARR _TBYTES _I32 _I32 _F64);
 
 
 }
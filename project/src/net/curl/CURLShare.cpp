@@ -0,0 +1,112 @@
+#include <net/curl/CURLShare.h>
+
+
+namespace lime {
+
+
+	static CURLShare* defaultShare = NULL;
+	static Mutex defaultShareMutex;
+
+
+	CURLShare::CURLShare () : references (1) {
+
+		share = curl_share_init ();
+
+		if (share) {
+
+			curl_share_setopt (share, CURLSHOPT_LOCKFUNC, LockCallback);
+			curl_share_setopt (share, CURLSHOPT_UNLOCKFUNC, UnlockCallback);
+			curl_share_setopt (share, CURLSHOPT_USERDATA, this);
+
+		}
+
+	}
+
+
+	CURLShare::~CURLShare () {
+
+		if (share) {
+
+			curl_share_cleanup (share);
+
+		}
+
+	}
+
+
+	CURLShare* CURLShare::GetDefault () {
+
+		defaultShareMutex.Lock ();
+
+		if (!defaultShare) {
+
+			defaultShare = new CURLShare ();
+			defaultShare->Share (CURL_LOCK_DATA_DNS);
+			defaultShare->Share (CURL_LOCK_DATA_SSL_SESSION);
+
+		}
+
+		defaultShareMutex.Unlock ();
+
+		return defaultShare;
+
+	}
+
+
+	void CURLShare::LockCallback (CURL* curl, curl_lock_data data, curl_lock_access access, void* userp) {
+
+		if (data >= 0 && data < CURL_LOCK_DATA_LAST) {
+
+			((CURLShare*)userp)->mutexes[data].Lock ();
+
+		}
+
+	}
+
+
+	void CURLShare::Release () {
+
+		if (--references == 0) {
+
+			delete this;
+
+		}
+
+	}
+
+
+	void CURLShare::Retain () {
+
+		references++;
+
+	}
+
+
+	CURLSHcode CURLShare::Share (int data) {
+
+		if (!share) return CURLSHE_NOMEM;
+		return curl_share_setopt (share, CURLSHOPT_SHARE, (curl_lock_data)data);
+
+	}
+
+
+	void CURLShare::UnlockCallback (CURL* curl, curl_lock_data data, void* userp) {
+
+		if (data >= 0 && data < CURL_LOCK_DATA_LAST) {
+
+			((CURLShare*)userp)->mutexes[data].Unlock ();
+
+		}
+
+	}
+
+
+	CURLSHcode CURLShare::Unshare (int data) {
+
+		if (!share) return CURLSHE_NOMEM;
+		return curl_share_setopt (share, CURLSHOPT_UNSHARE, (curl_lock_data)data);
+
+	}
+
+
+}
@@ -0,0 +1,241 @@
+#ifdef HX_WINDOWS
+#include <windows.h>
+#include <codecvt>
+#include <locale>
+#include <string>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include <net/curl/DownloadFile.h>
+
+
+namespace lime {
+
+
+	DownloadFile::DownloadFile () {
+
+		#ifdef HX_WINDOWS
+		handle = INVALID_HANDLE_VALUE;
+		#else
+		fd = -1;
+		#endif
+		size = 0;
+
+	}
+
+
+	DownloadFile::~DownloadFile () {
+
+		#ifdef HX_WINDOWS
+		if (handle != INVALID_HANDLE_VALUE) CloseHandle ((HANDLE)handle);
+		#else
+		if (fd > -1) close (fd);
+		#endif
+
+	}
+
+
+	DownloadFile* DownloadFile::Open (const char* path, bool resume) {
+
+		if (!path) return NULL;
+
+		DownloadFile* file = new DownloadFile ();
+
+		#ifdef HX_WINDOWS
+
+		std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
+		std::wstring widePath = converter.from_bytes (path);
+
+		HANDLE handle = CreateFileW (widePath.c_str (), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, resume ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+
+		if (handle == INVALID_HANDLE_VALUE) {
+
+			delete file;
+			return NULL;
+
+		}
+
+		LARGE_INTEGER length;
+		file->handle = handle;
+		file->size = GetFileSizeEx (handle, &length) ? length.QuadPart : 0;
+
+		#else
+
+		int fd;
+
+		do {
+
+			fd = open (path, O_RDWR | O_CREAT | (resume ? 0 : O_TRUNC), 0644);
+
+		} while (fd < 0 && errno == EINTR);
+
+		if (fd < 0) {
+
+			delete file;
+			return NULL;
+
+		}
+
+		struct stat info;
+		file->fd = fd;
+		file->size = (fstat (fd, &info) == 0) ? (int64_t)info.st_size : 0;
+
+		#endif
+
+		return file;
+
+	}
+
+
+	bool DownloadFile::Preallocate (int64_t length) {
+
+		if (length <= 0) return false;
+
+		#if defined (HX_WINDOWS)
+
+		FILE_ALLOCATION_INFO info;
+		info.AllocationSize.QuadPart = length;
+		return SetFileInformationByHandle ((HANDLE)handle, FileAllocationInfo, &info, sizeof (info)) != 0;
+
+		#elif defined (__APPLE__)
+
+		fstore_t store = { F_ALLOCATECONTIG, F_PEOFPOSMODE, 0, (off_t)length, 0 };
+
+		if (fcntl (fd, F_PREALLOCATE, &store) == -1) {
+
+			store.fst_flags = F_ALLOCATEALL;
+			return fcntl (fd, F_PREALLOCATE, &store) != -1;
+
+		}
+
+		return true;
+
+		#elif defined (__linux__) && defined (FALLOC_FL_KEEP_SIZE)
+
+		return fallocate (fd, FALLOC_FL_KEEP_SIZE, 0, (off_t)length) == 0;
+
+		#else
+
+		return false;
+
+		#endif
+
+	}
+
+
+	size_t DownloadFile::Read (void* data, size_t length, int64_t offset) {
+
+		char* bytes = (char*)data;
+		size_t total = 0;
+
+		while (total < length) {
+
+			#ifdef HX_WINDOWS
+
+			OVERLAPPED overlapped = {};
+			overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+			overlapped.OffsetHigh = (DWORD)(offset >> 32);
+
+			DWORD read = 0;
+
+			if (!ReadFile ((HANDLE)handle, bytes, (DWORD)(length - total), &read, &overlapped) || read == 0) {
+
+				break;
+
+			}
+
+			#else
+
+			ssize_t read = pread (fd, bytes, length - total, (off_t)offset);
+
+			if (read < 0 && errno == EINTR) continue;
+			if (read <= 0) break;
+
+			#endif
+
+			bytes += read;
+			total += read;
+			offset += read;
+
+		}
+
+		return total;
+
+	}
+
+
+	bool DownloadFile::Truncate (int64_t length) {
+
+		#ifdef HX_WINDOWS
+
+		LARGE_INTEGER position;
+		position.QuadPart = length;
+
+		if (!SetFilePointerEx ((HANDLE)handle, position, NULL, FILE_BEGIN) || !SetEndOfFile ((HANDLE)handle)) {
+
+			return false;
+
+		}
+
+		#else
+
+		if (ftruncate (fd, (off_t)length) != 0) {
+
+			return false;
+
+		}
+
+		#endif
+
+		size = length;
+		return true;
+
+	}
+
+
+	bool DownloadFile::Write (const void* data, size_t length, int64_t offset) {
+
+		const char* bytes = (const char*)data;
+
+		while (length > 0) {
+
+			#ifdef HX_WINDOWS
+
+			OVERLAPPED overlapped = {};
+			overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+			overlapped.OffsetHigh = (DWORD)(offset >> 32);
+
+			DWORD written = 0;
+
+			if (!WriteFile ((HANDLE)handle, bytes, (DWORD)length, &written, &overlapped) || written == 0) {
+
+				return false;
+
+			}
+
+			#else
+
+			ssize_t written = pwrite (fd, bytes, length, (off_t)offset);
+
+			if (written < 0 && errno == EINTR) continue;
+			if (written <= 0) return false;
+
+			#endif
+
+			bytes += written;
+			length -= written;
+			offset += written;
+
+		}
+
+		return true;
+
+	}
+
+
+}
@@ -0,0 +1,1054 @@
+#include <net/curl/DownloadFile.h>
+#include <net/curl/DownloadManager.h>
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+
+namespace lime {
+
+
+	static const int HASH_READ_SIZE = 64 * 1024;
+	static const int MAX_POLL_WAIT = 1000;
+	static const double MAX_RETRY_DELAY = 30000;
+
+	static const uint32_t SHA256_K[64] = {
+
+		0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+		0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+		0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+		0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+		0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+		0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+		0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+		0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+
+	};
+
+
+	static double Now () {
+
+		return std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+
+	}
+
+
+	static inline uint32_t Rotate (uint32_t value, int bits) {
+
+		return (value >> bits) | (value << (32 - bits));
+
+	}
+
+
+	static const uint32_t* CRC32Table () {
+
+		static struct Table {
+
+			uint32_t values[256];
+
+			Table () {
+
+				for (uint32_t i = 0; i < 256; i++) {
+
+					uint32_t value = i;
+
+					for (int j = 0; j < 8; j++) {
+
+						value = (value & 1) ? (0xEDB88320 ^ (value >> 1)) : (value >> 1);
+
+					}
+
+					values[i] = value;
+
+				}
+
+			}
+
+		} table;
+
+		return table.values;
+
+	}
+
+
+	// Incremental CRC-32 (the zlib polynomial) or SHA-256 over the bytes it is
+	// given, which must be fed in file order
+
+	class DownloadDigest {
+
+
+		public:
+
+			DownloadDigest () { Reset (DOWNLOAD_HASH_NONE); }
+
+			std::string Finish ();
+			void Reset (int type);
+			void Update (const unsigned char* data, size_t length);
+
+		private:
+
+			void Transform (const unsigned char* data);
+
+			unsigned char block[64];
+			size_t blockLength;
+			uint32_t crc;
+			uint64_t length;
+			uint32_t state[8];
+			int type;
+
+
+	};
+
+
+	std::string DownloadDigest::Finish () {
+
+		char hex[65];
+
+		if (type == DOWNLOAD_HASH_CRC32) {
+
+			snprintf (hex, sizeof (hex), "%08x", crc ^ 0xFFFFFFFF);
+			return hex;
+
+		} else if (type != DOWNLOAD_HASH_SHA256) {
+
+			return "";
+
+		}
+
+		uint64_t bits = length * 8;
+
+		block[blockLength++] = 0x80;
+
+		if (blockLength > 56) {
+
+			memset (block + blockLength, 0, 64 - blockLength);
+			Transform (block);
+			blockLength = 0;
+
+		}
+
+		memset (block + blockLength, 0, 56 - blockLength);
+
+		for (int i = 0; i < 8; i++) {
+
+			block[63 - i] = (unsigned char)(bits >> (i * 8));
+
+		}
+
+		Transform (block);
+		blockLength = 0;
+
+		for (int i = 0; i < 8; i++) {
+
+			snprintf (hex + i * 8, 9, "%08x", state[i]);
+
+		}
+
+		return hex;
+
+	}
+
+
+	void DownloadDigest::Reset (int type) {
+
+		static const uint32_t initial[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+		this->type = type;
+		blockLength = 0;
+		crc = 0xFFFFFFFF;
+		length = 0;
+		memcpy (state, initial, sizeof (state));
+
+	}
+
+
+	void DownloadDigest::Transform (const unsigned char* data) {
+
+		uint32_t w[64];
+
+		for (int i = 0; i < 16; i++) {
+
+			w[i] = ((uint32_t)data[i * 4] << 24) | ((uint32_t)data[i * 4 + 1] << 16) | ((uint32_t)data[i * 4 + 2] << 8) | (uint32_t)data[i * 4 + 3];
+
+		}
+
+		for (int i = 16; i < 64; i++) {
+
+			uint32_t s0 = Rotate (w[i - 15], 7) ^ Rotate (w[i - 15], 18) ^ (w[i - 15] >> 3);
+			uint32_t s1 = Rotate (w[i - 2], 17) ^ Rotate (w[i - 2], 19) ^ (w[i - 2] >> 10);
+			w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+
+		}
+
+		uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+		uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+		for (int i = 0; i < 64; i++) {
+
+			uint32_t t1 = h + (Rotate (e, 6) ^ Rotate (e, 11) ^ Rotate (e, 25)) + ((e & f) ^ (~e & g)) + SHA256_K[i] + w[i];
+			uint32_t t2 = (Rotate (a, 2) ^ Rotate (a, 13) ^ Rotate (a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+
+			h = g;
+			g = f;
+			f = e;
+			e = d + t1;
+			d = c;
+			c = b;
+			b = a;
+			a = t1 + t2;
+
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+
+	}
+
+
+	void DownloadDigest::Update (const unsigned char* data, size_t length) {
+
+		this->length += length;
+
+		if (type == DOWNLOAD_HASH_CRC32) {
+
+			const uint32_t* table = CRC32Table ();
+
+			for (size_t i = 0; i < length; i++) {
+
+				crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+			}
+
+		} else if (type == DOWNLOAD_HASH_SHA256) {
+
+			while (length > 0) {
+
+				size_t count = 64 - blockLength;
+				if (count > length) count = length;
+
+				memcpy (block + blockLength, data, count);
+				blockLength += count;
+				data += count;
+				length -= count;
+
+				if (blockLength == 64) {
+
+					Transform (block);
+					blockLength = 0;
+
+				}
+
+			}
+
+		}
+
+	}
+
+
+	struct DownloadManager::Segment {
+
+		bool active;
+		int attempts;
+		bool checked;
+		CURL* curl;
+		bool done;
+		Download* download;
+		int64_t end;
+		bool fatal;
+		bool probe;
+		bool ranged;
+		double retryTime;
+		int64_t start;
+		int64_t written;
+
+	};
+
+
+	struct DownloadManager::Download {
+
+		bool acceptRanges;
+		DownloadDigest digest;
+		DownloadFile* file;
+		int hash;
+		int64_t hashed;
+		int id;
+		double lastProgress;
+		int64_t lastProgressLoaded;
+		int64_t length;
+		int64_t loaded;
+		DownloadManager* manager;
+		int maxRetries;
+		int maxSegments;
+		int64_t minSegmentSize;
+		std::string path;
+		double progressInterval;
+		double retryDelay;
+		std::vector<Segment*> segments;
+		int status;
+		std::string url;
+
+	};
+
+
+	DownloadManager::DownloadManager (int maxConnections) {
+
+		current = 0;
+		nextID = 1;
+		stopping = false;
+
+		share = CURLShare::GetDefault ();
+		share->Retain ();
+
+		multi = curl_multi_init ();
+
+		if (maxConnections > 0) {
+
+			curl_multi_setopt (multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, (long)maxConnections);
+
+		}
+
+		// multiplexing would put every segment on one HTTP/2 connection,
+		// which is exactly the single stream that splitting tries to avoid
+
+		curl_multi_setopt (multi, CURLMOPT_PIPELINING, (long)CURLPIPE_NOTHING);
+
+		worker = std::thread (&DownloadManager::Run, this);
+
+	}
+
+
+	DownloadManager::~DownloadManager () {
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			stopping = true;
+
+		}
+
+		Wake ();
+		worker.join ();
+
+		while (!active.empty ()) {
+
+			Destroy (active.begin ()->second);
+
+		}
+
+		for (size_t i = 0; i < pending.size (); i++) {
+
+			delete pending[i];
+
+		}
+
+		for (size_t i = 0; i < messages.size (); i++) {
+
+			delete messages[i];
+
+		}
+
+		delete current;
+
+		curl_multi_cleanup (multi);
+		share->Release ();
+
+	}
+
+
+	void DownloadManager::AdvanceHash (Download* download) {
+
+		if (download->hash == DOWNLOAD_HASH_NONE) return;
+
+		std::vector<unsigned char> buffer;
+
+		for (size_t i = 0; i < download->segments.size (); i++) {
+
+			Segment* segment = download->segments[i];
+			int64_t available = segment->start + segment->written;
+
+			while (download->hashed < available) {
+
+				if (buffer.empty ()) buffer.resize (HASH_READ_SIZE);
+
+				int64_t remaining = available - download->hashed;
+				size_t length = remaining < HASH_READ_SIZE ? (size_t)remaining : HASH_READ_SIZE;
+				size_t read = download->file->Read (&buffer[0], length, download->hashed);
+
+				if (read == 0) return;
+
+				download->digest.Update (&buffer[0], read);
+				download->hashed += read;
+
+			}
+
+			if (!segment->done) break;
+
+		}
+
+	}
+
+
+	void DownloadManager::Begin (Download* download) {
+
+		active[download->id] = download;
+
+		download->file = DownloadFile::Open (download->path.c_str (), false);
+
+		if (!download->file) {
+
+			Fail (download, CURLE_WRITE_ERROR, 0);
+			return;
+
+		}
+
+		Segment* probe = new Segment ();
+		probe->download = download;
+		probe->end = -1;
+		probe->probe = true;
+
+		download->segments.push_back (probe);
+
+		if (!StartSegment (probe)) {
+
+			Fail (download, CURLE_OUT_OF_MEMORY, 0);
+
+		}
+
+	}
+
+
+	void DownloadManager::Cancel (int id) {
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			canceled.push_back (id);
+
+		}
+
+		Wake ();
+
+	}
+
+
+	void DownloadManager::Complete (Segment* segment, CURLcode result) {
+
+		Download* download = segment->download;
+		CURL* curl = segment->curl;
+
+		long status = 0;
+		curl_easy_getinfo (curl, CURLINFO_RESPONSE_CODE, &status);
+
+		if (segment->probe) {
+
+			// a failed HEAD is not fatal, the server may only answer GET
+
+			curl_off_t length = -1;
+			std::string url = download->url;
+
+			if (result == CURLE_OK && status < 300) {
+
+				char* effectiveURL = NULL;
+				curl_easy_getinfo (curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &length);
+
+				if (curl_easy_getinfo (curl, CURLINFO_EFFECTIVE_URL, &effectiveURL) == CURLE_OK && effectiveURL) {
+
+					url = effectiveURL;
+
+				}
+
+			} else {
+
+				download->acceptRanges = false;
+
+			}
+
+			curl_multi_remove_handle (multi, curl);
+			curl_easy_cleanup (curl);
+
+			download->segments.clear ();
+			delete segment;
+
+			Split (download, url.c_str (), length);
+			return;
+
+		}
+
+		curl_multi_remove_handle (multi, curl);
+		curl_easy_cleanup (curl);
+		segment->active = false;
+		segment->curl = NULL;
+
+		bool ranged = segment->ranged;
+		int64_t size = segment->end >= 0 ? segment->end + 1 - segment->start : -1;
+
+		// a range that arrived whole is kept even if the connection failed
+		// afterwards, asking for it again would be an invalid range
+
+		if ((size >= 0 && segment->written == size) || (result == CURLE_OK && status < 300 && size < 0)) {
+
+			segment->done = true;
+			download->status = (int)status;
+
+			AdvanceHash (download);
+
+			for (size_t i = 0; i < download->segments.size (); i++) {
+
+				if (!download->segments[i]->done) return;
+
+			}
+
+			Finish (download);
+			return;
+
+		}
+
+		// a server that stops honouring ranges cannot be resumed, and other
+		// client errors will not go away by asking again
+
+		if (ranged && status == 200) {
+
+			Fail (download, CURLE_RANGE_ERROR, (int)status);
+			return;
+
+		}
+
+		bool retry = !segment->fatal && (status < 400 || status == 408 || status == 429 || status >= 500);
+
+		if (!retry || segment->attempts >= download->maxRetries) {
+
+			if (segment->fatal) result = CURLE_WRITE_ERROR;
+			else if (result == CURLE_OK) result = status >= 400 ? CURLE_HTTP_RETURNED_ERROR : CURLE_PARTIAL_FILE;
+
+			Fail (download, result, (int)status);
+			return;
+
+		}
+
+		segment->attempts++;
+
+		double delay = download->retryDelay * (double)(1 << (segment->attempts < 16 ? segment->attempts - 1 : 15));
+		segment->retryTime = Now () + (delay < MAX_RETRY_DELAY ? delay : MAX_RETRY_DELAY);
+
+		if (segment->end < 0 && !download->acceptRanges && segment->written > 0) {
+
+			// without range support the only way to continue is from the start
+
+			download->loaded -= segment->written;
+			download->hashed = 0;
+			download->digest.Reset (download->hash);
+			segment->written = 0;
+
+		}
+
+	}
+
+
+	void DownloadManager::Destroy (Download* download) {
+
+		active.erase (download->id);
+
+		for (size_t i = 0; i < download->segments.size (); i++) {
+
+			Segment* segment = download->segments[i];
+
+			if (segment->curl) {
+
+				if (segment->active) curl_multi_remove_handle (multi, segment->curl);
+				curl_easy_cleanup (segment->curl);
+
+			}
+
+			delete segment;
+
+		}
+
+		delete download->file;
+		delete download;
+
+	}
+
+
+	void DownloadManager::Fail (Download* download, int result, int status) {
+
+		DownloadMessage* message = new DownloadMessage ();
+		message->bytesLoaded = (double)download->loaded;
+		message->bytesTotal = (double)(download->length >= 0 ? download->length : download->loaded);
+		message->id = download->id;
+		message->result = result;
+		message->status = status;
+		message->type = DOWNLOAD_COMPLETE;
+
+		Destroy (download);
+		Post (message);
+
+	}
+
+
+	void DownloadManager::Finish (Download* download) {
+
+		AdvanceHash (download);
+
+		if (download->hash != DOWNLOAD_HASH_NONE && download->hashed != download->loaded) {
+
+			Fail (download, CURLE_READ_ERROR, download->status);
+			return;
+
+		}
+
+		DownloadMessage* message = new DownloadMessage ();
+		message->bytesLoaded = (double)download->loaded;
+		message->bytesTotal = (double)download->loaded;
+		message->digest = download->digest.Finish ();
+		message->id = download->id;
+		message->result = CURLE_OK;
+		message->status = download->status;
+		message->type = DOWNLOAD_COMPLETE;
+
+		Destroy (download);
+		Post (message);
+
+	}
+
+
+	size_t DownloadManager::HeaderCallback (char* buffer, size_t size, size_t count, void* userp) {
+
+		Segment* segment = (Segment*)userp;
+		size_t length = size * count;
+
+		static const char* prefix = "accept-ranges:";
+		size_t prefixLength = strlen (prefix);
+
+		if (length >= 5 && memcmp (buffer, "HTTP/", 5) == 0) {
+
+			// each redirect starts a new set of headers
+			segment->download->acceptRanges = false;
+
+		} else if (length > prefixLength) {
+
+			for (size_t i = 0; i < prefixLength; i++) {
+
+				char c = buffer[i];
+				if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+				if (c != prefix[i]) return length;
+
+			}
+
+			std::string value (buffer + prefixLength, length - prefixLength);
+			segment->download->acceptRanges = value.find ("bytes") != std::string::npos;
+
+		}
+
+		return length;
+
+	}
+
+
+	void DownloadManager::Post (DownloadMessage* message) {
+
+		std::unique_lock<std::mutex> lock (mutex);
+		messages.push_back (message);
+
+	}
+
+
+	bool DownloadManager::Process () {
+
+		std::vector<Download*> added;
+		std::vector<int> removed;
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+
+			if (stopping) return false;
+
+			added.swap (pending);
+			removed.swap (canceled);
+
+		}
+
+		for (size_t i = 0; i < added.size (); i++) {
+
+			Begin (added[i]);
+
+		}
+
+		for (size_t i = 0; i < removed.size (); i++) {
+
+			std::map<int, Download*>::iterator it = active.find (removed[i]);
+
+			if (it != active.end ()) {
+
+				Destroy (it->second);
+
+			}
+
+		}
+
+		return true;
+
+	}
+
+
+	void DownloadManager::Progress (Download* download) {
+
+		if (download->progressInterval < 0 || download->loaded == download->lastProgressLoaded) return;
+
+		double now = Now ();
+
+		if (now - download->lastProgress < download->progressInterval) return;
+
+		download->lastProgress = now;
+		download->lastProgressLoaded = download->loaded;
+
+		DownloadMessage* message = new DownloadMessage ();
+		message->bytesLoaded = (double)download->loaded;
+		message->bytesTotal = (double)(download->length >= 0 ? download->length : download->loaded);
+		message->id = download->id;
+		message->result = CURLE_OK;
+		message->status = 0;
+		message->type = DOWNLOAD_PROGRESS;
+
+		Post (message);
+
+	}
+
+
+	DownloadMessage* DownloadManager::Read () {
+
+		delete current;
+		current = 0;
+
+		std::unique_lock<std::mutex> lock (mutex);
+
+		if (!messages.empty ()) {
+
+			current = messages.front ();
+			messages.pop_front ();
+
+		}
+
+		return current;
+
+	}
+
+
+	void DownloadManager::ReadMessages () {
+
+		CURLMsg* msg;
+		int queued;
+
+		while ((msg = curl_multi_info_read (multi, &queued))) {
+
+			if (msg->msg != CURLMSG_DONE) continue;
+
+			Segment* segment = 0;
+			curl_easy_getinfo (msg->easy_handle, CURLINFO_PRIVATE, (char**)&segment);
+
+			if (segment) {
+
+				Complete (segment, msg->data.result);
+
+			} else {
+
+				curl_multi_remove_handle (multi, msg->easy_handle);
+
+			}
+
+		}
+
+	}
+
+
+	int DownloadManager::Retry (double now) {
+
+		double next = now + MAX_POLL_WAIT;
+		std::vector<Download*> failed;
+
+		for (std::map<int, Download*>::iterator it = active.begin (); it != active.end (); ++it) {
+
+			Download* download = it->second;
+
+			for (size_t i = 0; i < download->segments.size (); i++) {
+
+				Segment* segment = download->segments[i];
+
+				if (segment->active || segment->done || segment->attempts == 0) continue;
+
+				if (segment->retryTime <= now) {
+
+					if (!StartSegment (segment)) {
+
+						failed.push_back (download);
+						break;
+
+					}
+
+				} else if (segment->retryTime < next) {
+
+					next = segment->retryTime;
+
+				}
+
+			}
+
+		}
+
+		for (size_t i = 0; i < failed.size (); i++) {
+
+			Fail (failed[i], CURLE_OUT_OF_MEMORY, 0);
+
+		}
+
+		return (int)(next - now + 0.999);
+
+	}
+
+
+	void DownloadManager::Run () {
+
+		while (Process ()) {
+
+			int running = 0;
+			int wait = Retry (Now ());
+
+			curl_multi_perform (multi, &running);
+			curl_multi_poll (multi, NULL, 0, wait, NULL);
+			curl_multi_perform (multi, &running);
+
+			ReadMessages ();
+
+		}
+
+	}
+
+
+	void DownloadManager::Split (Download* download, const char* url, curl_off_t length) {
+
+		download->url = url;
+		download->length = length;
+
+		if (length > 0) {
+
+			// reserves the space up front, so parallel writes at scattered
+			// offsets do not fragment the file
+
+			download->file->Preallocate (length);
+
+		}
+
+		int count = 1;
+
+		if (length > 0 && download->acceptRanges) {
+
+			int64_t segments = (length + download->minSegmentSize - 1) / download->minSegmentSize;
+			count = segments < download->maxSegments ? (int)segments : download->maxSegments;
+
+		}
+
+		if (count > 1) {
+
+			int64_t size = length / count;
+
+			for (int i = 0; i < count; i++) {
+
+				Segment* segment = new Segment ();
+				segment->download = download;
+				segment->start = i * size;
+				segment->end = (i == count - 1) ? length - 1 : (i + 1) * size - 1;
+				download->segments.push_back (segment);
+
+			}
+
+		} else {
+
+			Segment* segment = new Segment ();
+			segment->download = download;
+			segment->end = -1;
+			download->segments.push_back (segment);
+
+		}
+
+		for (size_t i = 0; i < download->segments.size (); i++) {
+
+			if (!StartSegment (download->segments[i])) {
+
+				Fail (download, CURLE_OUT_OF_MEMORY, 0);
+				return;
+
+			}
+
+		}
+
+	}
+
+
+	int DownloadManager::Start (const char* url, const char* path, int segments, int minSegmentSize, int hash, int maxRetries, double retryDelay, double progressInterval) {
+
+		if (!url || !path) return -1;
+
+		Download* download = new Download ();
+		download->acceptRanges = false;
+		download->digest.Reset (hash);
+		download->file = NULL;
+		download->hash = hash;
+		download->hashed = 0;
+		download->lastProgress = 0;
+		download->lastProgressLoaded = 0;
+		download->length = -1;
+		download->loaded = 0;
+		download->manager = this;
+		download->maxRetries = maxRetries > 0 ? maxRetries : 0;
+		download->maxSegments = segments > 0 ? segments : 1;
+		download->minSegmentSize = minSegmentSize > 0 ? minSegmentSize : 1;
+		download->path = path;
+		download->progressInterval = progressInterval * 1000;
+		download->retryDelay = retryDelay > 0 ? retryDelay * 1000 : 0;
+		download->status = 0;
+		download->url = url;
+
+		int id;
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			id = nextID++;
+			download->id = id;
+			pending.push_back (download);
+
+		}
+
+		Wake ();
+		return id;
+
+	}
+
+
+	bool DownloadManager::StartSegment (Segment* segment) {
+
+		Download* download = segment->download;
+		CURL* curl = curl_easy_init ();
+
+		if (!curl) return false;
+
+		segment->checked = false;
+		segment->curl = curl;
+
+		curl_easy_setopt (curl, CURLOPT_URL, download->url.c_str ());
+		curl_easy_setopt (curl, CURLOPT_PRIVATE, segment);
+		curl_easy_setopt (curl, CURLOPT_NOSIGNAL, 1L);
+		curl_easy_setopt (curl, CURLOPT_FOLLOWLOCATION, 1L);
+		curl_easy_setopt (curl, CURLOPT_SHARE, share->GetHandle ());
+
+		// same as HTTPClient, the digest is what guards the content
+		curl_easy_setopt (curl, CURLOPT_SSL_VERIFYPEER, 0L);
+		curl_easy_setopt (curl, CURLOPT_SSL_VERIFYHOST, 0L);
+
+		// a stalled connection fails, so the segment is retried elsewhere
+		curl_easy_setopt (curl, CURLOPT_LOW_SPEED_LIMIT, 1L);
+		curl_easy_setopt (curl, CURLOPT_LOW_SPEED_TIME, 30L);
+
+		if (segment->probe) {
+
+			curl_easy_setopt (curl, CURLOPT_NOBODY, 1L);
+			curl_easy_setopt (curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
+			curl_easy_setopt (curl, CURLOPT_HEADERDATA, segment);
+
+		} else {
+
+			curl_easy_setopt (curl, CURLOPT_WRITEFUNCTION, WriteCallback);
+			curl_easy_setopt (curl, CURLOPT_WRITEDATA, segment);
+
+			int64_t from = segment->start + segment->written;
+			char range[64];
+
+			segment->ranged = segment->end >= 0 || from > 0;
+
+			if (segment->end >= 0) {
+
+				snprintf (range, sizeof (range), "%lld-%lld", (long long)from, (long long)segment->end);
+				curl_easy_setopt (curl, CURLOPT_RANGE, range);
+
+			} else if (from > 0) {
+
+				snprintf (range, sizeof (range), "%lld-", (long long)from);
+				curl_easy_setopt (curl, CURLOPT_RANGE, range);
+
+			}
+
+		}
+
+		segment->active = true;
+		curl_multi_add_handle (multi, curl);
+		return true;
+
+	}
+
+
+	void DownloadManager::Wake () {
+
+		curl_multi_wakeup (multi);
+
+	}
+
+
+	size_t DownloadManager::WriteCallback (char* buffer, size_t size, size_t count, void* userp) {
+
+		Segment* segment = (Segment*)userp;
+		Download* download = segment->download;
+		size_t length = size * count;
+
+		if (!segment->checked) {
+
+			// refuse the body of an error, or of a full response to a range
+			// request, before any of it reaches the file
+
+			long status = 0;
+			curl_easy_getinfo (segment->curl, CURLINFO_RESPONSE_CODE, &status);
+			segment->checked = true;
+
+			if (status >= 300 || (segment->ranged && status != 206)) return 0;
+
+		}
+
+		int64_t offset = segment->start + segment->written;
+
+		if (segment->end >= 0 && offset + (int64_t)length > segment->end + 1) {
+
+			length = (size_t)(segment->end + 1 - offset);
+
+		}
+
+		if (length > 0 && !download->file->Write (buffer, length, offset)) {
+
+			segment->fatal = true;
+			return 0;
+
+		}
+
+		if (download->hash != DOWNLOAD_HASH_NONE && download->hashed == offset) {
+
+			download->digest.Update ((const unsigned char*)buffer, length);
+			download->hashed += length;
+
+		}
+
+		segment->written += length;
+		download->loaded += length;
+
+		download->manager->Progress (download);
+
+		return size * count;
+
+	}
+
+
+}
@@ -0,0 +1,634 @@
+#include <net/curl/HTTPClient.h>
+#include <chrono>
+#include <string.h>
+
+#if defined (__linux__)
+#define LIME_HTTP_CLIENT_EPOLL
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+
+namespace lime {
+
+
+	static const int MAX_EVENTS = 64;
+
+
+	static double Now () {
+
+		return std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+
+	}
+
+
+	HTTPClient::HTTPClient (int maxConnections, CURLShare* share) {
+
+		this->share = share ? share : CURLShare::GetDefault ();
+		this->share->Retain ();
+
+		current = 0;
+		epoll = -1;
+		nextID = 1;
+		stopping = false;
+		timerDeadline = -1;
+		wakeEvent = -1;
+
+		multi = curl_multi_init ();
+
+		if (maxConnections > 0) {
+
+			curl_multi_setopt (multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, (long)maxConnections);
+
+		}
+
+		#ifdef LIME_HTTP_CLIENT_EPOLL
+		epoll = epoll_create1 (EPOLL_CLOEXEC);
+		wakeEvent = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+		struct epoll_event event;
+		memset (&event, 0, sizeof (event));
+		event.events = EPOLLIN;
+		event.data.fd = wakeEvent;
+
+		if (epoll < 0 || wakeEvent < 0 || epoll_ctl (epoll, EPOLL_CTL_ADD, wakeEvent, &event) != 0) {
+
+			// fall back to curl_multi_poll
+
+			if (epoll >= 0) close (epoll);
+			if (wakeEvent >= 0) close (wakeEvent);
+			epoll = -1;
+			wakeEvent = -1;
+
+		} else {
+
+			curl_multi_setopt (multi, CURLMOPT_SOCKETFUNCTION, SocketCallback);
+			curl_multi_setopt (multi, CURLMOPT_SOCKETDATA, this);
+			curl_multi_setopt (multi, CURLMOPT_TIMERFUNCTION, TimerCallback);
+			curl_multi_setopt (multi, CURLMOPT_TIMERDATA, this);
+
+		}
+		#endif
+
+		worker = std::thread (&HTTPClient::Run, this);
+
+	}
+
+
+	HTTPClient::~HTTPClient () {
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			stopping = true;
+
+		}
+
+		Wake ();
+		worker.join ();
+
+		for (std::map<int, Transfer*>::iterator it = active.begin (); it != active.end (); ++it) {
+
+			curl_multi_remove_handle (multi, it->second->curl);
+			Destroy (it->second);
+
+		}
+
+		for (size_t i = 0; i < pending.size (); i++) {
+
+			Destroy (pending[i]);
+
+		}
+
+		for (size_t i = 0; i < messages.size (); i++) {
+
+			delete messages[i];
+
+		}
+
+		delete current;
+
+		curl_multi_cleanup (multi);
+		share->Release ();
+
+		#ifdef LIME_HTTP_CLIENT_EPOLL
+		if (epoll >= 0) close (epoll);
+		if (wakeEvent >= 0) close (wakeEvent);
+		#endif
+
+	}
+
+
+	void HTTPClient::Cancel (int id) {
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			canceled.push_back (id);
+
+		}
+
+		Wake ();
+
+	}
+
+
+	void HTTPClient::Complete (Transfer* transfer, CURLcode result) {
+
+		HTTPClientMessage* message = new HTTPClientMessage ();
+		message->id = transfer->id;
+		message->result = result;
+		message->type = HTTP_CLIENT_COMPLETE;
+
+		long status = 0;
+		curl_easy_getinfo (transfer->curl, CURLINFO_RESPONSE_CODE, &status);
+		message->status = (int)status;
+
+		curl_off_t total = -1;
+		curl_easy_getinfo (transfer->curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &total);
+		message->bytesLoaded = (double)transfer->data.size ();
+		message->bytesTotal = total >= 0 ? (double)total : message->bytesLoaded;
+
+		message->data.swap (transfer->data);
+		message->headers.swap (transfer->responseHeaders);
+
+		if (transfer->flags & HTTP_CLIENT_MANAGE_COOKIES) {
+
+			// cookies only live for the session, the next request with
+			// managed cookies starts from the jar of the last one to finish
+
+			curl_slist* list = NULL;
+
+			if (curl_easy_getinfo (transfer->curl, CURLINFO_COOKIELIST, &list) == CURLE_OK) {
+
+				cookies.clear ();
+
+				for (curl_slist* item = list; item; item = item->next) {
+
+					cookies.push_back (item->data);
+
+				}
+
+				curl_slist_free_all (list);
+
+			}
+
+		}
+
+		active.erase (transfer->id);
+		Destroy (transfer);
+		Post (message);
+
+	}
+
+
+	void HTTPClient::Destroy (Transfer* transfer) {
+
+		curl_easy_cleanup (transfer->curl);
+		curl_slist_free_all (transfer->headers);
+		delete transfer;
+
+	}
+
+
+	size_t HTTPClient::HeaderCallback (char* buffer, size_t size, size_t count, void* userp) {
+
+		Transfer* transfer = (Transfer*)userp;
+		transfer->responseHeaders.append (buffer, size * count);
+		return size * count;
+
+	}
+
+
+	void HTTPClient::Post (HTTPClientMessage* message) {
+
+		std::unique_lock<std::mutex> lock (mutex);
+		messages.push_back (message);
+
+	}
+
+
+	bool HTTPClient::Process () {
+
+		std::vector<Transfer*> added;
+		std::vector<int> removed;
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+
+			if (stopping) return false;
+
+			added.swap (pending);
+			removed.swap (canceled);
+
+		}
+
+		for (size_t i = 0; i < added.size (); i++) {
+
+			Start (added[i]);
+
+		}
+
+		for (size_t i = 0; i < removed.size (); i++) {
+
+			std::map<int, Transfer*>::iterator it = active.find (removed[i]);
+
+			if (it != active.end ()) {
+
+				Transfer* transfer = it->second;
+				active.erase (it);
+
+				curl_multi_remove_handle (multi, transfer->curl);
+				Destroy (transfer);
+
+			}
+
+		}
+
+		return true;
+
+	}
+
+
+	HTTPClientMessage* HTTPClient::Read () {
+
+		delete current;
+		current = 0;
+
+		std::unique_lock<std::mutex> lock (mutex);
+
+		if (!messages.empty ()) {
+
+			current = messages.front ();
+			messages.pop_front ();
+
+		}
+
+		return current;
+
+	}
+
+
+	size_t HTTPClient::ReadCallback (char* buffer, size_t size, size_t count, void* userp) {
+
+		Transfer* transfer = (Transfer*)userp;
+		size_t length = transfer->request.size () - transfer->requestPosition;
+
+		if (length > size * count) length = size * count;
+
+		if (length > 0) {
+
+			memcpy (buffer, &transfer->request[transfer->requestPosition], length);
+			transfer->requestPosition += length;
+
+		}
+
+		return length;
+
+	}
+
+
+	void HTTPClient::ReadMessages () {
+
+		CURLMsg* msg;
+		int queued;
+
+		while ((msg = curl_multi_info_read (multi, &queued))) {
+
+			if (msg->msg != CURLMSG_DONE) continue;
+
+			CURL* curl = msg->easy_handle;
+			CURLcode result = msg->data.result;
+			Transfer* transfer = 0;
+
+			curl_easy_getinfo (curl, CURLINFO_PRIVATE, (char**)&transfer);
+			curl_multi_remove_handle (multi, curl);
+
+			if (transfer) {
+
+				Complete (transfer, result);
+
+			}
+
+		}
+
+	}
+
+
+	int HTTPClient::Request (const char* url, const char* method, curl_slist* headers, const unsigned char* data, int length, int flags, int timeout, double progressInterval) {
+
+		CURL* curl = curl_easy_init ();
+
+		if (!curl) {
+
+			curl_slist_free_all (headers);
+			return -1;
+
+		}
+
+		Transfer* transfer = new Transfer ();
+		transfer->client = this;
+		transfer->curl = curl;
+		transfer->flags = flags;
+		transfer->headers = headers;
+		transfer->lastProgress = 0;
+		transfer->progressInterval = progressInterval * 1000;
+		transfer->progressLoaded = 0;
+		transfer->progressTotal = 0;
+		transfer->requestPosition = 0;
+
+		if (data && length > 0) {
+
+			transfer->request.assign (data, data + length);
+
+		}
+
+		curl_easy_setopt (curl, CURLOPT_URL, url);
+		curl_easy_setopt (curl, CURLOPT_PRIVATE, transfer);
+		curl_easy_setopt (curl, CURLOPT_NOSIGNAL, 1L);
+		curl_easy_setopt (curl, CURLOPT_FOLLOWLOCATION, (flags & HTTP_CLIENT_FOLLOW_REDIRECTS) ? 1L : 0L);
+		curl_easy_setopt (curl, CURLOPT_AUTOREFERER, 1L);
+		curl_easy_setopt (curl, CURLOPT_HTTPHEADER, headers);
+		curl_easy_setopt (curl, CURLOPT_SHARE, share->GetHandle ());
+		curl_easy_setopt (curl, CURLOPT_WRITEFUNCTION, WriteCallback);
+		curl_easy_setopt (curl, CURLOPT_WRITEDATA, transfer);
+
+		// same as the CURL based request backend this replaces
+		curl_easy_setopt (curl, CURLOPT_SSL_VERIFYPEER, 0L);
+		curl_easy_setopt (curl, CURLOPT_SSL_VERIFYHOST, 0L);
+		curl_easy_setopt (curl, CURLOPT_TRANSFERTEXT, (flags & HTTP_CLIENT_TEXT) ? 1L : 0L);
+
+		if (flags & HTTP_CLIENT_RESPONSE_HEADERS) {
+
+			curl_easy_setopt (curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
+			curl_easy_setopt (curl, CURLOPT_HEADERDATA, transfer);
+
+		}
+
+		if (progressInterval >= 0) {
+
+			curl_easy_setopt (curl, CURLOPT_NOPROGRESS, 0L);
+			curl_easy_setopt (curl, CURLOPT_XFERINFOFUNCTION, XferInfoCallback);
+			curl_easy_setopt (curl, CURLOPT_XFERINFODATA, transfer);
+
+		}
+
+		// the previous backend ignored HTTPRequest.timeout, so it only limits
+		// connecting here. A limit on the whole transfer would fail large
+		// downloads that used to complete.
+
+		if (timeout > 0) {
+
+			curl_easy_setopt (curl, CURLOPT_CONNECTTIMEOUT_MS, (long)timeout);
+
+		}
+
+		if (flags & HTTP_CLIENT_NO_BODY) {
+
+			curl_easy_setopt (curl, CURLOPT_NOBODY, 1L);
+
+		} else if (!method || strcmp (method, "GET") == 0) {
+
+			curl_easy_setopt (curl, CURLOPT_HTTPGET, 1L);
+
+		} else if (strcmp (method, "PUT") == 0) {
+
+			curl_easy_setopt (curl, CURLOPT_UPLOAD, 1L);
+			curl_easy_setopt (curl, CURLOPT_READFUNCTION, ReadCallback);
+			curl_easy_setopt (curl, CURLOPT_READDATA, transfer);
+			curl_easy_setopt (curl, CURLOPT_INFILESIZE_LARGE, (curl_off_t)transfer->request.size ());
+
+		} else {
+
+			bool post = strcmp (method, "POST") == 0;
+
+			if (!post) {
+
+				curl_easy_setopt (curl, CURLOPT_CUSTOMREQUEST, method);
+
+			}
+
+			if (post || !transfer->request.empty ()) {
+
+				curl_easy_setopt (curl, CURLOPT_POST, 1L);
+				curl_easy_setopt (curl, CURLOPT_READFUNCTION, ReadCallback);
+				curl_easy_setopt (curl, CURLOPT_READDATA, transfer);
+				curl_easy_setopt (curl, CURLOPT_POSTFIELDSIZE_LARGE, (curl_off_t)transfer->request.size ());
+
+			}
+
+		}
+
+		int id;
+
+		{
+
+			std::unique_lock<std::mutex> lock (mutex);
+			id = nextID++;
+			transfer->id = id;
+			pending.push_back (transfer);
+
+		}
+
+		Wake ();
+		return id;
+
+	}
+
+
+	void HTTPClient::Run () {
+
+		while (Process ()) {
+
+			int running = 0;
+
+			#ifdef LIME_HTTP_CLIENT_EPOLL
+			if (epoll >= 0) {
+
+				int wait = -1;
+
+				if (timerDeadline >= 0) {
+
+					double remaining = timerDeadline - Now ();
+					wait = remaining > 0 ? (int)(remaining + 0.999) : 0;
+
+				}
+
+				struct epoll_event events[MAX_EVENTS];
+				int count = epoll_wait (epoll, events, MAX_EVENTS, wait);
+
+				for (int i = 0; i < count; i++) {
+
+					int socket = events[i].data.fd;
+
+					if (socket == wakeEvent) {
+
+						uint64_t value;
+						while (read (wakeEvent, &value, sizeof (value)) > 0) {}
+						continue;
+
+					}
+
+					int mask = 0;
+					if (events[i].events & EPOLLIN) mask |= CURL_CSELECT_IN;
+					if (events[i].events & EPOLLOUT) mask |= CURL_CSELECT_OUT;
+					if (events[i].events & (EPOLLERR | EPOLLHUP)) mask |= CURL_CSELECT_ERR;
+
+					curl_multi_socket_action (multi, socket, mask, &running);
+
+				}
+
+				double deadline = timerDeadline;
+
+				if (deadline >= 0 && Now () >= deadline) {
+
+					timerDeadline = -1;
+					curl_multi_socket_action (multi, CURL_SOCKET_TIMEOUT, 0, &running);
+
+				}
+
+			} else
+			#endif
+			{
+
+				curl_multi_perform (multi, &running);
+				curl_multi_poll (multi, NULL, 0, 1000, NULL);
+				curl_multi_perform (multi, &running);
+
+			}
+
+			ReadMessages ();
+
+		}
+
+	}
+
+
+	int HTTPClient::SocketCallback (CURL* curl, curl_socket_t socket, int action, void* userp, void* socketp) {
+
+		#ifdef LIME_HTTP_CLIENT_EPOLL
+		HTTPClient* client = (HTTPClient*)userp;
+
+		if (action == CURL_POLL_REMOVE) {
+
+			epoll_ctl (client->epoll, EPOLL_CTL_DEL, socket, NULL);
+			return 0;
+
+		}
+
+		struct epoll_event event;
+		memset (&event, 0, sizeof (event));
+		event.data.fd = socket;
+		if (action & CURL_POLL_IN) event.events |= EPOLLIN;
+		if (action & CURL_POLL_OUT) event.events |= EPOLLOUT;
+
+		if (epoll_ctl (client->epoll, EPOLL_CTL_MOD, socket, &event) != 0) {
+
+			epoll_ctl (client->epoll, EPOLL_CTL_ADD, socket, &event);
+
+		}
+		#endif
+
+		return 0;
+
+	}
+
+
+	void HTTPClient::Start (Transfer* transfer) {
+
+		if (transfer->flags & HTTP_CLIENT_MANAGE_COOKIES) {
+
+			// an empty file name keeps the cookies in memory
+			curl_easy_setopt (transfer->curl, CURLOPT_COOKIEFILE, "");
+
+			for (size_t i = 0; i < cookies.size (); i++) {
+
+				curl_easy_setopt (transfer->curl, CURLOPT_COOKIELIST, cookies[i].c_str ());
+
+			}
+
+		}
+
+		active[transfer->id] = transfer;
+		curl_multi_add_handle (multi, transfer->curl);
+
+	}
+
+
+	int HTTPClient::TimerCallback (CURLM* multi, long timeout, void* userp) {
+
+		HTTPClient* client = (HTTPClient*)userp;
+		client->timerDeadline = timeout < 0 ? -1 : Now () + timeout;
+		return 0;
+
+	}
+
+
+	void HTTPClient::Wake () {
+
+		#ifdef LIME_HTTP_CLIENT_EPOLL
+		if (wakeEvent >= 0) {
+
+			uint64_t value = 1;
+			if (write (wakeEvent, &value, sizeof (value)) < 0) {}
+			return;
+
+		}
+		#endif
+
+		curl_multi_wakeup (multi);
+
+	}
+
+
+	size_t HTTPClient::WriteCallback (char* buffer, size_t size, size_t count, void* userp) {
+
+		Transfer* transfer = (Transfer*)userp;
+		transfer->data.insert (transfer->data.end (), (unsigned char*)buffer, (unsigned char*)buffer + size * count);
+		return size * count;
+
+	}
+
+
+	int HTTPClient::XferInfoCallback (void* userp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t ultotal, curl_off_t ulnow) {
+
+		Transfer* transfer = (Transfer*)userp;
+
+		double loaded = (double)(dlnow > ulnow ? dlnow : ulnow);
+		double total = (double)(dltotal > ultotal ? dltotal : ultotal);
+
+		if (loaded == transfer->progressLoaded && total == transfer->progressTotal) {
+
+			return 0;
+
+		}
+
+		double now = Now ();
+
+		if (now - transfer->lastProgress < transfer->progressInterval) {
+
+			return 0;
+
+		}
+
+		transfer->lastProgress = now;
+		transfer->progressLoaded = loaded;
+		transfer->progressTotal = total;
+
+		HTTPClientMessage* message = new HTTPClientMessage ();
+		message->bytesLoaded = loaded;
+		message->bytesTotal = total;
+		message->id = transfer->id;
+		message->result = CURLE_OK;
+		message->status = 0;
+		message->type = HTTP_CLIENT_PROGRESS;
+
+		transfer->client->Post (message);
+		return 0;
+
+	}
+
+
+}
@@ -0,0 +1,625 @@
+#include <system/AsyncFileReader.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (__linux__) && !defined (__ANDROID__) && defined (__has_include)
+#if __has_include (<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#ifdef IORING_FEAT_RW_CUR_POS
+#define LIME_IO_URING
+#endif
+#endif
+#endif
+
+#ifdef LIME_IO_URING
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef HX_WINDOWS
+#include <codecvt>
+#include <locale>
+#endif
+
+
+namespace lime {
+
+
+	static const int DEFAULT_THREADS = 2;
+	static const unsigned RING_ENTRIES = 64;
+
+
+	static void FreeRequest (AsyncFileRead* request) {
+
+		if (request->data) free (request->data);
+		delete request;
+
+	}
+
+
+	static bool AllocRequest (AsyncFileRead* request, int64_t size) {
+
+		if (request->length < 0) {
+
+			int64_t remaining = size - request->offset;
+			if (remaining > INT_MAX) return false;
+			request->length = remaining > 0 ? (int)remaining : 0;
+
+		}
+
+		request->data = (unsigned char*)malloc (request->length > 0 ? request->length : 1);
+		return request->data != NULL;
+
+	}
+
+
+	static void ReadRequest (AsyncFileRead* request) {
+
+		#ifdef HX_WINDOWS
+		std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
+		FILE* file = ::_wfopen (converter.from_bytes (request->path).c_str (), L"rb");
+		#else
+		FILE* file = ::fopen (request->path.c_str (), "rb");
+		#endif
+
+		request->result = -1;
+
+		if (!file) return;
+
+		#ifdef HX_WINDOWS
+		bool seek = (_fseeki64 (file, 0, SEEK_END) == 0);
+		int64_t size = seek ? _ftelli64 (file) : -1;
+		seek = seek && (_fseeki64 (file, request->offset, SEEK_SET) == 0);
+		#else
+		bool seek = (fseeko (file, 0, SEEK_END) == 0);
+		int64_t size = seek ? (int64_t)ftello (file) : -1;
+		seek = seek && (fseeko (file, request->offset, SEEK_SET) == 0);
+		#endif
+
+		if (seek && size >= 0 && AllocRequest (request, size)) {
+
+			request->position = (int)::fread (request->data, 1, request->length, file);
+
+			if (!ferror (file)) {
+
+				request->result = request->position;
+
+			}
+
+		}
+
+		::fclose (file);
+
+	}
+
+
+	#ifdef LIME_IO_URING
+
+
+	// A minimal io_uring wrapper over the raw syscalls, since liburing is
+	// not part of the build. Submit is called with the reader's mutex held,
+	// and only the completion thread calls Wait and Reap.
+
+	class IORing {
+
+
+		public:
+
+			IORing () : cq (MAP_FAILED), fd (-1), sq (MAP_FAILED), sqes ((io_uring_sqe*)MAP_FAILED) {}
+
+
+			~IORing () {
+
+				if (sqes != MAP_FAILED) munmap (sqes, sqesSize);
+				if (cq != MAP_FAILED && cq != sq) munmap (cq, cqSize);
+				if (sq != MAP_FAILED) munmap (sq, sqSize);
+				if (fd >= 0) close (fd);
+
+			}
+
+
+			bool Init (unsigned entries) {
+
+				io_uring_params params;
+				memset (&params, 0, sizeof (params));
+
+				fd = (int)syscall (__NR_io_uring_setup, entries, &params);
+				if (fd < 0) return false;
+
+				// IORING_OP_READ arrived in the same kernel as this feature
+
+				if (!(params.features & IORING_FEAT_RW_CUR_POS)) return false;
+
+				sqSize = params.sq_off.array + params.sq_entries * sizeof (unsigned);
+				cqSize = params.cq_off.cqes + params.cq_entries * sizeof (io_uring_cqe);
+				sqesSize = params.sq_entries * sizeof (io_uring_sqe);
+
+				if (params.features & IORING_FEAT_SINGLE_MMAP) {
+
+					if (cqSize > sqSize) sqSize = cqSize;
+					cqSize = sqSize;
+
+				}
+
+				sq = mmap (0, sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+				if (sq == MAP_FAILED) return false;
+
+				if (params.features & IORING_FEAT_SINGLE_MMAP) {
+
+					cq = sq;
+
+				} else {
+
+					cq = mmap (0, cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+					if (cq == MAP_FAILED) return false;
+
+				}
+
+				sqes = (io_uring_sqe*)mmap (0, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+				if (sqes == MAP_FAILED) return false;
+
+				sqTail = (unsigned*)((char*)sq + params.sq_off.tail);
+				sqMask = *(unsigned*)((char*)sq + params.sq_off.ring_mask);
+				sqArray = (unsigned*)((char*)sq + params.sq_off.array);
+				cqHead = (unsigned*)((char*)cq + params.cq_off.head);
+				cqTail = (unsigned*)((char*)cq + params.cq_off.tail);
+				cqMask = *(unsigned*)((char*)cq + params.cq_off.ring_mask);
+				cqes = (io_uring_cqe*)((char*)cq + params.cq_off.cqes);
+
+				return true;
+
+			}
+
+
+			void Reap (std::vector<std::pair<AsyncFileRead*, int> >& events) {
+
+				unsigned head = *cqHead;
+				unsigned tail = __atomic_load_n (cqTail, __ATOMIC_ACQUIRE);
+
+				for (; head != tail; head++) {
+
+					io_uring_cqe* cqe = &cqes[head & cqMask];
+					events.push_back (std::make_pair ((AsyncFileRead*)(uintptr_t)cqe->user_data, cqe->res));
+
+				}
+
+				__atomic_store_n (cqHead, head, __ATOMIC_RELEASE);
+
+			}
+
+
+			bool Submit (AsyncFileRead* request) {
+
+				unsigned tail = *sqTail;
+				unsigned index = tail & sqMask;
+				io_uring_sqe* sqe = &sqes[index];
+
+				memset (sqe, 0, sizeof (io_uring_sqe));
+
+				if (request) {
+
+					sqe->opcode = IORING_OP_READ;
+					sqe->fd = request->fd;
+					sqe->addr = (uintptr_t)(request->data + request->position);
+					sqe->len = request->length - request->position;
+					sqe->off = request->offset + request->position;
+					sqe->user_data = (uintptr_t)request;
+
+				} else {
+
+					sqe->opcode = IORING_OP_NOP;
+
+				}
+
+				sqArray[index] = index;
+				__atomic_store_n (sqTail, tail + 1, __ATOMIC_RELEASE);
+
+				int result;
+
+				do {
+
+					result = (int)syscall (__NR_io_uring_enter, fd, 1, 0, 0, NULL, 0);
+
+				} while (result < 0 && errno == EINTR);
+
+				return result == 1;
+
+			}
+
+
+			void Wait () {
+
+				syscall (__NR_io_uring_enter, fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+
+			}
+
+
+		private:
+
+			void* cq;
+			unsigned* cqHead;
+			unsigned cqMask;
+			io_uring_cqe* cqes;
+			size_t cqSize;
+			unsigned* cqTail;
+			int fd;
+			void* sq;
+			unsigned* sqArray;
+			unsigned sqMask;
+			size_t sqSize;
+			unsigned* sqTail;
+			io_uring_sqe* sqes;
+			size_t sqesSize;
+
+
+	};
+
+
+	#else
+
+
+	class IORing {};
+
+
+	#endif
+
+
+	AsyncFileReader::AsyncFileReader (int threads) {
+
+		current = NULL;
+		inFlight = 0;
+		nextID = 0;
+		ring = NULL;
+		stopping = false;
+		waking = false;
+
+		#ifdef LIME_IO_URING
+		ring = new IORing ();
+
+		if (ring->Init (RING_ENTRIES)) {
+
+			workers.push_back (std::thread (&AsyncFileReader::RunRing, this));
+			return;
+
+		}
+
+		delete ring;
+		ring = NULL;
+		#endif
+
+		if (threads <= 0) threads = DEFAULT_THREADS;
+
+		for (int i = 0; i < threads; i++) {
+
+			workers.push_back (std::thread (&AsyncFileReader::Run, this));
+
+		}
+
+	}
+
+
+	AsyncFileReader::~AsyncFileReader () {
+
+		{
+
+			std::lock_guard<std::mutex> lock (mutex);
+			stopping = true;
+
+			#ifdef LIME_IO_URING
+			if (ring && !waking) {
+
+				waking = ring->Submit (NULL);
+
+			}
+			#endif
+
+		}
+
+		condition.notify_all ();
+
+		for (size_t i = 0; i < workers.size (); i++) {
+
+			workers[i].join ();
+
+		}
+
+		#ifdef LIME_IO_URING
+		delete ring;
+		#endif
+
+		for (size_t i = 0; i < pending.size (); i++) {
+
+			FreeRequest (pending[i]);
+
+		}
+
+		for (size_t i = 0; i < completed.size (); i++) {
+
+			FreeRequest (completed[i]);
+
+		}
+
+		if (current) {
+
+			FreeRequest (current);
+
+		}
+
+	}
+
+
+	void AsyncFileReader::Cancel (int id) {
+
+		std::lock_guard<std::mutex> lock (mutex);
+
+		for (std::deque<AsyncFileRead*>::iterator it = pending.begin (); it != pending.end (); it++) {
+
+			if ((*it)->id == id) {
+
+				FreeRequest (*it);
+				pending.erase (it);
+				return;
+
+			}
+
+		}
+
+		canceled.insert (id);
+
+	}
+
+
+	void AsyncFileReader::Complete (AsyncFileRead* request) {
+
+		#ifdef LIME_IO_URING
+		if (request->fd >= 0) {
+
+			close (request->fd);
+			request->fd = -1;
+
+		}
+		#endif
+
+		completed.push_back (request);
+
+	}
+
+
+	AsyncFileRead* AsyncFileReader::Read () {
+
+		std::lock_guard<std::mutex> lock (mutex);
+
+		if (current) {
+
+			FreeRequest (current);
+			current = NULL;
+
+		}
+
+		while (!completed.empty ()) {
+
+			AsyncFileRead* request = completed.front ();
+			completed.pop_front ();
+
+			if (canceled.erase (request->id)) {
+
+				FreeRequest (request);
+				continue;
+
+			}
+
+			current = request;
+			break;
+
+		}
+
+		return current;
+
+	}
+
+
+	void AsyncFileReader::Run () {
+
+		while (true) {
+
+			AsyncFileRead* request;
+
+			{
+
+				std::unique_lock<std::mutex> lock (mutex);
+
+				while (pending.empty () && !stopping) {
+
+					condition.wait (lock);
+
+				}
+
+				if (stopping) break;
+
+				request = pending.front ();
+				pending.pop_front ();
+
+			}
+
+			ReadRequest (request);
+
+			std::lock_guard<std::mutex> lock (mutex);
+			Complete (request);
+
+		}
+
+	}
+
+
+	void AsyncFileReader::RunRing () {
+
+		#ifdef LIME_IO_URING
+		std::vector<std::pair<AsyncFileRead*, int> > events;
+		std::vector<AsyncFileRead*> opening;
+
+		while (true) {
+
+			ring->Wait ();
+			ring->Reap (events);
+
+			std::unique_lock<std::mutex> lock (mutex);
+
+			for (size_t i = 0; i < events.size (); i++) {
+
+				AsyncFileRead* request = events[i].first;
+				int result = events[i].second;
+
+				if (!request) {
+
+					waking = false;
+					continue;
+
+				}
+
+				if (result == -EINTR || result == -EAGAIN) {
+
+					if (SubmitRing (request)) continue;
+					result = -1;
+
+				} else if (result > 0) {
+
+					request->position += result;
+
+					if (request->position < request->length && !stopping) {
+
+						if (SubmitRing (request)) continue;
+						result = -1;
+
+					}
+
+				}
+
+				request->result = (result < 0) ? -1 : request->position;
+				inFlight--;
+				Complete (request);
+
+			}
+
+			events.clear ();
+
+			if (stopping) {
+
+				if (inFlight == 0) break;
+				continue;
+
+			}
+
+			// files are opened here rather than in Submit so a slow open
+			// never blocks the caller
+
+			while (!pending.empty () && inFlight < (int)RING_ENTRIES / 2) {
+
+				opening.push_back (pending.front ());
+				pending.pop_front ();
+				inFlight++;
+
+			}
+
+			if (opening.empty ()) continue;
+
+			lock.unlock ();
+
+			for (size_t i = 0; i < opening.size (); i++) {
+
+				AsyncFileRead* request = opening[i];
+				struct stat info;
+
+				request->fd = open (request->path.c_str (), O_RDONLY | O_CLOEXEC);
+				request->result = -1;
+
+				if (request->fd < 0 || fstat (request->fd, &info) != 0 || !AllocRequest (request, info.st_size)) {
+
+					request->length = 0;
+
+				}
+
+			}
+
+			lock.lock ();
+
+			for (size_t i = 0; i < opening.size (); i++) {
+
+				AsyncFileRead* request = opening[i];
+
+				if (request->fd >= 0 && request->length > 0 && SubmitRing (request)) continue;
+
+				if (request->fd >= 0 && request->data) {
+
+					request->result = 0;
+
+				}
+
+				inFlight--;
+				Complete (request);
+
+			}
+
+			opening.clear ();
+
+		}
+		#endif
+
+	}
+
+
+	int AsyncFileReader::Submit (const char* path, double offset, int length) {
+
+		if (!path || offset < 0) return -1;
+
+		AsyncFileRead* request = new AsyncFileRead ();
+		request->data = NULL;
+		request->fd = -1;
+		request->length = length;
+		request->offset = (int64_t)offset;
+		request->path = path;
+		request->position = 0;
+		request->result = 0;
+
+		std::lock_guard<std::mutex> lock (mutex);
+
+		request->id = nextID++;
+		pending.push_back (request);
+
+		#ifdef LIME_IO_URING
+		if (ring) {
+
+			if (!waking) {
+
+				waking = ring->Submit (NULL);
+
+			}
+
+			return request->id;
+
+		}
+		#endif
+
+		condition.notify_one ();
+		return request->id;
+
+	}
+
+
+	bool AsyncFileReader::SubmitRing (AsyncFileRead* request) {
+
+		#ifdef LIME_IO_URING
+		return ring->Submit (request);
+		#else
+		return false;
+		#endif
+
+	}
+
+
+}
@@ -1,3 +1,4 @@
+#include <app/EventQueue.h>
 #include <system/CFFI.h>
 #include <system/ClipboardEvent.h>
 
@@ -21,6 +22,8 @@ namespace lime {
 
 	void ClipboardEvent::Dispatch (ClipboardEvent* event) {
 
+		EventQueue::Flush ();
+
 		if (ClipboardEvent::callback) {
 
 			if (ClipboardEvent::eventObject->IsCFFIValue ()) {
@@ -1,11 +1,282 @@
 // include order is important
 #include <efsw/efsw.hpp>
 #include <system/FileWatcher.h>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef HX_WINDOWS
+#include <codecvt>
+#include <io.h>
+#include <locale>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
 
 
 namespace lime {
 
 
+	static double Now () {
+
+		return std::chrono::duration<double> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+
+	}
+
+
+	static std::string EventKey (const std::string& dir, const std::string& file) {
+
+		return dir + '\0' + file;
+
+	}
+
+
+	static std::string EventPath (const std::string& dir, const std::string& file) {
+
+		if (dir.empty () || dir[dir.size () - 1] == '/' || dir[dir.size () - 1] == '\\') {
+
+			return dir + file;
+
+		}
+
+		return dir + '/' + file;
+
+	}
+
+
+	static void ListFiles (const std::string& directory, bool recursive, time_t before, std::vector<std::string>& files) {
+
+		// runs on the hashing thread, so it avoids lime's file helpers
+		// for the same reason as HashFile. Only files last written before
+		// the given time are listed.
+
+		#ifdef HX_WINDOWS
+		std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
+		struct _wfinddata64_t data;
+		intptr_t handle = ::_wfindfirst64 (converter.from_bytes (EventPath (directory, "*")).c_str (), &data);
+
+		if (handle == -1) return;
+
+		do {
+
+			std::string name = converter.to_bytes (data.name);
+			if (name == "." || name == "..") continue;
+
+			std::string path = EventPath (directory, name);
+
+			if (data.attrib & _A_SUBDIR) {
+
+				if (recursive) ListFiles (path, recursive, before, files);
+
+			} else if (data.time_write < before) {
+
+				files.push_back (path);
+
+			}
+
+		} while (::_wfindnext64 (handle, &data) == 0);
+
+		::_findclose (handle);
+		#else
+		DIR* dir = ::opendir (directory.c_str ());
+
+		if (!dir) return;
+
+		struct dirent* entry;
+
+		while ((entry = ::readdir (dir))) {
+
+			std::string name = entry->d_name;
+			if (name == "." || name == "..") continue;
+
+			// lstat, so symlinked directories can not send the walk in circles
+			std::string path = EventPath (directory, name);
+			struct stat info;
+
+			if (::lstat (path.c_str (), &info) != 0) continue;
+
+			if (S_ISDIR (info.st_mode)) {
+
+				if (recursive) ListFiles (path, recursive, before, files);
+
+			} else if (S_ISREG (info.st_mode) && info.st_mtime < before) {
+
+				files.push_back (path);
+
+			}
+
+		}
+
+		::closedir (dir);
+		#endif
+
+	}
+
+
+	// XXH64, streamed over the file in fixed-size reads
+
+	static const uint64_t XXH_PRIME1 = 0x9E3779B185EBCA87ULL;
+	static const uint64_t XXH_PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+	static const uint64_t XXH_PRIME3 = 0x165667B19E3779F9ULL;
+	static const uint64_t XXH_PRIME4 = 0x85EBCA77C2B2AE63ULL;
+	static const uint64_t XXH_PRIME5 = 0x27D4EB2F165667C5ULL;
+
+
+	static inline uint64_t XXHRotate (uint64_t value, int bits) {
+
+		return (value << bits) | (value >> (64 - bits));
+
+	}
+
+
+	static inline uint64_t XXHRead64 (const unsigned char* data) {
+
+		uint64_t value = 0;
+
+		for (int i = 7; i >= 0; i--) {
+
+			value = (value << 8) | data[i];
+
+		}
+
+		return value;
+
+	}
+
+
+	static inline uint64_t XXHRead32 (const unsigned char* data) {
+
+		return (uint64_t)data[0] | ((uint64_t)data[1] << 8) | ((uint64_t)data[2] << 16) | ((uint64_t)data[3] << 24);
+
+	}
+
+
+	static inline uint64_t XXHRound (uint64_t acc, uint64_t input) {
+
+		acc += input * XXH_PRIME2;
+		return XXHRotate (acc, 31) * XXH_PRIME1;
+
+	}
+
+
+	static inline uint64_t XXHMerge (uint64_t acc, uint64_t value) {
+
+		acc ^= XXHRound (0, value);
+		return acc * XXH_PRIME1 + XXH_PRIME4;
+
+	}
+
+
+	static bool HashFile (const std::string& path, uint64_t* hash) {
+
+		// lime::fopen enters a GC blocking zone, which is not allowed on
+		// a thread the GC does not know about
+
+		#ifdef HX_WINDOWS
+		std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
+		FILE* file = ::_wfopen (converter.from_bytes (path).c_str (), L"rb");
+		#else
+		FILE* file = ::fopen (path.c_str (), "rb");
+		#endif
+
+		if (!file) return false;
+
+		static const size_t BUFFER_SIZE = 1 << 16;
+		std::vector<unsigned char> buffer (BUFFER_SIZE);
+
+		uint64_t v1 = XXH_PRIME1 + XXH_PRIME2;
+		uint64_t v2 = XXH_PRIME2;
+		uint64_t v3 = 0;
+		uint64_t v4 = -XXH_PRIME1;
+		uint64_t total = 0;
+		size_t filled = 0;
+		size_t read;
+
+		while ((read = ::fread (&buffer[filled], 1, BUFFER_SIZE - filled, file)) > 0) {
+
+			total += read;
+			filled += read;
+
+			const unsigned char* data = &buffer[0];
+			size_t stripes = filled / 32;
+
+			for (size_t i = 0; i < stripes; i++, data += 32) {
+
+				v1 = XXHRound (v1, XXHRead64 (data));
+				v2 = XXHRound (v2, XXHRead64 (data + 8));
+				v3 = XXHRound (v3, XXHRead64 (data + 16));
+				v4 = XXHRound (v4, XXHRead64 (data + 24));
+
+			}
+
+			filled -= stripes * 32;
+
+			if (filled > 0) {
+
+				memmove (&buffer[0], data, filled);
+
+			}
+
+		}
+
+		::fclose (file);
+
+		uint64_t result;
+
+		if (total >= 32) {
+
+			result = XXHRotate (v1, 1) + XXHRotate (v2, 7) + XXHRotate (v3, 12) + XXHRotate (v4, 18);
+			result = XXHMerge (result, v1);
+			result = XXHMerge (result, v2);
+			result = XXHMerge (result, v3);
+			result = XXHMerge (result, v4);
+
+		} else {
+
+			result = XXH_PRIME5;
+
+		}
+
+		result += total;
+
+		const unsigned char* data = &buffer[0];
+
+		for (; filled >= 8; filled -= 8, data += 8) {
+
+			result ^= XXHRound (0, XXHRead64 (data));
+			result = XXHRotate (result, 27) * XXH_PRIME1 + XXH_PRIME4;
+
+		}
+
+		if (filled >= 4) {
+
+			result ^= XXHRead32 (data) * XXH_PRIME1;
+			result = XXHRotate (result, 23) * XXH_PRIME2 + XXH_PRIME3;
+			filled -= 4;
+			data += 4;
+
+		}
+
+		for (; filled > 0; filled--, data++) {
+
+			result ^= (*data) * XXH_PRIME5;
+			result = XXHRotate (result, 11) * XXH_PRIME1;
+
+		}
+
+		result ^= result >> 33;
+		result *= XXH_PRIME2;
+		result ^= result >> 29;
+		result *= XXH_PRIME3;
+		result ^= result >> 32;
+
+		*hash = result;
+		return true;
+
+	}
+
+
 	class UpdateListener : public efsw::FileWatchListener {
 
 		public:
@@ -18,7 +289,7 @@ namespace lime {
 
 			void handleFileAction (efsw::WatchID watchid, const std::string& dir, const std::string& filename, efsw::Action action, std::string oldFilename = "") {
 
-				FileWatcherEvent event = { watchid, std::string (dir.begin (), dir.end ()), std::string (filename.begin (), filename.end ()), action, oldFilename };
+				FileWatcherEvent event = { watchid, std::string (dir.begin (), dir.end ()), std::string (filename.begin (), filename.end ()), action, oldFilename, 0.0 };
 				watcher->QueueEvent (event);
 
 			}
@@ -30,7 +301,11 @@ namespace lime {
 
 	FileWatcher::FileWatcher (value _callback) {
 
+		batchCallback = 0;
 		callback = new AutoGCRoot (_callback);
+		compareContent = false;
+		debounce = 0;
+		hashStopping = false;
 		fileWatcher = new efsw::FileWatcher ();
 		mutex = 0;
 
@@ -39,9 +314,26 @@ namespace lime {
 
 	FileWatcher::~FileWatcher () {
 
+		if (hashThread.joinable ()) {
+
+			hashMutex.lock ();
+			hashStopping = true;
+			hashMutex.unlock ();
+
+			hashCondition.notify_one ();
+			hashThread.join ();
+
+		}
+
 		delete callback;
 		delete (efsw::FileWatcher*)fileWatcher;
 
+		if (batchCallback) {
+
+			delete batchCallback;
+
+		}
+
 		if (mutex) {
 
 			delete mutex;
@@ -61,12 +353,22 @@ namespace lime {
 
 	long FileWatcher::AddDirectory (std::string directory, bool recursive) {
 
+		// taken before the watch exists, so nothing it reports can be seeded
+		time_t started = ::time (NULL);
+
 		UpdateListener* listener = new UpdateListener (this);
-		efsw::WatchID watchID = ((efsw::FileWatcher*)fileWatcher)->addWatch (directory, listener, true);
+		efsw::WatchID watchID = ((efsw::FileWatcher*)fileWatcher)->addWatch (directory, listener, recursive);
 
 		if (watchID >= 0) {
 
 			listeners[watchID] = listener;
+			directories[watchID] = std::make_pair (directory, recursive);
+
+			if (compareContent) {
+
+				SeedHashes (directory, recursive, started);
+
+			}
 
 			if (!mutex) {
 
@@ -82,10 +384,228 @@ namespace lime {
 	}
 
 
+	void FileWatcher::HashEvents () {
+
+		std::vector<FileWatcherEvent> events;
+		std::vector<FileWatcherEvent> changed;
+		std::vector<FileWatcherSeed> seeds;
+		std::vector<std::string> files;
+
+		while (true) {
+
+			{
+
+				std::unique_lock<std::mutex> lock (hashMutex);
+
+				while (hashQueue.empty () && seedQueue.empty () && !hashStopping) {
+
+					hashCondition.wait (lock);
+
+				}
+
+				if (hashStopping) break;
+
+				events.swap (hashQueue);
+				seeds.swap (seedQueue);
+
+			}
+
+			// existing files only fill in hashes that events have not
+			// recorded yet, those are newer. Files written after the seed
+			// was queued are skipped, since the events for those writes
+			// may still be on their way and would match the new bytes.
+
+			for (size_t i = 0; i < seeds.size (); i++) {
+
+				ListFiles (seeds[i].directory, seeds[i].recursive, seeds[i].started, files);
+
+				for (size_t j = 0; j < files.size (); j++) {
+
+					uint64_t hash;
+
+					if (contentHashes.find (files[j]) == contentHashes.end () && HashFile (files[j], &hash)) {
+
+						contentHashes[files[j]] = hash;
+
+					}
+
+				}
+
+				files.clear ();
+
+			}
+
+			seeds.clear ();
+
+			for (size_t i = 0; i < events.size (); i++) {
+
+				FileWatcherEvent& event = events[i];
+				std::string path = EventPath (event.dir, event.file);
+				uint64_t hash;
+
+				switch (event.action) {
+
+					case efsw::Actions::Add:
+					case efsw::Actions::Modified:
+
+						if (HashFile (path, &hash)) {
+
+							std::map<std::string, uint64_t>::iterator it = contentHashes.find (path);
+
+							if (it != contentHashes.end () && it->second == hash) {
+
+								continue;
+
+							}
+
+							contentHashes[path] = hash;
+
+						} else {
+
+							contentHashes.erase (path);
+
+						}
+
+						break;
+
+					case efsw::Actions::Delete:
+
+						contentHashes.erase (path);
+						break;
+
+					case efsw::Actions::Moved:
+
+						contentHashes.erase (EventPath (event.dir, event.oldFile));
+
+						if (HashFile (path, &hash)) {
+
+							contentHashes[path] = hash;
+
+						} else {
+
+							contentHashes.erase (path);
+
+						}
+
+						break;
+
+					default:
+
+						continue;
+
+				}
+
+				changed.push_back (event);
+
+			}
+
+			events.clear ();
+
+			if (changed.size () > 0) {
+
+				hashMutex.lock ();
+				hashed.insert (hashed.end (), changed.begin (), changed.end ());
+				hashMutex.unlock ();
+
+				changed.clear ();
+
+			}
+
+		}
+
+	}
+
+
+	void FileWatcher::IndexQueue () {
+
+		queueIndex.clear ();
+
+		for (size_t i = 0; i < queue.size (); i++) {
+
+			FileWatcherEvent& event = queue[i];
+
+			if (event.action == efsw::Actions::Moved) {
+
+				queueIndex.erase (EventKey (event.dir, event.file));
+				queueIndex.erase (EventKey (event.dir, event.oldFile));
+
+			} else {
+
+				queueIndex[EventKey (event.dir, event.file)] = i;
+
+			}
+
+		}
+
+	}
+
+
 	void FileWatcher::QueueEvent (FileWatcherEvent event) {
 
+		event.time = Now ();
+
 		mutex->Lock ();
-		queue.push_back (event);
+
+		if (event.action == efsw::Actions::Moved) {
+
+			// later events for either path must not merge into entries
+			// from before the move
+
+			queueIndex.erase (EventKey (event.dir, event.file));
+			queueIndex.erase (EventKey (event.dir, event.oldFile));
+			queue.push_back (event);
+
+		} else {
+
+			std::string key = EventKey (event.dir, event.file);
+			std::map<std::string, size_t>::iterator it = queueIndex.find (key);
+
+			if (it == queueIndex.end ()) {
+
+				queueIndex[key] = queue.size ();
+				queue.push_back (event);
+
+			} else {
+
+				FileWatcherEvent& queued = queue[it->second];
+
+				switch (queued.action) {
+
+					case efsw::Actions::Add:
+
+						// the file was never reported, so a delete cancels it
+
+						if (event.action == efsw::Actions::Delete) {
+
+							queued.action = 0;
+
+						}
+
+						break;
+
+					case efsw::Actions::Delete:
+
+						queued.action = (event.action == efsw::Actions::Add) ? efsw::Actions::Modified : event.action;
+						break;
+
+					case efsw::Actions::Modified:
+
+						queued.action = (event.action == efsw::Actions::Delete) ? efsw::Actions::Delete : efsw::Actions::Modified;
+						break;
+
+					default:
+
+						queued.action = event.action;
+						break;
+
+				}
+
+				queued.time = event.time;
+
+			}
+
+		}
+
 		mutex->Unlock ();
 
 	}
@@ -94,6 +614,7 @@ namespace lime {
 	void FileWatcher::RemoveDirectory (long watchID) {
 
 		((efsw::FileWatcher*)fileWatcher)->removeWatch (watchID);
+		directories.erase (watchID);
 
 		if (listeners.find (watchID) != listeners.end ()) {
 
@@ -105,32 +626,184 @@ namespace lime {
 	}
 
 
+	void FileWatcher::SeedHashes (const std::string& directory, bool recursive, time_t started) {
+
+		FileWatcherSeed seed = { directory, recursive, started };
+
+		hashMutex.lock ();
+
+		seedQueue.push_back (seed);
+
+		if (!hashThread.joinable ()) {
+
+			hashThread = std::thread (&FileWatcher::HashEvents, this);
+
+		}
+
+		hashMutex.unlock ();
+
+		hashCondition.notify_one ();
+
+	}
+
+
+	void FileWatcher::SetOptions (double debounce, value batchCallback, bool compareContent) {
+
+		bool seed = compareContent && !this->compareContent;
+		time_t started = ::time (NULL);
+
+		this->compareContent = compareContent;
+		this->debounce = debounce;
+
+		if (seed) {
+
+			for (std::map<long, std::pair<std::string, bool> >::iterator it = directories.begin (); it != directories.end (); ++it) {
+
+				SeedHashes (it->second.first, it->second.second, started);
+
+			}
+
+		}
+
+		if (this->batchCallback) {
+
+			delete this->batchCallback;
+			this->batchCallback = 0;
+
+		}
+
+		if (!val_is_null (batchCallback)) {
+
+			this->batchCallback = new AutoGCRoot (batchCallback);
+
+		}
+
+	}
+
+
 	void FileWatcher::Update () {
 
-		if (mutex) {
+		if (!mutex) return;
+
+		std::vector<FileWatcherEvent> events;
+
+		mutex->Lock ();
+
+		if (queue.size () > 0) {
+
+			if (debounce <= 0) {
+
+				events.swap (queue);
+				queueIndex.clear ();
+
+			} else {
+
+				double settled = Now () - debounce;
+				std::vector<FileWatcherEvent> waiting;
+
+				for (size_t i = 0; i < queue.size (); i++) {
+
+					if (queue[i].time <= settled) {
+
+						events.push_back (queue[i]);
 
-			mutex->Lock ();
+					} else {
 
-			int size = queue.size ();
+						waiting.push_back (queue[i]);
 
-			if (size > 0) {
+					}
 
-				FileWatcherEvent event;
-				value _callback = callback->get ();
+				}
+
+				if (events.size () > 0) {
+
+					queue.swap (waiting);
+					IndexQueue ();
+
+				}
+
+			}
+
+		}
+
+		mutex->Unlock ();
 
-				for (int i = 0; i < size; i++) {
+		if (compareContent || hashThread.joinable ()) {
 
-					event = queue[i];
-					value args[4] = { alloc_string (event.dir.c_str ()), alloc_string (event.file.c_str ()), alloc_int (event.action), alloc_string (event.oldFile.c_str ()) };
-					val_callN (_callback, args, 4);
+			std::vector<FileWatcherEvent> ready;
+
+			hashMutex.lock ();
+
+			ready.swap (hashed);
+
+			if (compareContent && events.size () > 0) {
+
+				hashQueue.insert (hashQueue.end (), events.begin (), events.end ());
+				events.clear ();
+
+				if (!hashThread.joinable ()) {
+
+					hashThread = std::thread (&FileWatcher::HashEvents, this);
 
 				}
 
-				queue.clear ();
+			}
+
+			hashMutex.unlock ();
+
+			hashCondition.notify_one ();
+
+			if (ready.size () > 0) {
+
+				ready.insert (ready.end (), events.begin (), events.end ());
+				events.swap (ready);
 
 			}
 
-			mutex->Unlock ();
+		}
+
+		int size = 0;
+
+		for (size_t i = 0; i < events.size (); i++) {
+
+			if (events[i].action != 0) size++;
+
+		}
+
+		if (size == 0) return;
+
+		if (batchCallback) {
+
+			value result = alloc_array (size * 4);
+			int index = 0;
+
+			for (size_t i = 0; i < events.size (); i++) {
+
+				FileWatcherEvent& event = events[i];
+				if (event.action == 0) continue;
+
+				val_array_set_i (result, index++, alloc_string (event.dir.c_str ()));
+				val_array_set_i (result, index++, alloc_string (event.file.c_str ()));
+				val_array_set_i (result, index++, alloc_int (event.action));
+				val_array_set_i (result, index++, alloc_string (event.oldFile.c_str ()));
+
+			}
+
+			val_call1 (batchCallback->get (), result);
+
+		} else {
+
+			value _callback = callback->get ();
+
+			for (size_t i = 0; i < events.size (); i++) {
+
+				FileWatcherEvent& event = events[i];
+				if (event.action == 0) continue;
+
+				value args[4] = { alloc_string (event.dir.c_str ()), alloc_string (event.file.c_str ()), alloc_int (event.action), alloc_string (event.oldFile.c_str ()) };
+				val_callN (_callback, args, 4);
+
+			}
 
 		}
 
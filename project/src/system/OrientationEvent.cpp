@@ -1,3 +1,4 @@
+#include <app/EventQueue.h>
 #include <system/CFFI.h>
 #include <system/OrientationEvent.h>
 
@@ -25,6 +26,8 @@ namespace lime {
 
 	void OrientationEvent::Dispatch (OrientationEvent* event) {
 
+		EventQueue::Flush ();
+
 		if (OrientationEvent::callback) {
 
 			if (OrientationEvent::eventObject->IsCFFIValue ()) {
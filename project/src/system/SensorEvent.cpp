@@ -1,3 +1,4 @@
+#include <app/EventQueue.h>
 #include <system/CFFI.h>
 #include <system/SensorEvent.h>
 
@@ -29,6 +30,8 @@ namespace lime {
 
 	void SensorEvent::Dispatch (SensorEvent* event) {
 
+		EventQueue::Flush ();
+
 		if (SensorEvent::callback) {
 
 			if (SensorEvent::eventObject->IsCFFIValue ()) {
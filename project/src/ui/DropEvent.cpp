@@ -1,3 +1,4 @@
+#include <app/EventQueue.h>
 #include <system/CFFI.h>
 #include <ui/DropEvent.h>
 
@@ -23,6 +24,8 @@ namespace lime {
 
 	void DropEvent::Dispatch (DropEvent* event) {
 
+		EventQueue::Flush ();
+
 		if (DropEvent::callback) {
 
 			if (DropEvent::eventObject->IsCFFIValue ()) {
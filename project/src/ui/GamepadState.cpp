@@ -0,0 +1,142 @@
+#include <ui/GamepadState.h>
+#include <string.h>
+
+
+namespace lime {
+
+
+	bool GamepadState::axisEvents = true;
+	std::vector<GamepadStateRecord> GamepadState::records;
+
+	static_assert (sizeof (GamepadStateRecord) == 80, "GamepadStateRecord layout changed");
+
+
+	void GamepadState::Connect (int id, int kind) {
+
+		if (Find (id, kind)) return;
+
+		GamepadStateRecord record;
+		memset (&record, 0, sizeof (record));
+		record.id = id;
+		record.kind = kind;
+		records.push_back (record);
+
+	}
+
+
+	void GamepadState::Disconnect (int id, int kind) {
+
+		for (size_t i = 0; i < records.size (); i++) {
+
+			if (records[i].id == id && records[i].kind == kind) {
+
+				records.erase (records.begin () + i);
+				return;
+
+			}
+
+		}
+
+	}
+
+
+	GamepadStateRecord* GamepadState::Find (int id, int kind) {
+
+		for (size_t i = 0; i < records.size (); i++) {
+
+			if (records[i].id == id && records[i].kind == kind) {
+
+				return &records[i];
+
+			}
+
+		}
+
+		return 0;
+
+	}
+
+
+	int GamepadState::Read (GamepadStateRecord* records, int max) {
+
+		int count = (int)GamepadState::records.size ();
+
+		if (records && count > 0) {
+
+			memcpy (records, &GamepadState::records[0], sizeof (GamepadStateRecord) * (count < max ? count : max));
+
+		}
+
+		// the caller grows its buffer when more devices are connected
+		return count;
+
+	}
+
+
+	void GamepadState::SetAxis (int id, int kind, int axis, float value, double timestamp) {
+
+		GamepadStateRecord* record = Find (id, kind);
+
+		if (record && axis >= 0 && axis < 8) {
+
+			record->axes[axis] = value;
+			record->timestamp = timestamp;
+
+		}
+
+	}
+
+
+	void GamepadState::SetButton (int id, int kind, int button, bool down, double timestamp) {
+
+		GamepadStateRecord* record = Find (id, kind);
+
+		if (record && button >= 0 && button < 32) {
+
+			if (down) {
+
+				record->buttons |= (1u << button);
+
+			} else {
+
+				record->buttons &= ~(1u << button);
+
+			}
+
+			record->timestamp = timestamp;
+
+		}
+
+	}
+
+
+	void GamepadState::SetHat (int id, int kind, int hat, int value, double timestamp) {
+
+		GamepadStateRecord* record = Find (id, kind);
+
+		if (record && hat >= 0 && hat < 8) {
+
+			int shift = hat * 4;
+			record->hats = (record->hats & ~(0xFu << shift)) | ((uint32_t)(value & 0xF) << shift);
+			record->timestamp = timestamp;
+
+		}
+
+	}
+
+
+	void GamepadState::SetSensor (int id, int sensor, const float* data, double timestamp) {
+
+		GamepadStateRecord* record = Find (id, GAMEPAD_STATE_GAMEPAD);
+
+		if (record) {
+
+			memcpy (sensor == GAMEPAD_STATE_GYRO ? record->gyro : record->accelerometer, data, sizeof (float) * 3);
+			record->timestamp = timestamp;
+
+		}
+
+	}
+
+
+}
@@ -1,3 +1,4 @@
+#include <app/EventQueue.h>
 #include <system/CFFI.h>
 #include <ui/JoystickEvent.h>
 
@@ -10,6 +11,7 @@ namespace lime {
 	
 	static int id_id;
 	static int id_index;
+	static int id_timestamp;
 	static int id_type;
 	static int id_value;
 	static int id_x;
@@ -24,6 +26,7 @@ namespace lime {
 		eventValue = 0;
 		x = 0;
 		y = 0;
+		timestamp = 0;
 		type = JOYSTICK_AXIS_MOVE;
 		
 	}
@@ -31,6 +34,8 @@ namespace lime {
 	
 	void JoystickEvent::Dispatch (JoystickEvent* event) {
 		
+		EventQueue::Flush ();
+		
 		if (JoystickEvent::callback) {
 			
 			if (JoystickEvent::eventObject->IsCFFIValue ()) {
@@ -39,6 +44,7 @@ namespace lime {
 					
 					id_id = val_id ("id");
 					id_index = val_id ("index");
+					id_timestamp = val_id ("timestamp");
 					id_type = val_id ("type");
 					id_value = val_id ("eventValue");
 					id_x = val_id ("x");
@@ -51,6 +57,7 @@ namespace lime {
 				
 				alloc_field (object, id_id, alloc_int (event->id));
 				alloc_field (object, id_index, alloc_int (event->index));
+				alloc_field (object, id_timestamp, alloc_float (event->timestamp));
 				alloc_field (object, id_type, alloc_int (event->type));
 				alloc_field (object, id_value, alloc_int (event->eventValue));
 				alloc_field (object, id_x, alloc_float (event->x));
@@ -62,6 +69,7 @@ namespace lime {
 				
 				eventObject->id = event->id;
 				eventObject->index = event->index;
+				eventObject->timestamp = event->timestamp;
 				eventObject->type = event->type;
 				eventObject->eventValue = event->eventValue;
 				eventObject->x = event->x;
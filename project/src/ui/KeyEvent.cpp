@@ -1,3 +1,4 @@
+#include <app/EventQueue.h>
 #include <system/CFFI.h>
 #include <ui/KeyEvent.h>
 
@@ -10,6 +11,7 @@ namespace lime {
 
 	static double id_keyCode;
 	static int id_modifier;
+	static int id_timestamp;
 	static int id_type;
 	static int id_windowID;
 	static bool init = false;
@@ -19,6 +21,7 @@ namespace lime {
 
 		keyCode = 0;
 		modifier = 0;
+		timestamp = 0;
 		type = KEY_DOWN;
 		windowID = 0;
 
@@ -27,6 +30,8 @@ namespace lime {
 
 	void KeyEvent::Dispatch (KeyEvent* event) {
 
+		if (EventQueue::Push (event)) return;
+
 		if (KeyEvent::callback) {
 
 			if (KeyEvent::eventObject->IsCFFIValue ()) {
@@ -35,6 +40,7 @@ namespace lime {
 
 					id_keyCode = val_id ("keyCode");
 					id_modifier = val_id ("modifier");
+					id_timestamp = val_id ("timestamp");
 					id_type = val_id ("type");
 					id_windowID = val_id ("windowID");
 					init = true;
@@ -45,6 +51,7 @@ namespace lime {
 
 				alloc_field (object, id_keyCode, alloc_float (event->keyCode));
 				alloc_field (object, id_modifier, alloc_int (event->modifier));
+				alloc_field (object, id_timestamp, alloc_float (event->timestamp));
 				alloc_field (object, id_type, alloc_int (event->type));
 				alloc_field (object, id_windowID, alloc_int (event->windowID));
 
@@ -54,6 +61,7 @@ namespace lime {
 
 				eventObject->keyCode = event->keyCode;
 				eventObject->modifier = event->modifier;
+				eventObject->timestamp = event->timestamp;
 				eventObject->type = event->type;
 				eventObject->windowID = event->windowID;
 
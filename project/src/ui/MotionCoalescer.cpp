@@ -0,0 +1,165 @@
+#include <ui/MotionCoalescer.h>
+#include <string.h>
+
+
+namespace lime {
+
+
+	bool MotionCoalescer::enabled = false;
+	std::vector<MotionSample> MotionCoalescer::history;
+	std::vector<MouseEvent> MotionCoalescer::pendingMouse;
+	std::vector<TouchEvent> MotionCoalescer::pendingTouch;
+	std::vector<MotionSample> MotionCoalescer::recording;
+
+	static_assert (sizeof (MotionSample) == 56, "MotionSample layout changed");
+
+
+	void MotionCoalescer::BeginFrame () {
+
+		history.swap (recording);
+		recording.clear ();
+
+	}
+
+
+	void MotionCoalescer::Flush () {
+
+		if (pendingMouse.empty () && pendingTouch.empty ()) return;
+
+		// copy out first, a listener may cause more motion to be pushed
+
+		std::vector<MouseEvent> mouse;
+		std::vector<TouchEvent> touch;
+		mouse.swap (pendingMouse);
+		touch.swap (pendingTouch);
+
+		for (size_t i = 0; i < mouse.size (); i++) {
+
+			MouseEvent::Dispatch (&mouse[i]);
+
+		}
+
+		for (size_t i = 0; i < touch.size (); i++) {
+
+			TouchEvent::Dispatch (&touch[i]);
+
+		}
+
+		// hand the storage back so the next frame does not allocate
+
+		if (pendingMouse.empty ()) {
+
+			mouse.clear ();
+			pendingMouse.swap (mouse);
+
+		}
+
+		if (pendingTouch.empty ()) {
+
+			touch.clear ();
+			pendingTouch.swap (touch);
+
+		}
+
+	}
+
+
+	int MotionCoalescer::GetHistory (MotionSample* samples, int max) {
+
+		int count = history.size ();
+
+		if (samples && count > 0) {
+
+			memcpy (samples, &history[0], sizeof (MotionSample) * (count < max ? count : max));
+
+		}
+
+		return count;
+
+	}
+
+
+	bool MotionCoalescer::Push (MouseEvent* event, double time) {
+
+		if (!enabled || event->type != MOUSE_MOVE) return false;
+
+		Record (MOTION_SAMPLE_MOUSE, event->windowID, time, event->x, event->y, event->movementX, event->movementY, 0);
+
+		for (size_t i = 0; i < pendingMouse.size (); i++) {
+
+			MouseEvent& pending = pendingMouse[i];
+
+			if (pending.windowID == event->windowID) {
+
+				pending.x = event->x;
+				pending.y = event->y;
+				pending.movementX += event->movementX;
+				pending.movementY += event->movementY;
+				pending.timestamp = event->timestamp;
+				return true;
+
+			}
+
+		}
+
+		pendingMouse.push_back (*event);
+		return true;
+
+	}
+
+
+	bool MotionCoalescer::Push (TouchEvent* event, double time) {
+
+		if (!enabled || event->type != TOUCH_MOVE) return false;
+
+		Record (MOTION_SAMPLE_TOUCH, event->id, time, event->x, event->y, event->dx, event->dy, event->pressure);
+
+		for (size_t i = 0; i < pendingTouch.size (); i++) {
+
+			TouchEvent& pending = pendingTouch[i];
+
+			if (pending.id == event->id && pending.device == event->device) {
+
+				pending.x = event->x;
+				pending.y = event->y;
+				pending.dx += event->dx;
+				pending.dy += event->dy;
+				pending.pressure = event->pressure;
+				pending.timestamp = event->timestamp;
+				return true;
+
+			}
+
+		}
+
+		pendingTouch.push_back (*event);
+		return true;
+
+	}
+
+
+	void MotionCoalescer::Record (int type, int id, double time, double x, double y, double dx, double dy, double pressure) {
+
+		// the history only covers one frame, once it is full the remaining
+		// samples are still coalesced but no longer recorded
+
+		if (recording.size () >= HISTORY_SIZE) return;
+
+		MotionSample sample;
+		memset (&sample, 0, sizeof (MotionSample));
+
+		sample.type = type;
+		sample.id = id;
+		sample.time = time;
+		sample.x = x;
+		sample.y = y;
+		sample.dx = dx;
+		sample.dy = dy;
+		sample.pressure = pressure;
+
+		recording.push_back (sample);
+
+	}
+
+
+}
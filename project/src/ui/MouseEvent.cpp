@@ -1,3 +1,4 @@
+#include <app/EventQueue.h>
 #include <system/CFFI.h>
 #include <ui/MouseEvent.h>
 
@@ -11,6 +12,7 @@ namespace lime {
 	static int id_button;
 	static int id_movementX;
 	static int id_movementY;
+	static int id_timestamp;
 	static int id_type;
 	static int id_windowID;
 	static int id_x;
@@ -29,12 +31,15 @@ namespace lime {
 		movementX = 0.0;
 		movementY = 0.0;
 		clickCount = 0;
+		timestamp = 0;
 
 	}
 
 
 	void MouseEvent::Dispatch (MouseEvent* event) {
 
+		if (EventQueue::Push (event)) return;
+
 		if (MouseEvent::callback) {
 
 			if (MouseEvent::eventObject->IsCFFIValue ()) {
@@ -44,6 +49,7 @@ namespace lime {
 					id_button = val_id ("button");
 					id_movementX = val_id ("movementX");
 					id_movementY = val_id ("movementY");
+					id_timestamp = val_id ("timestamp");
 					id_type = val_id ("type");
 					id_windowID = val_id ("windowID");
 					id_x = val_id ("x");
@@ -67,6 +73,7 @@ namespace lime {
 
 				alloc_field (object, id_movementX, alloc_float (event->movementX));
 				alloc_field (object, id_movementY, alloc_float (event->movementY));
+				alloc_field (object, id_timestamp, alloc_float (event->timestamp));
 				alloc_field (object, id_type, alloc_int (event->type));
 				alloc_field (object, id_windowID, alloc_int (event->windowID));
 				alloc_field (object, id_x, alloc_float (event->x));
@@ -79,6 +86,7 @@ namespace lime {
 				eventObject->button = event->button;
 				eventObject->movementX = event->movementX;
 				eventObject->movementY = event->movementY;
+				eventObject->timestamp = event->timestamp;
 				eventObject->type = event->type;
 				eventObject->windowID = event->windowID;
 				eventObject->x = event->x;
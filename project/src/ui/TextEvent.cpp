@@ -1,3 +1,4 @@
+#include <app/EventQueue.h>
 #include <system/CFFI.h>
 #include <ui/TextEvent.h>
 
@@ -28,6 +29,8 @@ namespace lime {
 
 	void TextEvent::Dispatch (TextEvent* event) {
 
+		EventQueue::Flush ();
+
 		if (TextEvent::callback) {
 
 			if (TextEvent::eventObject->IsCFFIValue ()) {
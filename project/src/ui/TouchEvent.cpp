@@ -1,3 +1,4 @@
+#include <app/EventQueue.h>
 #include <system/CFFI.h>
 #include <ui/TouchEvent.h>
 
@@ -13,6 +14,7 @@ namespace lime {
 	static int id_dy;
 	static int id_id;
 	static int id_pressure;
+	static int id_timestamp;
 	static int id_type;
 	static int id_x;
 	static int id_y;
@@ -29,12 +31,15 @@ namespace lime {
 		dy = 0;
 		pressure = 0;
 		device = 0;
+		timestamp = 0;
 
 	}
 
 
 	void TouchEvent::Dispatch (TouchEvent* event) {
 
+		if (EventQueue::Push (event)) return;
+
 		if (TouchEvent::callback) {
 
 			if (TouchEvent::eventObject->IsCFFIValue ()) {
@@ -46,6 +51,7 @@ namespace lime {
 					id_dy = val_id ("dy");
 					id_id = val_id ("id");
 					id_pressure = val_id ("pressure");
+					id_timestamp = val_id ("timestamp");
 					id_type = val_id ("type");
 					id_x = val_id ("x");
 					id_y = val_id ("y");
@@ -60,6 +66,7 @@ namespace lime {
 				alloc_field (object, id_dy, alloc_float (event->dy));
 				alloc_field (object, id_id, alloc_int (event->id));
 				alloc_field (object, id_pressure, alloc_float (event->pressure));
+				alloc_field (object, id_timestamp, alloc_float (event->timestamp));
 				alloc_field (object, id_type, alloc_int (event->type));
 				alloc_field (object, id_x, alloc_float (event->x));
 				alloc_field (object, id_y, alloc_float (event->y));
@@ -73,6 +80,7 @@ namespace lime {
 				eventObject->dy = event->dy;
 				eventObject->id = event->id;
 				eventObject->pressure = event->pressure;
+				eventObject->timestamp = event->timestamp;
 				eventObject->type = event->type;
 				eventObject->x = event->x;
 				eventObject->y = event->y;
@@ -1,3 +1,4 @@
+#include <app/EventQueue.h>
 #include <system/CFFI.h>
 #include <ui/WindowEvent.h>
 
@@ -32,6 +33,8 @@ namespace lime {
 
 	void WindowEvent::Dispatch (WindowEvent* event) {
 
+		EventQueue::Flush ();
+
 		if (WindowEvent::callback) {
 
 			if (WindowEvent::eventObject->IsCFFIValue ()) {
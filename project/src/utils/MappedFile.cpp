@@ -0,0 +1,261 @@
+#ifdef HX_WINDOWS
+#include <windows.h>
+#include <codecvt>
+#include <locale>
+#include <string>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <system/System.h>
+#include <utils/MappedFile.h>
+#include <stdlib.h>
+#include <map>
+#include <mutex>
+
+
+namespace lime {
+
+
+	// files with live views, by the start of their data, so a view can be
+	// released from nothing but its pointer
+	static std::map<const unsigned char*, MappedFile*> viewFiles;
+	static std::mutex viewMutex;
+
+
+	MappedFile::MappedFile () {
+
+		closed = false;
+		data = NULL;
+		destroyed = false;
+		length = 0;
+		mapped = false;
+		views = 0;
+		#ifdef HX_WINDOWS
+		mapping = NULL;
+		#endif
+
+	}
+
+
+	MappedFile::~MappedFile () {
+
+		Unmap ();
+
+	}
+
+
+	void MappedFile::Close () {
+
+		std::lock_guard<std::mutex> lock (viewMutex);
+
+		if (closed) return;
+
+		closed = true;
+		if (views == 0) Unmap ();
+
+	}
+
+
+	void MappedFile::Destroy () {
+
+		viewMutex.lock ();
+
+		closed = true;
+		destroyed = true;
+
+		if (views > 0) {
+
+			// the last view deletes it
+			viewMutex.unlock ();
+			return;
+
+		}
+
+		viewMutex.unlock ();
+		delete this;
+
+	}
+
+
+	void MappedFile::ReleaseView (const void* pointer) {
+
+		std::lock_guard<std::mutex> lock (viewMutex);
+
+		const unsigned char* address = (const unsigned char*)pointer;
+		std::map<const unsigned char*, MappedFile*>::iterator it = viewFiles.upper_bound (address);
+
+		if (it == viewFiles.begin ()) return;
+
+		--it;
+		MappedFile* file = it->second;
+
+		if (address >= file->data + file->length || --file->views > 0) return;
+
+		viewFiles.erase (it);
+
+		if (file->destroyed) {
+
+			delete file;
+
+		} else if (file->closed) {
+
+			file->Unmap ();
+
+		}
+
+	}
+
+
+	bool MappedFile::RetainView () {
+
+		std::lock_guard<std::mutex> lock (viewMutex);
+
+		if (closed || !data || length <= 0) return false;
+
+		if (views++ == 0) viewFiles[data] = this;
+		return true;
+
+	}
+
+
+	void MappedFile::Unmap () {
+
+		if (data) {
+
+			if (mapped) {
+
+				#ifdef HX_WINDOWS
+				UnmapViewOfFile (data);
+				#else
+				munmap (data, length);
+				#endif
+
+			} else {
+
+				free (data);
+
+			}
+
+		}
+
+		#ifdef HX_WINDOWS
+		if (mapping) CloseHandle ((HANDLE)mapping);
+		mapping = NULL;
+		#endif
+
+		data = NULL;
+		length = 0;
+		mapped = false;
+
+	}
+
+
+	MappedFile* MappedFile::Open (const char* path) {
+
+		if (!path) return NULL;
+
+		MappedFile* file = new MappedFile ();
+
+		#ifdef HX_WINDOWS
+		std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
+		std::wstring wpath = converter.from_bytes (path);
+
+		HANDLE handle = CreateFileW (wpath.c_str (), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+		if (handle != INVALID_HANDLE_VALUE) {
+
+			LARGE_INTEGER size;
+
+			if (GetFileSizeEx (handle, &size) && size.QuadPart > 0) {
+
+				file->mapping = CreateFileMappingW (handle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+
+				if (file->mapping) {
+
+					file->data = (unsigned char*)MapViewOfFile ((HANDLE)file->mapping, FILE_MAP_COPY, 0, 0, 0);
+
+				}
+
+			}
+
+			CloseHandle (handle);
+
+			if (file->data) {
+
+				file->length = size.QuadPart;
+				file->mapped = true;
+				return file;
+
+			}
+
+			file->Unmap ();
+
+		}
+		#else
+		int fd = ::open (path, O_RDONLY | O_CLOEXEC);
+
+		if (fd > -1) {
+
+			struct stat info;
+
+			if (fstat (fd, &info) == 0 && info.st_size > 0) {
+
+				void* data = mmap (NULL, info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+				if (data != MAP_FAILED) {
+
+					file->data = (unsigned char*)data;
+					file->length = info.st_size;
+					file->mapped = true;
+
+				}
+
+			}
+
+			::close (fd);
+
+			if (file->mapped) return file;
+
+		}
+		#endif
+
+		// fall back to reading the file, which also resolves bundle and
+		// APK paths the same way other asset loads do
+
+		FILE_HANDLE* handle = lime::fopen (path, "rb");
+
+		if (handle) {
+
+			lime::fseek (handle, 0, SEEK_END);
+			long size = lime::ftell (handle);
+			lime::fseek (handle, 0, SEEK_SET);
+
+			file->data = (unsigned char*)malloc (size > 0 ? size : 1);
+
+			if (file->data && size > 0 && lime::fread (file->data, 1, size, handle) == (size_t)size) {
+
+				file->length = size;
+
+			} else if (size != 0) {
+
+				file->Unmap ();
+
+			}
+
+			lime::fclose (handle);
+
+			if (file->data) return file;
+
+		}
+
+		delete file;
+		return NULL;
+
+	}
+
+
+}
@@ -0,0 +1,376 @@
+#include <graphics/format/JPEG.h>
+#include <graphics/format/PNG.h>
+#include <media/containers/OGG.h>
+#include <media/containers/WAV.h>
+#include <utils/compress/Zlib.h>
+#include <utils/compress/Zstd.h>
+#include <utils/PackedAssetLoader.h>
+#include <utils/Resource.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef LIME_ZLIB
+#include <zlib.h>
+#endif
+
+
+namespace lime {
+
+
+	static void FreeLoad (PackedAssetLoad* load) {
+
+		// Bytes only release memory they allocated themselves once it has
+		// been passed to Haxe, so decoded buffers are emptied explicitly
+
+		if (load->data) free (load->data);
+
+		if (load->image) {
+
+			if (load->image->data) load->image->data->Resize (0);
+			delete load->image;
+
+		}
+
+		if (load->audio) {
+
+			if (load->audio->data) load->audio->data->Resize (0);
+			delete load->audio;
+
+		}
+
+		delete load;
+
+	}
+
+
+	static bool Inflate (PackedAssetLoad* load) {
+
+		#ifdef LIME_ZLIB
+		int windowBits = (load->compression == GZIP ? 31 : -15);
+		int size = 0;
+
+		// gzip streams end with their size, which lets the output be
+		// allocated once. Raw deflate streams start from an estimate.
+
+		if (load->compression == GZIP && load->sourceLength >= 18) {
+
+			const unsigned char* trailer = load->source + load->sourceLength - 4;
+			size = trailer[0] | (trailer[1] << 8) | (trailer[2] << 16) | ((unsigned int)trailer[3] << 24);
+
+		}
+
+		if (size <= 0) {
+
+			size = load->sourceLength < (1 << 14) ? (1 << 16) : load->sourceLength * 4;
+
+		}
+
+		z_stream stream;
+		memset (&stream, 0, sizeof (z_stream));
+
+		if (inflateInit2 (&stream, windowBits) != Z_OK) {
+
+			return false;
+
+		}
+
+		unsigned char* data = (unsigned char*)malloc (size);
+		int ret = data ? Z_OK : Z_MEM_ERROR;
+
+		stream.next_in = (Bytef*)load->source;
+		stream.avail_in = load->sourceLength;
+
+		while (ret == Z_OK) {
+
+			if (stream.total_out == (uLong)size) {
+
+				if (size > (1 << 30)) {
+
+					ret = Z_MEM_ERROR;
+					break;
+
+				}
+
+				unsigned char* resized = (unsigned char*)realloc (data, size * 2);
+
+				if (!resized) {
+
+					ret = Z_MEM_ERROR;
+					break;
+
+				}
+
+				data = resized;
+				size *= 2;
+
+			}
+
+			stream.next_out = data + stream.total_out;
+			stream.avail_out = size - stream.total_out;
+
+			ret = inflate (&stream, Z_NO_FLUSH);
+
+			if (ret == Z_BUF_ERROR && stream.avail_out > 0) {
+
+				// the input ended before the stream did
+				break;
+
+			}
+
+			if (ret == Z_BUF_ERROR) ret = Z_OK;
+
+		}
+
+		inflateEnd (&stream);
+
+		if (ret != Z_STREAM_END) {
+
+			free (data);
+			return false;
+
+		}
+
+		load->data = data;
+		load->length = stream.total_out;
+		return true;
+		#else
+		return false;
+		#endif
+
+	}
+
+
+	static bool Decompress (PackedAssetLoad* load) {
+
+		#ifdef LIME_ZSTD
+		load->data = Zstd::Decompress (load->source, load->sourceLength, &load->length);
+		return load->data != NULL;
+		#else
+		return false;
+		#endif
+
+	}
+
+
+	static void Process (PackedAssetLoad* load) {
+
+		bool unpacked = true;
+
+		if (load->compression == PACKED_ASSET_ZSTD) {
+
+			unpacked = Decompress (load);
+
+		} else if (load->compression >= 0) {
+
+			unpacked = Inflate (load);
+
+		}
+
+		if (!unpacked) {
+
+			load->length = -1;
+			return;
+
+		}
+
+		if (load->decode == PACKED_ASSET_BYTES) {
+
+			if (!load->data) load->length = load->sourceLength;
+			return;
+
+		}
+
+		Bytes bytes;
+		bytes.b = load->data ? load->data : (unsigned char*)load->source;
+		bytes.length = load->data ? load->length : load->sourceLength;
+
+		Resource resource = Resource (&bytes);
+		bool decoded = false;
+
+		if (load->decode == PACKED_ASSET_IMAGE) {
+
+			load->image = new ImageBuffer (alloc_null ());
+			load->image->data = new ArrayBufferView (alloc_null ());
+
+			#ifdef LIME_PNG
+			decoded = PNG::Decode (&resource, load->image);
+			#endif
+
+			#ifdef LIME_JPEG
+			if (!decoded) decoded = JPEG::Decode (&resource, load->image);
+			#endif
+
+		} else if (load->decode == PACKED_ASSET_AUDIO) {
+
+			load->audio = new AudioBuffer (alloc_null ());
+			load->audio->data = new ArrayBufferView (alloc_null ());
+
+			decoded = WAV::Decode (&resource, load->audio);
+
+			#ifdef LIME_OGG
+			if (!decoded) decoded = OGG::Decode (&resource, load->audio);
+			#endif
+
+		}
+
+		bytes.b = 0;
+
+		// the decoded buffer replaces the inflated entry
+		if (load->data) free (load->data);
+		load->data = NULL;
+		load->length = decoded ? 0 : -1;
+
+	}
+
+
+	PackedAssetLoader::PackedAssetLoader (int threads) {
+
+		current = NULL;
+		nextID = 0;
+		stopping = false;
+
+		// Image and audio buffers look up their field IDs the first time
+		// they are created, which has to happen here rather than on a worker
+
+		ImageBuffer image (alloc_null ());
+		image.data = new ArrayBufferView (alloc_null ());
+		AudioBuffer audio (alloc_null ());
+		audio.data = NULL;
+
+		if (threads <= 0) {
+
+			threads = std::thread::hardware_concurrency ();
+			if (threads > 1) threads--;
+			if (threads <= 0) threads = 1;
+
+		}
+
+		for (int i = 0; i < threads; i++) {
+
+			workers.push_back (std::thread (&PackedAssetLoader::Run, this));
+
+		}
+
+	}
+
+
+	PackedAssetLoader::~PackedAssetLoader () {
+
+		{
+
+			std::lock_guard<std::mutex> lock (mutex);
+			stopping = true;
+
+		}
+
+		condition.notify_all ();
+
+		for (size_t i = 0; i < workers.size (); i++) {
+
+			workers[i].join ();
+
+		}
+
+		for (size_t i = 0; i < pending.size (); i++) {
+
+			FreeLoad (pending[i]);
+
+		}
+
+		for (size_t i = 0; i < completed.size (); i++) {
+
+			FreeLoad (completed[i]);
+
+		}
+
+		if (current) {
+
+			FreeLoad (current);
+
+		}
+
+	}
+
+
+	PackedAssetLoad* PackedAssetLoader::Read () {
+
+		std::lock_guard<std::mutex> lock (mutex);
+
+		if (current) {
+
+			FreeLoad (current);
+			current = NULL;
+
+		}
+
+		if (!completed.empty ()) {
+
+			current = completed.front ();
+			completed.pop_front ();
+
+		}
+
+		return current;
+
+	}
+
+
+	void PackedAssetLoader::Run () {
+
+		while (true) {
+
+			PackedAssetLoad* load;
+
+			{
+
+				std::unique_lock<std::mutex> lock (mutex);
+
+				while (pending.empty () && !stopping) {
+
+					condition.wait (lock);
+
+				}
+
+				if (stopping) break;
+
+				load = pending.front ();
+				pending.pop_front ();
+
+			}
+
+			Process (load);
+
+			std::lock_guard<std::mutex> lock (mutex);
+			completed.push_back (load);
+
+		}
+
+	}
+
+
+	int PackedAssetLoader::Submit (const unsigned char* source, int length, int compression, int decode) {
+
+		if (!source || length < 0) return -1;
+
+		PackedAssetLoad* load = new PackedAssetLoad ();
+		load->audio = NULL;
+		load->compression = (compression == PACKED_ASSET_DEFLATE || compression == PACKED_ASSET_GZIP || compression == PACKED_ASSET_ZSTD) ? compression : -1;
+		load->data = NULL;
+		load->decode = decode;
+		load->image = NULL;
+		load->length = 0;
+		load->source = source;
+		load->sourceLength = length;
+
+		std::lock_guard<std::mutex> lock (mutex);
+
+		load->id = nextID++;
+		pending.push_back (load);
+
+		condition.notify_one ();
+		return load->id;
+
+	}
+
+
+}
@@ -0,0 +1,147 @@
+#include <utils/compress/Zstd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zstd.h>
+
+
+namespace lime {
+
+
+	void Zstd::Compress (Bytes* data, Bytes* result) {
+
+		size_t bound = ZSTD_compressBound (data->length);
+		unsigned char* buffer = (unsigned char*)malloc (bound);
+
+		if (!buffer) {
+
+			result->Resize (0);
+			return;
+
+		}
+
+		// packs are compressed once and read many times, so this favours
+		// size over speed. Decoding is equally fast at any level.
+		size_t size = ZSTD_compress (buffer, bound, data->b, data->length, 19);
+
+		if (ZSTD_isError (size)) {
+
+			size = 0;
+
+		}
+
+		result->Resize (size);
+		if (size > 0) memcpy (result->b, buffer, size);
+		free (buffer);
+
+	}
+
+
+	void Zstd::Decompress (Bytes* data, Bytes* result) {
+
+		unsigned long long size = ZSTD_getFrameContentSize (data->b, data->length);
+
+		if (size != ZSTD_CONTENTSIZE_UNKNOWN && size != ZSTD_CONTENTSIZE_ERROR && size < (1u << 31)) {
+
+			result->Resize ((int)size);
+
+			if (ZSTD_isError (ZSTD_decompress (result->b, (size_t)size, data->b, data->length))) {
+
+				result->Resize (0);
+
+			}
+
+			return;
+
+		}
+
+		int length = 0;
+		unsigned char* buffer = Decompress (data->b, data->length, &length);
+
+		result->Resize (buffer ? length : 0);
+		if (buffer && length > 0) memcpy (result->b, buffer, length);
+		if (buffer) free (buffer);
+
+	}
+
+
+	unsigned char* Zstd::Decompress (const unsigned char* data, int length, int* resultLength) {
+
+		unsigned long long frameSize = ZSTD_getFrameContentSize (data, length);
+
+		if (frameSize == ZSTD_CONTENTSIZE_ERROR || (frameSize != ZSTD_CONTENTSIZE_UNKNOWN && frameSize >= (1u << 31))) {
+
+			return NULL;
+
+		}
+
+		// frames written by Compress carry their size, so the output is
+		// allocated once. Streamed frames start from an estimate.
+
+		size_t size = frameSize != ZSTD_CONTENTSIZE_UNKNOWN ? (size_t)frameSize : (length < (1 << 14) ? (1 << 16) : (size_t)length * 4);
+		unsigned char* buffer = (unsigned char*)malloc (size > 0 ? size : 1);
+
+		if (!buffer) return NULL;
+
+		if (frameSize != ZSTD_CONTENTSIZE_UNKNOWN) {
+
+			if (ZSTD_isError (ZSTD_decompress (buffer, size, data, length))) {
+
+				free (buffer);
+				return NULL;
+
+			}
+
+			*resultLength = (int)size;
+			return buffer;
+
+		}
+
+		ZSTD_DStream* stream = ZSTD_createDStream ();
+		ZSTD_inBuffer input = { data, (size_t)length, 0 };
+		ZSTD_outBuffer output = { buffer, size, 0 };
+		size_t ret = stream ? 1 : 0;
+
+		while (ret != 0) {
+
+			if (output.pos == output.size) {
+
+				unsigned char* resized = size <= (1u << 30) ? (unsigned char*)realloc (buffer, size * 2) : NULL;
+
+				if (!resized) break;
+
+				buffer = resized;
+				size *= 2;
+				output.dst = buffer;
+				output.size = size;
+
+			}
+
+			ret = ZSTD_decompressStream (stream, &output, &input);
+
+			if (ZSTD_isError (ret)) break;
+
+			if (ret != 0 && input.pos == input.size && output.pos < output.size) {
+
+				// the input ended before the frame did
+				break;
+
+			}
+
+		}
+
+		if (stream) ZSTD_freeDStream (stream);
+
+		if (ret != 0) {
+
+			free (buffer);
+			return NULL;
+
+		}
+
+		*resultLength = (int)output.pos;
+		return buffer;
+
+	}
+
+
+}
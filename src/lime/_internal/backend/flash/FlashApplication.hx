@@ -3,8 +3,11 @@ package lime._internal.backend.flash;
 import flash.ui.MultitouchInputMode;
 import flash.ui.Multitouch;
 import lime.app.Application;
+import lime.app.FramePacing;
+import lime.app.FrameStats;
 import lime.media.AudioManager;
 import lime.system.Orientation;
+import lime.ui.MotionSample;
 import lime.ui.Window;
 
 @:access(lime.app.Application)
@@ -12,6 +15,11 @@ class FlashApplication
 {
 	private static var createFirstWindow:Bool;
 
+	public var fixedTimeStep:Float = 0;
+	public var framePacing:FramePacing = PRECISE;
+	public var motionCoalescing:Bool = false;
+	public var preciseInput:Bool = false;
+
 	private var parent:Application;
 	private var requestedWindow:Bool;
 
@@ -36,6 +44,38 @@ class FlashApplication
 
 	public function exit():Void {}
 
+	public function getFrameStats():FrameStats
+	{
+		return null;
+	}
+
+	public function getMotionHistory(samples:Array<MotionSample>):Array<MotionSample>
+	{
+		if (samples == null) return [];
+		samples.splice(0, samples.length);
+		return samples;
+	}
+
+	public function setFixedTimeStep(value:Float):Float
+	{
+		return fixedTimeStep = value;
+	}
+
+	public function setFramePacing(value:FramePacing):FramePacing
+	{
+		return framePacing = value;
+	}
+
+	public function setMotionCoalescing(value:Bool):Bool
+	{
+		return motionCoalescing = value;
+	}
+
+	public function setPreciseInput(value:Bool):Bool
+	{
+		return preciseInput = value;
+	}
+
 	public function getDeviceOrientation():Orientation
 	{
 		return UNKNOWN;
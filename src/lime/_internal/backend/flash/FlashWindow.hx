@@ -15,6 +15,7 @@ import flash.ui.Mouse;
 import flash.ui.MouseCursor as FlashMouseCursor;
 import flash.Lib;
 import lime.app.Application;
+import lime.app.Future;
 import lime.graphics.Image;
 import lime.graphics.RenderContext;
 import lime.graphics.RenderContextAttributes;
@@ -61,6 +62,8 @@ class FlashWindow
 		create();
 	}
 
+	public function addDirtyRect(rect:Rectangle):Void {}
+
 	public function alert(message:String, title:String):Void {}
 
 	public function close():Void
@@ -582,8 +585,27 @@ class FlashWindow
 		return textInputEnabled;
 	}
 
+	public function injectKeyDown(keyCode:KeyCode, modifier:KeyModifier):Void {}
+
+	public function injectKeyUp(keyCode:KeyCode, modifier:KeyModifier):Void {}
+
+	public function injectMouseDown(x:Float, y:Float, button:MouseButton):Void {}
+
+	public function injectMouseMove(x:Float, y:Float):Void {}
+
+	public function injectMouseUp(x:Float, y:Float, button:MouseButton):Void {}
+
+	public function injectMouseWheel(deltaX:Float, deltaY:Float):Void {}
+
+	public function injectTextInput(text:String):Void {}
+
 	public function move(x:Int, y:Int):Void {}
 
+	public function readPixelsAsync(rect:Rectangle):Future<Image>
+	{
+		return Future.withValue(readPixels(rect));
+	}
+
 	public function resize(width:Int, height:Int):Void {}
 
 	public function setMinSize(width:Int, height:Int):Void {}
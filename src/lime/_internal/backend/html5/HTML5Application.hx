@@ -4,6 +4,8 @@ import js.html.DeviceMotionEvent;
 import js.html.KeyboardEvent;
 import js.Browser;
 import lime.app.Application;
+import lime.app.FramePacing;
+import lime.app.FrameStats;
 import lime.media.AudioManager;
 import lime.system.Orientation;
 import lime.system.Sensor;
@@ -14,6 +16,7 @@ import lime.ui.KeyModifier;
 import lime.ui.Gamepad;
 import lime.ui.GamepadButton;
 import lime.ui.Joystick;
+import lime.ui.MotionSample;
 import lime.ui.Window;
 
 @:access(lime._internal.backend.html5.HTML5Window)
@@ -37,6 +40,11 @@ class HTML5Application
 	private var stats:Dynamic;
 	#end
 
+	public var fixedTimeStep:Float = 0;
+	public var framePacing:FramePacing = PRECISE;
+	public var motionCoalescing:Bool = false;
+	public var preciseInput:Bool = false;
+
 	public inline function new(parent:Application)
 	{
 		this.parent = parent;
@@ -351,6 +359,38 @@ class HTML5Application
 
 	public function exit():Void {}
 
+	public function getFrameStats():FrameStats
+	{
+		return null;
+	}
+
+	public function getMotionHistory(samples:Array<MotionSample>):Array<MotionSample>
+	{
+		if (samples == null) return [];
+		samples.splice(0, samples.length);
+		return samples;
+	}
+
+	public function setFixedTimeStep(value:Float):Float
+	{
+		return fixedTimeStep = value;
+	}
+
+	public function setFramePacing(value:FramePacing):FramePacing
+	{
+		return framePacing = value;
+	}
+
+	public function setMotionCoalescing(value:Bool):Bool
+	{
+		return motionCoalescing = value;
+	}
+
+	public function setPreciseInput(value:Bool):Bool
+	{
+		return preciseInput = value;
+	}
+
 	public function getDeviceOrientation():Orientation
 	{
 		if (Browser.window.screen.orientation != null)
@@ -19,6 +19,7 @@ import js.html.ClipboardEvent;
 import js.Browser;
 import lime._internal.graphics.ImageCanvasUtil;
 import lime.app.Application;
+import lime.app.Future;
 import lime.graphics.opengl.GL;
 import lime.graphics.Image;
 import lime.graphics.OpenGLRenderContext;
@@ -31,6 +32,9 @@ import lime.system.System;
 import lime.system.Clipboard;
 import lime.ui.Gamepad;
 import lime.ui.Joystick;
+import lime.ui.KeyCode;
+import lime.ui.KeyModifier;
+import lime.ui.MouseButton;
 import lime.ui.MouseCursor;
 import lime.ui.MouseWheelMode;
 import lime.ui.Touch;
@@ -243,6 +247,8 @@ class HTML5Window
 		}
 	}
 
+	public function addDirtyRect(rect:Rectangle):Void {}
+
 	public function alert(message:String, title:String):Void
 	{
 		if (message != null)
@@ -996,6 +1002,20 @@ class HTML5Window
 		return false;
 	}
 
+	public function injectKeyDown(keyCode:KeyCode, modifier:KeyModifier):Void {}
+
+	public function injectKeyUp(keyCode:KeyCode, modifier:KeyModifier):Void {}
+
+	public function injectMouseDown(x:Float, y:Float, button:MouseButton):Void {}
+
+	public function injectMouseMove(x:Float, y:Float):Void {}
+
+	public function injectMouseUp(x:Float, y:Float, button:MouseButton):Void {}
+
+	public function injectMouseWheel(deltaX:Float, deltaY:Float):Void {}
+
+	public function injectTextInput(text:String):Void {}
+
 	public function move(x:Int, y:Int):Void {}
 
 	public function readPixels(rect:Rectangle):Image
@@ -1031,6 +1051,11 @@ class HTML5Window
 		return null;
 	}
 
+	public function readPixelsAsync(rect:Rectangle):Future<Image>
+	{
+		return Future.withValue(readPixels(rect));
+	}
+
 	public function resize(width:Int, height:Int):Void {}
 
 	public function setMinSize(width:Int, height:Int):Void {}
@@ -1,8 +1,11 @@
 package lime._internal.backend.native;
 
+import haxe.io.Bytes;
 import haxe.Timer;
 import lime._internal.backend.native.NativeCFFI;
 import lime.app.Application;
+import lime.app.FramePacing;
+import lime.app.FrameStats;
 import lime.graphics.opengl.GL;
 import lime.graphics.OpenGLRenderContext;
 import lime.graphics.RenderContext;
@@ -22,6 +25,7 @@ import lime.ui.Joystick;
 import lime.ui.JoystickHatPosition;
 import lime.ui.KeyCode;
 import lime.ui.KeyModifier;
+import lime.ui.MotionSample;
 import lime.ui.Touch;
 import lime.ui.Window;
 
@@ -48,6 +52,9 @@ class NativeApplication
 	private var clipboardEventInfo = new ClipboardEventInfo();
 	private var currentTouches = new Map<Int, Touch>();
 	private var dropEventInfo = new DropEventInfo();
+	#if lime_batch_events
+	private var eventQueue = Bytes.alloc(65536);
+	#end
 	private var gamepadEventInfo = new GamepadEventInfo();
 	private var joystickEventInfo = new JoystickEventInfo();
 	private var keyEventInfo = new KeyEventInfo();
@@ -60,12 +67,17 @@ class NativeApplication
 	private var unusedTouchesPool = new List<Touch>();
 	private var windowEventInfo = new WindowEventInfo();
 
+	public var fixedTimeStep:Float = 0;
+	public var framePacing:FramePacing = PRECISE;
 	public var handle:Dynamic;
+	public var motionCoalescing:Bool = false;
+	public var preciseInput:Bool = #if lime_precise_input true #else false #end;
 
 	#if (android && !macro)
 	private var deviceOrientationListener:OrientationChangeListener;
 	#end
 
+	private var motionHistory:Bytes;
 	private var pauseTimer:Int;
 	private var parent:Application;
 	private var toggleFullscreen:Bool;
@@ -97,6 +109,16 @@ class NativeApplication
 		#end
 
 		#if (!macro && lime_cffi)
+		#if (lime_headless && sys)
+		// read by the native application before SDL is initialized
+		Sys.putEnv("LIME_HEADLESS", "1");
+		#end
+
+		#if (lime_precise_input && sys)
+		// the joystick thread has to be requested before SDL is initialized
+		Sys.putEnv("LIME_PRECISE_INPUT", "1");
+		#end
+
 		handle = NativeCFFI.lime_application_create();
 		#end
 	}
@@ -131,6 +153,9 @@ class NativeApplication
 		NativeCFFI.lime_text_event_manager_register(handleTextEvent, textEventInfo);
 		NativeCFFI.lime_touch_event_manager_register(handleTouchEvent, touchEventInfo);
 		NativeCFFI.lime_window_event_manager_register(handleWindowEvent, windowEventInfo);
+		#if lime_batch_events
+		NativeCFFI.lime_event_queue_register(handleEventQueue, eventQueue);
+		#end
 		#if (ios || android)
 		NativeCFFI.lime_orientation_event_manager_register(handleOrientationEvent, orientationEventInfo);
 		#end
@@ -191,6 +216,95 @@ class NativeApplication
 		#end
 	}
 
+	public function getFrameStats():FrameStats
+	{
+		#if (!macro && lime_cffi)
+		return NativeCFFI.lime_application_get_frame_stats(handle);
+		#else
+		return null;
+		#end
+	}
+
+	public function getMotionHistory(samples:Array<MotionSample>):Array<MotionSample>
+	{
+		if (samples == null) samples = [];
+		var count = 0;
+
+		#if (!macro && lime_cffi)
+		// 56 byte records, see project/include/ui/MotionCoalescer.h
+
+		if (motionHistory == null) motionHistory = Bytes.alloc(56 * 64);
+		count = NativeCFFI.lime_motion_coalescer_get_history(motionHistory);
+
+		if (count * 56 > motionHistory.length)
+		{
+			motionHistory = Bytes.alloc(count * 56);
+			count = NativeCFFI.lime_motion_coalescer_get_history(motionHistory);
+		}
+
+		for (i in 0...count)
+		{
+			var sample = samples[i];
+
+			if (sample == null)
+			{
+				sample = samples[i] = new MotionSample();
+			}
+
+			var position = i * 56;
+			sample.touch = (motionHistory.get(position) == 1);
+			sample.id = motionHistory.getInt32(position + 4);
+			sample.time = motionHistory.getDouble(position + 8);
+			sample.x = motionHistory.getDouble(position + 16);
+			sample.y = motionHistory.getDouble(position + 24);
+			sample.dx = motionHistory.getDouble(position + 32);
+			sample.dy = motionHistory.getDouble(position + 40);
+			sample.pressure = motionHistory.getDouble(position + 48);
+		}
+		#end
+
+		if (samples.length > count) samples.splice(count, samples.length - count);
+		return samples;
+	}
+
+	public function setFixedTimeStep(value:Float):Float
+	{
+		if (value < 0) value = 0;
+
+		#if (!macro && lime_cffi)
+		NativeCFFI.lime_application_set_fixed_time_step(handle, value);
+		#end
+
+		return fixedTimeStep = value;
+	}
+
+	public function setFramePacing(value:FramePacing):FramePacing
+	{
+		#if (!macro && lime_cffi)
+		NativeCFFI.lime_application_set_frame_pacing(handle, value);
+		#end
+
+		return framePacing = value;
+	}
+
+	public function setMotionCoalescing(value:Bool):Bool
+	{
+		#if (!macro && lime_cffi)
+		NativeCFFI.lime_motion_coalescer_set_enabled(value);
+		#end
+
+		return motionCoalescing = value;
+	}
+
+	public function setPreciseInput(value:Bool):Bool
+	{
+		#if (!macro && lime_cffi)
+		NativeCFFI.lime_application_set_precise_input(handle, value);
+		#end
+
+		return preciseInput = value;
+	}
+
 	private function handleApplicationEvent():Void
 	{
 		switch (applicationEventInfo.type)
@@ -222,8 +336,68 @@ class NativeApplication
 		}
 	}
 
+	#if lime_batch_events
+	private function handleEventQueue():Void
+	{
+		// key, mouse and touch events of a frame arrive together as fixed
+		// size records, see project/include/app/EventQueue.h for the layout
+
+		var count = eventQueue.getInt32(0);
+		var position = 4;
+
+		for (i in 0...count)
+		{
+			switch (eventQueue.get(position))
+			{
+				case EventRecordType.KEY:
+					keyEventInfo.type = cast eventQueue.get(position + 1);
+					keyEventInfo.windowID = eventQueue.getInt32(position + 4);
+					keyEventInfo.modifier = eventQueue.getInt32(position + 8);
+					keyEventInfo.keyCode = eventQueue.getDouble(position + 16);
+					keyEventInfo.timestamp = eventQueue.getDouble(position + 24);
+					position += 32;
+
+					handleKeyEvent();
+
+				case EventRecordType.MOUSE:
+					mouseEventInfo.type = cast eventQueue.get(position + 1);
+					mouseEventInfo.windowID = eventQueue.getInt32(position + 4);
+					mouseEventInfo.button = eventQueue.getInt32(position + 8);
+					mouseEventInfo.clickCount = eventQueue.getInt32(position + 12);
+					mouseEventInfo.x = eventQueue.getDouble(position + 16);
+					mouseEventInfo.y = eventQueue.getDouble(position + 24);
+					mouseEventInfo.movementX = eventQueue.getDouble(position + 32);
+					mouseEventInfo.movementY = eventQueue.getDouble(position + 40);
+					mouseEventInfo.timestamp = eventQueue.getDouble(position + 48);
+					position += 56;
+
+					handleMouseEvent();
+
+				case EventRecordType.TOUCH:
+					touchEventInfo.type = cast eventQueue.get(position + 1);
+					touchEventInfo.id = eventQueue.getInt32(position + 4);
+					touchEventInfo.device = eventQueue.getInt32(position + 8);
+					touchEventInfo.x = eventQueue.getDouble(position + 16);
+					touchEventInfo.y = eventQueue.getDouble(position + 24);
+					touchEventInfo.dx = eventQueue.getDouble(position + 32);
+					touchEventInfo.dy = eventQueue.getDouble(position + 40);
+					touchEventInfo.pressure = eventQueue.getDouble(position + 48);
+					touchEventInfo.timestamp = eventQueue.getDouble(position + 56);
+					position += 64;
+
+					handleTouchEvent();
+
+				default:
+					return;
+			}
+		}
+	}
+	#end
+
 	private function handleGamepadEvent():Void
 	{
+		parent.eventTimestamp = gamepadEventInfo.timestamp;
+
 		switch (gamepadEventInfo.type)
 		{
 			case AXIS_MOVE:
@@ -248,6 +422,8 @@ class NativeApplication
 
 	private function handleJoystickEvent():Void
 	{
+		parent.eventTimestamp = joystickEventInfo.timestamp;
+
 		switch (joystickEventInfo.type)
 		{
 			case AXIS_MOVE:
@@ -276,6 +452,8 @@ class NativeApplication
 
 	private function handleKeyEvent():Void
 	{
+		parent.eventTimestamp = keyEventInfo.timestamp;
+
 		var window = parent.__windowByID.get(keyEventInfo.windowID);
 
 		if (window != null)
@@ -357,6 +535,8 @@ class NativeApplication
 
 	private function handleMouseEvent():Void
 	{
+		parent.eventTimestamp = mouseEventInfo.timestamp;
+
 		var window = parent.__windowByID.get(mouseEventInfo.windowID);
 
 		if (window != null)
@@ -492,6 +672,8 @@ class NativeApplication
 
 	private function handleTouchEvent():Void
 	{
+		parent.eventTimestamp = touchEventInfo.timestamp;
+
 		switch (touchEventInfo.type)
 		{
 			case TOUCH_START:
@@ -577,6 +759,8 @@ class NativeApplication
 					window.onEnter.dispatch();
 
 				case WINDOW_EXPOSE:
+					// the window contents were lost, present everything on the next frame
+					window.__backend.presentFullFrame = true;
 					window.onExpose.dispatch();
 
 				case WINDOW_FOCUS_IN:
@@ -750,19 +934,21 @@ private enum abstract DropEventType(Int)
 	public var id:Int;
 	public var type:GamepadEventType;
 	public var axisValue:Float;
+	public var timestamp:Float;
 
-	public function new(type:GamepadEventType = null, id:Int = 0, button:Int = 0, axis:Int = 0, value:Float = 0)
+	public function new(type:GamepadEventType = null, id:Int = 0, button:Int = 0, axis:Int = 0, value:Float = 0, timestamp:Float = 0)
 	{
 		this.type = type;
 		this.id = id;
 		this.button = button;
 		this.axis = axis;
 		this.axisValue = value;
+		this.timestamp = timestamp;
 	}
 
 	public function clone():GamepadEventInfo
 	{
-		return new GamepadEventInfo(type, id, button, axis, axisValue);
+		return new GamepadEventInfo(type, id, button, axis, axisValue, timestamp);
 	}
 }
 
@@ -783,8 +969,9 @@ private enum abstract GamepadEventType(Int)
 	public var eventValue:Int;
 	public var x:Float;
 	public var y:Float;
+	public var timestamp:Float;
 
-	public function new(type:JoystickEventType = null, id:Int = 0, index:Int = 0, value:Int = 0, x:Float = 0, y:Float = 0)
+	public function new(type:JoystickEventType = null, id:Int = 0, index:Int = 0, value:Int = 0, x:Float = 0, y:Float = 0, timestamp:Float = 0)
 	{
 		this.type = type;
 		this.id = id;
@@ -792,11 +979,12 @@ private enum abstract GamepadEventType(Int)
 		this.eventValue = value;
 		this.x = x;
 		this.y = y;
+		this.timestamp = timestamp;
 	}
 
 	public function clone():JoystickEventInfo
 	{
-		return new JoystickEventInfo(type, id, index, eventValue, x, y);
+		return new JoystickEventInfo(type, id, index, eventValue, x, y, timestamp);
 	}
 }
 
@@ -816,21 +1004,32 @@ private enum abstract JoystickEventType(Int)
 	public var modifier:Int;
 	public var type:KeyEventType;
 	public var windowID:Int;
+	public var timestamp:Float;
 
-	public function new(type:KeyEventType = null, windowID:Int = 0, keyCode:Float = 0, modifier:Int = 0)
+	public function new(type:KeyEventType = null, windowID:Int = 0, keyCode:Float = 0, modifier:Int = 0, timestamp:Float = 0)
 	{
 		this.type = type;
 		this.windowID = windowID;
 		this.keyCode = keyCode;
 		this.modifier = modifier;
+		this.timestamp = timestamp;
 	}
 
 	public function clone():KeyEventInfo
 	{
-		return new KeyEventInfo(type, windowID, keyCode, modifier);
+		return new KeyEventInfo(type, windowID, keyCode, modifier, timestamp);
 	}
 }
 
+#if lime_batch_events
+private enum abstract EventRecordType(Int) from Int to Int
+{
+	var KEY = 0;
+	var MOUSE = 1;
+	var TOUCH = 2;
+}
+#end
+
 private enum abstract KeyEventType(Int)
 {
 	var KEY_DOWN = 0;
@@ -847,9 +1046,10 @@ private enum abstract KeyEventType(Int)
 	public var x:Float;
 	public var y:Float;
 	public var clickCount:Int;
+	public var timestamp:Float;
 
 	public function new(type:MouseEventType = null, windowID:Int = 0, x:Float = 0, y:Float = 0, button:Int = 0, movementX:Float = 0, movementY:Float = 0,
-			clickCount:Int = 0)
+			clickCount:Int = 0, timestamp:Float = 0)
 	{
 		this.type = type;
 		this.windowID = 0;
@@ -859,11 +1059,12 @@ private enum abstract KeyEventType(Int)
 		this.movementX = movementX;
 		this.movementY = movementY;
 		this.clickCount = clickCount;
+		this.timestamp = timestamp;
 	}
 
 	public function clone():MouseEventInfo
 	{
-		return new MouseEventInfo(type, windowID, x, y, button, movementX, movementY, clickCount);
+		return new MouseEventInfo(type, windowID, x, y, button, movementX, movementY, clickCount, timestamp);
 	}
 }
 
@@ -965,8 +1166,10 @@ private enum abstract TextEventType(Int)
 	public var type:TouchEventType;
 	public var x:Float;
 	public var y:Float;
+	public var timestamp:Float;
 
-	public function new(type:TouchEventType = null, x:Float = 0, y:Float = 0, id:Int = 0, dx:Float = 0, dy:Float = 0, pressure:Float = 0, device:Int = 0)
+	public function new(type:TouchEventType = null, x:Float = 0, y:Float = 0, id:Int = 0, dx:Float = 0, dy:Float = 0, pressure:Float = 0, device:Int = 0,
+			timestamp:Float = 0)
 	{
 		this.type = type;
 		this.x = x;
@@ -976,11 +1179,12 @@ private enum abstract TextEventType(Int)
 		this.dy = dy;
 		this.pressure = pressure;
 		this.device = device;
+		this.timestamp = timestamp;
 	}
 
 	public function clone():TouchEventInfo
 	{
-		return new TouchEventInfo(type, x, y, id, dx, dy, pressure, device);
+		return new TouchEventInfo(type, x, y, id, dx, dy, pressure, device, timestamp);
 	}
 }
 
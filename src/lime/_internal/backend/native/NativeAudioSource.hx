@@ -9,6 +9,7 @@ import lime.media.openal.ALSource;
 import lime.media.vorbis.VorbisFile;
 import lime.media.AudioManager;
 import lime.media.AudioSource;
+import lime.media.WAVStream;
 import lime.utils.UInt8Array;
 
 #if !lime_debug
@@ -102,12 +103,20 @@ class NativeAudioSource
 			}
 		}
 
-		if (parent.buffer.__srcVorbisFile != null)
+		if (parent.buffer.__srcVorbisFile != null || parent.buffer.__srcWAVStream != null)
 		{
 			stream = true;
 
-			var vorbisFile = parent.buffer.__srcVorbisFile;
-			dataLength = Std.int(Int64.toInt(vorbisFile.pcmTotal()) * parent.buffer.channels * (parent.buffer.bitsPerSample / 8));
+			if (parent.buffer.__srcWAVStream != null)
+			{
+				var wavStream = parent.buffer.__srcWAVStream;
+				dataLength = Std.int(wavStream.length * parent.buffer.channels * (parent.buffer.bitsPerSample / 8));
+			}
+			else
+			{
+				var vorbisFile = parent.buffer.__srcVorbisFile;
+				dataLength = Std.int(Int64.toInt(vorbisFile.pcmTotal()) * parent.buffer.channels * (parent.buffer.bitsPerSample / 8));
+			}
 
 			buffers = new Array();
 			bufferTimeBlocks = new Array();
@@ -215,6 +224,31 @@ class NativeAudioSource
 		}
 	}
 
+	private function getStreamPosition():Int
+	{
+		if (parent.buffer.__srcWAVStream != null)
+		{
+			var wavStream = parent.buffer.__srcWAVStream;
+			return Std.int(wavStream.tell() * parent.buffer.channels * (parent.buffer.bitsPerSample / 8));
+		}
+
+		#if lime_vorbis
+		return Int64.toInt(parent.buffer.__srcVorbisFile.pcmTell());
+		#else
+		return 0;
+		#end
+	}
+
+	private function readStreamBuffer(length:Int):UInt8Array
+	{
+		if (parent.buffer.__srcWAVStream != null)
+		{
+			return readWAVStreamBuffer(parent.buffer.__srcWAVStream, length);
+		}
+
+		return readVorbisFileBuffer(parent.buffer.__srcVorbisFile, length);
+	}
+
 	private function readVorbisFileBuffer(vorbisFile:VorbisFile, length:Int):UInt8Array
 	{
 		#if lime_vorbis
@@ -254,10 +288,28 @@ class NativeAudioSource
 		#end
 	}
 
+	private function readWAVStreamBuffer(wavStream:WAVStream, length:Int):UInt8Array
+	{
+		var buffer = new UInt8Array(length);
+
+		for (i in 0...STREAM_NUM_BUFFERS - 1)
+		{
+			bufferTimeBlocks[i] = bufferTimeBlocks[i + 1];
+		}
+		bufferTimeBlocks[STREAM_NUM_BUFFERS - 1] = wavStream.tell() / parent.buffer.sampleRate;
+
+		var total = wavStream.read(buffer.buffer, 0, length);
+
+		if (total < length)
+		{
+			return buffer.subarray(0, total);
+		}
+
+		return buffer;
+	}
+
 	private function refillBuffers(buffers:Array<ALBuffer> = null):Void
 	{
-		#if lime_vorbis
-		var vorbisFile = null;
 		var position = 0;
 
 		if (buffers == null)
@@ -266,8 +318,7 @@ class NativeAudioSource
 
 			if (buffersProcessed > 0)
 			{
-				vorbisFile = parent.buffer.__srcVorbisFile;
-				position = Int64.toInt(vorbisFile.pcmTell());
+				position = getStreamPosition();
 
 				if (position < dataLength)
 				{
@@ -275,15 +326,13 @@ class NativeAudioSource
 				}
 			}
 		}
+		else
+		{
+			position = getStreamPosition();
+		}
 
 		if (buffers != null)
 		{
-			if (vorbisFile == null)
-			{
-				vorbisFile = parent.buffer.__srcVorbisFile;
-				position = Int64.toInt(vorbisFile.pcmTell());
-			}
-
 			var numBuffers = 0;
 			var data;
 
@@ -291,14 +340,14 @@ class NativeAudioSource
 			{
 				if (dataLength - position >= STREAM_BUFFER_SIZE)
 				{
-					data = readVorbisFileBuffer(vorbisFile, STREAM_BUFFER_SIZE);
+					data = readStreamBuffer(STREAM_BUFFER_SIZE);
 					AL.bufferData(buffer, format, data, data.length, parent.buffer.sampleRate);
 					position += STREAM_BUFFER_SIZE;
 					numBuffers++;
 				}
 				else if (position < dataLength)
 				{
-					data = readVorbisFileBuffer(vorbisFile, dataLength - position);
+					data = readStreamBuffer(dataLength - position);
 					AL.bufferData(buffer, format, data, data.length, parent.buffer.sampleRate);
 					numBuffers++;
 					break;
@@ -316,7 +365,6 @@ class NativeAudioSource
 				AL.sourcePlay(handle);
 			}
 		}
-		#end
 	}
 
 	public function stop():Void
@@ -411,7 +459,15 @@ class NativeAudioSource
 			{
 				AL.sourceStop(handle);
 
-				parent.buffer.__srcVorbisFile.timeSeek((value + parent.offset) / 1000);
+				if (parent.buffer.__srcWAVStream != null)
+				{
+					parent.buffer.__srcWAVStream.seek(Math.ffloor((value + parent.offset) / 1000 * parent.buffer.sampleRate));
+				}
+				else
+				{
+					parent.buffer.__srcVorbisFile.timeSeek((value + parent.offset) / 1000);
+				}
+
 				AL.sourceUnqueueBuffers(handle, STREAM_NUM_BUFFERS);
 				refillBuffers(buffers);
 
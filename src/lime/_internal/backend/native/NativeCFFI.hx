@@ -61,18 +61,38 @@ class NativeCFFI
 
 	@:cffi private static function lime_application_exec(handle:Dynamic):Int;
 
+	@:cffi private static function lime_application_get_frame_stats(handle:Dynamic):Dynamic;
+
 	@:cffi private static function lime_application_init(handle:Dynamic):Void;
 
 	@:cffi private static function lime_application_quit(handle:Dynamic):Int;
 
+	@:cffi private static function lime_application_set_fixed_time_step(handle:Dynamic, step:Float):Void;
+
+	@:cffi private static function lime_application_set_frame_pacing(handle:Dynamic, policy:Int):Void;
+
 	@:cffi private static function lime_application_set_frame_rate(handle:Dynamic, value:Float):Void;
 
+	@:cffi private static function lime_application_set_precise_input(handle:Dynamic, value:Bool):Void;
+
 	@:cffi private static function lime_application_update(handle:Dynamic):Bool;
 
+	@:cffi private static function lime_async_file_reader_cancel(handle:CFFIPointer, id:Int):Void;
+
+	@:cffi private static function lime_async_file_reader_create(threads:Int):CFFIPointer;
+
+	@:cffi private static function lime_async_file_reader_read(handle:CFFIPointer):Dynamic;
+
+	@:cffi private static function lime_async_file_reader_read_data(handle:CFFIPointer, bytes:Dynamic):Void;
+
+	@:cffi private static function lime_async_file_reader_submit(handle:CFFIPointer, path:String, offset:Float, length:Int):Int;
+
 	@:cffi private static function lime_audio_load(data:Dynamic, buffer:Dynamic):Dynamic;
 
 	@:cffi private static function lime_audio_load_bytes(data:Dynamic, buffer:Dynamic):Dynamic;
 
+	@:cffi private static function lime_audio_load_data_pointer(data:Float, length:Int, buffer:Dynamic):Dynamic;
+
 	@:cffi private static function lime_audio_load_file(path:Dynamic, buffer:Dynamic):Dynamic;
 
 	@:cffi private static function lime_bytes_from_data_pointer(data:Float, length:Int, bytes:Dynamic):Dynamic;
@@ -99,6 +119,8 @@ class NativeCFFI
 
 	@:cffi private static function lime_drop_event_manager_register(callback:Dynamic, eventObject:Dynamic):Void;
 
+	@:cffi private static function lime_event_queue_register(callback:Dynamic, buffer:Dynamic):Void;
+
 	@:cffi private static function lime_file_dialog_open_directory(title:String, filter:String, defaultPath:String):Dynamic;
 
 	@:cffi private static function lime_file_dialog_open_file(title:String, filter:String, defaultPath:String):Dynamic;
@@ -113,6 +135,9 @@ class NativeCFFI
 
 	@:cffi private static function lime_file_watcher_remove_directory(handle:CFFIPointer, watchID:Dynamic):Void;
 
+	@:cffi private static function lime_file_watcher_set_options(handle:CFFIPointer, debounce:Float, batchCallback:Dynamic,
+		compareContent:Bool):Void;
+
 	@:cffi private static function lime_file_watcher_update(handle:CFFIPointer):Void;
 
 	@:cffi private static function lime_font_get_ascender(handle:Dynamic):Int;
@@ -141,6 +166,8 @@ class NativeCFFI
 
 	@:cffi private static function lime_font_load_bytes(data:Dynamic):Dynamic;
 
+	@:cffi private static function lime_font_load_data_pointer(data:Float, length:Int):Dynamic;
+
 	@:cffi private static function lime_font_load_file(path:Dynamic):Dynamic;
 
 	@:cffi private static function lime_font_outline_decompose(handle:Dynamic, size:Int):Dynamic;
@@ -159,6 +186,12 @@ class NativeCFFI
 
 	@:cffi private static function lime_gamepad_event_manager_register(callback:Dynamic, eventObject:Dynamic):Void;
 
+	@:cffi private static function lime_gamepad_get_states(buffer:Dynamic):Int;
+
+	@:cffi private static function lime_gamepad_set_axis_events(enabled:Bool):Void;
+
+	@:cffi private static function lime_gamepad_set_motion_sensors(enabled:Bool):Void;
+
 	@:cffi private static function lime_gzip_compress(data:Dynamic, bytes:Dynamic):Dynamic;
 
 	@:cffi private static function lime_gzip_decompress(data:Dynamic, bytes:Dynamic):Dynamic;
@@ -171,6 +204,8 @@ class NativeCFFI
 
 	@:cffi private static function lime_image_load_bytes(data:Dynamic, buffer:Dynamic):Dynamic;
 
+	@:cffi private static function lime_image_load_data_pointer(data:Float, length:Int, buffer:Dynamic):Dynamic;
+
 	@:cffi private static function lime_image_load_file(path:Dynamic, buffer:Dynamic):Dynamic;
 
 	@:cffi private static function lime_image_data_util_color_transform(image:Dynamic, rect:Dynamic, colorMatrix:Dynamic):Void;
@@ -229,12 +264,38 @@ class NativeCFFI
 
 	@:cffi private static function lime_lzma_decompress(data:Dynamic, bytes:Dynamic):Dynamic;
 
+	@:cffi private static function lime_mapped_file_close(handle:CFFIPointer):Void;
+
+	@:cffi private static function lime_mapped_file_get_data_pointer(handle:CFFIPointer):Float;
+
+	@:cffi private static function lime_mapped_file_get_length(handle:CFFIPointer):Float;
+
+	@:cffi private static function lime_mapped_file_open(path:String):CFFIPointer;
+
+	@:cffi private static function lime_mapped_file_release_view(data:Float):Void;
+
+	@:cffi private static function lime_mapped_file_retain_view(handle:CFFIPointer):Bool;
+
+	@:cffi private static function lime_motion_coalescer_get_history(buffer:Dynamic):Int;
+
+	@:cffi private static function lime_motion_coalescer_set_enabled(enabled:Bool):Void;
+
 	@:cffi private static function lime_mouse_event_manager_register(callback:Dynamic, eventObject:Dynamic):Void;
 
 	@:cffi private static function lime_neko_execute(module:String):Void;
 
 	@:cffi private static function lime_orientation_event_manager_register(callback:Dynamic, eventObject:Dynamic):Void;
 
+	@:cffi private static function lime_packed_asset_loader_create(threads:Int):CFFIPointer;
+
+	@:cffi private static function lime_packed_asset_loader_read(handle:CFFIPointer):Dynamic;
+
+	@:cffi private static function lime_packed_asset_loader_read_audio(handle:CFFIPointer, buffer:Dynamic):Dynamic;
+
+	@:cffi private static function lime_packed_asset_loader_read_image(handle:CFFIPointer, buffer:Dynamic):Dynamic;
+
+	@:cffi private static function lime_packed_asset_loader_submit(handle:CFFIPointer, data:Float, length:Int, compression:Int, decode:Int):Int;
+
 	@:cffi private static function lime_png_decode_bytes(data:Dynamic, decodeData:Bool, buffer:Dynamic):Dynamic;
 
 	@:cffi private static function lime_png_decode_file(path:String, decodeData:Bool, buffer:Dynamic):Dynamic;
@@ -277,6 +338,16 @@ class NativeCFFI
 
 	@:cffi private static function lime_touch_event_manager_register(callback:Dynamic, eventObject:Dynamic):Void;
 
+	@:cffi private static function lime_wav_stream_from_file(path:String):Dynamic;
+
+	@:cffi private static function lime_wav_stream_info(handle:Dynamic):Dynamic;
+
+	@:cffi private static function lime_wav_stream_read(handle:Dynamic, buffer:Dynamic, position:Int, length:Int):Int;
+
+	@:cffi private static function lime_wav_stream_seek(handle:Dynamic, frame:Float):Bool;
+
+	@:cffi private static function lime_wav_stream_tell(handle:Dynamic):Float;
+
 	@:cffi private static function lime_window_alert(handle:Dynamic, message:String, title:String):Void;
 
 	@:cffi private static function lime_window_close(handle:Dynamic):Void;
@@ -319,10 +390,20 @@ class NativeCFFI
 
 	@:cffi private static function lime_window_get_y(handle:Dynamic):Int;
 
+	@:cffi private static function lime_window_inject_key_event(handle:Dynamic, type:Int, keyCode:Int, modifier:Int):Void;
+
+	@:cffi private static function lime_window_inject_mouse_event(handle:Dynamic, type:Int, x:Float, y:Float, button:Int):Void;
+
+	@:cffi private static function lime_window_inject_text_event(handle:Dynamic, text:String):Void;
+
 	@:cffi private static function lime_window_move(handle:Dynamic, x:Int, y:Int):Void;
 
 	@:cffi private static function lime_window_read_pixels(handle:Dynamic, rect:Dynamic, imageBuffer:Dynamic):Dynamic;
 
+	@:cffi private static function lime_window_read_pixels_async(handle:Dynamic, rect:Dynamic):Int;
+
+	@:cffi private static function lime_window_read_pixels_async_result(handle:Dynamic, id:Int, imageBuffer:Dynamic):Int;
+
 	@:cffi private static function lime_window_resize(handle:Dynamic, width:Int, height:Int):Void;
 
 	@:cffi private static function lime_window_set_minimum_size(handle:Dynamic, width:Int, height:Int):Void;
@@ -333,6 +414,8 @@ class NativeCFFI
 
 	@:cffi private static function lime_window_set_cursor(handle:Dynamic, cursor:Int):Void;
 
+	@:cffi private static function lime_window_set_dirty_rects(handle:Dynamic, rects:DataPointer, count:Int):Void;
+
 	@:cffi private static function lime_window_set_display_mode(handle:Dynamic, displayMode:Dynamic):Dynamic;
 
 	@:cffi private static function lime_window_set_fullscreen(handle:Dynamic, fullscreen:Bool):Bool;
@@ -366,19 +449,43 @@ class NativeCFFI
 	@:cffi private static function lime_zlib_compress(data:Dynamic, bytes:Dynamic):Dynamic;
 
 	@:cffi private static function lime_zlib_decompress(data:Dynamic, bytes:Dynamic):Dynamic;
+
+	@:cffi private static function lime_zstd_compress(data:Dynamic, bytes:Dynamic):Dynamic;
+
+	@:cffi private static function lime_zstd_decompress(data:Dynamic, bytes:Dynamic):Dynamic;
 	#else
 	private static var lime_application_create = new cpp.Callable<Void->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_application_create", "o", false));
 	private static var lime_application_event_manager_register = new cpp.Callable<cpp.Object->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
 		"lime_application_event_manager_register", "oov", false));
 	private static var lime_application_exec = new cpp.Callable<cpp.Object->Int>(cpp.Prime._loadPrime("lime", "lime_application_exec", "oi", false));
+	private static var lime_application_get_frame_stats = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_application_get_frame_stats", "oo", false));
 	private static var lime_application_init = new cpp.Callable<cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_application_init", "ov", false));
 	private static var lime_application_quit = new cpp.Callable<cpp.Object->Int>(cpp.Prime._loadPrime("lime", "lime_application_quit", "oi", false));
+	private static var lime_application_set_fixed_time_step = new cpp.Callable<cpp.Object->Float->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_application_set_fixed_time_step", "odv", false));
+	private static var lime_application_set_frame_pacing = new cpp.Callable<cpp.Object->Int->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_application_set_frame_pacing", "oiv", false));
 	private static var lime_application_set_frame_rate = new cpp.Callable<cpp.Object->Float->cpp.Void>(cpp.Prime._loadPrime("lime",
 		"lime_application_set_frame_rate", "odv", false));
+	private static var lime_application_set_precise_input = new cpp.Callable<cpp.Object->Bool->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_application_set_precise_input", "obv", false));
 	private static var lime_application_update = new cpp.Callable<cpp.Object->Bool>(cpp.Prime._loadPrime("lime", "lime_application_update", "ob", false));
+	private static var lime_async_file_reader_cancel = new cpp.Callable<cpp.Object->Int->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_async_file_reader_cancel", "oiv", false));
+	private static var lime_async_file_reader_create = new cpp.Callable<Int->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_async_file_reader_create", "io", false));
+	private static var lime_async_file_reader_read = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_async_file_reader_read", "oo", false));
+	private static var lime_async_file_reader_read_data = new cpp.Callable<cpp.Object->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_async_file_reader_read_data", "oov", false));
+	private static var lime_async_file_reader_submit = new cpp.Callable<cpp.Object->String->Float->Int->Int>(cpp.Prime._loadPrime("lime",
+		"lime_async_file_reader_submit", "osdii", false));
 	private static var lime_audio_load = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_audio_load", "ooo", false));
 	private static var lime_audio_load_bytes = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_audio_load_bytes",
 		"ooo", false));
+	private static var lime_audio_load_data_pointer = new cpp.Callable<Float->Int->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_audio_load_data_pointer", "dioo", false));
 	private static var lime_audio_load_file = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_audio_load_file", "ooo",
 		false));
 	private static var lime_bytes_from_data_pointer = new cpp.Callable<Float->Int->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
@@ -403,6 +510,8 @@ class NativeCFFI
 		"ooo", false));
 	private static var lime_drop_event_manager_register = new cpp.Callable<cpp.Object->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
 		"lime_drop_event_manager_register", "oov", false));
+	private static var lime_event_queue_register = new cpp.Callable<cpp.Object->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_event_queue_register", "oov", false));
 	private static var lime_file_dialog_open_directory = new cpp.Callable<String->String->String->cpp.Object>(cpp.Prime._loadPrime("lime",
 		"lime_file_dialog_open_directory", "ssso", false));
 	private static var lime_file_dialog_open_file = new cpp.Callable<String->String->String->cpp.Object>(cpp.Prime._loadPrime("lime",
@@ -417,6 +526,8 @@ class NativeCFFI
 		"lime_file_watcher_add_directory", "oobo", false));
 	private static var lime_file_watcher_remove_directory = new cpp.Callable<cpp.Object->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
 		"lime_file_watcher_remove_directory", "oov", false));
+	private static var lime_file_watcher_set_options = new cpp.Callable<cpp.Object->Float->cpp.Object->Bool->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_file_watcher_set_options", "odobv", false));
 	private static var lime_file_watcher_update = new cpp.Callable<cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_file_watcher_update", "ov",
 		false));
 	private static var lime_font_get_ascender = new cpp.Callable<cpp.Object->Int>(cpp.Prime._loadPrime("lime", "lime_font_get_ascender", "oi", false));
@@ -438,6 +549,8 @@ class NativeCFFI
 	private static var lime_font_get_units_per_em = new cpp.Callable<cpp.Object->Int>(cpp.Prime._loadPrime("lime", "lime_font_get_units_per_em", "oi", false));
 	private static var lime_font_load = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_font_load", "oo", false));
 	private static var lime_font_load_bytes = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_font_load_bytes", "oo", false));
+	private static var lime_font_load_data_pointer = new cpp.Callable<Float->Int->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_font_load_data_pointer", "dio", false));
 	private static var lime_font_load_file = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_font_load_file", "oo", false));
 	private static var lime_font_outline_decompose = new cpp.Callable<cpp.Object->Int->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_font_outline_decompose",
 		"oio", false));
@@ -454,6 +567,11 @@ class NativeCFFI
 		false));
 	private static var lime_gamepad_event_manager_register = new cpp.Callable<cpp.Object->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
 		"lime_gamepad_event_manager_register", "oov", false));
+	private static var lime_gamepad_get_states = new cpp.Callable<cpp.Object->Int>(cpp.Prime._loadPrime("lime", "lime_gamepad_get_states", "oi", false));
+	private static var lime_gamepad_set_axis_events = new cpp.Callable<Bool->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_gamepad_set_axis_events", "bv", false));
+	private static var lime_gamepad_set_motion_sensors = new cpp.Callable<Bool->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_gamepad_set_motion_sensors", "bv", false));
 	private static var lime_gzip_compress = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_gzip_compress", "ooo",
 		false));
 	private static var lime_gzip_decompress = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_gzip_decompress", "ooo",
@@ -464,6 +582,8 @@ class NativeCFFI
 	private static var lime_image_load = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_image_load", "ooo", false));
 	private static var lime_image_load_bytes = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_image_load_bytes",
 		"ooo", false));
+	private static var lime_image_load_data_pointer = new cpp.Callable<Float->Int->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_image_load_data_pointer", "dioo", false));
 	private static var lime_image_load_file = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_image_load_file", "ooo",
 		false));
 	private static var lime_image_data_util_color_transform = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
@@ -515,11 +635,35 @@ class NativeCFFI
 		false));
 	private static var lime_lzma_decompress = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_lzma_decompress", "ooo",
 		false));
+	private static var lime_mapped_file_close = new cpp.Callable<cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_mapped_file_close", "ov", false));
+	private static var lime_mapped_file_get_data_pointer = new cpp.Callable<cpp.Object->Float>(cpp.Prime._loadPrime("lime",
+		"lime_mapped_file_get_data_pointer", "od", false));
+	private static var lime_mapped_file_get_length = new cpp.Callable<cpp.Object->Float>(cpp.Prime._loadPrime("lime",
+		"lime_mapped_file_get_length", "od", false));
+	private static var lime_mapped_file_open = new cpp.Callable<String->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_mapped_file_open", "so", false));
+	private static var lime_mapped_file_release_view = new cpp.Callable<Float->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_mapped_file_release_view", "dv", false));
+	private static var lime_mapped_file_retain_view = new cpp.Callable<cpp.Object->Bool>(cpp.Prime._loadPrime("lime",
+		"lime_mapped_file_retain_view", "ob", false));
+	private static var lime_motion_coalescer_get_history = new cpp.Callable<cpp.Object->Int>(cpp.Prime._loadPrime("lime",
+		"lime_motion_coalescer_get_history", "oi", false));
+	private static var lime_motion_coalescer_set_enabled = new cpp.Callable<Bool->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_motion_coalescer_set_enabled", "bv", false));
 	private static var lime_mouse_event_manager_register = new cpp.Callable<cpp.Object->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
 		"lime_mouse_event_manager_register", "oov", false));
 	private static var lime_neko_execute = new cpp.Callable<String->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_neko_execute", "sv", false));
 	private static var lime_orientation_event_manager_register = new cpp.Callable<cpp.Object->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
 		"lime_orientation_event_manager_register", "oov", false));
+	private static var lime_packed_asset_loader_create = new cpp.Callable<Int->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_packed_asset_loader_create", "io", false));
+	private static var lime_packed_asset_loader_read = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_packed_asset_loader_read", "oo", false));
+	private static var lime_packed_asset_loader_read_audio = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_packed_asset_loader_read_audio", "ooo", false));
+	private static var lime_packed_asset_loader_read_image = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_packed_asset_loader_read_image", "ooo", false));
+	private static var lime_packed_asset_loader_submit = new cpp.Callable<cpp.Object->Float->Int->Int->Int->Int>(cpp.Prime._loadPrime("lime",
+		"lime_packed_asset_loader_submit", "odiiii", false));
 	private static var lime_png_decode_bytes = new cpp.Callable<cpp.Object->Bool->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
 		"lime_png_decode_bytes", "oboo", false));
 	private static var lime_png_decode_file = new cpp.Callable<String->Bool->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_png_decode_file",
@@ -555,6 +699,13 @@ class NativeCFFI
 		"lime_text_event_manager_register", "oov", false));
 	private static var lime_touch_event_manager_register = new cpp.Callable<cpp.Object->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
 		"lime_touch_event_manager_register", "oov", false));
+	private static var lime_wav_stream_from_file = new cpp.Callable<String->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_wav_stream_from_file", "so", false));
+	private static var lime_wav_stream_info = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_wav_stream_info", "oo", false));
+	private static var lime_wav_stream_read = new cpp.Callable<cpp.Object->cpp.Object->Int->Int->Int>(cpp.Prime._loadPrime("lime",
+		"lime_wav_stream_read", "ooiii", false));
+	private static var lime_wav_stream_seek = new cpp.Callable<cpp.Object->Float->Bool>(cpp.Prime._loadPrime("lime", "lime_wav_stream_seek", "odb", false));
+	private static var lime_wav_stream_tell = new cpp.Callable<cpp.Object->Float>(cpp.Prime._loadPrime("lime", "lime_wav_stream_tell", "od", false));
 	private static var lime_window_alert = new cpp.Callable<cpp.Object->String->String->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_window_alert", "ossv",
 		false));
 	private static var lime_window_close = new cpp.Callable<cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_window_close", "ov", false));
@@ -586,9 +737,19 @@ class NativeCFFI
 	private static var lime_window_get_width = new cpp.Callable<cpp.Object->Int>(cpp.Prime._loadPrime("lime", "lime_window_get_width", "oi", false));
 	private static var lime_window_get_x = new cpp.Callable<cpp.Object->Int>(cpp.Prime._loadPrime("lime", "lime_window_get_x", "oi", false));
 	private static var lime_window_get_y = new cpp.Callable<cpp.Object->Int>(cpp.Prime._loadPrime("lime", "lime_window_get_y", "oi", false));
+	private static var lime_window_inject_key_event = new cpp.Callable<cpp.Object->Int->Int->Int->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_window_inject_key_event", "oiiiv", false));
+	private static var lime_window_inject_mouse_event = new cpp.Callable<cpp.Object->Int->Float->Float->Int->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_window_inject_mouse_event", "oiddiv", false));
+	private static var lime_window_inject_text_event = new cpp.Callable<cpp.Object->String->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_window_inject_text_event", "osv", false));
 	private static var lime_window_move = new cpp.Callable<cpp.Object->Int->Int->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_window_move", "oiiv", false));
 	private static var lime_window_read_pixels = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
 		"lime_window_read_pixels", "oooo", false));
+	private static var lime_window_read_pixels_async = new cpp.Callable<cpp.Object->cpp.Object->Int>(cpp.Prime._loadPrime("lime",
+		"lime_window_read_pixels_async", "ooi", false));
+	private static var lime_window_read_pixels_async_result = new cpp.Callable<cpp.Object->Int->cpp.Object->Int>(cpp.Prime._loadPrime("lime",
+		"lime_window_read_pixels_async_result", "oioi", false));
 	private static var lime_window_resize = new cpp.Callable<cpp.Object->Int->Int->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_window_resize", "oiiv",
 		false));
 	private static var lime_window_set_minimum_size = new cpp.Callable<cpp.Object->Int->Int->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_window_set_minimum_size", "oiiv",
@@ -599,6 +760,8 @@ class NativeCFFI
 		false));
 	private static var lime_window_set_cursor = new cpp.Callable<cpp.Object->Int->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_window_set_cursor", "oiv",
 		false));
+	private static var lime_window_set_dirty_rects = new cpp.Callable<cpp.Object->lime.utils.DataPointer->Int->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_window_set_dirty_rects", "odiv", false));
 	private static var lime_window_set_display_mode = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
 		"lime_window_set_display_mode", "ooo", false));
 	private static var lime_window_set_fullscreen = new cpp.Callable<cpp.Object->Bool->Bool>(cpp.Prime._loadPrime("lime", "lime_window_set_fullscreen", "obb",
@@ -633,18 +796,32 @@ class NativeCFFI
 		false));
 	private static var lime_zlib_decompress = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_zlib_decompress", "ooo",
 		false));
+	private static var lime_zstd_compress = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_zstd_compress", "ooo",
+		false));
+	private static var lime_zstd_decompress = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_zstd_decompress", "ooo",
+		false));
 	#end
 	#end
 	#if (neko || cppia)
 	private static var lime_application_create = CFFI.load("lime", "lime_application_create", 0);
 	private static var lime_application_event_manager_register = CFFI.load("lime", "lime_application_event_manager_register", 2);
 	private static var lime_application_exec = CFFI.load("lime", "lime_application_exec", 1);
+	private static var lime_application_get_frame_stats = CFFI.load("lime", "lime_application_get_frame_stats", 1);
 	private static var lime_application_init = CFFI.load("lime", "lime_application_init", 1);
 	private static var lime_application_quit = CFFI.load("lime", "lime_application_quit", 1);
+	private static var lime_application_set_fixed_time_step = CFFI.load("lime", "lime_application_set_fixed_time_step", 2);
+	private static var lime_application_set_frame_pacing = CFFI.load("lime", "lime_application_set_frame_pacing", 2);
 	private static var lime_application_set_frame_rate = CFFI.load("lime", "lime_application_set_frame_rate", 2);
+	private static var lime_application_set_precise_input = CFFI.load("lime", "lime_application_set_precise_input", 2);
 	private static var lime_application_update = CFFI.load("lime", "lime_application_update", 1);
+	private static var lime_async_file_reader_cancel = CFFI.load("lime", "lime_async_file_reader_cancel", 2);
+	private static var lime_async_file_reader_create = CFFI.load("lime", "lime_async_file_reader_create", 1);
+	private static var lime_async_file_reader_read = CFFI.load("lime", "lime_async_file_reader_read", 1);
+	private static var lime_async_file_reader_read_data = CFFI.load("lime", "lime_async_file_reader_read_data", 2);
+	private static var lime_async_file_reader_submit = CFFI.load("lime", "lime_async_file_reader_submit", 4);
 	private static var lime_audio_load = CFFI.load("lime", "lime_audio_load", 2);
 	private static var lime_audio_load_bytes = CFFI.load("lime", "lime_audio_load_bytes", 2);
+	private static var lime_audio_load_data_pointer = CFFI.load("lime", "lime_audio_load_data_pointer", 3);
 	private static var lime_audio_load_file = CFFI.load("lime", "lime_audio_load_file", 2);
 	private static var lime_bytes_from_data_pointer = CFFI.load("lime", "lime_bytes_from_data_pointer", 3);
 	private static var lime_bytes_get_data_pointer = CFFI.load("lime", "lime_bytes_get_data_pointer", 1);
@@ -658,6 +835,7 @@ class NativeCFFI
 	private static var lime_deflate_compress = CFFI.load("lime", "lime_deflate_compress", 2);
 	private static var lime_deflate_decompress = CFFI.load("lime", "lime_deflate_decompress", 2);
 	private static var lime_drop_event_manager_register = CFFI.load("lime", "lime_drop_event_manager_register", 2);
+	private static var lime_event_queue_register = CFFI.load("lime", "lime_event_queue_register", 2);
 	private static var lime_file_dialog_open_directory = CFFI.load("lime", "lime_file_dialog_open_directory", 3);
 	private static var lime_file_dialog_open_file = CFFI.load("lime", "lime_file_dialog_open_file", 3);
 	private static var lime_file_dialog_open_files = CFFI.load("lime", "lime_file_dialog_open_files", 3);
@@ -665,6 +843,7 @@ class NativeCFFI
 	private static var lime_file_watcher_create = CFFI.load("lime", "lime_file_watcher_create", 1);
 	private static var lime_file_watcher_add_directory = CFFI.load("lime", "lime_file_watcher_add_directory", 3);
 	private static var lime_file_watcher_remove_directory = CFFI.load("lime", "lime_file_watcher_remove_directory", 2);
+	private static var lime_file_watcher_set_options = CFFI.load("lime", "lime_file_watcher_set_options", 4);
 	private static var lime_file_watcher_update = CFFI.load("lime", "lime_file_watcher_update", 1);
 	private static var lime_font_get_ascender = CFFI.load("lime", "lime_font_get_ascender", 1);
 	private static var lime_font_get_descender = CFFI.load("lime", "lime_font_get_descender", 1);
@@ -679,6 +858,7 @@ class NativeCFFI
 	private static var lime_font_get_units_per_em = CFFI.load("lime", "lime_font_get_units_per_em", 1);
 	private static var lime_font_load = CFFI.load("lime", "lime_font_load", 1);
 	private static var lime_font_load_bytes = CFFI.load("lime", "lime_font_load_bytes", 1);
+	private static var lime_font_load_data_pointer = CFFI.load("lime", "lime_font_load_data_pointer", 2);
 	private static var lime_font_load_file = CFFI.load("lime", "lime_font_load_file", 1);
 	private static var lime_font_outline_decompose = CFFI.load("lime", "lime_font_outline_decompose", 2);
 	private static var lime_font_render_glyph = CFFI.load("lime", "lime_font_render_glyph", 3);
@@ -688,12 +868,16 @@ class NativeCFFI
 	private static var lime_gamepad_get_device_guid = CFFI.load("lime", "lime_gamepad_get_device_guid", 1);
 	private static var lime_gamepad_get_device_name = CFFI.load("lime", "lime_gamepad_get_device_name", 1);
 	private static var lime_gamepad_event_manager_register = CFFI.load("lime", "lime_gamepad_event_manager_register", 2);
+	private static var lime_gamepad_get_states = CFFI.load("lime", "lime_gamepad_get_states", 1);
+	private static var lime_gamepad_set_axis_events = CFFI.load("lime", "lime_gamepad_set_axis_events", 1);
+	private static var lime_gamepad_set_motion_sensors = CFFI.load("lime", "lime_gamepad_set_motion_sensors", 1);
 	private static var lime_gzip_compress = CFFI.load("lime", "lime_gzip_compress", 2);
 	private static var lime_gzip_decompress = CFFI.load("lime", "lime_gzip_decompress", 2);
 	private static var lime_haptic_vibrate = CFFI.load("lime", "lime_haptic_vibrate", 2);
 	private static var lime_image_encode = CFFI.load("lime", "lime_image_encode", 4);
 	private static var lime_image_load = CFFI.load("lime", "lime_image_load", 2);
 	private static var lime_image_load_bytes = CFFI.load("lime", "lime_image_load_bytes", 2);
+	private static var lime_image_load_data_pointer = CFFI.load("lime", "lime_image_load_data_pointer", 3);
 	private static var lime_image_load_file = CFFI.load("lime", "lime_image_load_file", 2);
 	private static var lime_image_data_util_color_transform = CFFI.load("lime", "lime_image_data_util_color_transform", 3);
 	private static var lime_image_data_util_copy_channel = CFFI.load("lime", "lime_image_data_util_copy_channel", -1);
@@ -721,9 +905,22 @@ class NativeCFFI
 	private static var lime_key_event_manager_register = CFFI.load("lime", "lime_key_event_manager_register", 2);
 	private static var lime_lzma_compress = CFFI.load("lime", "lime_lzma_compress", 2);
 	private static var lime_lzma_decompress = CFFI.load("lime", "lime_lzma_decompress", 2);
+	private static var lime_mapped_file_close = CFFI.load("lime", "lime_mapped_file_close", 1);
+	private static var lime_mapped_file_get_data_pointer = CFFI.load("lime", "lime_mapped_file_get_data_pointer", 1);
+	private static var lime_mapped_file_get_length = CFFI.load("lime", "lime_mapped_file_get_length", 1);
+	private static var lime_mapped_file_open = CFFI.load("lime", "lime_mapped_file_open", 1);
+	private static var lime_mapped_file_release_view = CFFI.load("lime", "lime_mapped_file_release_view", 1);
+	private static var lime_mapped_file_retain_view = CFFI.load("lime", "lime_mapped_file_retain_view", 1);
+	private static var lime_motion_coalescer_get_history = CFFI.load("lime", "lime_motion_coalescer_get_history", 1);
+	private static var lime_motion_coalescer_set_enabled = CFFI.load("lime", "lime_motion_coalescer_set_enabled", 1);
 	private static var lime_mouse_event_manager_register = CFFI.load("lime", "lime_mouse_event_manager_register", 2);
 	private static var lime_neko_execute = CFFI.load("lime", "lime_neko_execute", 1);
 	private static var lime_orientation_event_manager_register = CFFI.load("lime", "lime_orientation_event_manager_register", 2);
+	private static var lime_packed_asset_loader_create = CFFI.load("lime", "lime_packed_asset_loader_create", 1);
+	private static var lime_packed_asset_loader_read = CFFI.load("lime", "lime_packed_asset_loader_read", 1);
+	private static var lime_packed_asset_loader_read_audio = CFFI.load("lime", "lime_packed_asset_loader_read_audio", 2);
+	private static var lime_packed_asset_loader_read_image = CFFI.load("lime", "lime_packed_asset_loader_read_image", 2);
+	private static var lime_packed_asset_loader_submit = CFFI.load("lime", "lime_packed_asset_loader_submit", 5);
 	private static var lime_png_decode_bytes = CFFI.load("lime", "lime_png_decode_bytes", 3);
 	private static var lime_png_decode_file = CFFI.load("lime", "lime_png_decode_file", 3);
 	private static var lime_render_event_manager_register = CFFI.load("lime", "lime_render_event_manager_register", 2);
@@ -745,6 +942,11 @@ class NativeCFFI
 	private static var lime_system_open_url = CFFI.load("lime", "lime_system_open_url", 2);
 	private static var lime_text_event_manager_register = CFFI.load("lime", "lime_text_event_manager_register", 2);
 	private static var lime_touch_event_manager_register = CFFI.load("lime", "lime_touch_event_manager_register", 2);
+	private static var lime_wav_stream_from_file = CFFI.load("lime", "lime_wav_stream_from_file", 1);
+	private static var lime_wav_stream_info = CFFI.load("lime", "lime_wav_stream_info", 1);
+	private static var lime_wav_stream_read = CFFI.load("lime", "lime_wav_stream_read", 4);
+	private static var lime_wav_stream_seek = CFFI.load("lime", "lime_wav_stream_seek", 2);
+	private static var lime_wav_stream_tell = CFFI.load("lime", "lime_wav_stream_tell", 1);
 	private static var lime_window_alert = CFFI.load("lime", "lime_window_alert", 3);
 	private static var lime_window_close = CFFI.load("lime", "lime_window_close", 1);
 	private static var lime_window_context_flip = CFFI.load("lime", "lime_window_context_flip", 1);
@@ -766,13 +968,19 @@ class NativeCFFI
 	private static var lime_window_get_width = CFFI.load("lime", "lime_window_get_width", 1);
 	private static var lime_window_get_x = CFFI.load("lime", "lime_window_get_x", 1);
 	private static var lime_window_get_y = CFFI.load("lime", "lime_window_get_y", 1);
+	private static var lime_window_inject_key_event = CFFI.load("lime", "lime_window_inject_key_event", 4);
+	private static var lime_window_inject_mouse_event = CFFI.load("lime", "lime_window_inject_mouse_event", 5);
+	private static var lime_window_inject_text_event = CFFI.load("lime", "lime_window_inject_text_event", 2);
 	private static var lime_window_move = CFFI.load("lime", "lime_window_move", 3);
 	private static var lime_window_read_pixels = CFFI.load("lime", "lime_window_read_pixels", 3);
+	private static var lime_window_read_pixels_async = CFFI.load("lime", "lime_window_read_pixels_async", 2);
+	private static var lime_window_read_pixels_async_result = CFFI.load("lime", "lime_window_read_pixels_async_result", 3);
 	private static var lime_window_resize = CFFI.load("lime", "lime_window_resize", 3);
 	private static var lime_window_set_minimum_size = CFFI.load("lime", "lime_window_set_minimum_size", 3);
 	private static var lime_window_set_maximum_size = CFFI.load("lime", "lime_window_set_maximum_size", 3);
 	private static var lime_window_set_borderless = CFFI.load("lime", "lime_window_set_borderless", 2);
 	private static var lime_window_set_cursor = CFFI.load("lime", "lime_window_set_cursor", 2);
+	private static var lime_window_set_dirty_rects = CFFI.load("lime", "lime_window_set_dirty_rects", 3);
 	private static var lime_window_set_display_mode = CFFI.load("lime", "lime_window_set_display_mode", 2);
 	private static var lime_window_set_fullscreen = CFFI.load("lime", "lime_window_set_fullscreen", 2);
 	private static var lime_window_set_icon = CFFI.load("lime", "lime_window_set_icon", 2);
@@ -790,6 +998,8 @@ class NativeCFFI
 	private static var lime_window_event_manager_register = CFFI.load("lime", "lime_window_event_manager_register", 2);
 	private static var lime_zlib_compress = CFFI.load("lime", "lime_zlib_compress", 2);
 	private static var lime_zlib_decompress = CFFI.load("lime", "lime_zlib_decompress", 2);
+	private static var lime_zstd_compress = CFFI.load("lime", "lime_zstd_compress", 2);
+	private static var lime_zstd_decompress = CFFI.load("lime", "lime_zstd_decompress", 2);
 	#end
 
 	#if hl
@@ -806,6 +1016,11 @@ class NativeCFFI
 		return 0;
 	}
 
+	@:hlNative("lime", "hl_application_get_frame_stats") private static function lime_application_get_frame_stats(handle:CFFIPointer):Dynamic
+	{
+		return null;
+	}
+
 	@:hlNative("lime", "hl_application_init") private static function lime_application_init(handle:CFFIPointer):Void {}
 
 	@:hlNative("lime", "hl_application_quit") private static function lime_application_quit(handle:CFFIPointer):Int
@@ -813,19 +1028,52 @@ class NativeCFFI
 		return 0;
 	}
 
+	@:hlNative("lime", "hl_application_set_fixed_time_step") private static function lime_application_set_fixed_time_step(handle:CFFIPointer, step:Float):Void {}
+
+	@:hlNative("lime", "hl_application_set_frame_pacing") private static function lime_application_set_frame_pacing(handle:CFFIPointer, policy:Int):Void {}
+
 	@:hlNative("lime", "hl_application_set_frame_rate") private static function lime_application_set_frame_rate(handle:CFFIPointer, value:Float):Void {}
 
+	@:hlNative("lime", "hl_application_set_precise_input") private static function lime_application_set_precise_input(handle:CFFIPointer, value:Bool):Void {}
+
 	@:hlNative("lime", "hl_application_update") private static function lime_application_update(handle:CFFIPointer):Bool
 	{
 		return false;
 	}
 
+	@:hlNative("lime", "hl_async_file_reader_cancel") private static function lime_async_file_reader_cancel(handle:CFFIPointer, id:Int):Void {}
+
+	@:hlNative("lime", "hl_async_file_reader_create") private static function lime_async_file_reader_create(threads:Int):CFFIPointer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_async_file_reader_read") private static function lime_async_file_reader_read(handle:CFFIPointer, object:Dynamic):Dynamic
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_async_file_reader_read_data") private static function lime_async_file_reader_read_data(handle:CFFIPointer,
+		bytes:Bytes):Void {}
+
+	@:hlNative("lime", "hl_async_file_reader_submit") private static function lime_async_file_reader_submit(handle:CFFIPointer, path:String,
+			offset:Float, length:Int):Int
+	{
+		return 0;
+	}
+
 	// @:cffi private static function lime_audio_load (data:Dynamic, buffer:Dynamic):Dynamic;
 	@:hlNative("lime", "hl_audio_load_bytes") private static function lime_audio_load_bytes(data:Bytes, buffer:AudioBuffer):AudioBuffer
 	{
 		return null;
 	}
 
+	@:hlNative("lime", "hl_audio_load_data_pointer") private static function lime_audio_load_data_pointer(data:Float, length:Int,
+			buffer:AudioBuffer):AudioBuffer
+	{
+		return null;
+	}
+
 	@:hlNative("lime", "hl_audio_load_file") private static function lime_audio_load_file(path:String, buffer:AudioBuffer):AudioBuffer
 	{
 		return null;
@@ -884,6 +1132,8 @@ class NativeCFFI
 	@:hlNative("lime", "hl_drop_event_manager_register") private static function lime_drop_event_manager_register(callback:Void->Void,
 		eventObject:DropEventInfo):Void {}
 
+	@:hlNative("lime", "hl_event_queue_register") private static function lime_event_queue_register(callback:Void->Void, buffer:Bytes):Void {}
+
 	@:hlNative("lime", "hl_file_dialog_open_directory") private static function lime_file_dialog_open_directory(title:String, filter:String,
 			defaultPath:String):hl.Bytes
 	{
@@ -922,6 +1172,9 @@ class NativeCFFI
 	@:hlNative("lime", "hl_file_watcher_remove_directory") private static function lime_file_watcher_remove_directory(handle:CFFIPointer,
 		watchID:Int):Void {}
 
+	@:hlNative("lime", "hl_file_watcher_set_options") private static function lime_file_watcher_set_options(handle:CFFIPointer,
+		debounce:Float, batchCallback:Dynamic, compareContent:Bool):Void {}
+
 	@:hlNative("lime", "hl_file_watcher_update") private static function lime_file_watcher_update(handle:CFFIPointer):Void {}
 
 	@:hlNative("lime", "hl_font_get_ascender") private static function lime_font_get_ascender(handle:CFFIPointer):Int
@@ -986,6 +1239,11 @@ class NativeCFFI
 		return null;
 	}
 
+	@:hlNative("lime", "hl_font_load_data_pointer") private static function lime_font_load_data_pointer(data:Float, length:Int):CFFIPointer
+	{
+		return null;
+	}
+
 	@:hlNative("lime", "hl_font_load_file") private static function lime_font_load_file(path:String):CFFIPointer
 	{
 		return null;
@@ -1024,6 +1282,15 @@ class NativeCFFI
 	@:hlNative("lime", "hl_gamepad_event_manager_register") private static function lime_gamepad_event_manager_register(callback:Void->Void,
 		eventObject:GamepadEventInfo):Void {}
 
+	@:hlNative("lime", "hl_gamepad_get_states") private static function lime_gamepad_get_states(buffer:Bytes):Int
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_gamepad_set_axis_events") private static function lime_gamepad_set_axis_events(enabled:Bool):Void {}
+
+	@:hlNative("lime", "hl_gamepad_set_motion_sensors") private static function lime_gamepad_set_motion_sensors(enabled:Bool):Void {}
+
 	@:hlNative("lime", "hl_gzip_compress") private static function lime_gzip_compress(data:Bytes, bytes:Bytes):Bytes
 	{
 		return null;
@@ -1047,6 +1314,12 @@ class NativeCFFI
 		return null;
 	}
 
+	@:hlNative("lime", "hl_image_load_data_pointer") private static function lime_image_load_data_pointer(data:Float, length:Int,
+			buffer:ImageBuffer):ImageBuffer
+	{
+		return null;
+	}
+
 	@:hlNative("lime", "hl_image_load_file") private static function lime_image_load_file(path:String, buffer:ImageBuffer):ImageBuffer
 	{
 		return null;
@@ -1158,6 +1431,37 @@ class NativeCFFI
 		return null;
 	}
 
+	@:hlNative("lime", "hl_mapped_file_close") private static function lime_mapped_file_close(handle:CFFIPointer):Void {}
+
+	@:hlNative("lime", "hl_mapped_file_get_data_pointer") private static function lime_mapped_file_get_data_pointer(handle:CFFIPointer):Float
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_mapped_file_get_length") private static function lime_mapped_file_get_length(handle:CFFIPointer):Float
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_mapped_file_open") private static function lime_mapped_file_open(path:String):CFFIPointer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_mapped_file_release_view") private static function lime_mapped_file_release_view(data:Float):Void {}
+
+	@:hlNative("lime", "hl_mapped_file_retain_view") private static function lime_mapped_file_retain_view(handle:CFFIPointer):Bool
+	{
+		return false;
+	}
+
+	@:hlNative("lime", "hl_motion_coalescer_get_history") private static function lime_motion_coalescer_get_history(buffer:Bytes):Int
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_motion_coalescer_set_enabled") private static function lime_motion_coalescer_set_enabled(enabled:Bool):Void {}
+
 	@:hlNative("lime", "hl_mouse_event_manager_register") private static function lime_mouse_event_manager_register(callback:Void->Void,
 		eventObject:MouseEventInfo):Void {}
 
@@ -1166,6 +1470,34 @@ class NativeCFFI
 	@:hlNative("lime", "hl_orientation_event_manager_register") private static function lime_orientation_event_manager_register(callback:Void->Void,
 		eventObject:OrientationEventInfo):Void {}
 
+	@:hlNative("lime", "hl_packed_asset_loader_create") private static function lime_packed_asset_loader_create(threads:Int):CFFIPointer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_packed_asset_loader_read") private static function lime_packed_asset_loader_read(handle:CFFIPointer, object:Dynamic):Dynamic
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_packed_asset_loader_read_audio") private static function lime_packed_asset_loader_read_audio(handle:CFFIPointer,
+		buffer:AudioBuffer):AudioBuffer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_packed_asset_loader_read_image") private static function lime_packed_asset_loader_read_image(handle:CFFIPointer,
+		buffer:ImageBuffer):ImageBuffer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_packed_asset_loader_submit") private static function lime_packed_asset_loader_submit(handle:CFFIPointer, data:Float,
+		length:Int, compression:Int, decode:Int):Int
+	{
+		return 0;
+	}
+
 	@:hlNative("lime", "hl_png_decode_bytes") private static function lime_png_decode_bytes(data:Bytes, decodeData:Bool, buffer:ImageBuffer):ImageBuffer
 	{
 		return null;
@@ -1257,6 +1589,31 @@ class NativeCFFI
 	@:hlNative("lime", "hl_touch_event_manager_register") private static function lime_touch_event_manager_register(callback:Void->Void,
 		eventObject:TouchEventInfo):Void {}
 
+	@:hlNative("lime", "hl_wav_stream_from_file") private static function lime_wav_stream_from_file(path:String):CFFIPointer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_wav_stream_info") private static function lime_wav_stream_info(handle:CFFIPointer):Dynamic
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_wav_stream_read") private static function lime_wav_stream_read(handle:CFFIPointer, buffer:Bytes, position:Int, length:Int):Int
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_wav_stream_seek") private static function lime_wav_stream_seek(handle:CFFIPointer, frame:Float):Bool
+	{
+		return false;
+	}
+
+	@:hlNative("lime", "hl_wav_stream_tell") private static function lime_wav_stream_tell(handle:CFFIPointer):Float
+	{
+		return 0;
+	}
+
 	@:hlNative("lime", "hl_window_alert") private static function lime_window_alert(handle:CFFIPointer, message:String, title:String):Void {}
 
 	@:hlNative("lime", "hl_window_close") private static function lime_window_close(handle:CFFIPointer):Void {}
@@ -1337,6 +1694,12 @@ class NativeCFFI
 		return 0;
 	}
 
+	@:hlNative("lime", "hl_window_inject_key_event") private static function lime_window_inject_key_event(handle:CFFIPointer, type:Int, keyCode:Int, modifier:Int):Void {}
+
+	@:hlNative("lime", "hl_window_inject_mouse_event") private static function lime_window_inject_mouse_event(handle:CFFIPointer, type:Int, x:Float, y:Float, button:Int):Void {}
+
+	@:hlNative("lime", "hl_window_inject_text_event") private static function lime_window_inject_text_event(handle:CFFIPointer, text:String):Void {}
+
 	@:hlNative("lime", "hl_window_move") private static function lime_window_move(handle:CFFIPointer, x:Int, y:Int):Void {}
 
 	@:hlNative("lime", "hl_window_read_pixels") private static function lime_window_read_pixels(handle:CFFIPointer, rect:Rectangle,
@@ -1345,6 +1708,16 @@ class NativeCFFI
 		return null;
 	}
 
+	@:hlNative("lime", "hl_window_read_pixels_async") private static function lime_window_read_pixels_async(handle:CFFIPointer, rect:Rectangle):Int
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_window_read_pixels_async_result") private static function lime_window_read_pixels_async_result(handle:CFFIPointer, id:Int, imageBuffer:ImageBuffer):Int
+	{
+		return 0;
+	}
+
 	@:hlNative("lime", "hl_window_resize") private static function lime_window_resize(handle:CFFIPointer, width:Int, height:Int):Void {}
 
 	@:hlNative("lime", "hl_window_set_minimum_size") private static function lime_window_set_minimum_size(handle:CFFIPointer, width:Int, height:Int):Void {}
@@ -1358,6 +1731,8 @@ class NativeCFFI
 
 	@:hlNative("lime", "hl_window_set_cursor") private static function lime_window_set_cursor(handle:CFFIPointer, cursor:Int):Void {}
 
+	@:hlNative("lime", "hl_window_set_dirty_rects") private static function lime_window_set_dirty_rects(handle:CFFIPointer, rects:DataPointer, count:Int):Void {}
+
 	@:hlNative("lime", "hl_window_set_display_mode") private static function lime_window_set_display_mode(handle:CFFIPointer, displayMode:DisplayMode,
 		result:DisplayMode):Void {}
 
@@ -1424,6 +1799,16 @@ class NativeCFFI
 	{
 		return null;
 	}
+
+	@:hlNative("lime", "hl_zstd_compress") private static function lime_zstd_compress(data:Bytes, bytes:Bytes):Bytes
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_zstd_decompress") private static function lime_zstd_decompress(data:Bytes, bytes:Bytes):Bytes
+	{
+		return null;
+	}
 	#end
 	#end
 	#if (lime_cffi && !macro && android)
@@ -1706,6 +2091,22 @@ class NativeCFFI
 
 	@:cffi private static function lime_al_speed_of_sound(speed:Float32):Void;
 
+	@:cffi private static function lime_al_get_voicei(pool:CFFIPointer, voice:Int, param:Int):Int;
+
+	@:cffi private static function lime_al_voice_play(pool:CFFIPointer, buffer:CFFIPointer, priority:Float32):Int;
+
+	@:cffi private static function lime_al_voice_pool_create(maxSources:Int):CFFIPointer;
+
+	@:cffi private static function lime_al_voice_pool_update(pool:CFFIPointer, deltaTime:Float32):Void;
+
+	@:cffi private static function lime_al_voice_stop(pool:CFFIPointer, voice:Int):Void;
+
+	@:cffi private static function lime_al_voice3f(pool:CFFIPointer, voice:Int, param:Int, value1:Float32, value2:Float32, value3:Float32):Void;
+
+	@:cffi private static function lime_al_voicef(pool:CFFIPointer, voice:Int, param:Int, value:Float32):Void;
+
+	@:cffi private static function lime_al_voicei(pool:CFFIPointer, voice:Int, param:Int, value:Int):Void;
+
 	@:cffi private static function lime_alc_close_device(device:CFFIPointer):Bool;
 
 	@:cffi private static function lime_alc_create_context(device:CFFIPointer, attrlist:Dynamic):CFFIPointer;
@@ -1881,6 +2282,19 @@ class NativeCFFI
 	private static var lime_al_sourceiv = new cpp.Callable<cpp.Object->Int->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_al_sourceiv", "oiov",
 		false));
 	private static var lime_al_speed_of_sound = new cpp.Callable<cpp.Float32->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_al_speed_of_sound", "fv", false));
+	private static var lime_al_get_voicei = new cpp.Callable<cpp.Object->Int->Int->Int>(cpp.Prime._loadPrime("lime", "lime_al_get_voicei", "oiii", false));
+	private static var lime_al_voice_play = new cpp.Callable<cpp.Object->cpp.Object->cpp.Float32->Int>(cpp.Prime._loadPrime("lime", "lime_al_voice_play",
+		"oofi", false));
+	private static var lime_al_voice_pool_create = new cpp.Callable<Int->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_al_voice_pool_create", "io", false));
+	private static var lime_al_voice_pool_update = new cpp.Callable<cpp.Object->cpp.Float32->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_al_voice_pool_update", "ofv", false));
+	private static var lime_al_voice_stop = new cpp.Callable<cpp.Object->Int->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_al_voice_stop", "oiv", false));
+	private static var lime_al_voice3f = new cpp.Callable<cpp.Object->Int->Int->cpp.Float32->cpp.Float32->cpp.Float32->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_al_voice3f", "oiifffv", false));
+	private static var lime_al_voicef = new cpp.Callable<cpp.Object->Int->Int->cpp.Float32->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_al_voicef",
+		"oiifv", false));
+	private static var lime_al_voicei = new cpp.Callable<cpp.Object->Int->Int->Int->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_al_voicei", "oiiiv",
+		false));
 	private static var lime_alc_close_device = new cpp.Callable<cpp.Object->Bool>(cpp.Prime._loadPrime("lime", "lime_alc_close_device", "ob", false));
 	private static var lime_alc_create_context = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_alc_create_context",
 		"ooo", false));
@@ -2010,6 +2424,14 @@ class NativeCFFI
 	private static var lime_al_sourcei = CFFI.load("lime", "lime_al_sourcei", 3);
 	private static var lime_al_sourceiv = CFFI.load("lime", "lime_al_sourceiv", 3);
 	private static var lime_al_speed_of_sound = CFFI.load("lime", "lime_al_speed_of_sound", 1);
+	private static var lime_al_get_voicei = CFFI.load("lime", "lime_al_get_voicei", 3);
+	private static var lime_al_voice_play = CFFI.load("lime", "lime_al_voice_play", 3);
+	private static var lime_al_voice_pool_create = CFFI.load("lime", "lime_al_voice_pool_create", 1);
+	private static var lime_al_voice_pool_update = CFFI.load("lime", "lime_al_voice_pool_update", 2);
+	private static var lime_al_voice_stop = CFFI.load("lime", "lime_al_voice_stop", 2);
+	private static var lime_al_voice3f = CFFI.load("lime", "lime_al_voice3f", -1);
+	private static var lime_al_voicef = CFFI.load("lime", "lime_al_voicef", 4);
+	private static var lime_al_voicei = CFFI.load("lime", "lime_al_voicei", 4);
 	private static var lime_alc_close_device = CFFI.load("lime", "lime_alc_close_device", 1);
 	private static var lime_alc_create_context = CFFI.load("lime", "lime_alc_create_context", 2);
 	private static var lime_alc_destroy_context = CFFI.load("lime", "lime_alc_destroy_context", 1);
@@ -2330,6 +2752,32 @@ class NativeCFFI
 
 	@:hlNative("lime", "hl_al_speed_of_sound") private static function lime_al_speed_of_sound(speed:hl.F32):Void {}
 
+	@:hlNative("lime", "hl_al_get_voicei") private static function lime_al_get_voicei(pool:CFFIPointer, voice:Int, param:Int):Int
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_al_voice_play") private static function lime_al_voice_play(pool:CFFIPointer, buffer:CFFIPointer, priority:hl.F32):Int
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_al_voice_pool_create") private static function lime_al_voice_pool_create(maxSources:Int):CFFIPointer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_al_voice_pool_update") private static function lime_al_voice_pool_update(pool:CFFIPointer, deltaTime:hl.F32):Void {}
+
+	@:hlNative("lime", "hl_al_voice_stop") private static function lime_al_voice_stop(pool:CFFIPointer, voice:Int):Void {}
+
+	@:hlNative("lime", "hl_al_voice3f") private static function lime_al_voice3f(pool:CFFIPointer, voice:Int, param:Int, value1:hl.F32, value2:hl.F32,
+		value3:hl.F32):Void {}
+
+	@:hlNative("lime", "hl_al_voicef") private static function lime_al_voicef(pool:CFFIPointer, voice:Int, param:Int, value:hl.F32):Void {}
+
+	@:hlNative("lime", "hl_al_voicei") private static function lime_al_voicei(pool:CFFIPointer, voice:Int, param:Int, value:Int):Void {}
+
 	@:hlNative("lime", "hl_alc_close_device") private static function lime_alc_close_device(device:CFFIPointer):Bool
 	{
 		return false;
@@ -3442,6 +3890,10 @@ class NativeCFFI
 
 	@:cffi private static function lime_curl_easy_send(curl:CFFIPointer, buffer:Dynamic, buflen:Int, n:Int):Int;
 
+	@:cffi private static function lime_curl_easy_set_write_chunk(handle:CFFIPointer, callback:Dynamic, bytes:Dynamic, chunkSize:Int):Int;
+
+	@:cffi private static function lime_curl_easy_set_write_file(handle:CFFIPointer, path:Dynamic, resume:Bool, preallocate:Bool):Int;
+
 	@:cffi private static function lime_curl_easy_setopt(handle:CFFIPointer, option:Int, parameter:Dynamic, writeBytes:Dynamic):Int;
 
 	@:cffi private static function lime_curl_easy_strerror(errornum:Int):Dynamic;
@@ -3463,6 +3915,38 @@ class NativeCFFI
 	@:cffi private static function lime_curl_multi_setopt(multi_handle:CFFIPointer, option:Int, parameter:Dynamic):Int;
 
 	@:cffi private static function lime_curl_multi_wait(multi_handle:CFFIPointer, timeout_ms:Int):Int;
+
+	@:cffi private static function lime_curl_share_cleanup(handle:CFFIPointer):Void;
+
+	@:cffi private static function lime_curl_share_init():CFFIPointer;
+
+	@:cffi private static function lime_curl_share_setopt(handle:CFFIPointer, option:Int, parameter:Int):Int;
+
+	@:cffi private static function lime_curl_share_strerror(errornum:Int):Dynamic;
+
+	@:cffi private static function lime_download_manager_cancel(handle:CFFIPointer, id:Int):Void;
+
+	@:cffi private static function lime_download_manager_create(maxConnections:Int):CFFIPointer;
+
+	@:cffi private static function lime_download_manager_get_digest(handle:CFFIPointer):Dynamic;
+
+	@:cffi private static function lime_download_manager_read(handle:CFFIPointer):Dynamic;
+
+	@:cffi private static function lime_download_manager_start(handle:CFFIPointer, url:String, path:String, segments:Int, minSegmentSize:Int,
+		hash:Int, maxRetries:Int, retryDelay:Float, progressInterval:Float):Int;
+
+	@:cffi private static function lime_http_client_cancel(handle:CFFIPointer, id:Int):Void;
+
+	@:cffi private static function lime_http_client_create(maxConnections:Int, share:CFFIPointer):CFFIPointer;
+
+	@:cffi private static function lime_http_client_get_headers(handle:CFFIPointer):Dynamic;
+
+	@:cffi private static function lime_http_client_read(handle:CFFIPointer):Dynamic;
+
+	@:cffi private static function lime_http_client_read_data(handle:CFFIPointer, bytes:Dynamic):Void;
+
+	@:cffi private static function lime_http_client_request(handle:CFFIPointer, url:String, method:String, headers:Dynamic, data:Dynamic, flags:Int,
+		timeout:Int, progressInterval:Float):Int;
 	#else
 	private static var lime_curl_getdate = new cpp.Callable<String->Float->Float>(cpp.Prime._loadPrime("lime", "lime_curl_getdate", "sdd", false));
 	private static var lime_curl_global_cleanup = new cpp.Callable<Void->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_curl_global_cleanup", "v", false));
@@ -3485,6 +3969,10 @@ class NativeCFFI
 	private static var lime_curl_easy_reset = new cpp.Callable<cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_curl_easy_reset", "ov", false));
 	private static var lime_curl_easy_send = new cpp.Callable<cpp.Object->cpp.Object->Int->Int->Int>(cpp.Prime._loadPrime("lime", "lime_curl_easy_send",
 		"ooiii", false));
+	private static var lime_curl_easy_set_write_chunk = new cpp.Callable<cpp.Object->cpp.Object->cpp.Object->Int->Int>(cpp.Prime._loadPrime("lime",
+		"lime_curl_easy_set_write_chunk", "oooii", false));
+	private static var lime_curl_easy_set_write_file = new cpp.Callable<cpp.Object->cpp.Object->Bool->Bool->Int>(cpp.Prime._loadPrime("lime",
+		"lime_curl_easy_set_write_file", "oobbi", false));
 	private static var lime_curl_easy_setopt = new cpp.Callable<cpp.Object->Int->cpp.Object->cpp.Object->Int>(cpp.Prime._loadPrime("lime",
 		"lime_curl_easy_setopt", "oiooi", false));
 	private static var lime_curl_easy_strerror = new cpp.Callable<Int->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_curl_easy_strerror", "io", false));
@@ -3503,6 +3991,32 @@ class NativeCFFI
 	private static var lime_curl_multi_setopt = new cpp.Callable<cpp.Object->Int->cpp.Object->Int>(cpp.Prime._loadPrime("lime", "lime_curl_multi_setopt",
 		"oioi", false));
 	private static var lime_curl_multi_wait = new cpp.Callable<cpp.Object->Int->Int>(cpp.Prime._loadPrime("lime", "lime_curl_multi_wait", "oii", false));
+	private static var lime_curl_share_cleanup = new cpp.Callable<cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime", "lime_curl_share_cleanup", "ov", false));
+	private static var lime_curl_share_init = new cpp.Callable<Void->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_curl_share_init", "o", false));
+	private static var lime_curl_share_setopt = new cpp.Callable<cpp.Object->Int->Int->Int>(cpp.Prime._loadPrime("lime",
+		"lime_curl_share_setopt", "oiii", false));
+	private static var lime_curl_share_strerror = new cpp.Callable<Int->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_curl_share_strerror", "io", false));
+	private static var lime_download_manager_cancel = new cpp.Callable<cpp.Object->Int->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_download_manager_cancel", "oiv", false));
+	private static var lime_download_manager_create = new cpp.Callable<Int->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_download_manager_create", "io", false));
+	private static var lime_download_manager_get_digest = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_download_manager_get_digest", "oo", false));
+	private static var lime_download_manager_read = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_download_manager_read", "oo", false));
+	private static var lime_download_manager_start = new cpp.Callable<cpp.Object->String->String->Int->Int->Int->Int->Float->Float->
+		Int>(cpp.Prime._loadPrime("lime", "lime_download_manager_start", "ossiiiiddi", false));
+	private static var lime_http_client_cancel = new cpp.Callable<cpp.Object->Int->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_http_client_cancel", "oiv", false));
+	private static var lime_http_client_create = new cpp.Callable<Int->cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_http_client_create", "ioo", false));
+	private static var lime_http_client_get_headers = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_http_client_get_headers", "oo", false));
+	private static var lime_http_client_read = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime", "lime_http_client_read", "oo", false));
+	private static var lime_http_client_read_data = new cpp.Callable<cpp.Object->cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_http_client_read_data", "oov", false));
+	private static var lime_http_client_request = new cpp.Callable<cpp.Object->String->String->cpp.Object->cpp.Object->Int->Int->Float->
+		Int>(cpp.Prime._loadPrime("lime", "lime_http_client_request", "ossooiidi", false));
 	#end
 	#end
 	#if (neko || cppia)
@@ -3522,6 +4036,8 @@ class NativeCFFI
 	private static var lime_curl_easy_recv = CFFI.load("lime", "lime_curl_easy_recv", 4);
 	private static var lime_curl_easy_reset = CFFI.load("lime", "lime_curl_easy_reset", 1);
 	private static var lime_curl_easy_send = CFFI.load("lime", "lime_curl_easy_send", 4);
+	private static var lime_curl_easy_set_write_chunk = CFFI.load("lime", "lime_curl_easy_set_write_chunk", 4);
+	private static var lime_curl_easy_set_write_file = CFFI.load("lime", "lime_curl_easy_set_write_file", 4);
 	private static var lime_curl_easy_setopt = CFFI.load("lime", "lime_curl_easy_setopt", 4);
 	private static var lime_curl_easy_strerror = CFFI.load("lime", "lime_curl_easy_strerror", 1);
 	private static var lime_curl_easy_unescape = CFFI.load("lime", "lime_curl_easy_unescape", 4);
@@ -3533,6 +4049,21 @@ class NativeCFFI
 	private static var lime_curl_multi_remove_handle = CFFI.load("lime", "lime_curl_multi_remove_handle", 2);
 	private static var lime_curl_multi_setopt = CFFI.load("lime", "lime_curl_multi_setopt", 3);
 	private static var lime_curl_multi_wait = CFFI.load("lime", "lime_curl_multi_wait", 2);
+	private static var lime_curl_share_cleanup = CFFI.load("lime", "lime_curl_share_cleanup", 1);
+	private static var lime_curl_share_init = CFFI.load("lime", "lime_curl_share_init", 0);
+	private static var lime_curl_share_setopt = CFFI.load("lime", "lime_curl_share_setopt", 3);
+	private static var lime_curl_share_strerror = CFFI.load("lime", "lime_curl_share_strerror", 1);
+	private static var lime_download_manager_cancel = CFFI.load("lime", "lime_download_manager_cancel", 2);
+	private static var lime_download_manager_create = CFFI.load("lime", "lime_download_manager_create", 1);
+	private static var lime_download_manager_get_digest = CFFI.load("lime", "lime_download_manager_get_digest", 1);
+	private static var lime_download_manager_read = CFFI.load("lime", "lime_download_manager_read", 1);
+	private static var lime_download_manager_start = CFFI.load("lime", "lime_download_manager_start", -1);
+	private static var lime_http_client_cancel = CFFI.load("lime", "lime_http_client_cancel", 2);
+	private static var lime_http_client_create = CFFI.load("lime", "lime_http_client_create", 2);
+	private static var lime_http_client_get_headers = CFFI.load("lime", "lime_http_client_get_headers", 1);
+	private static var lime_http_client_read = CFFI.load("lime", "lime_http_client_read", 1);
+	private static var lime_http_client_read_data = CFFI.load("lime", "lime_http_client_read_data", 2);
+	private static var lime_http_client_request = CFFI.load("lime", "lime_http_client_request", -1);
 	#end
 
 	#if hl
@@ -3604,6 +4135,16 @@ class NativeCFFI
 		return 0;
 	}
 
+	@:hlNative("lime", "hl_curl_easy_set_write_chunk") private static function lime_curl_easy_set_write_chunk(handle:CFFIPointer, callback:Dynamic, bytes:Bytes, chunkSize:Int):Int
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_curl_easy_set_write_file") private static function lime_curl_easy_set_write_file(handle:CFFIPointer, path:String, resume:Bool, preallocate:Bool):Int
+	{
+		return 0;
+	}
+
 	@:hlNative("lime", "hl_curl_easy_setopt") private static function lime_curl_easy_setopt(handle:CFFIPointer, option:Int, parameter:Dynamic,
 			writeBytes:Bytes):Int
 	{
@@ -3662,6 +4203,71 @@ class NativeCFFI
 	{
 		return 0;
 	}
+
+	@:hlNative("lime", "hl_curl_share_cleanup") private static function lime_curl_share_cleanup(handle:CFFIPointer):Void {}
+
+	@:hlNative("lime", "hl_curl_share_init") private static function lime_curl_share_init():CFFIPointer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_curl_share_setopt") private static function lime_curl_share_setopt(handle:CFFIPointer, option:Int, parameter:Int):Int
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_curl_share_strerror") private static function lime_curl_share_strerror(errornum:Int):hl.Bytes
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_download_manager_cancel") private static function lime_download_manager_cancel(handle:CFFIPointer, id:Int):Void {}
+
+	@:hlNative("lime", "hl_download_manager_create") private static function lime_download_manager_create(maxConnections:Int):CFFIPointer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_download_manager_get_digest") private static function lime_download_manager_get_digest(handle:CFFIPointer):hl.Bytes
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_download_manager_read") private static function lime_download_manager_read(handle:CFFIPointer, object:Dynamic):Dynamic
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_download_manager_start") private static function lime_download_manager_start(handle:CFFIPointer, url:String, path:String,
+			segments:Int, minSegmentSize:Int, hash:Int, maxRetries:Int, retryDelay:Float, progressInterval:Float):Int
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_http_client_cancel") private static function lime_http_client_cancel(handle:CFFIPointer, id:Int):Void {}
+
+	@:hlNative("lime", "hl_http_client_create") private static function lime_http_client_create(maxConnections:Int, share:CFFIPointer):CFFIPointer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_http_client_get_headers") private static function lime_http_client_get_headers(handle:CFFIPointer):hl.Bytes
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_http_client_read") private static function lime_http_client_read(handle:CFFIPointer, object:Dynamic):Dynamic
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_http_client_read_data") private static function lime_http_client_read_data(handle:CFFIPointer, bytes:Bytes):Void {}
+
+	@:hlNative("lime", "hl_http_client_request") private static function lime_http_client_request(handle:CFFIPointer, url:String, method:String,
+			headers:hl.NativeArray<String>, data:Bytes, flags:Int, timeout:Int, progressInterval:Float):Int
+	{
+		return 0;
+	}
 	#end
 	#end
 	#if (lime_cffi && !macro && (lime_opengl || lime_opengles))
@@ -7021,4 +7627,111 @@ class NativeCFFI
 	}
 	#end
 	#end
+
+	#if (lime_cffi && !macro && lime_vpx && lime_webm)
+	#if (cpp && !cppia)
+	#if (disable_cffi || haxe_ver < "3.4.0")
+	@:cffi private static function lime_video_decoder_close(handle:Dynamic):Void;
+
+	@:cffi private static function lime_video_decoder_get_info(handle:Dynamic):Dynamic;
+
+	@:cffi private static function lime_video_decoder_open(path:String, format:Int, threads:Int, ringSize:Int):Dynamic;
+
+	@:cffi private static function lime_video_decoder_read(handle:Dynamic, time:Float, data:DataPointer, length:Int):Float;
+
+	@:cffi private static function lime_video_decoder_seek(handle:Dynamic, time:Float):Void;
+
+	@:cffi private static function lime_video_recorder_add_frame(handle:Dynamic, imageBuffer:Dynamic, time:Float):Bool;
+
+	@:cffi private static function lime_video_recorder_close(handle:Dynamic):Bool;
+
+	@:cffi private static function lime_video_recorder_create(path:String, width:Int, height:Int, frameRate:Float, codec:Int, bitrate:Int, threads:Int,
+		queueSize:Int):Dynamic;
+
+	@:cffi private static function lime_video_recorder_get_dropped_frames(handle:Dynamic):Int;
+
+	@:cffi private static function lime_video_recorder_get_encoded_frames(handle:Dynamic):Int;
+	#else
+	private static var lime_video_decoder_close = new cpp.Callable<cpp.Object->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_video_decoder_close", "ov", false));
+	private static var lime_video_decoder_get_info = new cpp.Callable<cpp.Object->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_video_decoder_get_info", "oo", false));
+	private static var lime_video_decoder_open = new cpp.Callable<String->Int->Int->Int->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_video_decoder_open", "siiio", false));
+	private static var lime_video_decoder_read = new cpp.Callable<cpp.Object->Float->lime.utils.DataPointer->Int->Float>(cpp.Prime._loadPrime("lime",
+		"lime_video_decoder_read", "oddid", false));
+	private static var lime_video_decoder_seek = new cpp.Callable<cpp.Object->Float->cpp.Void>(cpp.Prime._loadPrime("lime",
+		"lime_video_decoder_seek", "odv", false));
+	private static var lime_video_recorder_add_frame = new cpp.Callable<cpp.Object->cpp.Object->Float->Bool>(cpp.Prime._loadPrime("lime",
+		"lime_video_recorder_add_frame", "oodb", false));
+	private static var lime_video_recorder_close = new cpp.Callable<cpp.Object->Bool>(cpp.Prime._loadPrime("lime", "lime_video_recorder_close", "ob", false));
+	private static var lime_video_recorder_create = new cpp.Callable<String->Int->Int->Float->Int->Int->Int->Int->cpp.Object>(cpp.Prime._loadPrime("lime",
+		"lime_video_recorder_create", "siidiiiio", false));
+	private static var lime_video_recorder_get_dropped_frames = new cpp.Callable<cpp.Object->Int>(cpp.Prime._loadPrime("lime",
+		"lime_video_recorder_get_dropped_frames", "oi", false));
+	private static var lime_video_recorder_get_encoded_frames = new cpp.Callable<cpp.Object->Int>(cpp.Prime._loadPrime("lime",
+		"lime_video_recorder_get_encoded_frames", "oi", false));
+	#end
+	#end
+	#if (neko || cppia)
+	private static var lime_video_decoder_close = CFFI.load("lime", "lime_video_decoder_close", 1);
+	private static var lime_video_decoder_get_info = CFFI.load("lime", "lime_video_decoder_get_info", 1);
+	private static var lime_video_decoder_open = CFFI.load("lime", "lime_video_decoder_open", 4);
+	private static var lime_video_decoder_read = CFFI.load("lime", "lime_video_decoder_read", 4);
+	private static var lime_video_decoder_seek = CFFI.load("lime", "lime_video_decoder_seek", 2);
+	private static var lime_video_recorder_add_frame = CFFI.load("lime", "lime_video_recorder_add_frame", 3);
+	private static var lime_video_recorder_close = CFFI.load("lime", "lime_video_recorder_close", 1);
+	private static var lime_video_recorder_create = CFFI.load("lime", "lime_video_recorder_create", -1);
+	private static var lime_video_recorder_get_dropped_frames = CFFI.load("lime", "lime_video_recorder_get_dropped_frames", 1);
+	private static var lime_video_recorder_get_encoded_frames = CFFI.load("lime", "lime_video_recorder_get_encoded_frames", 1);
+	#end
+
+	#if hl
+	@:hlNative("lime", "hl_video_decoder_close") private static function lime_video_decoder_close(handle:CFFIPointer):Void {}
+
+	@:hlNative("lime", "hl_video_decoder_get_info") private static function lime_video_decoder_get_info(handle:CFFIPointer):Dynamic
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_video_decoder_open") private static function lime_video_decoder_open(path:String, format:Int, threads:Int, ringSize:Int):CFFIPointer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_video_decoder_read") private static function lime_video_decoder_read(handle:CFFIPointer, time:Float, data:DataPointer, length:Int):Float
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_video_decoder_seek") private static function lime_video_decoder_seek(handle:CFFIPointer, time:Float):Void {}
+
+	@:hlNative("lime", "hl_video_recorder_add_frame") private static function lime_video_recorder_add_frame(handle:CFFIPointer, imageBuffer:ImageBuffer,
+			time:Float):Bool
+	{
+		return false;
+	}
+
+	@:hlNative("lime", "hl_video_recorder_close") private static function lime_video_recorder_close(handle:CFFIPointer):Bool
+	{
+		return false;
+	}
+
+	@:hlNative("lime", "hl_video_recorder_create") private static function lime_video_recorder_create(path:String, width:Int, height:Int, frameRate:Float,
+			codec:Int, bitrate:Int, threads:Int, queueSize:Int):CFFIPointer
+	{
+		return null;
+	}
+
+	@:hlNative("lime", "hl_video_recorder_get_dropped_frames") private static function lime_video_recorder_get_dropped_frames(handle:CFFIPointer):Int
+	{
+		return 0;
+	}
+
+	@:hlNative("lime", "hl_video_recorder_get_encoded_frames") private static function lime_video_recorder_get_encoded_frames(handle:CFFIPointer):Int
+	{
+		return 0;
+	}
+	#end
+	#end
 }
@@ -1,22 +1,19 @@
 package lime._internal.backend.native;
 
 import haxe.io.Bytes;
-import haxe.io.BytesBuffer;
 import haxe.Timer;
 import lime.app.Future;
 import lime.app.Promise;
 import lime.net.curl.CURL;
 import lime.net.curl.CURLCode;
-import lime.net.curl.CURLMulti;
-import lime.net.curl.CURLMultiCode;
-import lime.net.curl.CURLMultiMessage;
 import lime.net.HTTPRequest;
 import lime.net.HTTPRequestHeader;
 import lime.net.HTTPRequestMethod;
+import lime.system.CFFI;
+import lime.system.CFFIPointer;
 import lime.system.ThreadPool;
 import lime.system.WorkOutput;
 #if sys
-import sys.thread.Deque;
 import sys.FileSystem;
 #end
 
@@ -24,35 +21,35 @@ import sys.FileSystem;
 @:fileXml('tags="haxe,release"')
 @:noDebug
 #end
+@:access(lime._internal.backend.native.NativeCFFI)
 class NativeHTTPRequest
 {
-	private static var activeInstances:Array<NativeHTTPRequest>;
+	private static inline var CLIENT_FOLLOW_REDIRECTS = 1;
+	private static inline var CLIENT_MANAGE_COOKIES = 2;
+	private static inline var CLIENT_NO_BODY = 4;
+	private static inline var CLIENT_RESPONSE_HEADERS = 8;
+	private static inline var CLIENT_TEXT = 16;
+	private static inline var MESSAGE_PROGRESS = 1;
+	private static inline var PROGRESS_INTERVAL = 0.008;
+
+	private static var client:CFFIPointer;
+	private static var clientInstances:Map<Int, NativeHTTPRequest>;
+	private static var clientTimer:Timer;
 	private static var localThreadPool:ThreadPool;
-	private static var multi:CURLMulti;
-	private static var multiInstances:Map<CURL, NativeHTTPRequest>;
-	private static var multiProgressTimer:Timer;
-	private static var multiThreadPool:ThreadPool;
-	private static var multiThreadPoolRunning:Bool;
-	#if (cpp || neko || hl)
-	private static var multiAddHandle:Deque<CURL>;
+	#if hl
+	private static var messageObject:Dynamic = {};
 	#end
-	private static var cookieList:Array<String>;
 
-	private var buffer:BytesBuffer = new BytesBuffer();
 	private var bytes:Bytes;
-	private var bytesLoaded:Int;
-	private var bytesTotal:Int;
 	private var canceled:Bool;
-	private var curl:CURL;
 	private var parent:_IHTTPRequest;
 	private var promise:Promise<Bytes>;
-	private var writeBytesLoaded:Int;
-	private var writeBytesTotal:Int;
+	private var requestID:Int;
 	private var timeout:Timer;
 
 	public function new()
 	{
-		curl = null;
+		requestID = -1;
 		timeout = null;
 	}
 
@@ -60,15 +57,14 @@ class NativeHTTPRequest
 	{
 		canceled = true;
 
-		if (curl != null)
+		#if (lime_cffi && !macro && lime_curl)
+		if (requestID > -1)
 		{
-			// This is probably run from a different thread if cURL is running
-			// TODO
-
-			// CURLEasy.cleanup (curl);
-			// CURLEasy.reset (curl);
-			// CURLEasy.perform (curl);
+			NativeCFFI.lime_http_client_cancel(client, requestID);
+			clientInstances.remove(requestID);
+			requestID = -1;
 		}
+		#end
 
 		if (timeout != null)
 		{
@@ -82,24 +78,9 @@ class NativeHTTPRequest
 		this.parent = parent;
 	}
 
-	private function initRequest(uri:String, binary:Bool):Void
+	private function initRequest(uri:String, binary:Bool):Int
 	{
-		bytes = Bytes.alloc(0);
-
-		bytesLoaded = 0;
-		bytesTotal = 0;
-		writeBytesLoaded = 0;
-		writeBytesTotal = 0;
-
-		if (curl == null)
-		{
-			curl = new CURL();
-		}
-		else
-		{
-			curl.reset();
-		}
-
+		#if (lime_cffi && !macro && lime_curl)
 		var data = parent.data;
 		var query = "";
 
@@ -135,54 +116,9 @@ class NativeHTTPRequest
 			if (data != null && data.length == 0) data = null;
 		}
 
-		curl.setOption(URL, uri);
-
-		switch (parent.method)
-		{
-			case HEAD:
-				curl.setOption(NOBODY, true);
-
-			case GET:
-				curl.setOption(HTTPGET, true);
-
-			case POST:
-				curl.setOption(POST, true);
-
-				if (data != null)
-				{
-					curl.setOption(INFILE, data);
-					curl.setOption(INFILESIZE, data.length);
-					curl.setOption(POSTFIELDSIZE, data.length);
-				}
-				else
-				{
-					curl.setOption(POSTFIELDSIZE, 0);
-				}
-
-			case PUT:
-				curl.setOption(UPLOAD, true);
-
-				if (data != null)
-				{
-					curl.setOption(INFILE, data);
-					curl.setOption(INFILESIZE, data.length);
-				}
-
-			case _:
-				curl.setOption(CUSTOMREQUEST, Std.string(parent.method));
-
-				if (data != null)
-				{
-					curl.setOption(INFILE, data);
-					curl.setOption(INFILESIZE, data.length);
-				}
-		}
-
-		curl.setOption(FOLLOWLOCATION, parent.followRedirects);
-		curl.setOption(AUTOREFERER, true);
-
 		var headers = [];
 		headers.push("Expect: ");
+		headers.push("User-Agent: " + (parent.userAgent == null ? "libcurl-agent/1.0" : parent.userAgent));
 
 		var contentType = null;
 
@@ -220,43 +156,33 @@ class NativeHTTPRequest
 			headers.push("Content-Type: " + contentType);
 		}
 
-		curl.setOption(HTTPHEADER, headers);
-
-		curl.setOption(PROGRESSFUNCTION, curl_onProgress);
-		curl.setOption(WRITEFUNCTION, curl_onWrite);
+		var flags = 0;
+		if (parent.followRedirects) flags |= CLIENT_FOLLOW_REDIRECTS;
+		if (parent.manageCookies) flags |= CLIENT_MANAGE_COOKIES;
+		if (parent.method == HEAD) flags |= CLIENT_NO_BODY;
+		if (!binary) flags |= CLIENT_TEXT;
 
 		if (parent.enableResponseHeaders)
 		{
 			parent.responseHeaders = [];
-			curl.setOption(HEADERFUNCTION, curl_onHeader);
+			flags |= CLIENT_RESPONSE_HEADERS;
 		}
 
-		if (parent.manageCookies)
+		#if hl
+		var nativeHeaders = new hl.NativeArray<String>(headers.length);
+		for (i in 0...headers.length)
 		{
-			// an empty string means store cookies in memory
-			// cookies are stored only for the current session
-			curl.setOption(COOKIEFILE, "");
-			if (cookieList != null)
-			{
-				for (cookie in cookieList)
-				{
-					// pass in each stored cookie individually
-					curl.setOption(COOKIELIST, cookie);
-				}
-			}
+			nativeHeaders[i] = headers[i];
 		}
 
-		curl.setOption(SSL_VERIFYPEER, false);
-		curl.setOption(SSL_VERIFYHOST, 0);
-		curl.setOption(USERAGENT, parent.userAgent == null ? "libcurl-agent/1.0" : parent.userAgent);
-
-		// curl.setOption (CONNECTTIMEOUT, 30);
-		curl.setOption(NOSIGNAL, true);
-
-		curl.setOption(TRANSFERTEXT, !binary);
-
-		#if curl_verbose
-		curl.setOption(VERBOSE, true);
+		return NativeCFFI.lime_http_client_request(client, uri, Std.string(parent.method), nativeHeaders, data, flags, parent.timeout,
+			PROGRESS_INTERVAL);
+		#else
+		return NativeCFFI.lime_http_client_request(client, uri, Std.string(parent.method), headers, data, flags, parent.timeout,
+			PROGRESS_INTERVAL);
+		#end
+		#else
+		return -1;
 		#end
 	}
 
@@ -286,47 +212,34 @@ class NativeHTTPRequest
 		}
 		else
 		{
-			if (multi == null)
+			#if (lime_cffi && !macro && lime_curl)
+			if (client == null)
 			{
 				CURL.globalInit(CURL.GLOBAL_ALL);
 
-				multi = new CURLMulti();
-				activeInstances = new Array();
-				multiInstances = new Map();
+				client = NativeCFFI.lime_http_client_create(0, null);
+				clientInstances = new Map();
 			}
 
-			initRequest(uri, binary);
+			requestID = initRequest(uri, binary);
 
-			if (curl != null)
+			if (requestID > -1)
 			{
-				activeInstances.push(this);
-				multiInstances.set(curl, this);
+				clientInstances.set(requestID, this);
 
-				#if (cpp || neko || hl)
-				if (multiAddHandle == null) multiAddHandle = new Deque<CURL>();
-				multiAddHandle.add(curl);
-				#end
-
-				if (multiThreadPool == null)
+				if (clientTimer == null)
 				{
-					multiThreadPool = new ThreadPool(0, 1);
-					multiThreadPool.onProgress.add(multiThreadPool_onProgress);
-					multiThreadPool.onComplete.add(multiThreadPool_onComplete);
-				}
-
-				if (!multiThreadPoolRunning)
-				{
-					multiThreadPoolRunning = true;
-					multiThreadPool.run(multiThreadPool_doWork, multi);
-				}
-
-				if (multiProgressTimer == null)
-				{
-					multiProgressTimer = new Timer(8);
-					multiProgressTimer.run = multiProgressTimer_onRun;
-					multiProgressTimer_onRun();
+					clientTimer = new Timer(8);
+					clientTimer.run = clientTimer_onRun;
 				}
 			}
+			else
+			{
+				promise.error(new _HTTPRequestErrorResponse("Cannot load URI: " + uri, null));
+			}
+			#else
+			promise.error(new _HTTPRequestErrorResponse("Cannot load URI: " + uri, null));
+			#end
 		}
 
 		return promise.future;
@@ -355,43 +268,108 @@ class NativeHTTPRequest
 		return promise.future;
 	}
 
-	private function buildBuffer()	{
-		bytes = buffer.getBytes();
-		return bytes;
-	}
-
 	// Event Handlers
-	private function curl_onHeader(curl:CURL, header:String):Void
+	private static function clientTimer_onRun():Void
 	{
-		var parts = header.split(': ');
+		#if (lime_cffi && !macro && lime_curl)
+		var message:Dynamic = NativeCFFI.lime_http_client_read(client #if hl, messageObject #end);
 
-		if (parts.length == 2)
+		while (message != null)
 		{
-			parent.responseHeaders.push(new HTTPRequestHeader(StringTools.trim(parts[0]), StringTools.trim(parts[1])));
+			var instance = clientInstances.get(message.id);
+
+			if (instance != null)
+			{
+				if (message.type == MESSAGE_PROGRESS)
+				{
+					if (!instance.promise.isComplete && !instance.promise.isError)
+					{
+						instance.promise.progress(Std.int(message.bytesLoaded), Std.int(message.bytesTotal));
+					}
+				}
+				else
+				{
+					clientInstances.remove(message.id);
+					instance.requestID = -1;
+					instance.complete(message);
+				}
+			}
+
+			message = NativeCFFI.lime_http_client_read(client #if hl, messageObject #end);
 		}
+
+		if (!clientInstances.iterator().hasNext())
+		{
+			clientTimer.stop();
+			clientTimer = null;
+		}
+		#end
 	}
 
-	private function curl_onProgress(curl:CURL, dltotal:Float, dlnow:Float, uptotal:Float, upnow:Float):Int
+	private function complete(message:Dynamic):Void
 	{
-		if (upnow > writeBytesLoaded || dlnow > writeBytesLoaded || uptotal > writeBytesTotal || dltotal > writeBytesTotal)
+		#if (lime_cffi && !macro && lime_curl)
+		var status:Int = message.status;
+		var result:Int = message.result;
+
+		parent.responseStatus = status;
+
+		if (parent.enableResponseHeaders)
 		{
-			if (upnow > writeBytesLoaded) writeBytesLoaded = Std.int(upnow);
-			if (dlnow > writeBytesLoaded) writeBytesLoaded = Std.int(dlnow);
-			if (uptotal > writeBytesTotal) writeBytesTotal = Std.int(uptotal);
-			if (dltotal > writeBytesTotal) writeBytesTotal = Std.int(dltotal);
+			var headers:String = CFFI.stringValue(NativeCFFI.lime_http_client_get_headers(client));
+
+			if (headers != null)
+			{
+				for (line in headers.split("\n"))
+				{
+					var parts = line.split(': ');
 
-			// Wrong thread
-			// promise.progress (bytesLoaded, bytesTotal);
+					if (parts.length == 2)
+					{
+						parent.responseHeaders.push(new HTTPRequestHeader(StringTools.trim(parts[0]), StringTools.trim(parts[1])));
+					}
+				}
+			}
 		}
 
-		return 0;
-	}
+		if (result == CURLCode.OK)
+		{
+			bytes = Bytes.alloc(message.length);
+			if (bytes.length > 0) NativeCFFI.lime_http_client_read_data(client, bytes);
 
-	private function curl_onWrite(curl:CURL, output:Bytes):Int
-	{
-		buffer.addBytes(output, 0, output.length);
+			if ((status >= 200 && status < 400) || status == 0)
+			{
+				if (!promise.isError)
+				{
+					promise.complete(bytes);
+				}
+			}
+			else if (bytes.length > 0)
+			{
+				var error = bytes.getString(0, bytes.length);
+				promise.error(new _HTTPRequestErrorResponse(error, bytes));
+			}
+			else
+			{
+				var error = 'Status ${status}';
+				promise.error(new _HTTPRequestErrorResponse(error, bytes));
+			}
+		}
+		else
+		{
+			var error = CURL.strerror(result);
+			promise.error(new _HTTPRequestErrorResponse(error, null));
+		}
 
-		return output.length;
+		if (timeout != null)
+		{
+			timeout.stop();
+			timeout = null;
+		}
+
+		bytes = null;
+		promise = null;
+		#end
 	}
 
 	private static function localThreadPool_doWork(state:Dynamic, output:WorkOutput):Void
@@ -486,131 +464,4 @@ class NativeHTTPRequest
 		if (promise.isComplete || promise.isError) return;
 		promise.progress(state.bytesLoaded, state.bytesTotal);
 	}
-
-	private static function multiThreadPool_doWork(multi:CURLMulti, output:WorkOutput):Void
-	{
-		while (true)
-		{
-			#if (cpp || neko || hl)
-			var curl = multiAddHandle.pop(false);
-			if (curl != null) multi.addHandle(curl);
-			#end
-
-			var code = multi.wait(1000);
-
-			if (code == CURLMultiCode.OK)
-			{
-				multi.perform();
-				var message = multi.infoRead();
-
-				if (message == null && multi.runningHandles == 0)
-				{
-					output.sendComplete();
-					break;
-				}
-
-				while (message != null)
-				{
-					var curl = message.curl;
-					var status = curl.getInfo(RESPONSE_CODE);
-
-					// returns an array of cookie values
-					cookieList = curl.getInfo(COOKIELIST);
-
-					multi.removeHandle(curl);
-					curl.cleanup();
-
-					output.sendProgress({curl: curl, result: message.result, status: status});
-					message = multi.infoRead();
-				}
-			}
-		}
-	}
-
-	private static function multiThreadPool_onComplete(_):Void
-	{
-		#if (cpp || neko || hl)
-		var curl = multiAddHandle.pop(false);
-
-		if (curl != null)
-		{
-			multiAddHandle.push(curl);
-			multiThreadPool.run(multiThreadPool_doWork, multi);
-		}
-		else
-		{
-			if (multiProgressTimer != null)
-			{
-				multiProgressTimer.stop();
-				multiProgressTimer = null;
-			}
-
-			multiThreadPoolRunning = false;
-		}
-		#end
-	}
-
-	private static function multiThreadPool_onProgress(state:{curl:CURL, result:Int, status:Int}):Void
-	{
-		if (multiInstances.exists(state.curl))
-		{
-			var instance = multiInstances.get(state.curl);
-			activeInstances.remove(instance);
-			multiInstances.remove(state.curl);
-
-			instance.parent.responseStatus = state.status;
-
-			if (state.result == CURLCode.OK)
-			{
-				if ((state.status >= 200 && state.status < 400) || state.status == 0)
-				{
-					if (!instance.promise.isError)
-					{
-						instance.promise.complete(instance.buildBuffer());
-					}
-				}
-				else if (instance.bytes != null)
-				{
-					var error = instance.bytes.getString(0, instance.bytes.length);
-					var responseData = instance.buildBuffer();
-					instance.promise.error(new _HTTPRequestErrorResponse(error, responseData));
-				}
-				else
-				{
-					var error = 'Status ${state.status}';
-					var responseData = instance.buildBuffer();
-					instance.promise.error(new _HTTPRequestErrorResponse(error, responseData));
-				}
-			}
-			else
-			{
-				var error = CURL.strerror(state.result);
-				instance.promise.error(new _HTTPRequestErrorResponse(error, null));
-			}
-
-			if (instance.timeout != null)
-			{
-				instance.timeout.stop();
-				instance.timeout = null;
-			}
-
-			instance.bytes = null;
-			instance.promise = null;
-		}
-
-		state.curl = null;
-	}
-
-	private static function multiProgressTimer_onRun():Void
-	{
-		for (instance in activeInstances)
-		{
-			if (instance.bytesLoaded != instance.writeBytesLoaded || instance.bytesTotal != instance.writeBytesTotal)
-			{
-				instance.bytesLoaded = instance.writeBytesLoaded;
-				instance.bytesTotal = instance.writeBytesTotal;
-				instance.promise.progress(instance.bytesLoaded, instance.bytesTotal);
-			}
-		}
-	}
 }
@@ -3,6 +3,8 @@ package lime._internal.backend.native;
 import haxe.io.Bytes;
 import lime._internal.backend.native.NativeCFFI;
 import lime.app.Application;
+import lime.app.Future;
+import lime.app.Promise;
 import lime.graphics.cairo.Cairo;
 import lime.graphics.cairo.CairoFormat;
 import lime.graphics.cairo.CairoImageSurface;
@@ -20,8 +22,13 @@ import lime.system.Display;
 import lime.system.DisplayMode;
 import lime.system.JNI;
 import lime.system.System;
+import lime.ui.KeyCode;
+import lime.ui.KeyModifier;
+import lime.ui.MouseButton;
 import lime.ui.MouseCursor;
 import lime.ui.Window;
+import lime.utils.DataPointer;
+import lime.utils.Int32Array;
 import lime.utils.UInt8Array;
 
 #if !lime_debug
@@ -39,14 +46,22 @@ import lime.utils.UInt8Array;
 @:access(lime.ui.Window)
 class NativeWindow
 {
+	private static inline var MAX_DIRTY_RECTS:Int = 64;
+
 	public var handle:Dynamic;
 
 	private var closing:Bool;
 	private var cursor:MouseCursor;
+	private var dirtyRectCount:Int;
+	private var dirtyRects:Int32Array;
 	private var displayMode:DisplayMode;
 	private var frameRate:Float;
 	private var mouseLock:Bool;
 	private var parent:Window;
+	private var presentFullFrame:Bool;
+	private var readbackBuffer:ImageBuffer;
+	private var readbackIDs:Array<Int>;
+	private var readbackPromises:Array<Promise<Image>>;
 	private var useHardware:Bool;
 	#if lime_cairo
 	private var cacheLock:Dynamic;
@@ -59,6 +74,7 @@ class NativeWindow
 		this.parent = parent;
 
 		cursor = DEFAULT;
+		dirtyRectCount = 0;
 		displayMode = new DisplayMode(0, 0, 0, 0);
 
 		var attributes = parent.__attributes;
@@ -184,6 +200,34 @@ class NativeWindow
 		setTextInputEnabled(false);
 	}
 
+	public function addDirtyRect(rect:Rectangle):Void
+	{
+		if (presentFullFrame || rect == null) return;
+
+		if (dirtyRectCount >= MAX_DIRTY_RECTS)
+		{
+			// the native side would merge them into (nearly) the whole frame
+			presentFullFrame = true;
+			dirtyRectCount = 0;
+			return;
+		}
+
+		if (dirtyRects == null)
+		{
+			dirtyRects = new Int32Array(MAX_DIRTY_RECTS * 4);
+		}
+
+		var x = Math.floor(rect.x);
+		var y = Math.floor(rect.y);
+		var index = dirtyRectCount * 4;
+
+		dirtyRects[index] = x;
+		dirtyRects[index + 1] = y;
+		dirtyRects[index + 2] = Math.ceil(rect.x + rect.width) - x;
+		dirtyRects[index + 3] = Math.ceil(rect.y + rect.height) - y;
+		dirtyRectCount++;
+	}
+
 	public function alert(message:String, title:String):Void
 	{
 		if (handle != null)
@@ -229,10 +273,62 @@ class NativeWindow
 				primarySurface.flush();
 			}
 			#end
+			if (dirtyRectCount > 0 && !presentFullFrame)
+			{
+				NativeCFFI.lime_window_set_dirty_rects(handle, DataPointer.fromArrayBufferView(dirtyRects), dirtyRectCount);
+			}
+
 			NativeCFFI.lime_window_context_unlock(handle);
 		}
 
+		dirtyRectCount = 0;
+		presentFullFrame = false;
+
 		NativeCFFI.lime_window_context_flip(handle);
+
+		if (readbackIDs != null && readbackIDs.length > 0)
+		{
+			collectReadbacks();
+		}
+		#end
+	}
+
+	private function collectReadbacks():Void
+	{
+		#if (!macro && lime_cffi && !cs)
+		var i = 0;
+
+		while (i < readbackIDs.length)
+		{
+			if (readbackBuffer == null)
+			{
+				readbackBuffer = new ImageBuffer(new UInt8Array(Bytes.alloc(0)));
+			}
+
+			var status:Int = NativeCFFI.lime_window_read_pixels_async_result(handle, readbackIDs[i], readbackBuffer);
+
+			if (status == 0)
+			{
+				i++;
+				continue;
+			}
+
+			var promise = readbackPromises[i];
+			readbackIDs.splice(i, 1);
+			readbackPromises.splice(i, 1);
+
+			if (status > 0)
+			{
+				var imageBuffer = readbackBuffer;
+				imageBuffer.format = RGBA32;
+				readbackBuffer = null;
+				promise.complete(new Image(imageBuffer));
+			}
+			else
+			{
+				promise.error("Pixel readback was discarded");
+			}
+		}
 		#end
 	}
 
@@ -329,6 +425,76 @@ class NativeWindow
 		return false;
 	}
 
+	public function injectKeyDown(keyCode:KeyCode, modifier:KeyModifier):Void
+	{
+		if (handle != null)
+		{
+			#if (!macro && lime_cffi)
+			NativeCFFI.lime_window_inject_key_event(handle, KeyEventType.KEY_DOWN, keyCode, modifier);
+			#end
+		}
+	}
+
+	public function injectKeyUp(keyCode:KeyCode, modifier:KeyModifier):Void
+	{
+		if (handle != null)
+		{
+			#if (!macro && lime_cffi)
+			NativeCFFI.lime_window_inject_key_event(handle, KeyEventType.KEY_UP, keyCode, modifier);
+			#end
+		}
+	}
+
+	public function injectMouseDown(x:Float, y:Float, button:MouseButton):Void
+	{
+		if (handle != null)
+		{
+			#if (!macro && lime_cffi)
+			NativeCFFI.lime_window_inject_mouse_event(handle, MouseEventType.MOUSE_DOWN, x, y, button);
+			#end
+		}
+	}
+
+	public function injectMouseMove(x:Float, y:Float):Void
+	{
+		if (handle != null)
+		{
+			#if (!macro && lime_cffi)
+			NativeCFFI.lime_window_inject_mouse_event(handle, MouseEventType.MOUSE_MOVE, x, y, 0);
+			#end
+		}
+	}
+
+	public function injectMouseUp(x:Float, y:Float, button:MouseButton):Void
+	{
+		if (handle != null)
+		{
+			#if (!macro && lime_cffi)
+			NativeCFFI.lime_window_inject_mouse_event(handle, MouseEventType.MOUSE_UP, x, y, button);
+			#end
+		}
+	}
+
+	public function injectMouseWheel(deltaX:Float, deltaY:Float):Void
+	{
+		if (handle != null)
+		{
+			#if (!macro && lime_cffi)
+			NativeCFFI.lime_window_inject_mouse_event(handle, MouseEventType.MOUSE_WHEEL, deltaX, deltaY, 0);
+			#end
+		}
+	}
+
+	public function injectTextInput(text:String):Void
+	{
+		if (handle != null)
+		{
+			#if (!macro && lime_cffi)
+			NativeCFFI.lime_window_inject_text_event(handle, text);
+			#end
+		}
+	}
+
 	public function move(x:Int, y:Int):Void
 	{
 		if (handle != null)
@@ -422,6 +588,33 @@ class NativeWindow
 		return null;
 	}
 
+	public function readPixelsAsync(rect:Rectangle):Future<Image>
+	{
+		#if (!macro && lime_cffi && !cs)
+		if (useHardware && handle != null)
+		{
+			var id:Int = NativeCFFI.lime_window_read_pixels_async(handle, rect);
+
+			if (id > -1)
+			{
+				if (readbackIDs == null)
+				{
+					readbackIDs = [];
+					readbackPromises = [];
+				}
+
+				var promise = new Promise<Image>();
+				readbackIDs.push(id);
+				readbackPromises.push(promise);
+				return promise.future;
+			}
+		}
+		#end
+
+		// no pixel pack buffers, or every one is in use
+		return Future.withValue(readPixels(rect));
+	}
+
 	public function render():Void
 	{
 		#if (!macro && lime_cffi)
@@ -737,6 +930,12 @@ class NativeWindow
 	}
 }
 
+private enum abstract KeyEventType(Int) to Int
+{
+	var KEY_DOWN = 0;
+	var KEY_UP = 1;
+}
+
 private enum abstract MouseCursorType(Int) from Int to Int
 {
 	var HIDDEN = 0;
@@ -754,6 +953,14 @@ private enum abstract MouseCursorType(Int) from Int to Int
 	var WAIT_ARROW = 12;
 }
 
+private enum abstract MouseEventType(Int) to Int
+{
+	var MOUSE_DOWN = 0;
+	var MOUSE_UP = 1;
+	var MOUSE_MOVE = 2;
+	var MOUSE_WHEEL = 3;
+}
+
 private enum abstract WindowFlags(Int)
 {
 	var WINDOW_FLAG_FULLSCREEN = 0x00000001;
@@ -10,6 +10,7 @@ import lime.ui.Joystick;
 import lime.ui.JoystickHatPosition;
 import lime.ui.KeyCode;
 import lime.ui.KeyModifier;
+import lime.ui.MotionSample;
 import lime.ui.MouseButton;
 import lime.ui.MouseWheelMode;
 import lime.ui.Touch;
@@ -40,6 +41,29 @@ class Application extends Module
 	**/
 	public var deviceOrientation(get, never):Orientation;
 
+	/**
+		The time the input event that is currently being dispatched arrived
+		at, in milliseconds on the `System.getTimer()` clock. Compare it to
+		`System.getTimer()` to measure how long the event waited before the
+		frame loop delivered it. The timestamp has millisecond resolution
+		unless `preciseInput` is enabled. Only set on native targets.
+	**/
+	public var eventTimestamp(default, null):Float = 0;
+
+	/**
+		When greater than zero, every update advances by exactly this many
+		milliseconds and `System.getTimer()` follows the same virtual clock,
+		without waiting between frames. Useful for deterministic, headless
+		runs (see the `lime_headless` define). Only used on native targets.
+	**/
+	public var fixedTimeStep(get, set):Float;
+
+	/**
+		How the application waits between frames when a frame rate is set.
+		Only used on native targets.
+	**/
+	public var framePacing(get, set):FramePacing;
+
 	/**
 		Meta-data values for the application, such as a version or a package name
 	**/
@@ -50,6 +74,14 @@ class Application extends Module
 	**/
 	public var modules(default, null):Array<IModule>;
 
+	/**
+		Merge mouse and touch motion that arrives within one frame into a
+		single move event per window or touch, with the movement summed up.
+		The individual samples remain available through `getMotionHistory()`.
+		Only used on native targets.
+	**/
+	public var motionCoalescing(get, set):Bool;
+
 	/**
 		Update events are dispatched each frame (usually just before rendering)
 	**/
@@ -73,6 +105,17 @@ class Application extends Module
 	**/
 	public var onDeviceOrientationChange = new Event<Orientation->Void>();
 
+	/**
+		Wake up every millisecond while waiting for the next frame to collect
+		input as it arrives, and stamp each event with a microsecond timer as
+		it is queued, so `eventTimestamp` reflects the arrival time instead of
+		the start of the frame. Combine with the `lime_precise_input`
+		define, which also moves joystick and controller input to a dedicated
+		thread where SDL supports it. Events are still dispatched once per
+		frame. Only used on native targets.
+	**/
+	public var preciseInput(get, set):Bool;
+
 	/**
 		The Preloader for the current Application
 	**/
@@ -169,6 +212,27 @@ class Application extends Module
 		return __backend.exec();
 	}
 
+	/**
+		Returns frame timing statistics for the most recent frames, or `null`
+		if the target does not pace its own frames.
+	**/
+	public function getFrameStats():FrameStats
+	{
+		return __backend.getFrameStats();
+	}
+
+	/**
+		Returns the raw mouse and touch samples received since the previous
+		update, while `motionCoalescing` is enabled. The same samples are
+		returned throughout `onUpdate` and `onRender`. Up to 1024 samples are
+		kept per frame.
+		@param	samples	An array to reuse, instead of allocating a new one
+	**/
+	public function getMotionHistory(samples:Array<MotionSample> = null):Array<MotionSample>
+	{
+		return __backend.getMotionHistory(samples);
+	}
+
 	/**
 		Called when a gamepad axis move event is fired
 		@param	gamepad	The current gamepad
@@ -656,6 +720,46 @@ class Application extends Module
 	{
 		return __backend.getDeviceOrientation();
 	}
+
+	@:noCompletion private function get_fixedTimeStep():Float
+	{
+		return __backend.fixedTimeStep;
+	}
+
+	@:noCompletion private function set_fixedTimeStep(value:Float):Float
+	{
+		return __backend.setFixedTimeStep(value);
+	}
+
+	@:noCompletion private function get_framePacing():FramePacing
+	{
+		return __backend.framePacing;
+	}
+
+	@:noCompletion private function set_framePacing(value:FramePacing):FramePacing
+	{
+		return __backend.setFramePacing(value);
+	}
+
+	@:noCompletion private function get_motionCoalescing():Bool
+	{
+		return __backend.motionCoalescing;
+	}
+
+	@:noCompletion private function set_motionCoalescing(value:Bool):Bool
+	{
+		return __backend.setMotionCoalescing(value);
+	}
+
+	@:noCompletion private function get_preciseInput():Bool
+	{
+		return __backend.preciseInput;
+	}
+
+	@:noCompletion private function set_preciseInput(value:Bool):Bool
+	{
+		return __backend.setPreciseInput(value);
+	}
 }
 
 #if air
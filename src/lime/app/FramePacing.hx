@@ -0,0 +1,26 @@
+package lime.app;
+
+/**
+	How a native application waits between frames when a frame rate is set.
+**/
+enum abstract FramePacing(Int) from Int to Int
+{
+	/**
+		Sleep until shortly before the next frame, then spin for the rest of
+		the interval. The spin margin is calibrated against the measured
+		oversleep of the system timer. This is the default.
+	**/
+	var PRECISE = 0;
+
+	/**
+		Behaves like `PRECISE`, but does not wait at all while vsync already
+		limits the frame rate to the target or below.
+	**/
+	var ADAPTIVE = 1;
+
+	/**
+		Only sleep, never spin. Uses the least CPU, at the cost of more
+		jitter on platforms with a coarse timer.
+	**/
+	var POWER_SAVING = 2;
+}
@@ -0,0 +1,33 @@
+package lime.app;
+
+/**
+	Frame timing statistics over the most recent frames (up to 240), as
+	returned by `Application.getFrameStats()`. Times are in milliseconds.
+**/
+typedef FrameStats =
+{
+	/**
+		The number of frames since the application started.
+	**/
+	public var frames:Float;
+
+	public var frameTimeP50:Float;
+	public var frameTimeP99:Float;
+
+	/**
+		The distance between the frame time and the frame period.
+	**/
+	public var jitterP50:Float;
+
+	public var jitterP99:Float;
+
+	/**
+		Frames that took more than one and a half frame periods.
+	**/
+	public var missed:Int;
+
+	/**
+		The current spin margin of the `PRECISE` and `ADAPTIVE` policies.
+	**/
+	public var spinMargin:Float;
+}
@@ -1651,6 +1651,23 @@ class Image
 		}
 	}
 
+	#if (lime_cffi && !macro)
+	@:noCompletion private function __fromNativePointer(data:Float, length:Int):Bool
+	{
+		if (data == 0 || length <= 0) return false;
+
+		var imageBuffer:ImageBuffer = NativeCFFI.lime_image_load_data_pointer(data, length, new ImageBuffer(new UInt8Array(Bytes.alloc(0))));
+
+		if (imageBuffer != null)
+		{
+			__fromImageBuffer(imageBuffer);
+			return true;
+		}
+
+		return false;
+	}
+	#end
+
 	private static function __isGIF(bytes:Bytes):Bool
 	{
 		if (bytes == null || bytes.length < 6) return false;
@@ -74,6 +74,7 @@ class AudioBuffer
 	@:noCompletion private var __srcHowl:#if lime_howlerjs Howl #else Dynamic #end;
 	@:noCompletion private var __srcSound:#if flash Sound #else Dynamic #end;
 	@:noCompletion private var __srcVorbisFile:#if lime_vorbis VorbisFile #else Dynamic #end;
+	@:noCompletion private var __srcWAVStream:#if lime_cffi WAVStream #else Dynamic #end;
 
 	#if commonjs
 	private static function __init__()
@@ -312,6 +313,25 @@ class AudioBuffer
 	}
 	#end
 
+	/**
+		Creates an `AudioBuffer` that streams its data from a `WAVStream`.
+
+		@param stream The `WAVStream` to read audio data from.
+		@return An `AudioBuffer` instance backed by the stream.
+	**/
+	public static function fromWAVStream(stream:WAVStream):AudioBuffer
+	{
+		if (stream == null) return null;
+
+		var audioBuffer = new AudioBuffer();
+		audioBuffer.channels = stream.channels;
+		audioBuffer.sampleRate = stream.sampleRate;
+		audioBuffer.bitsPerSample = stream.bitsPerSample;
+		audioBuffer.__srcWAVStream = stream;
+
+		return audioBuffer;
+	}
+
 	/**
 		Asynchronously loads an `AudioBuffer` from a file.
 
@@ -444,6 +464,18 @@ class AudioBuffer
 		return null;
 	}
 
+	#if (lime_cffi && !macro)
+	@:noCompletion private static function __fromNativePointer(data:Float, length:Int):AudioBuffer
+	{
+		if (data == 0 || length <= 0) return null;
+
+		var audioBuffer = new AudioBuffer();
+		audioBuffer.data = new UInt8Array(Bytes.alloc(0));
+
+		return NativeCFFI.lime_audio_load_data_pointer(data, length, audioBuffer);
+	}
+	#end
+
 	// Get & Set Methods
 	@:noCompletion private function get_src():Dynamic
 	{
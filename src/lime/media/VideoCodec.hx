@@ -0,0 +1,7 @@
+package lime.media;
+
+enum abstract VideoCodec(Int) from Int to Int
+{
+	var VP8 = 0;
+	var VP9 = 1;
+}
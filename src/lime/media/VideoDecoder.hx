@@ -0,0 +1,235 @@
+package lime.media;
+
+#if (!lime_doc_gen || (lime_vpx && lime_webm))
+import lime._internal.backend.native.NativeCFFI;
+import lime.app.Event;
+import lime.graphics.Image;
+import lime.utils.DataPointer;
+import lime.utils.UInt8Array;
+
+/**
+	Plays the video track of a WebM file (VP8, or VP9 when the native build
+	has `LIME_VPX_VP9`).
+
+	Demuxing and decoding run ahead of playback on a background thread, and
+	`update` picks up the frame that is due at the current time. Frames land
+	in `image` as RGBA, or in `planes` as packed I420 (the Y plane, followed
+	by the quarter size U and V planes) when the decoder is opened with the
+	`I420` format, ready to be uploaded as textures and converted in a
+	shader.
+
+	Set `clock` to the `AudioSource` playing the soundtrack to keep the video
+	in sync with it, otherwise the decoder follows the time passed to
+	`update`.
+
+	Requires a native build with `LIME_VPX` and `LIME_WEBM`, and the
+	`lime-vpx` and `lime-webm` defines.
+**/
+#if hl
+@:keep
+#end
+@:access(lime._internal.backend.native.NativeCFFI)
+class VideoDecoder
+{
+	/**
+		When set, playback follows the current time of this audio source
+	**/
+	public var clock:AudioSource;
+
+	public var codec(default, null):VideoCodec;
+
+	/**
+		The playback position, in milliseconds
+	**/
+	public var currentTime(get, set):Float;
+
+	/**
+		The length of the video, in milliseconds, or `0` if the file does not say
+	**/
+	public var duration(default, null):Float;
+
+	public var format(default, null):VideoFrameFormat;
+
+	/**
+		The nominal frame rate, or `0` if the file does not say
+	**/
+	public var frameRate(default, null):Float;
+
+	public var height(default, null):Int;
+
+	/**
+		The current frame, when decoding to `RGBA`
+	**/
+	public var image(default, null):Image;
+
+	/**
+		Dispatched when the last frame has been shown
+	**/
+	public var onComplete = new Event<Void->Void>();
+
+	/**
+		Dispatched from `update` when a new frame is available
+	**/
+	public var onFrame = new Event<Void->Void>();
+
+	/**
+		The current frame, when decoding to `I420`
+	**/
+	public var planes(default, null):UInt8Array;
+
+	public var playing(default, null):Bool;
+	public var width(default, null):Int;
+
+	@:noCompletion private var __data:UInt8Array;
+	@:noCompletion private var __handle:Dynamic;
+	@:noCompletion private var __time:Float;
+
+	@:noCompletion private function new(handle:Dynamic, format:VideoFrameFormat)
+	{
+		__handle = handle;
+		__time = 0;
+
+		this.format = format;
+
+		#if (lime_cffi && lime_vpx && lime_webm && !macro)
+		var info = NativeCFFI.lime_video_decoder_get_info(handle);
+		codec = info.codec;
+		duration = info.duration;
+		frameRate = info.frameRate;
+		height = info.height;
+		width = info.width;
+		#end
+
+		if (format == I420)
+		{
+			planes = new UInt8Array(width * height + ((width + 1) >> 1) * ((height + 1) >> 1) * 2);
+			__data = planes;
+		}
+		else
+		{
+			image = new Image(null, 0, 0, width, height, 0xFF000000);
+			__data = image.data;
+		}
+	}
+
+	/**
+		Stops the decoder thread and closes the file
+	**/
+	public function dispose():Void
+	{
+		#if (lime_cffi && lime_vpx && lime_webm && !macro)
+		if (__handle != null)
+		{
+			NativeCFFI.lime_video_decoder_close(__handle);
+			__handle = null;
+		}
+		#end
+
+		playing = false;
+	}
+
+	/**
+		Opens a WebM file for playback.
+		@param	path	The file path
+		@param	format	(Optional) The frame format
+		@param	threads	(Optional) The number of decoder threads, or `0` for the default
+		@param	ringSize	(Optional) The number of frames decoded ahead, or `0` for the default
+		@return	A new `VideoDecoder` instance, or `null` if the file could not be opened
+	**/
+	public static function fromFile(path:String, format:VideoFrameFormat = RGBA, threads:Int = 0, ringSize:Int = 0):VideoDecoder
+	{
+		#if (lime_cffi && lime_vpx && lime_webm && !macro)
+		if (path == null) return null;
+
+		var handle = NativeCFFI.lime_video_decoder_open(path, format, threads, ringSize);
+
+		if (handle != null)
+		{
+			return new VideoDecoder(handle, format);
+		}
+		#end
+
+		return null;
+	}
+
+	public function pause():Void
+	{
+		playing = false;
+	}
+
+	public function play():Void
+	{
+		playing = true;
+	}
+
+	/**
+		Moves playback to a new position. Decoding restarts from the keyframe
+		before it, so the next frame can take a few updates to arrive.
+		@param	time	The new position, in milliseconds
+	**/
+	public function seek(time:Float):Void
+	{
+		if (time < 0) time = 0;
+		__time = time;
+
+		if (clock != null)
+		{
+			clock.currentTime = time;
+		}
+
+		#if (lime_cffi && lime_vpx && lime_webm && !macro)
+		if (__handle != null) NativeCFFI.lime_video_decoder_seek(__handle, time);
+		#end
+	}
+
+	/**
+		Advances playback and picks up the frame that is due, typically called
+		from `Application.update`.
+		@param	deltaTime	The time since the last update, in milliseconds, ignored when `clock` is set
+		@return	`true` if `image` or `planes` changed
+	**/
+	public function update(deltaTime:Float):Bool
+	{
+		#if (lime_cffi && lime_vpx && lime_webm && !macro)
+		if (__handle == null || !playing) return false;
+
+		if (clock != null)
+		{
+			__time = clock.currentTime;
+		}
+		else
+		{
+			__time += deltaTime;
+		}
+
+		var frameTime = NativeCFFI.lime_video_decoder_read(__handle, __time, DataPointer.fromArrayBufferView(__data), __data.byteLength);
+
+		if (frameTime >= 0)
+		{
+			if (image != null) image.version++;
+			onFrame.dispatch();
+			return true;
+		}
+		else if (frameTime == -2)
+		{
+			playing = false;
+			onComplete.dispatch();
+		}
+		#end
+
+		return false;
+	}
+
+	// Get & Set Methods
+	@:noCompletion private function get_currentTime():Float
+	{
+		return __time;
+	}
+
+	@:noCompletion private function set_currentTime(value:Float):Float
+	{
+		seek(value);
+		return __time;
+	}
+}
+#end
@@ -0,0 +1,14 @@
+package lime.media;
+
+enum abstract VideoFrameFormat(Int) from Int to Int
+{
+	/**
+		Frames are converted to RGBA32 on the decoder thread
+	**/
+	var RGBA = 0;
+
+	/**
+		Frames are packed Y, U and V planes, left for a shader to convert
+	**/
+	var I420 = 1;
+}
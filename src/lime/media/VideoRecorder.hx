@@ -0,0 +1,145 @@
+package lime.media;
+
+#if (!lime_doc_gen || (lime_vpx && lime_webm))
+import lime._internal.backend.native.NativeCFFI;
+import lime.graphics.Image;
+import lime.math.Vector2;
+
+/**
+	Records a sequence of images into a WebM file.
+
+	Frames are copied on the calling thread and encoded in the background.
+	When the encoder falls behind, `addFrame` drops the frame and returns
+	`false` instead of blocking, so a recording never stalls the game loop.
+	`droppedFrames` reports how many frames were skipped this way.
+
+	Requires a native build with `LIME_VPX` and `LIME_WEBM`, and the
+	`lime-vpx` and `lime-webm` defines. VP9 additionally needs `LIME_VPX_VP9`.
+**/
+#if hl
+@:keep
+#end
+@:access(lime._internal.backend.native.NativeCFFI)
+class VideoRecorder
+{
+	/**
+		The number of frames that were skipped because the encoder was busy
+	**/
+	public var droppedFrames(get, never):Int;
+
+	/**
+		The number of frames written to the file so far
+	**/
+	public var encodedFrames(get, never):Int;
+
+	public var height(default, null):Int;
+	public var width(default, null):Int;
+
+	@:noCompletion private var __handle:Dynamic;
+	@:noCompletion private var __scratch:Image;
+
+	@:noCompletion private function new(handle:Dynamic, width:Int, height:Int)
+	{
+		__handle = handle;
+		this.width = width;
+		this.height = height;
+	}
+
+	/**
+		Adds a frame to the recording. Images that are not unpremultiplied
+		RGBA32 of the recorder's size are converted first.
+		@param	image	The frame to record
+		@param	time	(Optional) The presentation time in milliseconds, by default frames are spaced evenly at the frame rate
+		@return	`true` if the frame was queued, `false` if it was dropped or the recorder is closed
+	**/
+	public function addFrame(image:Image, time:Float = -1):Bool
+	{
+		#if (lime_cffi && lime_vpx && lime_webm && !macro)
+		if (__handle == null || image == null || image.buffer == null) return false;
+
+		var buffer = image.buffer;
+
+		if (buffer.format != RGBA32 || buffer.premultiplied || image.offsetX != 0 || image.offsetY != 0 || buffer.width != width
+			|| buffer.height != height)
+		{
+			if (__scratch == null)
+			{
+				__scratch = new Image(null, 0, 0, width, height, 0x00000000);
+			}
+
+			__scratch.copyPixels(image, image.rect, new Vector2());
+			buffer = __scratch.buffer;
+		}
+
+		return NativeCFFI.lime_video_recorder_add_frame(__handle, buffer, time);
+		#else
+		return false;
+		#end
+	}
+
+	/**
+		Waits for the queued frames to be encoded and finalizes the file.
+		@return	`true` if the file was written successfully
+	**/
+	public function close():Bool
+	{
+		#if (lime_cffi && lime_vpx && lime_webm && !macro)
+		if (__handle == null) return false;
+
+		var success = NativeCFFI.lime_video_recorder_close(__handle);
+		__scratch = null;
+		return success;
+		#else
+		return false;
+		#end
+	}
+
+	/**
+		Opens a WebM file for recording.
+		@param	path	The output file path
+		@param	width	The frame width in pixels
+		@param	height	The frame height in pixels
+		@param	frameRate	(Optional) The nominal frame rate
+		@param	codec	(Optional) The video codec
+		@param	bitrate	(Optional) The target bitrate in kilobits per second, or `0` for the default
+		@param	threads	(Optional) The number of encoder threads, or `0` for the default
+		@param	queueSize	(Optional) The number of frames that can wait for the encoder, or `0` for the default
+		@return	A new `VideoRecorder` instance, or `null` if the file could not be opened
+	**/
+	public static function create(path:String, width:Int, height:Int, frameRate:Float = 30, codec:VideoCodec = VP8, bitrate:Int = 0, threads:Int = 0,
+			queueSize:Int = 0):VideoRecorder
+	{
+		#if (lime_cffi && lime_vpx && lime_webm && !macro)
+		if (path == null || width <= 0 || height <= 0) return null;
+
+		var handle = NativeCFFI.lime_video_recorder_create(path, width, height, frameRate, codec, bitrate, threads, queueSize);
+
+		if (handle != null)
+		{
+			return new VideoRecorder(handle, width, height);
+		}
+		#end
+
+		return null;
+	}
+
+	// Get & Set Methods
+	@:noCompletion private function get_droppedFrames():Int
+	{
+		#if (lime_cffi && lime_vpx && lime_webm && !macro)
+		if (__handle != null) return NativeCFFI.lime_video_recorder_get_dropped_frames(__handle);
+		#end
+
+		return 0;
+	}
+
+	@:noCompletion private function get_encodedFrames():Int
+	{
+		#if (lime_cffi && lime_vpx && lime_webm && !macro)
+		if (__handle != null) return NativeCFFI.lime_video_recorder_get_encoded_frames(__handle);
+		#end
+
+		return 0;
+	}
+}
+#end
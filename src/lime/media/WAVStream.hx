@@ -0,0 +1,121 @@
+package lime.media;
+
+import haxe.io.Bytes;
+import lime._internal.backend.native.NativeCFFI;
+
+#if hl
+@:keep
+#end
+#if !lime_debug
+@:fileXml('tags="haxe,release"')
+@:noDebug
+#end
+
+/**
+	A WAV file opened for streaming playback.
+
+	The chunk layout is parsed once when the file is opened, and sample data is
+	read from the `data` chunk in small windows as it is needed, so memory use
+	does not grow with the length of the file. 8-bit and 16-bit PCM is read as-is,
+	while 24-bit and 32-bit PCM and 32-bit or 64-bit float data is converted to
+	16-bit PCM on the fly.
+
+	Use `AudioBuffer.fromWAVStream` to play a `WAVStream` through an `AudioSource`.
+**/
+@:access(lime._internal.backend.native.NativeCFFI)
+class WAVStream
+{
+	/**
+		The number of bits per sample returned by `read`, either `8` or `16`.
+	**/
+	public var bitsPerSample(default, null):Int;
+
+	/**
+		The number of audio channels.
+	**/
+	public var channels(default, null):Int;
+
+	/**
+		The total length of the stream, in sample frames.
+	**/
+	public var length(default, null):Float;
+
+	/**
+		The sample rate of the stream, in Hz.
+	**/
+	public var sampleRate(default, null):Int;
+
+	@:noCompletion private var handle:Dynamic;
+
+	@:noCompletion private function new(handle:Dynamic)
+	{
+		this.handle = handle;
+
+		#if (lime_cffi && !macro)
+		var info:Dynamic = NativeCFFI.lime_wav_stream_info(handle);
+		bitsPerSample = info.bitsPerSample;
+		channels = info.channels;
+		length = info.length;
+		sampleRate = info.sampleRate;
+		#end
+	}
+
+	/**
+		Opens a WAV file for streaming.
+		@param path The path to the WAV file.
+		@return A new `WAVStream`, or `null` if the file could not be opened or is not a supported WAV file.
+	**/
+	public static function fromFile(path:String):WAVStream
+	{
+		#if (lime_cffi && !macro)
+		var handle = NativeCFFI.lime_wav_stream_from_file(path);
+
+		if (handle != null)
+		{
+			return new WAVStream(handle);
+		}
+		#end
+
+		return null;
+	}
+
+	/**
+		Reads decoded PCM data into `buffer`.
+		@param buffer The destination bytes.
+		@param position The offset in `buffer` to start writing at.
+		@param length The maximum number of bytes to read.
+		@return The number of bytes read, or `0` at the end of the stream.
+	**/
+	public function read(buffer:Bytes, position:Int, length:Int):Int
+	{
+		#if (lime_cffi && !macro)
+		return NativeCFFI.lime_wav_stream_read(handle, buffer, position, length);
+		#else
+		return 0;
+		#end
+	}
+
+	/**
+		Moves the read position to the given sample frame.
+	**/
+	public function seek(frame:Float):Bool
+	{
+		#if (lime_cffi && !macro)
+		return NativeCFFI.lime_wav_stream_seek(handle, frame);
+		#else
+		return false;
+		#end
+	}
+
+	/**
+		Returns the current read position, in sample frames.
+	**/
+	public function tell():Float
+	{
+		#if (lime_cffi && !macro)
+		return NativeCFFI.lime_wav_stream_tell(handle);
+		#else
+		return 0;
+		#end
+	}
+}
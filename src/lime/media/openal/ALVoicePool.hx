@@ -0,0 +1,147 @@
+package lime.media.openal;
+
+#if (!lime_doc_gen || lime_openal)
+import lime._internal.backend.native.NativeCFFI;
+import lime.system.CFFIPointer;
+
+#if !lime_debug
+@:fileXml('tags="haxe,release"')
+@:noDebug
+#end
+/**
+	A native pool of OpenAL sources shared by lightweight virtual voices.
+
+	Each call to `play` returns a voice handle immediately, even when every
+	source is busy. On `update`, voices are ranked by priority and audibility
+	(gain attenuated by distance from the listener) and only the highest ranked
+	voices own a real source. The rest keep advancing their playback position
+	virtually and resume where they should be once they win a source back.
+
+	Sources are allocated once and reused, so no sources are created or deleted
+	while the pool is in use.
+**/
+@:access(lime._internal.backend.native.NativeCFFI)
+class ALVoicePool
+{
+	/**
+		Voice parameter for `voicef`, controlling how the voice is ranked.
+	**/
+	public static inline var PRIORITY:Int = 0x10000;
+
+	/**
+		Voice parameter for `getVoicei`, returning `1` if the voice does not currently own a source.
+	**/
+	public static inline var VIRTUAL:Int = 0x10001;
+
+	@:noCompletion private var __buffers:Map<Int, ALBuffer>;
+	@:noCompletion private var __handle:CFFIPointer;
+
+	/**
+		Creates a new voice pool.
+		@param maxSources The number of sources to pre-allocate. Fewer are used if the device limit is lower.
+	**/
+	public function new(maxSources:Int = 32)
+	{
+		__buffers = new Map();
+
+		#if (lime_cffi && lime_openal && !macro)
+		__handle = NativeCFFI.lime_al_voice_pool_create(maxSources);
+		#end
+	}
+
+	/**
+		Returns a voice parameter, such as `AL.SOURCE_STATE` or `ALVoicePool.VIRTUAL`.
+	**/
+	public function getVoicei(voice:Int, param:Int):Int
+	{
+		#if (lime_cffi && lime_openal && !macro)
+		return NativeCFFI.lime_al_get_voicei(__handle, voice, param);
+		#else
+		return 0;
+		#end
+	}
+
+	/**
+		Starts a new voice playing `buffer` and returns its handle.
+		A handle of `0` means the voice could not be created.
+	**/
+	public function play(buffer:ALBuffer, priority:Float = 1):Int
+	{
+		#if (lime_cffi && lime_openal && !macro)
+		var voice = NativeCFFI.lime_al_voice_play(__handle, buffer, priority);
+		if (voice != 0) __buffers.set(voice, buffer);
+		return voice;
+		#else
+		return 0;
+		#end
+	}
+
+	/**
+		Stops a voice and returns its source, if any, to the pool.
+	**/
+	public function stop(voice:Int):Void
+	{
+		#if (lime_cffi && lime_openal && !macro)
+		NativeCFFI.lime_al_voice_stop(__handle, voice);
+		__buffers.remove(voice);
+		#end
+	}
+
+	/**
+		Re-ranks all voices and moves sources to the highest ranked voices.
+		Call once per frame.
+		@param deltaTime The elapsed time since the previous update, in seconds.
+	**/
+	public function update(deltaTime:Float):Void
+	{
+		#if (lime_cffi && lime_openal && !macro)
+		NativeCFFI.lime_al_voice_pool_update(__handle, deltaTime);
+
+		var finished = [];
+
+		for (voice in __buffers.keys())
+		{
+			if (NativeCFFI.lime_al_get_voicei(__handle, voice, AL.SOURCE_STATE) != AL.PLAYING)
+			{
+				finished.push(voice);
+			}
+		}
+
+		for (voice in finished)
+		{
+			__buffers.remove(voice);
+		}
+		#end
+	}
+
+	/**
+		Sets a vector voice parameter, such as `AL.POSITION` or `AL.VELOCITY`.
+	**/
+	public function voice3f(voice:Int, param:Int, value1:Float, value2:Float, value3:Float):Void
+	{
+		#if (lime_cffi && lime_openal && !macro)
+		NativeCFFI.lime_al_voice3f(__handle, voice, param, value1, value2, value3);
+		#end
+	}
+
+	/**
+		Sets a float voice parameter, such as `AL.GAIN`, `AL.PITCH` or `ALVoicePool.PRIORITY`.
+	**/
+	public function voicef(voice:Int, param:Int, value:Float):Void
+	{
+		#if (lime_cffi && lime_openal && !macro)
+		NativeCFFI.lime_al_voicef(__handle, voice, param, value);
+		#end
+	}
+
+	/**
+		Sets an integer voice parameter, such as `AL.LOOPING` or `AL.SOURCE_RELATIVE`.
+	**/
+	public function voicei(voice:Int, param:Int, value:Int):Void
+	{
+		#if (lime_cffi && lime_openal && !macro)
+		NativeCFFI.lime_al_voicei(__handle, voice, param, value);
+		#end
+	}
+}
+#end
@@ -11,6 +11,7 @@ import lime.system.CFFIPointer;
 @:noDebug
 #end
 @:access(lime._internal.backend.native.NativeCFFI)
+@:access(lime.net.curl.CURLShare)
 class CURL
 {
 	public static inline var GLOBAL_SSL:Int = 1 << 0;
@@ -141,6 +142,50 @@ class CURL
 		#end
 
 	}*/
+
+	/**
+		Delivers the response body to `callback` in chunks of `chunkSize` bytes
+		(the last chunk may be shorter), holding at most one chunk in memory.
+		Chunks are never smaller than `CURL_MAX_WRITE_SIZE` (16 KB).
+	**/
+	public function setWriteChunkFunction(callback:CURL->Bytes->Int, chunkSize:Int):CURLCode
+	{
+		#if (lime_cffi && lime_curl && !macro)
+		if (chunkSize < 16384) chunkSize = 16384;
+
+		var parameter = function(bytes:Bytes, length:Int):Int
+		{
+			var cacheLength = bytes.length;
+			@:privateAccess bytes.length = length;
+			var read = callback(this, bytes);
+			@:privateAccess bytes.length = cacheLength;
+			return read;
+		}
+
+		return cast NativeCFFI.lime_curl_easy_set_write_chunk(handle, parameter, Bytes.alloc(chunkSize), chunkSize);
+		#else
+		return cast 0;
+		#end
+	}
+
+	/**
+		Writes the response body directly to the file at `path` without passing
+		it through Haxe. With `resume`, an existing file is continued from its
+		current length using a range request. With `preallocate`, disk space for
+		the expected length is reserved once the response size is known.
+
+		The file stays open until `reset`, `cleanup` or another write mode is
+		set; pass `null` to close it.
+	**/
+	public function setWriteFile(path:String, resume:Bool = false, preallocate:Bool = false):CURLCode
+	{
+		#if (lime_cffi && lime_curl && !macro)
+		return cast NativeCFFI.lime_curl_easy_set_write_file(handle, path, resume, preallocate);
+		#else
+		return cast 0;
+		#end
+	}
+
 	public function setOption(option:CURLOption, parameter:Dynamic):CURLCode
 	{
 		#if (lime_cffi && lime_curl && !macro)
@@ -190,6 +235,10 @@ class CURL
 					callback(this, CFFI.stringValue(header));
 				}
 
+			case CURLOption.SHARE:
+				var share:CURLShare = cast parameter;
+				parameter = (share != null) ? share.handle : null;
+
 			case CURLOption.HTTPHEADER:
 				#if hl
 				var headers:Array<String> = cast parameter;
@@ -0,0 +1,210 @@
+package lime.net.curl;
+
+#if (!lime_doc_gen || lime_curl)
+import haxe.Timer;
+import lime._internal.backend.native.NativeCFFI;
+import lime.app.Future;
+import lime.app.Promise;
+import lime.system.CFFI;
+import lime.system.CFFIPointer;
+
+/**
+	Downloads large files straight to disk, splitting each file into byte
+	ranges that are fetched over parallel connections and written at their
+	offsets. Servers that do not accept ranges are downloaded as one stream.
+
+	Failed ranges are retried from the last byte received, waiting
+	`retryDelay` seconds before the first retry and twice as long before each
+	one after it. An optional CRC-32 or SHA-256 digest of the file is computed
+	while it downloads.
+
+	Transfers run on a native thread, so the main thread only handles
+	completion and progress.
+**/
+#if !lime_debug
+@:fileXml('tags="haxe,release"')
+@:noDebug
+#end
+@:access(lime._internal.backend.native.NativeCFFI)
+class CURLDownloadManager
+{
+	public static inline var HASH_NONE:Int = 0;
+	public static inline var HASH_CRC32:Int = 1;
+	public static inline var HASH_SHA256:Int = 2;
+
+	@:noCompletion private static inline var MESSAGE_PROGRESS = 1;
+	@:noCompletion private static inline var PROGRESS_INTERVAL = 0.1;
+
+	/**
+		The number of times a failed range is requested again before the
+		download fails.
+	**/
+	public var maxRetries:Int = 5;
+
+	/**
+		The smallest range, in bytes, a file is split into.
+	**/
+	public var minSegmentSize:Int = 1 << 20;
+
+	/**
+		The delay, in seconds, before a failed range is first retried.
+	**/
+	public var retryDelay:Float = 0.25;
+
+	/**
+		The number of ranges of each file fetched in parallel.
+	**/
+	public var segments:Int = 4;
+
+	@:noCompletion private var expectedDigests:Map<Int, String>;
+	@:noCompletion private var handle:CFFIPointer;
+	#if hl
+	@:noCompletion private var messageObject:Dynamic;
+	#end
+	@:noCompletion private var promises:Map<Int, Promise<String>>;
+	@:noCompletion private var timer:Timer;
+
+	/**
+		@param	maxConnections	The most connections open at once across all
+		downloads, or `0` for no limit.
+	**/
+	public function new(maxConnections:Int = 0)
+	{
+		expectedDigests = new Map();
+		promises = new Map();
+
+		#if hl
+		messageObject = {};
+		#end
+
+		#if (lime_cffi && lime_curl && !macro)
+		CURL.globalInit(CURL.GLOBAL_ALL);
+		handle = NativeCFFI.lime_download_manager_create(maxConnections);
+		#end
+	}
+
+	/**
+		Stops a download started by this manager. The file is left as it was.
+	**/
+	public function cancel(future:Future<String>):Void
+	{
+		for (id in promises.keys())
+		{
+			if (promises.get(id).future == future)
+			{
+				#if (lime_cffi && lime_curl && !macro)
+				NativeCFFI.lime_download_manager_cancel(handle, id);
+				#end
+
+				expectedDigests.remove(id);
+				promises.remove(id);
+				break;
+			}
+		}
+	}
+
+	/**
+		Downloads `url` to the file at `path`, replacing it if it exists.
+
+		The returned future completes with the lowercase hex digest selected by
+		`hash`, or `null` for `HASH_NONE`. If `expectedDigest` is given, the
+		future fails when the digest does not match it.
+	**/
+	public function download(url:String, path:String, hash:Int = HASH_NONE, expectedDigest:String = null):Future<String>
+	{
+		#if (lime_cffi && lime_curl && !macro)
+		var id = NativeCFFI.lime_download_manager_start(handle, url, path, segments, minSegmentSize, hash, maxRetries, retryDelay, PROGRESS_INTERVAL);
+
+		if (id < 0)
+		{
+			return cast Future.withError("Cannot download URI: " + url);
+		}
+
+		var promise = new Promise<String>();
+		promises.set(id, promise);
+
+		if (expectedDigest != null)
+		{
+			expectedDigests.set(id, expectedDigest.toLowerCase());
+		}
+
+		if (timer == null)
+		{
+			timer = new Timer(16);
+			timer.run = timer_onRun;
+		}
+
+		return promise.future;
+		#else
+		return cast Future.withError("Cannot download URI: " + url);
+		#end
+	}
+
+	@:noCompletion private function complete(promise:Promise<String>, message:Dynamic, expectedDigest:String):Void
+	{
+		#if (lime_cffi && lime_curl && !macro)
+		var result:Int = message.result;
+
+		if (result == CURLCode.OK)
+		{
+			var digest:String = CFFI.stringValue(NativeCFFI.lime_download_manager_get_digest(handle));
+
+			if (expectedDigest != null && digest != expectedDigest)
+			{
+				promise.error('Digest mismatch: expected ${expectedDigest}, received ${digest}');
+			}
+			else
+			{
+				promise.complete(digest);
+			}
+		}
+		else if (result == CURLCode.HTTP_RETURNED_ERROR)
+		{
+			promise.error('Status ${message.status}');
+		}
+		else
+		{
+			promise.error(CURL.strerror(result));
+		}
+		#end
+	}
+
+	// Event Handlers
+	@:noCompletion private function timer_onRun():Void
+	{
+		#if (lime_cffi && lime_curl && !macro)
+		var message:Dynamic = NativeCFFI.lime_download_manager_read(handle #if hl, messageObject #end);
+
+		while (message != null)
+		{
+			var id:Int = message.id;
+			var promise = promises.get(id);
+
+			if (promise != null)
+			{
+				if (message.type == MESSAGE_PROGRESS)
+				{
+					promise.progress(Std.int(message.bytesLoaded), Std.int(message.bytesTotal));
+				}
+				else
+				{
+					var expectedDigest = expectedDigests.get(id);
+					expectedDigests.remove(id);
+					promises.remove(id);
+
+					complete(promise, message, expectedDigest);
+				}
+			}
+
+			message = NativeCFFI.lime_download_manager_read(handle #if hl, messageObject #end);
+		}
+		#end
+
+		if (!promises.iterator().hasNext())
+		{
+			timer.stop();
+			timer = null;
+		}
+	}
+}
+#end
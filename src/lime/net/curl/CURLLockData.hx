@@ -0,0 +1,16 @@
+package lime.net.curl;
+
+#if (!lime_doc_gen || lime_curl)
+enum abstract CURLLockData(Int) from Int to Int from UInt to UInt
+{
+	var NONE = 0;
+	/* used internally to say that the locking is just made to change the
+		internal state of the share itself */
+	var SHARE = 1;
+	var COOKIE = 2;
+	var DNS = 3;
+	var SSL_SESSION = 4;
+	var CONNECT = 5;
+	var PSL = 6;
+}
+#end
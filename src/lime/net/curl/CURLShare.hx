@@ -0,0 +1,75 @@
+package lime.net.curl;
+
+#if (!lime_doc_gen || lime_curl)
+import lime._internal.backend.native.NativeCFFI;
+import lime.system.CFFI;
+import lime.system.CFFIPointer;
+
+/**
+	A shared cache that several `CURL` handles can use through
+	`CURLOption.SHARE`, so DNS results, TLS sessions, cookies or connections
+	obtained by one handle are reused by the others. Locking is handled
+	natively, so handles on different threads may use the same share.
+
+	libcurl does not support using a shared connection cache
+	(`CURLLockData.CONNECT`) from concurrent threads.
+**/
+#if !lime_debug
+@:fileXml('tags="haxe,release"')
+@:noDebug
+#end
+@:access(lime._internal.backend.native.NativeCFFI)
+class CURLShare
+{
+	@:noCompletion private var handle:CFFIPointer;
+
+	public function new(handle:CFFIPointer = null)
+	{
+		if (handle != null)
+		{
+			this.handle = handle;
+		}
+		else
+		{
+			#if (lime_cffi && lime_curl && !macro)
+			this.handle = NativeCFFI.lime_curl_share_init();
+			#end
+		}
+	}
+
+	/**
+		Releases the share. Handles still using it keep it alive until they
+		are cleaned up or set to another share.
+	**/
+	public function cleanup():Void
+	{
+		#if (lime_cffi && lime_curl && !macro)
+		if (handle != null)
+		{
+			NativeCFFI.lime_curl_share_cleanup(handle);
+			handle = null;
+		}
+		#end
+	}
+
+	public function setOption(option:CURLShareOption, parameter:CURLLockData):CURLShareCode
+	{
+		#if (lime_cffi && lime_curl && !macro)
+		if (handle == null) return CURLShareCode.INVALID;
+		return cast NativeCFFI.lime_curl_share_setopt(handle, option, parameter);
+		#else
+		return cast 0;
+		#end
+	}
+
+	public static function strerror(code:CURLShareCode):String
+	{
+		#if (lime_cffi && lime_curl && !macro)
+		var result = NativeCFFI.lime_curl_share_strerror(code);
+		return CFFI.stringValue(result);
+		#else
+		return null;
+		#end
+	}
+}
+#end
@@ -0,0 +1,20 @@
+package lime.net.curl;
+
+#if (!lime_doc_gen || lime_curl)
+enum abstract CURLShareCode(Int) from Int to Int from UInt /*to UInt*/
+{
+	/* all is fine */
+	var OK = 0;
+	/* 1 */
+	var BAD_OPTION = 1;
+	/* 2 */
+	var IN_USE = 2;
+	/* 3 */
+	var INVALID = 3;
+	/* 4 out of memory */
+	var NOMEM = 4;
+	/* 5 feature not present in lib */
+	var NOT_BUILT_IN = 5;
+	// LAST
+}
+#end
@@ -0,0 +1,11 @@
+package lime.net.curl;
+
+#if (!lime_doc_gen || lime_curl)
+enum abstract CURLShareOption(Int) from Int to Int from UInt to UInt
+{
+	/* specify a data type to share */
+	var SHARE = 1;
+	/* specify which data type to stop sharing */
+	var UNSHARE = 2;
+}
+#end
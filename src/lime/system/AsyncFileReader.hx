@@ -0,0 +1,145 @@
+package lime.system;
+
+#if (!lime_doc_gen || lime_cffi)
+import haxe.io.Bytes;
+import haxe.Timer;
+import lime._internal.backend.native.NativeCFFI;
+import lime.app.Future;
+import lime.app.Promise;
+
+/**
+	Reads files, or byte ranges of files, without blocking the calling
+	thread, so many reads can be in flight while the main thread decodes the
+	ones that have already arrived.
+
+	On Linux, reads are issued through io_uring. Elsewhere, or when io_uring
+	is unavailable, a small pool of native threads performs them.
+
+	Files packed inside an Android APK cannot be read this way. Use
+	`lime.utils.Bytes.loadFromFile` for those.
+**/
+#if !lime_debug
+@:fileXml('tags="haxe,release"')
+@:noDebug
+#end
+@:access(lime._internal.backend.native.NativeCFFI)
+class AsyncFileReader
+{
+	@:noCompletion private var handle:CFFIPointer;
+	#if hl
+	@:noCompletion private var messageObject:Dynamic;
+	#end
+	@:noCompletion private var promises:Map<Int, Promise<Bytes>>;
+	@:noCompletion private var timer:Timer;
+
+	/**
+		@param	threads	The number of threads used when io_uring is not
+		available, or `0` for the default.
+	**/
+	public function new(threads:Int = 0)
+	{
+		promises = new Map();
+
+		#if hl
+		messageObject = {};
+		#end
+
+		#if (lime_cffi && !macro)
+		handle = NativeCFFI.lime_async_file_reader_create(threads);
+		#end
+	}
+
+	/**
+		Discards a read started by this reader. Its future never completes.
+	**/
+	public function cancel(future:Future<Bytes>):Void
+	{
+		for (id in promises.keys())
+		{
+			if (promises.get(id).future == future)
+			{
+				#if (lime_cffi && !macro)
+				NativeCFFI.lime_async_file_reader_cancel(handle, id);
+				#end
+
+				promises.remove(id);
+				break;
+			}
+		}
+	}
+
+	/**
+		Reads `length` bytes of the file at `path`, starting at `offset`. A
+		`length` of `-1` reads to the end of the file. Fewer bytes are
+		returned if the file ends first.
+	**/
+	public function read(path:String, offset:Int = 0, length:Int = -1):Future<Bytes>
+	{
+		#if (lime_cffi && !macro)
+		var id = NativeCFFI.lime_async_file_reader_submit(handle, path, offset, length);
+
+		if (id < 0)
+		{
+			return cast Future.withError("Cannot read file: " + path);
+		}
+
+		var promise = new Promise<Bytes>();
+		promises.set(id, promise);
+
+		if (timer == null)
+		{
+			timer = new Timer(16);
+			timer.run = update;
+		}
+
+		return promise.future;
+		#else
+		return cast Future.withError("Cannot read file: " + path);
+		#end
+	}
+
+	/**
+		Completes the futures of reads that have finished. This runs on a
+		timer while reads are pending, and may be called directly to collect
+		results sooner, such as in a loading loop.
+	**/
+	public function update():Void
+	{
+		#if (lime_cffi && !macro)
+		var message:Dynamic = NativeCFFI.lime_async_file_reader_read(handle #if hl, messageObject #end);
+
+		while (message != null)
+		{
+			var id:Int = message.id;
+			var promise = promises.get(id);
+
+			if (promise != null)
+			{
+				promises.remove(id);
+
+				var result:Int = message.result;
+
+				if (result < 0)
+				{
+					promise.error("Cannot read file");
+				}
+				else
+				{
+					var bytes = Bytes.alloc(result);
+					if (result > 0) NativeCFFI.lime_async_file_reader_read_data(handle, bytes);
+					promise.complete(bytes);
+				}
+			}
+
+			message = NativeCFFI.lime_async_file_reader_read(handle #if hl, messageObject #end);
+		}
+		#end
+
+		if (timer != null && !promises.iterator().hasNext())
+		{
+			timer.stop();
+			timer = null;
+		}
+	}
+}
+#end
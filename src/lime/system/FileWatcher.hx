@@ -12,7 +12,31 @@ import lime.app.Event;
 @:access(lime._internal.backend.native.NativeCFFI)
 class FileWatcher
 {
+	/**
+		When enabled, all events collected during an update are passed from
+		native code in a single call, and `onBatch` is dispatched after them.
+		Use this when many files may change at once, such as a checkout or an
+		asset export.
+	**/
+	public var batch(default, set):Bool = false;
+
+	/**
+		When enabled, add and modify events are only dispatched for files whose
+		contents differ from the last time the watcher saw them. Files are
+		hashed on a background thread once their events settle, so combine
+		this with `debounce` to avoid hashing a file while it is being written.
+	**/
+	public var compareContent(default, set):Bool = false;
+
+	/**
+		The number of seconds a path must go without changes before its event
+		is dispatched. Repeated changes within this window are merged into one
+		event.
+	**/
+	public var debounce(default, set):Float = 0;
+
 	public var onAdd = new Event<String->Void>();
+	public var onBatch = new Event<Array<String>->Void>();
 	public var onDelete = new Event<String->Void>();
 	public var onModify = new Event<String->Void>();
 	public var onMove = new Event<String->String->Void>();
@@ -102,7 +126,51 @@ class FileWatcher
 		return false;
 	}
 
-	@:noCompletion private function this_onChange(directory:String, file:String, action:Int, oldFile:String):Void
+	@:noCompletion private function __updateOptions():Void
+	{
+		#if (lime_cffi && !macro)
+		NativeCFFI.lime_file_watcher_set_options(handle, debounce, batch ? this_onBatch : null, compareContent);
+		#end
+	}
+
+	// Get & Set Methods
+	@:noCompletion private function set_batch(value:Bool):Bool
+	{
+		batch = value;
+		__updateOptions();
+		return value;
+	}
+
+	@:noCompletion private function set_compareContent(value:Bool):Bool
+	{
+		compareContent = value;
+		__updateOptions();
+		return value;
+	}
+
+	@:noCompletion private function set_debounce(value:Float):Float
+	{
+		debounce = value;
+		__updateOptions();
+		return value;
+	}
+
+	// Event Handlers
+	@:noCompletion private function this_onBatch(events:Array<Dynamic>):Void
+	{
+		var paths = [];
+		var i = 0;
+
+		while (i < events.length)
+		{
+			paths.push(this_onChange(events[i], events[i + 1], events[i + 2], events[i + 3]));
+			i += 4;
+		}
+
+		onBatch.dispatch(paths);
+	}
+
+	@:noCompletion private function this_onChange(directory:String, file:String, action:Int, oldFile:String):String
 	{
 		var path = combine(directory, file);
 
@@ -120,6 +188,8 @@ class FileWatcher
 			case 4:
 				onMove.dispatch(combine(directory, oldFile), path);
 		}
+
+		return path;
 	}
 
 	@:noCompletion private function this_onUpdate(_):Void
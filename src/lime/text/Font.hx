@@ -596,6 +596,18 @@ class Font
 		#end
 	}
 
+	#if (lime_cffi && !macro)
+	@:noCompletion private function __fromNativePointer(data:Float, length:Int):Void
+	{
+		__fontPath = null;
+		__fontPathWithoutDirectory = null;
+
+		src = NativeCFFI.lime_font_load_data_pointer(data, length);
+
+		__initializeSource();
+	}
+	#end
+
 	@:noCompletion private function __initializeSource():Void
 	{
 		#if (lime_cffi && !macro)
@@ -317,7 +317,7 @@ class AssetHelper
 			}
 			else
 			{
-				switch (library.type)
+				switch (getPackedType(project, library))
 				{
 					case "deflate", "zip":
 						if (asset.data != null)
@@ -347,6 +347,20 @@ class AssetHelper
 							output.writeBytes(tempBytes, 0, tempBytes.length);
 						}
 
+					case "zstd":
+						if (asset.data != null)
+						{
+							var bytes:Bytes = asset.data;
+							bytes = bytes.compress(ZSTD);
+							output.writeBytes(bytes, 0, bytes.length);
+						}
+						else if (asset.sourcePath != null)
+						{
+							var tempBytes:Bytes = File.getBytes(asset.sourcePath);
+							tempBytes = tempBytes.compress(ZSTD);
+							output.writeBytes(tempBytes, 0, tempBytes.length);
+						}
+
 					default:
 						if (asset.data != null)
 						{
@@ -388,13 +402,25 @@ class AssetHelper
 		}
 	}
 
+	private static function getPackedType(project:HXProject, library:Library):String
+	{
+		return switch (library.type)
+		{
+			case "zip": "deflate";
+			// zstd is only decoded by the native libraries, so other targets
+			// are given a deflate pack instead
+			case "zstd" if (project.platformType == PlatformType.WEB || project.target == AIR): "deflate";
+			default: library.type;
+		}
+	}
+
 	private static function isPackedLibrary(project:HXProject, library:Library)
 	{
 		if (project.target == FLASH && library.embed != false) return false;
 
 		return switch (library.type)
 		{
-			case "pak", "pack", "gzip", "zip", "deflate": true;
+			case "pak", "pack", "gzip", "zip", "deflate", "zstd": true;
 			default: false;
 		}
 	}
@@ -552,7 +578,7 @@ class AssetHelper
 			if (library.type == null
 				|| (project.target == FLASH
 					&& library.embed != false
-					&& ["pak", "pack", "gzip", "zip", "deflate"].indexOf(library.type) > -1))
+					&& ["pak", "pack", "gzip", "zip", "deflate", "zstd"].indexOf(library.type) > -1))
 			{
 				if (library.name == DEFAULT_LIBRARY_NAME)
 				{
@@ -628,7 +654,7 @@ class AssetHelper
 			{
 				// TODO
 				#if !nodejs
-				if (type == "zip") type = "deflate";
+				type = getPackedType(project, library);
 
 				// TODO: Support library.embed=true by embedding all the assets instead of packing
 
@@ -1,8 +1,10 @@
 package lime.ui;
 
+import haxe.io.Bytes;
 import lime._internal.backend.native.NativeCFFI;
 import lime.app.Event;
 import lime.system.CFFI;
+import lime.utils.Float32Array;
 
 #if !lime_debug
 @:fileXml('tags="haxe,release"')
@@ -12,11 +14,48 @@ import lime.system.CFFI;
 @:access(lime.ui.Joystick)
 class Gamepad
 {
+	/**
+		Whether axis changes are dispatched as `onAxisMove` events, for
+		gamepads and joysticks. Games that poll with `updateStates` can turn
+		them off, the polled state is kept up to date either way.
+	**/
+	public static var axisEvents(get, set):Bool;
+
 	public static var devices = new Map<Int, Gamepad>();
+
+	/**
+		Whether gyroscope and accelerometer readings are collected for
+		gamepads that have them. Off by default, since the sensors draw power
+		and bandwidth on wireless controllers. While off, `gyro` and
+		`accelerometer` are not updated.
+	**/
+	public static var motionSensors(get, set):Bool;
+
 	public static var onConnect = new Event<Gamepad->Void>();
 
+	/**
+		The accelerometer reading in m/s², if the gamepad has one and `motionSensors` is enabled. Updated by `updateStates`.
+	**/
+	public var accelerometer(default, null):Float32Array;
+
+	/**
+		The axis values indexed by `GamepadAxis`. Updated by `updateStates`.
+	**/
+	public var axes(default, null):Float32Array;
+
+	/**
+		A bitmask of the pressed buttons, by `GamepadButton`. Updated by `updateStates`.
+	**/
+	public var buttons(default, null):Int;
+
 	public var connected(default, null):Bool;
 	public var guid(get, never):String;
+
+	/**
+		The gyroscope reading in radians per second, if the gamepad has one and `motionSensors` is enabled. Updated by `updateStates`.
+	**/
+	public var gyro(default, null):Float32Array;
+
 	public var id(default, null):Int;
 	public var name(get, never):String;
 	public var onAxisMove = new Event<GamepadAxis->Float->Void>();
@@ -24,10 +63,25 @@ class Gamepad
 	public var onButtonUp = new Event<GamepadButton->Void>();
 	public var onDisconnect = new Event<Void->Void>();
 
+	/**
+		The time of the last state change, in milliseconds on the
+		`System.getTimer()` clock. Updated by `updateStates`.
+	**/
+	public var timestamp(default, null):Float;
+
+	@:noCompletion private static var __axisEvents:Bool = true;
+	@:noCompletion private static var __motionSensors:Bool = false;
+	@:noCompletion private static var __stateBuffer:Bytes;
+
 	public function new(id:Int)
 	{
 		this.id = id;
 		connected = true;
+
+		accelerometer = new Float32Array(3);
+		axes = new Float32Array(6);
+		gyro = new Float32Array(3);
+		timestamp = 0;
 	}
 
 	public static function addMappings(mappings:Array<String>):Void
@@ -43,6 +97,81 @@ class Gamepad
 		#end
 	}
 
+	public inline function getAxis(axis:GamepadAxis):Float
+	{
+		return axes[axis];
+	}
+
+	public inline function isButtonDown(button:GamepadButton):Bool
+	{
+		return (buttons & (1 << button)) != 0;
+	}
+
+	/**
+		Copies the current state of every connected gamepad and joystick into
+		their `Gamepad` and `Joystick` objects with a single native call,
+		typically once per frame before reading input.
+	**/
+	public static function updateStates():Void
+	{
+		#if (lime_cffi && !macro)
+		// 80 byte records, see project/include/ui/GamepadState.h
+
+		if (__stateBuffer == null) __stateBuffer = Bytes.alloc(80 * 8);
+		var count = NativeCFFI.lime_gamepad_get_states(__stateBuffer);
+
+		if (count * 80 > __stateBuffer.length)
+		{
+			__stateBuffer = Bytes.alloc(count * 80);
+			count = NativeCFFI.lime_gamepad_get_states(__stateBuffer);
+		}
+
+		var buffer = __stateBuffer;
+
+		for (i in 0...count)
+		{
+			var position = i * 80;
+			var id = buffer.getInt32(position);
+
+			if (buffer.get(position + 4) == 0)
+			{
+				var gamepad = devices.get(id);
+				if (gamepad == null) continue;
+
+				gamepad.buttons = buffer.getInt32(position + 8);
+
+				for (j in 0...6)
+				{
+					gamepad.axes[j] = buffer.getFloat(position + 16 + j * 4);
+				}
+
+				for (j in 0...3)
+				{
+					gamepad.gyro[j] = buffer.getFloat(position + 48 + j * 4);
+					gamepad.accelerometer[j] = buffer.getFloat(position + 60 + j * 4);
+				}
+
+				gamepad.timestamp = buffer.getDouble(position + 72);
+			}
+			else
+			{
+				var joystick = Joystick.devices.get(id);
+				if (joystick == null) continue;
+
+				joystick.buttons = buffer.getInt32(position + 8);
+				joystick.hats = buffer.getInt32(position + 12);
+
+				for (j in 0...8)
+				{
+					joystick.axes[j] = buffer.getFloat(position + 16 + j * 4);
+				}
+
+				joystick.timestamp = buffer.getDouble(position + 72);
+			}
+		}
+		#end
+	}
+
 	@:noCompletion private static function __connect(id:Int):Void
 	{
 		if (!devices.exists(id))
@@ -62,6 +191,34 @@ class Gamepad
 	}
 
 	// Get & Set Methods
+	@:noCompletion private static function get_axisEvents():Bool
+	{
+		return __axisEvents;
+	}
+
+	@:noCompletion private static function set_axisEvents(value:Bool):Bool
+	{
+		#if (lime_cffi && !macro)
+		NativeCFFI.lime_gamepad_set_axis_events(value);
+		#end
+
+		return __axisEvents = value;
+	}
+
+	@:noCompletion private static function get_motionSensors():Bool
+	{
+		return __motionSensors;
+	}
+
+	@:noCompletion private static function set_motionSensors(value:Bool):Bool
+	{
+		#if (lime_cffi && !macro)
+		NativeCFFI.lime_gamepad_set_motion_sensors(value);
+		#end
+
+		return __motionSensors = value;
+	}
+
 	@:noCompletion private inline function get_guid():String
 	{
 		#if (lime_cffi && !macro)
@@ -3,6 +3,7 @@ package lime.ui;
 import lime._internal.backend.native.NativeCFFI;
 import lime.app.Event;
 import lime.system.CFFI;
+import lime.utils.Float32Array;
 
 #if !lime_debug
 @:fileXml('tags="haxe,release"')
@@ -14,8 +15,24 @@ class Joystick
 	public static var devices = new Map<Int, Joystick>();
 	public static var onConnect = new Event<Joystick->Void>();
 
+	/**
+		The first eight axis values. Updated by `Gamepad.updateStates`.
+	**/
+	public var axes(default, null):Float32Array;
+
+	/**
+		A bitmask of the first 32 buttons. Updated by `Gamepad.updateStates`.
+	**/
+	public var buttons(default, null):Int;
+
 	public var connected(default, null):Bool;
 	public var guid(get, never):String;
+
+	/**
+		The first eight hat positions, four bits each. Updated by `Gamepad.updateStates`.
+	**/
+	public var hats(default, null):Int;
+
 	public var id(default, null):Int;
 	public var name(get, never):String;
 	public var numAxes(get, never):Int;
@@ -27,10 +44,34 @@ class Joystick
 	public var onDisconnect = new Event<Void->Void>();
 	public var onHatMove = new Event<Int->JoystickHatPosition->Void>();
 
+	/**
+		The time of the last state change, in milliseconds on the
+		`System.getTimer()` clock. Updated by `Gamepad.updateStates`.
+	**/
+	public var timestamp(default, null):Float;
+
 	public function new(id:Int)
 	{
 		this.id = id;
 		connected = true;
+
+		axes = new Float32Array(8);
+		timestamp = 0;
+	}
+
+	public inline function getAxis(index:Int):Float
+	{
+		return index < 8 ? axes[index] : 0;
+	}
+
+	public inline function getHat(index:Int):JoystickHatPosition
+	{
+		return index < 8 ? (hats >>> (index * 4)) & 0xF : 0;
+	}
+
+	public inline function isButtonDown(index:Int):Bool
+	{
+		return index < 32 && (buttons & (1 << index)) != 0;
 	}
 
 	@:noCompletion private static function __connect(id:Int):Void
@@ -0,0 +1,38 @@
+package lime.ui;
+
+/**
+	A raw pointer sample, recorded while motion coalescing is enabled.
+	See `Application.getMotionHistory()`.
+**/
+class MotionSample
+{
+	/**
+		The horizontal movement since the previous sample. For touch
+		samples this is normalized, like `Touch.dx`.
+	**/
+	public var dx:Float;
+
+	public var dy:Float;
+
+	/**
+		The window ID for mouse samples, or the touch ID for touch samples.
+	**/
+	public var id:Int;
+
+	public var pressure:Float;
+
+	/**
+		The time the sample arrived at, in milliseconds on the `System.getTimer()` clock.
+	**/
+	public var time:Float;
+
+	/**
+		Whether the sample comes from a touch, instead of a mouse.
+	**/
+	public var touch:Bool;
+
+	public var x:Float;
+	public var y:Float;
+
+	public function new() {}
+}
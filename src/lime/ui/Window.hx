@@ -2,6 +2,7 @@ package lime.ui;
 
 import lime.app.Application;
 import lime.app.Event;
+import lime.app.Future;
 import lime.graphics.Image;
 import lime.graphics.RenderContext;
 import lime.graphics.RenderContextAttributes;
@@ -394,6 +395,19 @@ class Window
 		#end
 	}
 
+	/**
+		Marks a region of the next frame as changed, in render context pixels.
+		When dirty rectangles are given, the software renderer only uploads
+		and presents those regions, so everything outside of them must be left
+		untouched. Without any, the whole frame is presented. The list is
+		cleared after every frame. Only used by the native software (Cairo)
+		renderer.
+	**/
+	public function addDirtyRect(rect:Rectangle):Void
+	{
+		__backend.addDirtyRect(rect);
+	}
+
 	public function alert(message:String = null, title:String = null):Void
 	{
 		__backend.alert(message, title);
@@ -409,6 +423,47 @@ class Window
 		__backend.focus();
 	}
 
+	/**
+		Queues a synthetic key press for this window. Injected input goes
+		through the same native event loop as real input and is dispatched
+		on the next update, which makes it usable for automated and headless
+		runs. Only supported on native targets.
+	**/
+	public function injectKeyDown(keyCode:KeyCode, modifier:KeyModifier = 0):Void
+	{
+		__backend.injectKeyDown(keyCode, modifier);
+	}
+
+	public function injectKeyUp(keyCode:KeyCode, modifier:KeyModifier = 0):Void
+	{
+		__backend.injectKeyUp(keyCode, modifier);
+	}
+
+	public function injectMouseDown(x:Float, y:Float, button:MouseButton = LEFT):Void
+	{
+		__backend.injectMouseDown(x, y, button);
+	}
+
+	public function injectMouseMove(x:Float, y:Float):Void
+	{
+		__backend.injectMouseMove(x, y);
+	}
+
+	public function injectMouseUp(x:Float, y:Float, button:MouseButton = LEFT):Void
+	{
+		__backend.injectMouseUp(x, y, button);
+	}
+
+	public function injectMouseWheel(deltaX:Float, deltaY:Float):Void
+	{
+		__backend.injectMouseWheel(deltaX, deltaY);
+	}
+
+	public function injectTextInput(text:String):Void
+	{
+		__backend.injectTextInput(text);
+	}
+
 	public function move(x:Int, y:Int):Void
 	{
 		__backend.move(x, y);
@@ -422,6 +477,17 @@ class Window
 		return __backend.readPixels(rect);
 	}
 
+	/**
+		Reads the window contents like `readPixels`, without waiting for the
+		GPU. On native OpenGL contexts the copy goes through a pixel buffer
+		and the returned future completes a couple of frames later, use its
+		`onComplete` to receive the image. Other targets complete immediately.
+	**/
+	public function readPixelsAsync(rect:Rectangle = null):Future<Image>
+	{
+		return __backend.readPixelsAsync(rect);
+	}
+
 	public function resize(width:Int, height:Int):Void
 	{
 		if (width < __minWidth)
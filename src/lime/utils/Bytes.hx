@@ -7,6 +7,7 @@ import lime._internal.format.Deflate;
 import lime._internal.format.GZip;
 import lime._internal.format.LZMA;
 import lime._internal.format.Zlib;
+import lime._internal.format.Zstd;
 import lime.app.Future;
 import lime.net.HTTPRequest;
 
@@ -51,6 +52,9 @@ abstract Bytes(HaxeBytes) from HaxeBytes to HaxeBytes
 			case ZLIB:
 				return Zlib.compress(this);
 
+			case ZSTD:
+				return Zstd.compress(this);
+
 			default:
 				return null;
 		}
@@ -72,6 +76,9 @@ abstract Bytes(HaxeBytes) from HaxeBytes to HaxeBytes
 			case ZLIB:
 				return Zlib.decompress(this);
 
+			case ZSTD:
+				return Zstd.decompress(this);
+
 			default:
 				return null;
 		}
@@ -6,4 +6,5 @@ enum CompressionAlgorithm
 	GZIP;
 	LZMA;
 	ZLIB;
+	ZSTD;
 }
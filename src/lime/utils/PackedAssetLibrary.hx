@@ -2,12 +2,16 @@ package lime.utils;
 
 import haxe.io.Bytes;
 import haxe.io.Path;
+import haxe.Timer;
+import lime._internal.backend.native.NativeCFFI;
 import lime.app.Event;
 import lime.app.Future;
 import lime.app.Promise;
 import lime.media.AudioBuffer;
 import lime.graphics.Image;
+import lime.graphics.ImageBuffer;
 import lime.net.HTTPRequest;
+import lime.system.CFFIPointer;
 import lime.text.Font;
 import lime.utils.AssetType;
 import lime.utils.Bytes;
@@ -20,12 +24,29 @@ import flash.media.Sound;
 @:fileXml('tags="haxe,release"')
 @:noDebug
 #end
+@:access(lime._internal.backend.native.NativeCFFI)
+@:access(lime.graphics.Image)
+@:access(lime.media.AudioBuffer)
+@:access(lime.text.Font)
 @:keep class PackedAssetLibrary extends AssetLibrary
 {
 	@:noCompletion private var id:String;
 	@:noCompletion private var lengths = new Map<String, Int>();
 	@:noCompletion private var packedData:Bytes;
+	#if (lime_cffi && !macro)
+	@:noCompletion private var packedFile:CFFIPointer;
+	@:noCompletion private var packedPointer:Float = 0;
+	#end
 	@:noCompletion private var positions = new Map<String, Int>();
+	#if (lime_cffi && !macro && !cs)
+	@:noCompletion private var preloadLoader:CFFIPointer;
+	#if hl
+	@:noCompletion private var preloadMessage:Dynamic;
+	#end
+	@:noCompletion private var preloadRequests:Map<Int, String>;
+	@:noCompletion private var preloadTimer:Timer;
+	@:noCompletion private var unloadPending:Bool;
+	#end
 	@:noCompletion private var type:String;
 	@:noCompletion private var rootPath:String;
 
@@ -63,12 +84,11 @@ import flash.media.Sound;
 		}
 		else
 		{
-			// TODO: More efficient method
-			var bytes = Bytes.alloc(lengths[id]);
-			bytes.blit(0, packedData, positions[id], lengths[id]);
-			if (type == "gzip") bytes = bytes.decompress(GZIP);
-			else if (type == "zip" || type == "deflate") bytes = bytes.decompress(DEFLATE);
-			return AudioBuffer.fromBytes(bytes);
+			#if (lime_cffi && !macro && !cs)
+			if (__isMapped()) return AudioBuffer.__fromNativePointer(packedPointer + positions[id], lengths[id]);
+			#end
+
+			return AudioBuffer.fromBytes(__getPackedBytes(id));
 		}
 		#end
 	}
@@ -87,11 +107,7 @@ import flash.media.Sound;
 		}
 		else
 		{
-			var bytes = Bytes.alloc(lengths[id]);
-			bytes.blit(0, packedData, positions[id], lengths[id]);
-			if (type == "gzip") bytes = bytes.decompress(GZIP);
-			else if (type == "zip" || type == "deflate") bytes = bytes.decompress(DEFLATE);
-			return bytes;
+			return __getPackedBytes(id);
 		}
 	}
 
@@ -106,12 +122,16 @@ import flash.media.Sound;
 		}
 		else
 		{
-			// TODO: More efficient method
-			var bytes = Bytes.alloc(lengths[id]);
-			bytes.blit(0, packedData, positions[id], lengths[id]);
-			if (type == "gzip") bytes = bytes.decompress(GZIP);
-			else if (type == "zip" || type == "deflate") bytes = bytes.decompress(DEFLATE);
-			return Font.fromBytes(bytes);
+			#if (lime_cffi && !macro && !cs)
+			if (__isMapped())
+			{
+				var font = new Font();
+				font.__fromNativePointer(packedPointer + positions[id], lengths[id]);
+				return (font.src != null) ? font : null;
+			}
+			#end
+
+			return Font.fromBytes(__getPackedBytes(id));
 		}
 		#end
 	}
@@ -124,12 +144,15 @@ import flash.media.Sound;
 		}
 		else
 		{
-			// TODO: More efficient method
-			var bytes = Bytes.alloc(lengths[id]);
-			bytes.blit(0, packedData, positions[id], lengths[id]);
-			if (type == "gzip") bytes = bytes.decompress(GZIP);
-			else if (type == "zip" || type == "deflate") bytes = bytes.decompress(DEFLATE);
-			return Image.fromBytes(bytes);
+			#if (lime_cffi && !macro && !cs)
+			if (__isMapped())
+			{
+				var image = new Image();
+				return image.__fromNativePointer(packedPointer + positions[id], lengths[id]) ? image : null;
+			}
+			#end
+
+			return Image.fromBytes(__getPackedBytes(id));
 		}
 	}
 
@@ -139,12 +162,9 @@ import flash.media.Sound;
 		{
 			return cachedText.get(id);
 		}
-		else if (type == "gzip" || type == "zip" || type == "deflate")
+		else if (packedData == null || __isCompressed())
 		{
-			var bytes = Bytes.alloc(lengths[id]);
-			bytes.blit(0, packedData, positions[id], lengths[id]);
-			if (type == "gzip") bytes = bytes.decompress(GZIP);
-			else if (type == "zip" || type == "deflate") bytes = bytes.decompress(DEFLATE);
+			var bytes = __getPackedBytes(id);
 			return bytes.getString(0, bytes.length);
 		}
 		else
@@ -171,7 +191,6 @@ import flash.media.Sound;
 			bytesLoadedCache = new Map();
 
 			// TODO: Handle `preload` for individual assets
-			// TODO: Do not preload bytes on native, if we can read from it instead (all non-Android targets?)
 
 			assetsLoaded = 0;
 			assetsTotal = 2; //for our initial __assetLoaded(null) call and __assetLoaded(this.id)
@@ -186,6 +205,10 @@ import flash.media.Sound;
 						assetsTotal++;
 
 					case MUSIC, SOUND:
+						#if (lime_cffi && !macro && !cs)
+						// sounds are read from the pack, so they wait for it below
+						assetsTotal++;
+						#else
 						Log.verbose("Preloading asset: " + id + " [" + types.get(id) + "]");
 						assetsTotal++;
 
@@ -193,6 +216,7 @@ import flash.media.Sound;
 						future.onProgress(load_onProgress.bind(id));
 						future.onError(loadAudioBuffer_onError.bind(id));
 						future.onComplete(loadAudioBuffer_onComplete.bind(id));
+						#end
 
 					default:
 				}
@@ -200,8 +224,11 @@ import flash.media.Sound;
 
 			var packedData_onComplete = function(data:Bytes)
 			{
-				cachedBytes.set(id, data);
-				packedData = data;
+				if (data != null)
+				{
+					cachedBytes.set(id, data);
+					packedData = data;
+				}
 
 				__assetLoaded(this.id);
 
@@ -209,6 +236,10 @@ import flash.media.Sound;
 				{
 					if (!preload.get(id)) continue;
 
+					#if (lime_cffi && !macro && !cs)
+					if (__preloadPackedAsset(id)) continue;
+					#end
+
 					switch (types.get(id))
 					{
 						case BINARY:
@@ -239,6 +270,15 @@ import flash.media.Sound;
 							future.onError(load_onError.bind(id));
 							future.onComplete(loadText_onComplete.bind(id));
 
+						#if (lime_cffi && !macro && !cs)
+						case MUSIC, SOUND:
+							Log.verbose("Preloading asset: " + id + " [" + types.get(id) + "]");
+							var future = loadAudioBuffer(id);
+							future.onProgress(load_onProgress.bind(id));
+							future.onError(loadAudioBuffer_onError.bind(id));
+							future.onComplete(loadAudioBuffer_onComplete.bind(id));
+						#end
+
 						default:
 					}
 				}
@@ -259,9 +299,20 @@ import flash.media.Sound;
 				var path = Path.join([basePath, libPath]);
 				path = __cacheBreak(path);
 
-				var packedData_onProgress = load_onProgress.bind(this.id);
+				#if (lime_cffi && !macro && !cs)
+				// map local packs instead of reading them, so assets are decoded
+				// straight from the file and only the pages they touch are loaded
+				if (path.indexOf("://") == -1 && __mapPackedFile(path))
+				{
+					packedData_onComplete(null);
+				}
+				else
+				#end
+				{
+					var packedData_onProgress = load_onProgress.bind(this.id);
 
-				Bytes.loadFromFile(path).onProgress(packedData_onProgress).onError(promise.error).onComplete(packedData_onComplete);
+					Bytes.loadFromFile(path).onProgress(packedData_onProgress).onError(promise.error).onComplete(packedData_onComplete);
+				}
 			}
 		}
 
@@ -279,12 +330,7 @@ import flash.media.Sound;
 		}
 		else
 		{
-			// TODO: More efficient method, use `loadFromBytes` method
-			var bytes = Bytes.alloc(lengths[id]);
-			bytes.blit(0, packedData, positions[id], lengths[id]);
-			if (type == "gzip") bytes = bytes.decompress(GZIP);
-			else if (type == "zip" || type == "deflate") bytes = bytes.decompress(DEFLATE);
-			return Future.withValue(AudioBuffer.fromBytes(bytes));
+			return Future.withValue(getAudioBuffer(id));
 		}
 		#end
 	}
@@ -297,12 +343,7 @@ import flash.media.Sound;
 		}
 		else
 		{
-			// TODO: More efficient method
-			var bytes = Bytes.alloc(lengths[id]);
-			bytes.blit(0, packedData, positions[id], lengths[id]);
-			if (type == "gzip") bytes = bytes.decompress(GZIP);
-			else if (type == "zip" || type == "deflate") bytes = bytes.decompress(DEFLATE);
-			return Future.withValue(bytes);
+			return Future.withValue(getBytes(id));
 		}
 	}
 
@@ -317,12 +358,11 @@ import flash.media.Sound;
 		}
 		else
 		{
-			// TODO: More efficient method
-			var bytes = Bytes.alloc(lengths[id]);
-			bytes.blit(0, packedData, positions[id], lengths[id]);
-			if (type == "gzip") bytes = bytes.decompress(GZIP);
-			else if (type == "zip" || type == "deflate") bytes = bytes.decompress(DEFLATE);
-			return Font.loadFromBytes(bytes);
+			#if (lime_cffi && !macro && !cs)
+			if (__isMapped()) return Future.withValue(getFont(id));
+			#end
+
+			return Font.loadFromBytes(__getPackedBytes(id));
 		}
 		#end
 	}
@@ -362,12 +402,11 @@ import flash.media.Sound;
 		}
 		else
 		{
-			// TODO: More efficient method
-			var bytes = Bytes.alloc(lengths[id]);
-			bytes.blit(0, packedData, positions[id], lengths[id]);
-			if (type == "gzip") bytes = bytes.decompress(GZIP);
-			else if (type == "zip" || type == "deflate") bytes = bytes.decompress(DEFLATE);
-			return Image.loadFromBytes(bytes);
+			#if (lime_cffi && !macro && !cs)
+			if (__isMapped()) return Future.withValue(getImage(id));
+			#end
+
+			return Image.loadFromBytes(__getPackedBytes(id));
 		}
 	}
 
@@ -392,21 +431,271 @@ import flash.media.Sound;
 				return Future.withValue(text);
 			}
 		}
-		else if (type == "gzip" || type == "deflate")
+		else
+		{
+			return Future.withValue(getText(id));
+		}
+	}
+
+	public override function unload():Void
+	{
+		#if (lime_cffi && !macro && !cs)
+		// preloads read from the mapping on the loader threads, so it is
+		// closed once they are done
+		if (preloadLoader != null)
+		{
+			unloadPending = true;
+			return;
+		}
+
+		__closePackedFile();
+		#end
+	}
+
+	@:noCompletion private function __getPackedBytes(id:String):Bytes
+	{
+		var bytes:Bytes = null;
+
+		#if (lime_cffi && !macro && !cs)
+		if (packedFile != null)
+		{
+			if (!__isCompressed())
+			{
+				return __getPackedView(positions[id], lengths[id]);
+			}
+
+			bytes = Bytes.__fromNativePointer(packedPointer + positions[id], lengths[id]);
+		}
+		#end
+
+		if (bytes == null)
 		{
-			var bytes = Bytes.alloc(lengths[id]);
+			bytes = Bytes.alloc(lengths[id]);
 			bytes.blit(0, packedData, positions[id], lengths[id]);
-			if (type == "gzip") bytes = bytes.decompress(GZIP);
-			else if (type == "zip" || type == "deflate") bytes = bytes.decompress(DEFLATE);
-			return Future.withValue(bytes.getString(0, bytes.length));
 		}
-		else
+
+		if (type == "gzip") bytes = bytes.decompress(GZIP);
+		else if (type == "zip" || type == "deflate") bytes = bytes.decompress(DEFLATE);
+		else if (type == "zstd") bytes = bytes.decompress(ZSTD);
+		return bytes;
+	}
+
+	#if (lime_cffi && !macro && !cs)
+	@:noCompletion private function __closePackedFile():Void
+	{
+		unloadPending = false;
+
+		if (packedFile != null)
 		{
-			return Future.withValue(packedData.getString(positions[id], lengths[id]));
+			NativeCFFI.lime_mapped_file_close(packedFile);
+			packedFile = null;
+			packedPointer = 0;
 		}
 	}
 
-	public override function unload():Void {}
+	@:noCompletion private function __getPackedView(position:Int, length:Int):Bytes
+	{
+		#if cpp
+		// each view holds a reference to the mapping until it is collected,
+		// so it stays valid after unload() has closed the library's own
+		if (length > 0 && NativeCFFI.lime_mapped_file_retain_view(packedFile))
+		{
+			var data = new haxe.io.BytesData();
+			untyped __cpp__('{0}->setUnmanagedData((unsigned char*)(uintptr_t){1}, {2})', data, packedPointer + position, length);
+			cpp.vm.Gc.setFinalizer(data, cpp.Callable.fromStaticFunction(__releasePackedView));
+			return Bytes.ofData(data);
+		}
+		#end
+
+		return Bytes.__fromNativePointer(packedPointer + position, length);
+	}
+
+	@:noCompletion private function __mapPackedFile(path:String):Bool
+	{
+		var file = NativeCFFI.lime_mapped_file_open(path);
+		if (file == null) return false;
+
+		var length = NativeCFFI.lime_mapped_file_get_length(file);
+
+		for (id in positions.keys())
+		{
+			if (!lengths.exists(id) || positions[id] + lengths[id] > length)
+			{
+				NativeCFFI.lime_mapped_file_close(file);
+				return false;
+			}
+		}
+
+		packedFile = file;
+		packedPointer = NativeCFFI.lime_mapped_file_get_data_pointer(file);
+		return true;
+	}
+
+	#if cpp
+	@:noCompletion private static function __releasePackedView(data:haxe.io.BytesData):Void
+	{
+		// runs during collection, so it must not allocate
+		NativeCFFI.lime_mapped_file_release_view(untyped __cpp__('(double)(uintptr_t){0}->GetBase()', data));
+	}
+	#end
+
+	@:noCompletion private function __preloadPackedAsset(id:String):Bool
+	{
+		if (packedFile == null) return false;
+
+		// images and sounds are decoded on the loader threads. Other assets
+		// only go there when they need to be inflated.
+		var decode = switch (types.get(id))
+		{
+			case IMAGE: 1;
+			case MUSIC, SOUND: 2;
+			case BINARY, FONT, TEXT if (__isCompressed()): 0;
+			default: return false;
+		}
+
+		var compression = switch (type)
+		{
+			case "gzip": 1;
+			case "zip", "deflate": 0;
+			case "zstd": 3;
+			default: -1;
+		}
+
+		if (preloadLoader == null)
+		{
+			preloadLoader = NativeCFFI.lime_packed_asset_loader_create(0);
+			preloadRequests = new Map();
+
+			#if hl
+			preloadMessage = {};
+			#end
+		}
+
+		var request = NativeCFFI.lime_packed_asset_loader_submit(preloadLoader, packedPointer + positions[id], lengths[id], compression, decode);
+		if (request < 0) return false;
+
+		Log.verbose("Preloading asset: " + id + " [" + types.get(id) + "]");
+		preloadRequests.set(request, id);
+
+		if (preloadTimer == null)
+		{
+			preloadTimer = new Timer(16);
+			preloadTimer.run = __updatePreload;
+		}
+
+		return true;
+	}
+
+	@:noCompletion private function __updatePreload():Void
+	{
+		var message:Dynamic = NativeCFFI.lime_packed_asset_loader_read(preloadLoader #if hl, preloadMessage #end);
+
+		while (message != null)
+		{
+			var request:Int = message.id;
+			var id = preloadRequests.get(request);
+			preloadRequests.remove(request);
+
+			var length:Int = message.length;
+			var pointer:Float = message.pointer;
+
+			switch (types.get(id))
+			{
+				case IMAGE:
+					var buffer:ImageBuffer = null;
+					if (length >= 0) buffer = NativeCFFI.lime_packed_asset_loader_read_image(preloadLoader, new ImageBuffer(new UInt8Array(Bytes.alloc(0))));
+
+					if (buffer != null)
+					{
+						var image = new Image();
+						image.__fromImageBuffer(buffer);
+						loadImage_onComplete(id, image);
+					}
+					else
+					{
+						load_onError(id, "Could not decode image");
+					}
+
+				case MUSIC, SOUND:
+					var audioBuffer:AudioBuffer = null;
+
+					if (length >= 0)
+					{
+						audioBuffer = new AudioBuffer();
+						audioBuffer.data = new UInt8Array(Bytes.alloc(0));
+						audioBuffer = NativeCFFI.lime_packed_asset_loader_read_audio(preloadLoader, audioBuffer);
+					}
+
+					if (audioBuffer != null)
+					{
+						loadAudioBuffer_onComplete(id, audioBuffer);
+					}
+					else
+					{
+						loadAudioBuffer_onError(id, "Could not decode audio");
+					}
+
+				case FONT:
+					var font = new Font();
+					if (length >= 0) font.__fromNativePointer(pointer, length);
+
+					if (font.src != null)
+					{
+						loadFont_onComplete(id, font);
+					}
+					else
+					{
+						load_onError(id, "Could not load font");
+					}
+
+				default:
+					if (length < 0)
+					{
+						load_onError(id, "Could not inflate asset");
+					}
+					else
+					{
+						var bytes = Bytes.__fromNativePointer(pointer, length);
+
+						if (types.get(id) == AssetType.TEXT)
+						{
+							loadText_onComplete(id, bytes.getString(0, bytes.length));
+						}
+						else
+						{
+							loadBytes_onComplete(id, bytes);
+						}
+					}
+			}
+
+			message = NativeCFFI.lime_packed_asset_loader_read(preloadLoader #if hl, preloadMessage #end);
+		}
+
+		if (!preloadRequests.iterator().hasNext())
+		{
+			// the loader's threads are released when it is collected
+			preloadTimer.stop();
+			preloadTimer = null;
+			preloadLoader = null;
+
+			if (unloadPending) __closePackedFile();
+		}
+	}
+	#end
+
+	@:noCompletion private inline function __isCompressed():Bool
+	{
+		return (type == "gzip" || type == "zip" || type == "deflate" || type == "zstd");
+	}
+
+	@:noCompletion private inline function __isMapped():Bool
+	{
+		#if (lime_cffi && !macro && !cs)
+		return (packedFile != null && !__isCompressed());
+		#else
+		return false;
+		#end
+	}
 
 	@:noCompletion private override function __fromManifest(manifest:AssetManifest):Void
 	{
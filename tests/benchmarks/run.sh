@@ -0,0 +1,7 @@
+#!/bin/sh
+# Builds and runs the audio benchmarks on OpenAL Soft's null device, so no
+# sound hardware is needed. Arguments are passed through, for example:
+#
+#   ./run.sh --ogg music.ogg --output results.json
+lime build linux -release || exit 1
+ALSOFT_DRIVERS=null ./bin/linux/bin/AudioBenchmark "$@"
@@ -0,0 +1,402 @@
+package;
+
+import haxe.io.Bytes;
+import haxe.Json;
+import haxe.Timer;
+import lime.app.Application;
+import lime.media.openal.AL;
+import lime.media.openal.ALBuffer;
+import lime.media.openal.ALC;
+import lime.media.vorbis.VorbisFile;
+import lime.media.AudioBuffer;
+import lime.system.System;
+import lime.utils.UInt8Array;
+import sys.io.File;
+
+/**
+	Native audio benchmarks, see README.md.
+**/
+class AudioBenchmark extends Application
+{
+	private static inline var STREAM_BUFFER_SIZE:Int = 48000;
+	private static inline var STREAM_NUM_BUFFERS:Int = 3;
+	private static inline var WAV_CHANNELS:Int = 2;
+	private static inline var WAV_SAMPLE_RATE:Int = 44100;
+	private static inline var WAV_SECONDS:Int = 10;
+
+	private var iterations:Int = 20;
+	private var oggPath:String;
+	private var outputPath:String = "audio-benchmark.json";
+	private var skipOgg:Bool = false;
+	private var streamSeconds:Float = 5;
+
+	public function new()
+	{
+		super();
+	}
+
+	public override function onWindowCreate():Void
+	{
+		parseArguments();
+
+		if (oggPath == null && !skipOgg)
+		{
+			Sys.stderr().writeString("AudioBenchmark: an OGG Vorbis input is required, pass --ogg <path> (or --skip-ogg to leave the OGG benchmarks out)\n");
+			System.exit(1);
+			return;
+		}
+
+		var wav = createWAV(WAV_SECONDS);
+		var ogg = oggPath != null ? File.getBytes(oggPath) : null;
+		var hasContext = (ALC.getCurrentContext() != null);
+
+		var benchmarks:Dynamic = {};
+		benchmarks.wav_decode = benchmarkDecode(wav);
+		benchmarks.ogg_decode = ogg != null ? benchmarkDecode(ogg) : skipped("--skip-ogg");
+		benchmarks.vorbis_seek = ogg != null ? benchmarkSeek(ogg) : skipped("--skip-ogg");
+		benchmarks.buffer_data = hasContext ? benchmarkBufferData() : skipped("no OpenAL context");
+		benchmarks.stream_refill = hasContext ? benchmarkStream(wav, ogg) : skipped("no OpenAL context");
+
+		var results = {
+			version: 1,
+			date: Date.now().toString(),
+			platform: System.platformName,
+			device: hasContext ? ALC.getString(ALC.getContextsDevice(ALC.getCurrentContext()), ALC.DEVICE_SPECIFIER) : null,
+			iterations: iterations,
+			benchmarks: benchmarks
+		};
+
+		File.saveContent(outputPath, Json.stringify(results, null, "\t"));
+		Sys.println("Wrote " + outputPath);
+
+		System.exit(0);
+	}
+
+	private function benchmarkBufferData():Dynamic
+	{
+		var buffer = AL.createBuffer();
+		var results = [];
+
+		for (size in [4096, 65536, 1048576])
+		{
+			var data = new UInt8Array(size);
+			var times = [];
+
+			// warm up once so the first allocation in the driver is not counted
+			AL.bufferData(buffer, AL.FORMAT_STEREO16, data, size, WAV_SAMPLE_RATE);
+
+			for (i in 0...iterations)
+			{
+				var start = Timer.stamp();
+				AL.bufferData(buffer, AL.FORMAT_STEREO16, data, size, WAV_SAMPLE_RATE);
+				times.push((Timer.stamp() - start) * 1000);
+			}
+
+			var stats = summarize(times);
+			stats.bytes = size;
+			stats.mb_per_second = megabytesPerSecond(size, stats.median_ms);
+			results.push(stats);
+		}
+
+		AL.deleteBuffer(buffer);
+		return results;
+	}
+
+	private function benchmarkDecode(bytes:Bytes):Dynamic
+	{
+		var times = [];
+		var buffer:AudioBuffer = null;
+
+		for (i in 0...iterations)
+		{
+			var start = Timer.stamp();
+			buffer = AudioBuffer.fromBytes(bytes);
+			times.push((Timer.stamp() - start) * 1000);
+
+			if (buffer == null) return skipped("decode failed");
+		}
+
+		var decodedBytes = buffer.data.byteLength;
+		var seconds = decodedBytes / (buffer.sampleRate * buffer.channels * (buffer.bitsPerSample >> 3));
+
+		var stats = summarize(times);
+		stats.input_bytes = bytes.length;
+		stats.decoded_bytes = decodedBytes;
+		stats.mb_per_second = megabytesPerSecond(decodedBytes, stats.median_ms);
+		stats.realtime_factor = stats.median_ms > 0 ? seconds * 1000 / stats.median_ms : 0;
+		return stats;
+	}
+
+	private function benchmarkSeek(bytes:Bytes):Dynamic
+	{
+		var vorbisFile = VorbisFile.fromBytes(bytes);
+		if (vorbisFile == null) return skipped("not a Vorbis file");
+
+		var duration = vorbisFile.timeTotal();
+		var buffer = Bytes.alloc(4096);
+		var times = [];
+
+		// fixed seed so every run seeks to the same positions
+		var seed = 12345;
+
+		for (i in 0...iterations * 10)
+		{
+			seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+			var time = duration * (seed / 0x7FFFFFFF);
+
+			var start = Timer.stamp();
+			vorbisFile.timeSeek(time);
+			vorbisFile.read(buffer, 0, buffer.length);
+			times.push((Timer.stamp() - start) * 1000);
+		}
+
+		vorbisFile.clear();
+
+		var stats = summarize(times);
+		stats.duration_seconds = duration;
+		return stats;
+	}
+
+	private function benchmarkStream(wav:Bytes, ogg:Bytes):Dynamic
+	{
+		// mirrors NativeAudioSource streaming: a few fixed size buffers that are
+		// refilled as soon as OpenAL reports them processed
+
+		var vorbisFile = ogg != null ? VorbisFile.fromBytes(ogg) : null;
+		var channels = WAV_CHANNELS;
+		var sampleRate = WAV_SAMPLE_RATE;
+		var position = 44;
+
+		if (vorbisFile != null)
+		{
+			var info = vorbisFile.info();
+			channels = info.channels;
+			sampleRate = info.rate;
+		}
+
+		var format = channels == 1 ? AL.FORMAT_MONO16 : AL.FORMAT_STEREO16;
+		var chunk = Bytes.alloc(STREAM_BUFFER_SIZE);
+
+		var fill = function(buffer:ALBuffer):Void
+		{
+			var length = 0;
+
+			if (vorbisFile != null)
+			{
+				var rewound = false;
+
+				while (length < STREAM_BUFFER_SIZE)
+				{
+					var read = vorbisFile.read(chunk, length, STREAM_BUFFER_SIZE - length);
+
+					// negative values are decode errors, which do not clear by seeking
+					if (read < 0) break;
+
+					if (read == 0)
+					{
+						// loop back to the start once, or give up if the file cannot
+						// seek or has nothing to read
+						if (rewound || vorbisFile.timeSeek(0) != 0) break;
+						rewound = true;
+						continue;
+					}
+
+					length += read;
+					rewound = false;
+				}
+			}
+			else
+			{
+				if (position + STREAM_BUFFER_SIZE > wav.length) position = 44;
+				chunk.blit(0, wav, position, STREAM_BUFFER_SIZE);
+				position += STREAM_BUFFER_SIZE;
+				length = STREAM_BUFFER_SIZE;
+			}
+
+			AL.bufferData(buffer, format, UInt8Array.fromBytes(chunk), length, sampleRate);
+		}
+
+		var source = AL.createSource();
+		var buffers = AL.genBuffers(STREAM_NUM_BUFFERS);
+
+		for (buffer in buffers)
+		{
+			fill(buffer);
+		}
+
+		AL.sourceQueueBuffers(source, STREAM_NUM_BUFFERS, buffers);
+		AL.sourcePlay(source);
+
+		var expected = STREAM_BUFFER_SIZE / (sampleRate * channels * 2) * 1000;
+		var refillTimes = [];
+		var intervals = [];
+		var underruns = 0;
+		var start = Timer.stamp();
+		var lastRefill = -1.0;
+
+		while (Timer.stamp() - start < streamSeconds)
+		{
+			var processed:Int = AL.getSourcei(source, AL.BUFFERS_PROCESSED);
+
+			if (processed > 0)
+			{
+				var now = Timer.stamp();
+				if (lastRefill >= 0) intervals.push((now - lastRefill) * 1000 / processed);
+				lastRefill = now;
+
+				for (buffer in AL.sourceUnqueueBuffers(source, processed))
+				{
+					var refillStart = Timer.stamp();
+					fill(buffer);
+					AL.sourceQueueBuffers(source, 1, [buffer]);
+					refillTimes.push((Timer.stamp() - refillStart) * 1000);
+				}
+			}
+
+			if (AL.getSourcei(source, AL.SOURCE_STATE) != AL.PLAYING)
+			{
+				underruns++;
+				AL.sourcePlay(source);
+			}
+
+			Sys.sleep(0.001);
+		}
+
+		AL.sourceStop(source);
+		AL.deleteSource(source);
+		AL.deleteBuffers(buffers);
+
+		if (vorbisFile != null) vorbisFile.clear();
+
+		var deviations = [for (interval in intervals) Math.abs(interval - expected)];
+
+		return {
+			input: vorbisFile != null ? "ogg" : "wav",
+			buffer_ms: expected,
+			refills: refillTimes.length,
+			underruns: underruns,
+			refill: summarize(refillTimes),
+			interval: summarize(intervals),
+			jitter: summarize(deviations)
+		};
+	}
+
+	private static function createWAV(seconds:Int):Bytes
+	{
+		var frames = WAV_SAMPLE_RATE * seconds;
+		var dataSize = frames * WAV_CHANNELS * 2;
+		var bytes = Bytes.alloc(44 + dataSize);
+
+		bytes.blit(0, Bytes.ofString("RIFF"), 0, 4);
+		bytes.setInt32(4, 36 + dataSize);
+		bytes.blit(8, Bytes.ofString("WAVEfmt "), 0, 8);
+		bytes.setInt32(16, 16);
+		bytes.setUInt16(20, 1);
+		bytes.setUInt16(22, WAV_CHANNELS);
+		bytes.setInt32(24, WAV_SAMPLE_RATE);
+		bytes.setInt32(28, WAV_SAMPLE_RATE * WAV_CHANNELS * 2);
+		bytes.setUInt16(32, WAV_CHANNELS * 2);
+		bytes.setUInt16(34, 16);
+		bytes.blit(36, Bytes.ofString("data"), 0, 4);
+		bytes.setInt32(40, dataSize);
+
+		var offset = 44;
+
+		for (i in 0...frames)
+		{
+			var sample = Std.int(Math.sin(i * 2 * Math.PI * 440 / WAV_SAMPLE_RATE) * 16000) & 0xFFFF;
+
+			for (c in 0...WAV_CHANNELS)
+			{
+				bytes.setUInt16(offset, sample);
+				offset += 2;
+			}
+		}
+
+		return bytes;
+	}
+
+	private static function megabytesPerSecond(bytes:Int, milliseconds:Float):Float
+	{
+		return milliseconds > 0 ? (bytes / (1024 * 1024)) / (milliseconds / 1000) : 0;
+	}
+
+	private function parseArguments():Void
+	{
+		var args = Sys.args();
+		var i = 0;
+
+		while (i < args.length)
+		{
+			if (args[i] == "--skip-ogg")
+			{
+				skipOgg = true;
+				i++;
+				continue;
+			}
+
+			var value = i + 1 < args.length ? args[i + 1] : null;
+
+			switch (args[i])
+			{
+				case "--iterations": iterations = Std.parseInt(value);
+				case "--ogg": oggPath = value;
+				case "--output": outputPath = value;
+				case "--stream-seconds": streamSeconds = Std.parseFloat(value);
+				default:
+					i++;
+					continue;
+			}
+
+			if (value == null)
+			{
+				Sys.stderr().writeString("AudioBenchmark: missing value for " + args[i] + "\n");
+				System.exit(1);
+			}
+
+			i += 2;
+		}
+	}
+
+	private static function skipped(reason:String):Dynamic
+	{
+		return {skipped: reason};
+	}
+
+	private static function summarize(times:Array<Float>):Dynamic
+	{
+		if (times.length == 0) return {count: 0};
+
+		var sorted = times.copy();
+		sorted.sort(function(a, b) return a < b ? -1 : (a > b ? 1 : 0));
+
+		var total = 0.0;
+		for (time in sorted)
+		{
+			total += time;
+		}
+
+		var mean = total / sorted.length;
+		var variance = 0.0;
+		for (time in sorted)
+		{
+			variance += (time - mean) * (time - mean);
+		}
+
+		var percentile = function(p:Float):Float
+		{
+			return sorted[Std.int(Math.min(sorted.length - 1, Math.floor(p * sorted.length)))];
+		};
+
+		return {
+			count: sorted.length,
+			min_ms: sorted[0],
+			mean_ms: mean,
+			median_ms: percentile(0.5),
+			p95_ms: percentile(0.95),
+			p99_ms: percentile(0.99),
+			max_ms: sorted[sorted.length - 1],
+			stddev_ms: Math.sqrt(variance / sorted.length)
+		};
+	}
+}
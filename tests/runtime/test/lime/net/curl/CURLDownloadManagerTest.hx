@@ -0,0 +1,210 @@
+package lime.net.curl;
+
+#if (lime_cffi && lime_curl && sys && target.threaded)
+import haxe.crypto.Crc32;
+import haxe.crypto.Sha256;
+import haxe.io.Bytes;
+import haxe.io.Path;
+import lime.app.Future;
+import lime.system.System;
+import massive.munit.Assert;
+import massive.munit.async.AsyncFactory;
+import sys.io.File;
+import sys.FileSystem;
+#end
+
+class CURLDownloadManagerTest
+{
+	#if (lime_cffi && lime_curl && sys && target.threaded)
+	private static inline var CONTENT_LENGTH:Int = 256 * 1024;
+	private static inline var SEGMENT_SIZE:Int = 64 * 1024;
+	private static inline var TIMEOUT:Int = 10000;
+
+	private var content:Bytes;
+	private var manager:CURLDownloadManager;
+	private var path:String;
+	private var server:RangeServer;
+
+	@BeforeClass public function beforeClass():Void
+	{
+		content = Bytes.alloc(CONTENT_LENGTH);
+
+		for (i in 0...CONTENT_LENGTH)
+		{
+			content.set(i, (i * 31 + (i >> 8)) & 0xFF);
+		}
+	}
+
+	@Before public function setup():Void
+	{
+		server = new RangeServer(content);
+
+		manager = new CURLDownloadManager();
+		manager.minSegmentSize = SEGMENT_SIZE;
+		manager.retryDelay = 0.05;
+		manager.segments = 4;
+
+		var directory = System.applicationStorageDirectory;
+		if (!FileSystem.exists(directory)) FileSystem.createDirectory(directory);
+
+		path = Path.join([directory, "download-" + server.port + ".bin"]);
+	}
+
+	@After public function tearDown():Void
+	{
+		server.close();
+
+		if (FileSystem.exists(path))
+		{
+			FileSystem.deleteFile(path);
+		}
+	}
+
+	@AsyncTest public function downloadSplitRanges(factory:AsyncFactory):Void
+	{
+		var handler = factory.createHandler(this, function(digest:String, error:Dynamic)
+		{
+			Assert.isNull(error);
+			Assert.areEqual(1, server.headRequests);
+			Assert.areEqual(0, server.streamRequests);
+
+			var starts = server.rangeStarts;
+			starts.sort(function(a, b) return a - b);
+			Assert.areEqual("0,65536,131072,196608", starts.join(","));
+
+			assertDownloaded();
+		}, TIMEOUT);
+
+		listen(manager.download(server.url(), path), handler);
+	}
+
+	@AsyncTest public function downloadFallsBackWhenHeadFails(factory:AsyncFactory):Void
+	{
+		server.failHead = true;
+
+		var handler = factory.createHandler(this, function(digest:String, error:Dynamic)
+		{
+			Assert.isNull(error);
+			Assert.areEqual(1, server.headRequests);
+			Assert.areEqual(1, server.streamRequests);
+			Assert.areEqual(0, server.rangeStarts.length);
+
+			assertDownloaded();
+		}, TIMEOUT);
+
+		listen(manager.download(server.url(), path), handler);
+	}
+
+	@AsyncTest public function downloadFallsBackWithoutRanges(factory:AsyncFactory):Void
+	{
+		server.acceptRanges = false;
+
+		var handler = factory.createHandler(this, function(digest:String, error:Dynamic)
+		{
+			Assert.isNull(error);
+			Assert.areEqual(1, server.streamRequests);
+			Assert.areEqual(0, server.rangeStarts.length);
+
+			assertDownloaded();
+		}, TIMEOUT);
+
+		listen(manager.download(server.url(), path), handler);
+	}
+
+	@AsyncTest public function downloadRetriesDroppedRanges(factory:AsyncFactory):Void
+	{
+		server.drops = 2;
+		server.dropAfter = 1000;
+
+		var start = System.getTimer();
+
+		var handler = factory.createHandler(this, function(digest:String, error:Dynamic)
+		{
+			Assert.isNull(error);
+
+			// four ranges, then each dropped range again from the byte it stopped at
+			var starts = server.rangeStarts;
+			Assert.areEqual(6, starts.length);
+			Assert.areEqual(2, starts.filter(function(start) return start % SEGMENT_SIZE == 1000).length);
+
+			// the first retry waits retryDelay, the next one twice as long
+			Assert.isTrue(System.getTimer() - start >= 50);
+
+			assertDownloaded();
+		}, TIMEOUT);
+
+		listen(manager.download(server.url(), path), handler);
+	}
+
+	@AsyncTest public function downloadFailsAfterMaxRetries(factory:AsyncFactory):Void
+	{
+		server.drops = 1000;
+		manager.maxRetries = 2;
+
+		var handler = factory.createHandler(this, function(digest:String, error:Dynamic)
+		{
+			Assert.isNotNull(error);
+
+			// no more than four ranges and two retries of each
+			Assert.isTrue(server.rangeStarts.length <= 12);
+		}, TIMEOUT);
+
+		listen(manager.download(server.url(), path), handler);
+	}
+
+	@AsyncTest public function downloadComputesSHA256(factory:AsyncFactory):Void
+	{
+		server.drops = 1;
+
+		var handler = factory.createHandler(this, function(digest:String, error:Dynamic)
+		{
+			Assert.isNull(error);
+			Assert.areEqual(Sha256.make(content).toHex(), digest);
+
+			assertDownloaded();
+		}, TIMEOUT);
+
+		listen(manager.download(server.url(), path, CURLDownloadManager.HASH_SHA256), handler);
+	}
+
+	@AsyncTest public function downloadVerifiesCRC32(factory:AsyncFactory):Void
+	{
+		var expected = StringTools.hex(Crc32.make(content), 8).toLowerCase();
+
+		var handler = factory.createHandler(this, function(digest:String, error:Dynamic)
+		{
+			Assert.isNull(error);
+			Assert.areEqual(expected, digest);
+		}, TIMEOUT);
+
+		listen(manager.download(server.url(), path, CURLDownloadManager.HASH_CRC32, expected.toUpperCase()), handler);
+	}
+
+	@AsyncTest public function downloadRejectsDigestMismatch(factory:AsyncFactory):Void
+	{
+		var handler = factory.createHandler(this, function(digest:String, error:Dynamic)
+		{
+			Assert.isNull(digest);
+			Assert.isNotNull(error);
+			Assert.isTrue(Std.string(error).indexOf("Digest mismatch") > -1);
+		}, TIMEOUT);
+
+		listen(manager.download(server.url(), path, CURLDownloadManager.HASH_CRC32, "00000000"), handler);
+	}
+
+	private function assertDownloaded():Void
+	{
+		Assert.isTrue(FileSystem.exists(path));
+
+		var bytes = File.getBytes(path);
+		Assert.areEqual(content.length, bytes.length);
+		Assert.areEqual(0, bytes.compare(content));
+	}
+
+	private static function listen(future:Future<String>, handler:Dynamic):Void
+	{
+		future.onComplete(function(digest) handler(digest, null));
+		future.onError(function(error) handler(null, error));
+	}
+	#end
+}
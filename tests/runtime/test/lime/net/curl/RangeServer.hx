@@ -0,0 +1,241 @@
+package lime.net.curl;
+
+#if (sys && target.threaded)
+import haxe.io.Bytes;
+import sys.net.Host;
+import sys.net.Socket;
+import sys.thread.Mutex;
+import sys.thread.Thread;
+
+/**
+	A minimal HTTP/1.1 file server on 127.0.0.1 for the download tests.
+	It serves one file, answers byte range requests and can be told to fail
+	HEAD requests, ignore ranges or drop ranged responses part way through.
+**/
+class RangeServer
+{
+	/**
+		Whether HEAD responses advertise `Accept-Ranges: bytes` and ranged
+		GET requests are answered with `206 Partial Content`.
+	**/
+	public var acceptRanges:Bool = true;
+
+	public var content(default, null):Bytes;
+
+	/**
+		The number of ranged responses still to be cut off after
+		`dropAfter` bytes of body.
+	**/
+	public var drops:Int = 0;
+
+	public var dropAfter:Int = 1000;
+
+	/**
+		Whether HEAD requests are answered with `500 Internal Server Error`.
+	**/
+	public var failHead:Bool = false;
+
+	public var headRequests(get, never):Int;
+	public var port(default, null):Int;
+
+	/**
+		The first byte of every ranged GET request, in the order they arrived.
+	**/
+	public var rangeStarts(get, never):Array<Int>;
+
+	/**
+		The number of GET requests without a range.
+	**/
+	public var streamRequests(get, never):Int;
+
+	private var __headRequests:Int = 0;
+	private var __mutex:Mutex;
+	private var __rangeStarts:Array<Int>;
+	private var __running:Bool;
+	private var __socket:Socket;
+	private var __streamRequests:Int = 0;
+
+	public function new(content:Bytes)
+	{
+		this.content = content;
+
+		__mutex = new Mutex();
+		__rangeStarts = [];
+		__running = true;
+
+		__socket = new Socket();
+		__socket.bind(new Host("127.0.0.1"), 0);
+		__socket.listen(16);
+		port = __socket.host().port;
+
+		Thread.create(__accept);
+	}
+
+	public function close():Void
+	{
+		__running = false;
+
+		try
+		{
+			__socket.close();
+		}
+		catch (e:Dynamic) {}
+	}
+
+	public function url(path:String = "file.bin"):String
+	{
+		return "http://127.0.0.1:" + port + "/" + path;
+	}
+
+	private function __accept():Void
+	{
+		while (__running)
+		{
+			var client = try __socket.accept() catch (e:Dynamic) null;
+			if (client == null) break;
+
+			Thread.create(function()
+			{
+				__serve(client);
+			});
+		}
+	}
+
+	private function __serve(client:Socket):Void
+	{
+		try
+		{
+			while (__running)
+			{
+				var request = client.input.readLine();
+				if (request == "") continue;
+
+				var method = request.split(" ")[0];
+				var rangeStart = -1;
+				var rangeEnd = content.length - 1;
+
+				var line = client.input.readLine();
+
+				while (line != "")
+				{
+					var separator = line.indexOf(":");
+
+					if (separator > -1 && StringTools.trim(line.substr(0, separator)).toLowerCase() == "range")
+					{
+						var range = StringTools.trim(line.substr(separator + 1)).substr("bytes=".length).split("-");
+						rangeStart = Std.parseInt(range[0]);
+						if (range.length > 1 && range[1] != "") rangeEnd = Std.parseInt(range[1]);
+					}
+
+					line = client.input.readLine();
+				}
+
+				if (method == "HEAD")
+				{
+					__mutex.acquire();
+					__headRequests++;
+					__mutex.release();
+
+					if (failHead)
+					{
+						__writeHeaders(client, "500 Internal Server Error", ["Content-Length: 0"]);
+					}
+					else
+					{
+						var headers = ["Content-Length: " + content.length];
+						if (acceptRanges) headers.push("Accept-Ranges: bytes");
+						__writeHeaders(client, "200 OK", headers);
+					}
+
+					continue;
+				}
+
+				var drop = false;
+
+				__mutex.acquire();
+
+				if (rangeStart > -1 && acceptRanges)
+				{
+					__rangeStarts.push(rangeStart);
+
+					if (drops > 0)
+					{
+						drops--;
+						drop = true;
+					}
+				}
+				else
+				{
+					__streamRequests++;
+				}
+
+				__mutex.release();
+
+				if (rangeStart > -1 && acceptRanges)
+				{
+					var length = rangeEnd - rangeStart + 1;
+
+					__writeHeaders(client, "206 Partial Content", [
+						"Content-Length: " + length,
+						"Content-Range: bytes " + rangeStart + "-" + rangeEnd + "/" + content.length
+					]);
+
+					if (drop)
+					{
+						// send part of the body, then cut the connection
+						client.output.writeBytes(content, rangeStart, dropAfter < length ? dropAfter : length);
+						client.output.flush();
+						break;
+					}
+
+					client.output.writeBytes(content, rangeStart, length);
+				}
+				else
+				{
+					__writeHeaders(client, "200 OK", ["Content-Length: " + content.length]);
+					client.output.writeBytes(content, 0, content.length);
+				}
+
+				client.output.flush();
+			}
+		}
+		catch (e:Dynamic) {}
+
+		try
+		{
+			client.close();
+		}
+		catch (e:Dynamic) {}
+	}
+
+	private function __writeHeaders(client:Socket, status:String, headers:Array<String>):Void
+	{
+		client.output.writeString("HTTP/1.1 " + status + "\r\n" + headers.join("\r\n") + "\r\n\r\n");
+	}
+
+	// Get & Set Methods
+	private function get_headRequests():Int
+	{
+		__mutex.acquire();
+		var value = __headRequests;
+		__mutex.release();
+		return value;
+	}
+
+	private function get_rangeStarts():Array<Int>
+	{
+		__mutex.acquire();
+		var value = __rangeStarts.copy();
+		__mutex.release();
+		return value;
+	}
+
+	private function get_streamRequests():Int
+	{
+		__mutex.acquire();
+		var value = __streamRequests;
+		__mutex.release();
+		return value;
+	}
+}
+#end